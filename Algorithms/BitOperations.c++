@@ -0,0 +1,77 @@
+#include<iostream>
+
+#ifndef BIT_OPERATIONS
+#define BIT_OPERATIONS
+
+#include<cstdint>
+#include<cstring>
+
+#if defined(_MSC_VER)
+#include<intrin.h>
+#endif
+
+/// @brief Counts the zero bits below the lowest set bit of a value.
+/// @param value The value that'll be scanned, (it must not be zero).
+/// @return The index of the lowest set bit.
+inline unsigned CountTrailingZeros(const uint64_t &value)
+{
+#if defined(_MSC_VER)
+    unsigned long index;
+    _BitScanForward64(&index, value);
+    return (unsigned)index;
+#else
+    return (unsigned)__builtin_ctzll(value);
+#endif
+}
+
+/// @brief Counts the zero bits above the highest set bit of a value.
+/// @param value The value that'll be scanned, (it must not be zero).
+/// @return The amount of leading zero bits.
+inline unsigned CountLeadingZeros(const uint64_t &value)
+{
+#if defined(_MSC_VER)
+    unsigned long index;
+    _BitScanReverse64(&index, value);
+    return 63 - (unsigned)index;
+#else
+    return (unsigned)__builtin_clzll(value);
+#endif
+}
+
+/// @brief Counts the set bits of a value.
+/// @param value The value that'll be counted.
+/// @return The amount of set bits.
+inline unsigned PopulationCount(const uint64_t &value)
+{
+#if defined(_MSC_VER)
+    return (unsigned)__popcnt64(value);
+#else
+    return (unsigned)__builtin_popcountll(value);
+#endif
+}
+
+/// @brief Rotates the bits of a 32-bit value to the left.
+/// @param value The value that'll be rotated.
+/// @param shift The amount of bits to rotate by, (between 1 and 31).
+/// @return The rotated value.
+inline uint32_t RotateLeft(const uint32_t &value, const unsigned &shift) { return (value << shift) | (value >> (32 - shift)); }
+
+/// @brief Rotates the bits of a 64-bit value to the left.
+/// @param value The value that'll be rotated.
+/// @param shift The amount of bits to rotate by, (between 1 and 63).
+/// @return The rotated value.
+inline uint64_t RotateLeft(const uint64_t &value, const unsigned &shift) { return (value << shift) | (value >> (64 - shift)); }
+
+/// @brief Reads a value from memory that might not be aligned to its size.
+/// @tparam T The type of the value, (usually a fixed width integer).
+/// @param data A pointer to the first byte of the value.
+/// @return The value stored at that memory.
+template<typename T>
+inline T LoadUnaligned(const void* data)
+{
+    T value;
+    std::memcpy(&value, data, sizeof(T));
+    return value;
+}
+
+#endif
@@ -0,0 +1,185 @@
+#include<iostream>
+
+#ifndef HASHER
+#define HASHER
+
+#include<cstdint>
+#include<cstring>
+#include<string>
+#include<string_view>
+#include<type_traits>
+
+#include "MurmurHash3.c++"
+#include "XXHash.c++"
+
+/// @brief A non-owning view of a block of bytes in memory, so raw memory can be hashed by its content.
+struct ByteSpan
+{
+    /// @brief A pointer to the first byte of the block.
+    const void* Data = nullptr;
+    /// @brief The amount of bytes within the block.
+    size_t Length = 0;
+
+    /// @brief Compares this Byte Span with another one byte by byte.
+    /// @param byteSpan The Byte Span that'll be compared to.
+    /// @return A boolean representing whether or not both blocks have the same content.
+    bool operator==(const ByteSpan &byteSpan) const
+    { return Length == byteSpan.Length && (!Length || !std::memcmp(Data, byteSpan.Data, Length)); }
+
+    /// @brief Compares this Byte Span with another one byte by byte.
+    /// @param byteSpan The Byte Span that'll be compared to.
+    /// @return A boolean representing whether or not both blocks have different contents.
+    bool operator!=(const ByteSpan &byteSpan) const { return !(*this == byteSpan); }
+};
+
+/// @brief Mixes the bits of a 64-bit value, so every bit of the input affects every bit of the output,
+/// (using the finalizer of MurmurHash3).
+/// @param value The value that'll be mixed.
+/// @param seed An initial value that determines the outcome of the mixing.
+/// @return The mixed value.
+inline uint64_t MixBits(const uint64_t &value, const uint64_t &seed = 0) { return MurmurHash3Finalizer(value ^ seed); }
+
+/// @brief Hashes a block of bytes by its content, (using the xxHash64 algorithm).
+/// @param data A pointer to the first byte of the block.
+/// @param length The amount of bytes within the block.
+/// @param seed An initial value that determines the outcome of the hashing.
+/// @return The hashing value of the block.
+inline uint64_t HashBytes(const void* data, const size_t &length, const uint64_t &seed = 0) { return XXHash64(data, length, seed); }
+
+/// @brief A function object that hashes a key by its value, (not by its address), to be used by
+/// the Hash Tables, (a type without a specialization can still be hashed if it has a
+/// "size_t Hash() const" member function, or if the consumer specializes its own Hasher).
+/// @tparam T The type of the keys that'll be hashed.
+template<typename T, typename = void>
+struct Hasher;
+
+/// @brief Hashes integral and enumeration keys by their value.
+/// @tparam T The type of the keys that'll be hashed.
+template<typename T>
+struct Hasher<T, std::enable_if_t<std::is_integral_v<T> || std::is_enum_v<T>>>
+{
+    /// @brief Hashes a key by its value.
+    /// @param key The key that'll be hashed.
+    /// @param seed An initial value that determines the outcome of the hashing.
+    /// @return The hashing value of the key.
+    size_t operator()(const T &key, const size_t &seed = 0) const
+    { return (size_t)MixBits((uint64_t)key, seed); }
+};
+
+/// @brief Hashes floating point keys by their value, (where both zeros share the same hashing value).
+/// @tparam T The type of the keys that'll be hashed.
+template<typename T>
+struct Hasher<T, std::enable_if_t<std::is_floating_point_v<T>>>
+{
+    /// @brief Hashes a key by its value.
+    /// @param key The key that'll be hashed.
+    /// @param seed An initial value that determines the outcome of the hashing.
+    /// @return The hashing value of the key.
+    size_t operator()(const T &key, const size_t &seed = 0) const
+    {
+        if (key == T()) { return (size_t)MixBits(0, seed); }
+        return (size_t)HashBytes(&key, sizeof(key), seed);
+    }
+};
+
+/// @brief Hashes pointer keys by the address they point to.
+/// @tparam T The type of the keys that'll be hashed.
+template<typename T>
+struct Hasher<T, std::enable_if_t<std::is_pointer_v<T>>>
+{
+    /// @brief Hashes a key by its value.
+    /// @param key The key that'll be hashed.
+    /// @param seed An initial value that determines the outcome of the hashing.
+    /// @return The hashing value of the key.
+    size_t operator()(const T &key, const size_t &seed = 0) const
+    { return (size_t)MixBits((uint64_t)(uintptr_t)key, seed); }
+};
+
+/// @brief Hashes keys of a type that knows how to hash itself through a "Hash" member function.
+/// @tparam T The type of the keys that'll be hashed.
+template<typename T>
+struct Hasher<T, std::void_t<decltype((size_t)std::declval<const T&>().Hash())>>
+{
+    /// @brief Hashes a key by its value.
+    /// @param key The key that'll be hashed.
+    /// @param seed An initial value that determines the outcome of the hashing.
+    /// @return The hashing value of the key.
+    size_t operator()(const T &key, const size_t &seed = 0) const
+    { return (size_t)MixBits((uint64_t)key.Hash(), seed); }
+};
+
+/// @brief Hashes string keys by their characters.
+template<>
+struct Hasher<std::string>
+{
+    /// @brief Hashes a key by its value.
+    /// @param key The key that'll be hashed.
+    /// @param seed An initial value that determines the outcome of the hashing.
+    /// @return The hashing value of the key.
+    size_t operator()(const std::string &key, const size_t &seed = 0) const
+    { return (size_t)HashBytes(key.data(), key.size(), seed); }
+};
+
+/// @brief Hashes string view keys by their characters, (matching the hashing values of the strings).
+template<>
+struct Hasher<std::string_view>
+{
+    /// @brief Hashes a key by its value.
+    /// @param key The key that'll be hashed.
+    /// @param seed An initial value that determines the outcome of the hashing.
+    /// @return The hashing value of the key.
+    size_t operator()(const std::string_view &key, const size_t &seed = 0) const
+    { return (size_t)HashBytes(key.data(), key.size(), seed); }
+};
+
+/// @brief Hashes Byte Span keys by the content of the bytes they view.
+template<>
+struct Hasher<ByteSpan>
+{
+    /// @brief Hashes a key by its value.
+    /// @param key The key that'll be hashed.
+    /// @param seed An initial value that determines the outcome of the hashing.
+    /// @return The hashing value of the key.
+    size_t operator()(const ByteSpan &key, const size_t &seed = 0) const
+    { return (size_t)HashBytes(key.Data, key.Length, seed); }
+};
+
+/// @brief Indicates whether or not the values of a type can be hashed by a Hasher, (either through one of
+/// its specializations, or through a "Hash" member function).
+/// @tparam T The type of the values.
+template<typename T, typename = void>
+constexpr bool IS_HASHABLE = false;
+
+/// @brief Indicates that the values of a type can be hashed by a Hasher.
+/// @tparam T The type of the values.
+template<typename T>
+constexpr bool IS_HASHABLE<T, std::void_t<decltype(Hasher<T>()(std::declval<const T &>()))>> = true;
+
+/// @brief Hashes many keys at once, four at a time, so the independent hashing computations can
+/// overlap within the processor pipeline, (or get vectorized by the compiler if the target allows).
+/// @tparam T The type of the keys that'll be hashed.
+/// @tparam THasher The function object that hashes the keys by their values.
+/// @param keys A pointer to an array in memory of the keys that'll be hashed.
+/// @param count The amount of keys that'll be hashed.
+/// @param hashingValues A pointer to an array in memory that'll receive the hashing value of each key.
+/// @param seed An initial value that determines the outcome of the hashing.
+/// @param hasher The function object that'll be used to hash the keys.
+template<typename T, typename THasher = Hasher<T>>
+void HashMany(const T* keys, const size_t &count, size_t* hashingValues, const size_t &seed = 0, const THasher &hasher = THasher())
+{
+    size_t i = 0;
+    for ( ; i + 4 <= count; i += 4)
+    {
+        size_t hashValue1 = hasher(keys[i], seed), hashValue2 = hasher(keys[i + 1], seed),
+            hashValue3 = hasher(keys[i + 2], seed), hashValue4 = hasher(keys[i + 3], seed);
+
+        hashingValues[i] = hashValue1;
+        hashingValues[i + 1] = hashValue2;
+        hashingValues[i + 2] = hashValue3;
+        hashingValues[i + 3] = hashValue4;
+    }
+
+    for ( ; i < count; i++) { hashingValues[i] = hasher(keys[i], seed); }
+}
+
+#endif
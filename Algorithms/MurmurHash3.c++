@@ -0,0 +1,165 @@
+#include<iostream>
+
+#ifndef MURMUR_HASH_3
+#define MURMUR_HASH_3
+
+#include<cstdint>
+
+#include "BitOperations.c++"
+
+/// @brief The outcome of a 128-bit hashing algorithm, split into two 64-bit halves.
+struct HashingValue128
+{
+    /// @brief The lower 64 bits of the hashing value.
+    uint64_t Low = 0;
+    /// @brief The upper 64 bits of the hashing value.
+    uint64_t High = 0;
+
+    /// @brief Compares this hashing value with another one.
+    /// @param hashingValue The hashing value that'll be compared to.
+    /// @return A boolean representing whether or not both hashing values are equal.
+    bool operator==(const HashingValue128 &hashingValue) const { return Low == hashingValue.Low && High == hashingValue.High; }
+    /// @brief Compares this hashing value with another one.
+    /// @param hashingValue The hashing value that'll be compared to.
+    /// @return A boolean representing whether or not the hashing values are different.
+    bool operator!=(const HashingValue128 &hashingValue) const { return !(*this == hashingValue); }
+};
+
+/// @brief Mixes the bits of a 32-bit value, so every bit of the input affects every bit of the output,
+/// (the finalizer of MurmurHash3).
+/// @param value The value that'll be mixed.
+/// @return The mixed value.
+inline uint32_t MurmurHash3Finalizer(uint32_t value)
+{
+    value ^= value >> 16;
+    value *= 0x85EBCA6BU;
+    value ^= value >> 13;
+    value *= 0xC2B2AE35U;
+    value ^= value >> 16;
+    return value;
+}
+
+/// @brief Mixes the bits of a 64-bit value, so every bit of the input affects every bit of the output,
+/// (the finalizer of MurmurHash3).
+/// @param value The value that'll be mixed.
+/// @return The mixed value.
+inline uint64_t MurmurHash3Finalizer(uint64_t value)
+{
+    value ^= value >> 33;
+    value *= 0xFF51AFD7ED558CCDULL;
+    value ^= value >> 33;
+    value *= 0xC4CEB9FE1A85EC53ULL;
+    value ^= value >> 33;
+    return value;
+}
+
+/// @brief Hashes a block of bytes by its content, using the 32-bit variant of MurmurHash3 (x86_32).
+/// @param data A pointer to the first byte of the block.
+/// @param length The amount of bytes within the block.
+/// @param seed An initial value that determines the outcome of the hashing.
+/// @return The 32-bit hashing value of the block.
+inline uint32_t MurmurHash32(const void* data, const size_t &length, const uint32_t &seed = 0)
+{
+    const uint32_t C1 = 0xCC9E2D51U, C2 = 0x1B873593U;
+
+    const unsigned char* bytes = static_cast<const unsigned char*>(data);
+    const size_t BLOCK_COUNT = length / 4;
+    uint32_t hashValue = seed;
+
+    for (size_t i = 0; i < BLOCK_COUNT; i++)
+    {
+        uint32_t block = LoadUnaligned<uint32_t>(bytes + i * 4);
+        block *= C1;
+        block = RotateLeft(block, 15);
+        block *= C2;
+
+        hashValue ^= block;
+        hashValue = RotateLeft(hashValue, 13);
+        hashValue = hashValue * 5 + 0xE6546B64U;
+    }
+
+    const unsigned char* tail = bytes + BLOCK_COUNT * 4;
+    uint32_t remainder = 0;
+    switch (length & 3)
+    {
+        case 3: remainder ^= (uint32_t)tail[2] << 16; [[fallthrough]];
+        case 2: remainder ^= (uint32_t)tail[1] << 8; [[fallthrough]];
+        case 1:
+            remainder ^= tail[0];
+            remainder *= C1;
+            remainder = RotateLeft(remainder, 15);
+            remainder *= C2;
+            hashValue ^= remainder;
+    }
+
+    hashValue ^= (uint32_t)length;
+    return MurmurHash3Finalizer(hashValue);
+}
+
+/// @brief Hashes a block of bytes by its content, using the 128-bit variant of MurmurHash3 (x64_128).
+/// @param data A pointer to the first byte of the block.
+/// @param length The amount of bytes within the block.
+/// @param seed An initial value that determines the outcome of the hashing.
+/// @return The 128-bit hashing value of the block.
+inline HashingValue128 MurmurHash128(const void* data, const size_t &length, const uint64_t &seed = 0)
+{
+    const uint64_t C1 = 0x87C37B91114253D5ULL, C2 = 0x4CF5AD432745937FULL;
+
+    const unsigned char* bytes = static_cast<const unsigned char*>(data);
+    const size_t BLOCK_COUNT = length / 16;
+    uint64_t low = seed, high = seed;
+
+    for (size_t i = 0; i < BLOCK_COUNT; i++)
+    {
+        uint64_t lowBlock = LoadUnaligned<uint64_t>(bytes + i * 16),
+            highBlock = LoadUnaligned<uint64_t>(bytes + i * 16 + 8);
+
+        lowBlock *= C1; lowBlock = RotateLeft(lowBlock, 31); lowBlock *= C2; low ^= lowBlock;
+        low = RotateLeft(low, 27); low += high; low = low * 5 + 0x52DCE729ULL;
+
+        highBlock *= C2; highBlock = RotateLeft(highBlock, 33); highBlock *= C1; high ^= highBlock;
+        high = RotateLeft(high, 31); high += low; high = high * 5 + 0x38495AB5ULL;
+    }
+
+    const unsigned char* tail = bytes + BLOCK_COUNT * 16;
+    uint64_t lowRemainder = 0, highRemainder = 0;
+    switch (length & 15)
+    {
+        case 15: highRemainder ^= (uint64_t)tail[14] << 48; [[fallthrough]];
+        case 14: highRemainder ^= (uint64_t)tail[13] << 40; [[fallthrough]];
+        case 13: highRemainder ^= (uint64_t)tail[12] << 32; [[fallthrough]];
+        case 12: highRemainder ^= (uint64_t)tail[11] << 24; [[fallthrough]];
+        case 11: highRemainder ^= (uint64_t)tail[10] << 16; [[fallthrough]];
+        case 10: highRemainder ^= (uint64_t)tail[9] << 8; [[fallthrough]];
+        case 9:
+            highRemainder ^= (uint64_t)tail[8];
+            highRemainder *= C2; highRemainder = RotateLeft(highRemainder, 33); highRemainder *= C1; high ^= highRemainder;
+            [[fallthrough]];
+        case 8: lowRemainder ^= (uint64_t)tail[7] << 56; [[fallthrough]];
+        case 7: lowRemainder ^= (uint64_t)tail[6] << 48; [[fallthrough]];
+        case 6: lowRemainder ^= (uint64_t)tail[5] << 40; [[fallthrough]];
+        case 5: lowRemainder ^= (uint64_t)tail[4] << 32; [[fallthrough]];
+        case 4: lowRemainder ^= (uint64_t)tail[3] << 24; [[fallthrough]];
+        case 3: lowRemainder ^= (uint64_t)tail[2] << 16; [[fallthrough]];
+        case 2: lowRemainder ^= (uint64_t)tail[1] << 8; [[fallthrough]];
+        case 1:
+            lowRemainder ^= (uint64_t)tail[0];
+            lowRemainder *= C1; lowRemainder = RotateLeft(lowRemainder, 31); lowRemainder *= C2; low ^= lowRemainder;
+    }
+
+    low ^= (uint64_t)length;
+    high ^= (uint64_t)length;
+
+    low += high;
+    high += low;
+
+    low = MurmurHash3Finalizer(low);
+    high = MurmurHash3Finalizer(high);
+
+    low += high;
+    high += low;
+
+    return { low, high };
+}
+
+#endif
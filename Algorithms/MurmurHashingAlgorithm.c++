@@ -3,7 +3,12 @@
 #ifndef MURMUR_HASHING_ALGORITHM
 #define MURMUR_HASHING_ALGORITHM
 
+#include<climits>
+#include<cmath>
+#include<string>
+
 #include "../Array.c++"
+#include "MurmurHash3.c++"
 
 /// @brief Converts a decimal number into a binary number.
 /// @param value The value of the given number.
@@ -50,33 +55,12 @@ Array<short> ToByteArray(const long &value)
     return bytes;
 }
 
-/// @brief Takes a raw hashing value and hash it properly using the Murmur Hashing Algorithm way.
+/// @brief Takes a raw hashing value and hash it properly using the Murmur Hashing Algorithm way,
+/// (directly over the bytes of the value using MurmurHash3, without any allocations).
 /// @param rawHashing The raw value before it gets hashed properly.
 /// @param seed The initial value that determines the outcome of the hashing algorithm.
-/// @return A properly hashed value.
+/// @return A properly hashed value, (which is never negative).
 long MurmurHashingAlgorithm(const long &rawHashing, const long &seed = 0)
-{
-    const long PRIME = 2003, SHIFTING_RATE = 24;
-
-    long hashValue = seed ^ std::to_string(rawHashing).length();
-    auto bytes = ToByteArray(rawHashing);
-
-    for (auto &&byte : bytes)
-    {
-        byte = (byte * PRIME) & LONG_MAX;
-        byte ^= (byte >> SHIFTING_RATE);
-
-        byte = (byte * PRIME) & LONG_MAX;
-        hashValue = (hashValue * PRIME) & LONG_MAX;
-
-        hashValue ^= byte;
-    }
-
-    hashValue ^= (hashValue >> SHIFTING_RATE);
-    hashValue = (hashValue * PRIME) & LONG_MAX;
-    hashValue ^= (hashValue >> SHIFTING_RATE);
-    
-    return hashValue;
-}
+{ return (long)(MurmurHash128(&rawHashing, sizeof(rawHashing), (uint64_t)seed).Low & LONG_MAX); }
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,469 @@
+#include<iostream>
+
+#ifndef SEARCHING
+#define SEARCHING
+
+#include<cstdint>
+#include<type_traits>
+
+#if defined(__AVX2__)
+#define SEARCHING_AVX2
+#include<immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define SEARCHING_SSE2
+#include<emmintrin.h>
+#if defined(__SSE4_1__)
+#define SEARCHING_SSE4
+#include<smmintrin.h>
+#endif
+#if defined(__SSE4_2__)
+#define SEARCHING_SSE42
+#include<nmmintrin.h>
+#endif
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#define SEARCHING_NEON
+#include<arm_neon.h>
+#endif
+
+#include "BitOperations.c++"
+
+#if defined(SEARCHING_AVX2)
+/// @brief The amount of bytes compared at once by the search kernels.
+constexpr size_t SEARCHING_VECTOR_SIZE = 32;
+#elif defined(SEARCHING_SSE2) || defined(SEARCHING_NEON)
+/// @brief The amount of bytes compared at once by the search kernels.
+constexpr size_t SEARCHING_VECTOR_SIZE = 16;
+#else
+/// @brief The amount of bytes compared at once by the search kernels, (zero if there are no SIMD instructions).
+constexpr size_t SEARCHING_VECTOR_SIZE = 0;
+#endif
+
+#if defined(SEARCHING_NEON)
+/// @brief The amount of mask bits each compared byte takes.
+constexpr size_t SEARCHING_BITS_PER_BYTE = 4;
+#else
+/// @brief The amount of mask bits each compared byte takes.
+constexpr size_t SEARCHING_BITS_PER_BYTE = 1;
+#endif
+
+/// @brief Indicates whether or not the elements of a type are searched by the SIMD kernels, (integral
+/// and floating point types of up to eight bytes, when SIMD instructions are available).
+/// @tparam T The type of the elements.
+template<typename T>
+constexpr bool IS_VECTOR_SEARCHABLE = SEARCHING_VECTOR_SIZE && (std::is_integral_v<T> || std::is_floating_point_v<T>)
+    && (sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8);
+
+/// @brief The bit mask that keeps a single bit for each element within a SIMD comparison mask.
+/// @tparam T The type of the elements.
+/// @return The bit mask of the lowest bit of each element.
+template<typename T>
+constexpr uint64_t ElementMatchPattern()
+{
+    uint64_t pattern = 0;
+    for (size_t bit = SEARCHING_BITS_PER_BYTE - 1; bit < SEARCHING_VECTOR_SIZE * SEARCHING_BITS_PER_BYTE; bit += sizeof(T) * SEARCHING_BITS_PER_BYTE)
+    { pattern |= (uint64_t)1 << bit; }
+
+    return pattern;
+}
+
+/// @brief Compares a vector of elements with an element at once, (floating points are compared as numbers,
+/// so NaN never matches, and negative zero matches zero, just like the equality operator).
+/// @tparam T The type of the elements, (it must be SIMD searchable).
+/// @param data A pointer to the first element of the vector, (it doesn't have to be aligned).
+/// @param element The value of the desired element.
+/// @return A bit mask with one bit for each matching element, where the bit of an element
+/// is "index * sizeof(T) * SEARCHING_BITS_PER_BYTE" or higher within that span.
+template<typename T>
+inline uint64_t MatchVector(const T* data, const T &element)
+{
+#if defined(SEARCHING_AVX2)
+    __m256i matches;
+    if constexpr (std::is_same_v<T, float>)
+    { matches = _mm256_castps_si256(_mm256_cmp_ps(_mm256_loadu_ps(data), _mm256_set1_ps(element), _CMP_EQ_OQ)); }
+    else if constexpr (std::is_same_v<T, double>)
+    { matches = _mm256_castpd_si256(_mm256_cmp_pd(_mm256_loadu_pd(data), _mm256_set1_pd(element), _CMP_EQ_OQ)); }
+    else
+    {
+        __m256i vector = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data));
+        if constexpr (sizeof(T) == 1) { matches = _mm256_cmpeq_epi8(vector, _mm256_set1_epi8((char)element)); }
+        else if constexpr (sizeof(T) == 2) { matches = _mm256_cmpeq_epi16(vector, _mm256_set1_epi16((short)element)); }
+        else if constexpr (sizeof(T) == 4) { matches = _mm256_cmpeq_epi32(vector, _mm256_set1_epi32((int)element)); }
+        else { matches = _mm256_cmpeq_epi64(vector, _mm256_set1_epi64x((long long)element)); }
+    }
+
+    return (uint32_t)_mm256_movemask_epi8(matches) & ElementMatchPattern<T>();
+#elif defined(SEARCHING_SSE2)
+    __m128i matches;
+    if constexpr (std::is_same_v<T, float>)
+    { matches = _mm_castps_si128(_mm_cmpeq_ps(_mm_loadu_ps(data), _mm_set1_ps(element))); }
+    else if constexpr (std::is_same_v<T, double>)
+    { matches = _mm_castpd_si128(_mm_cmpeq_pd(_mm_loadu_pd(data), _mm_set1_pd(element))); }
+    else
+    {
+        __m128i vector = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+        if constexpr (sizeof(T) == 1) { matches = _mm_cmpeq_epi8(vector, _mm_set1_epi8((char)element)); }
+        else if constexpr (sizeof(T) == 2) { matches = _mm_cmpeq_epi16(vector, _mm_set1_epi16((short)element)); }
+        else if constexpr (sizeof(T) == 4) { matches = _mm_cmpeq_epi32(vector, _mm_set1_epi32((int)element)); }
+        else
+        {
+#if defined(SEARCHING_SSE4)
+            matches = _mm_cmpeq_epi64(vector, _mm_set1_epi64x((long long)element));
+#else
+            // Both halves of a 64-bit lane have to match, so each half is combined with its swapped neighbour.
+            __m128i halves = _mm_cmpeq_epi32(vector, _mm_set1_epi64x((long long)element));
+            matches = _mm_and_si128(halves, _mm_shuffle_epi32(halves, _MM_SHUFFLE(2, 3, 0, 1)));
+#endif
+        }
+    }
+
+    return (uint32_t)_mm_movemask_epi8(matches) & ElementMatchPattern<T>();
+#elif defined(SEARCHING_NEON)
+    uint8x16_t matches;
+    if constexpr (std::is_same_v<T, float>) { matches = vreinterpretq_u8_u32(vceqq_f32(vld1q_f32(data), vdupq_n_f32(element))); }
+    else if constexpr (std::is_same_v<T, double>) { matches = vreinterpretq_u8_u64(vceqq_f64(vld1q_f64(data), vdupq_n_f64(element))); }
+    else if constexpr (sizeof(T) == 1)
+    { matches = vceqq_u8(vld1q_u8(reinterpret_cast<const uint8_t*>(data)), vdupq_n_u8((uint8_t)element)); }
+    else if constexpr (sizeof(T) == 2)
+    { matches = vreinterpretq_u8_u16(vceqq_u16(vld1q_u16(reinterpret_cast<const uint16_t*>(data)), vdupq_n_u16((uint16_t)element))); }
+    else if constexpr (sizeof(T) == 4)
+    { matches = vreinterpretq_u8_u32(vceqq_u32(vld1q_u32(reinterpret_cast<const uint32_t*>(data)), vdupq_n_u32((uint32_t)element))); }
+    else
+    { matches = vreinterpretq_u8_u64(vceqq_u64(vld1q_u64(reinterpret_cast<const uint64_t*>(data)), vdupq_n_u64((uint64_t)element))); }
+
+    // Narrows every byte into four bits, since NEON has no equivalent of "movemask".
+    uint8x8_t nibbles = vshrn_n_u16(vreinterpretq_u16_u8(matches), 4);
+    return vget_lane_u64(vreinterpret_u64_u8(nibbles), 0) & ElementMatchPattern<T>();
+#else
+    return 0;
+#endif
+}
+
+/// @brief Orders a vector of elements against an element at once, (unsigned integers are compared by flipping
+/// their sign bits, and floating points are compared as numbers, so NaN is neither less nor greater).
+/// @tparam IsGreater Whether the elements of the vector are checked for being greater than the element, or less than it.
+/// @tparam T The type of the elements, (it must be SIMD searchable).
+/// @param data A pointer to the first element of the vector, (it doesn't have to be aligned).
+/// @param element The value of the element the vector is ordered against.
+/// @return A bit mask with one bit for each element of the vector that's ordered that way, (laid out like
+/// the masks of "MatchVector").
+template<bool IsGreater, typename T>
+inline uint64_t OrderVector(const T* data, const T &element)
+{
+#if defined(SEARCHING_AVX2)
+    __m256i matches;
+    if constexpr (std::is_same_v<T, float>)
+    { matches = _mm256_castps_si256(_mm256_cmp_ps(_mm256_loadu_ps(data), _mm256_set1_ps(element), IsGreater ? _CMP_GT_OQ : _CMP_LT_OQ)); }
+    else if constexpr (std::is_same_v<T, double>)
+    { matches = _mm256_castpd_si256(_mm256_cmp_pd(_mm256_loadu_pd(data), _mm256_set1_pd(element), IsGreater ? _CMP_GT_OQ : _CMP_LT_OQ)); }
+    else
+    {
+        __m256i vector = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data)), value;
+        if constexpr (sizeof(T) == 1) { value = _mm256_set1_epi8((char)element); }
+        else if constexpr (sizeof(T) == 2) { value = _mm256_set1_epi16((short)element); }
+        else if constexpr (sizeof(T) == 4) { value = _mm256_set1_epi32((int)element); }
+        else { value = _mm256_set1_epi64x((long long)element); }
+
+        if constexpr (std::is_unsigned_v<T>)
+        {
+            __m256i signBits;
+            if constexpr (sizeof(T) == 1) { signBits = _mm256_set1_epi8((char)0x80); }
+            else if constexpr (sizeof(T) == 2) { signBits = _mm256_set1_epi16((short)0x8000); }
+            else if constexpr (sizeof(T) == 4) { signBits = _mm256_set1_epi32((int)0x80000000); }
+            else { signBits = _mm256_set1_epi64x((long long)0x8000000000000000ULL); }
+
+            vector = _mm256_xor_si256(vector, signBits);
+            value = _mm256_xor_si256(value, signBits);
+        }
+
+        __m256i greater = IsGreater ? vector : value, lesser = IsGreater ? value : vector;
+        if constexpr (sizeof(T) == 1) { matches = _mm256_cmpgt_epi8(greater, lesser); }
+        else if constexpr (sizeof(T) == 2) { matches = _mm256_cmpgt_epi16(greater, lesser); }
+        else if constexpr (sizeof(T) == 4) { matches = _mm256_cmpgt_epi32(greater, lesser); }
+        else { matches = _mm256_cmpgt_epi64(greater, lesser); }
+    }
+
+    return (uint32_t)_mm256_movemask_epi8(matches) & ElementMatchPattern<T>();
+#elif defined(SEARCHING_SSE2)
+    __m128i matches;
+    if constexpr (std::is_same_v<T, float>)
+    {
+        __m128 vector = _mm_loadu_ps(data), value = _mm_set1_ps(element);
+        matches = _mm_castps_si128(IsGreater ? _mm_cmpgt_ps(vector, value) : _mm_cmplt_ps(vector, value));
+    }
+    else if constexpr (std::is_same_v<T, double>)
+    {
+        __m128d vector = _mm_loadu_pd(data), value = _mm_set1_pd(element);
+        matches = _mm_castpd_si128(IsGreater ? _mm_cmpgt_pd(vector, value) : _mm_cmplt_pd(vector, value));
+    }
+    else
+    {
+        __m128i vector = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data)), value;
+        if constexpr (sizeof(T) == 1) { value = _mm_set1_epi8((char)element); }
+        else if constexpr (sizeof(T) == 2) { value = _mm_set1_epi16((short)element); }
+        else if constexpr (sizeof(T) == 4) { value = _mm_set1_epi32((int)element); }
+        else { value = _mm_set1_epi64x((long long)element); }
+
+        if constexpr (std::is_unsigned_v<T>)
+        {
+            __m128i signBits;
+            if constexpr (sizeof(T) == 1) { signBits = _mm_set1_epi8((char)0x80); }
+            else if constexpr (sizeof(T) == 2) { signBits = _mm_set1_epi16((short)0x8000); }
+            else if constexpr (sizeof(T) == 4) { signBits = _mm_set1_epi32((int)0x80000000); }
+            else { signBits = _mm_set1_epi64x((long long)0x8000000000000000ULL); }
+
+            vector = _mm_xor_si128(vector, signBits);
+            value = _mm_xor_si128(value, signBits);
+        }
+
+        __m128i greater = IsGreater ? vector : value, lesser = IsGreater ? value : vector;
+        if constexpr (sizeof(T) == 1) { matches = _mm_cmpgt_epi8(greater, lesser); }
+        else if constexpr (sizeof(T) == 2) { matches = _mm_cmpgt_epi16(greater, lesser); }
+        else if constexpr (sizeof(T) == 4) { matches = _mm_cmpgt_epi32(greater, lesser); }
+        else
+        {
+#if defined(SEARCHING_SSE42)
+            matches = _mm_cmpgt_epi64(greater, lesser);
+#else
+            // The upper halves decide unless they're equal, where the borrow of subtracting the lower halves does.
+            __m128i upperOrder = _mm_cmpgt_epi32(greater, lesser),
+                lowerOrder = _mm_and_si128(_mm_cmpeq_epi32(greater, lesser), _mm_sub_epi64(lesser, greater));
+            matches = _mm_shuffle_epi32(_mm_or_si128(upperOrder, lowerOrder), _MM_SHUFFLE(3, 3, 1, 1));
+#endif
+        }
+    }
+
+    return (uint32_t)_mm_movemask_epi8(matches) & ElementMatchPattern<T>();
+#elif defined(SEARCHING_NEON)
+    uint8x16_t matches;
+    if constexpr (std::is_same_v<T, float>)
+    {
+        float32x4_t vector = vld1q_f32(data), value = vdupq_n_f32(element);
+        matches = vreinterpretq_u8_u32(IsGreater ? vcgtq_f32(vector, value) : vcltq_f32(vector, value));
+    }
+    else if constexpr (std::is_same_v<T, double>)
+    {
+        float64x2_t vector = vld1q_f64(data), value = vdupq_n_f64(element);
+        matches = vreinterpretq_u8_u64(IsGreater ? vcgtq_f64(vector, value) : vcltq_f64(vector, value));
+    }
+    else if constexpr (sizeof(T) == 1 && std::is_signed_v<T>)
+    {
+        int8x16_t vector = vld1q_s8(reinterpret_cast<const int8_t*>(data)), value = vdupq_n_s8((int8_t)element);
+        matches = IsGreater ? vcgtq_s8(vector, value) : vcltq_s8(vector, value);
+    }
+    else if constexpr (sizeof(T) == 1)
+    {
+        uint8x16_t vector = vld1q_u8(reinterpret_cast<const uint8_t*>(data)), value = vdupq_n_u8((uint8_t)element);
+        matches = IsGreater ? vcgtq_u8(vector, value) : vcltq_u8(vector, value);
+    }
+    else if constexpr (sizeof(T) == 2 && std::is_signed_v<T>)
+    {
+        int16x8_t vector = vld1q_s16(reinterpret_cast<const int16_t*>(data)), value = vdupq_n_s16((int16_t)element);
+        matches = vreinterpretq_u8_u16(IsGreater ? vcgtq_s16(vector, value) : vcltq_s16(vector, value));
+    }
+    else if constexpr (sizeof(T) == 2)
+    {
+        uint16x8_t vector = vld1q_u16(reinterpret_cast<const uint16_t*>(data)), value = vdupq_n_u16((uint16_t)element);
+        matches = vreinterpretq_u8_u16(IsGreater ? vcgtq_u16(vector, value) : vcltq_u16(vector, value));
+    }
+    else if constexpr (sizeof(T) == 4 && std::is_signed_v<T>)
+    {
+        int32x4_t vector = vld1q_s32(reinterpret_cast<const int32_t*>(data)), value = vdupq_n_s32((int32_t)element);
+        matches = vreinterpretq_u8_u32(IsGreater ? vcgtq_s32(vector, value) : vcltq_s32(vector, value));
+    }
+    else if constexpr (sizeof(T) == 4)
+    {
+        uint32x4_t vector = vld1q_u32(reinterpret_cast<const uint32_t*>(data)), value = vdupq_n_u32((uint32_t)element);
+        matches = vreinterpretq_u8_u32(IsGreater ? vcgtq_u32(vector, value) : vcltq_u32(vector, value));
+    }
+    else if constexpr (std::is_signed_v<T>)
+    {
+        int64x2_t vector = vld1q_s64(reinterpret_cast<const int64_t*>(data)), value = vdupq_n_s64((int64_t)element);
+        matches = vreinterpretq_u8_u64(IsGreater ? vcgtq_s64(vector, value) : vcltq_s64(vector, value));
+    }
+    else
+    {
+        uint64x2_t vector = vld1q_u64(reinterpret_cast<const uint64_t*>(data)), value = vdupq_n_u64((uint64_t)element);
+        matches = vreinterpretq_u8_u64(IsGreater ? vcgtq_u64(vector, value) : vcltq_u64(vector, value));
+    }
+
+    uint8x8_t nibbles = vshrn_n_u16(vreinterpretq_u16_u8(matches), 4);
+    return vget_lane_u64(vreinterpret_u64_u8(nibbles), 0) & ElementMatchPattern<T>();
+#else
+    return 0;
+#endif
+}
+
+/// @brief Searches for an element within a range, and returns its first occuring index, (comparing
+/// a whole vector of elements at once if they're SIMD searchable).
+/// @tparam T The type of the elements.
+/// @param data A pointer to the first element of the range.
+/// @param length The amount of elements within the range.
+/// @param element The value of the desired element.
+/// @return The first occuring index of the element, or -1 if unfound.
+template<typename T>
+size_t SearchFirst(const T* data, const size_t &length, const T &element)
+{
+    size_t i = 0;
+    if constexpr (IS_VECTOR_SEARCHABLE<T>)
+    {
+        constexpr size_t WIDTH = SEARCHING_VECTOR_SIZE / sizeof(T);
+        for (; i + WIDTH <= length; i += WIDTH)
+        {
+            uint64_t mask = MatchVector(data + i, element);
+            if (mask) { return i + CountTrailingZeros(mask) / (sizeof(T) * SEARCHING_BITS_PER_BYTE); }
+        }
+    }
+
+    for (; i < length; i++) { if (data[i] == element) { return i; } }
+    return -1;
+}
+
+/// @brief Searches for an element within a range, and returns its last occuring index, (comparing
+/// a whole vector of elements at once if they're SIMD searchable).
+/// @tparam T The type of the elements.
+/// @param data A pointer to the first element of the range.
+/// @param length The amount of elements within the range.
+/// @param element The value of the desired element.
+/// @return The last occuring index of the element, or -1 if unfound.
+template<typename T>
+size_t SearchLast(const T* data, const size_t &length, const T &element)
+{
+    size_t i = length;
+    if constexpr (IS_VECTOR_SEARCHABLE<T>)
+    {
+        constexpr size_t WIDTH = SEARCHING_VECTOR_SIZE / sizeof(T);
+        for (; i >= WIDTH; i -= WIDTH)
+        {
+            uint64_t mask = MatchVector(data + i - WIDTH, element);
+            if (mask) { return i - WIDTH + (63 - CountLeadingZeros(mask)) / (sizeof(T) * SEARCHING_BITS_PER_BYTE); }
+        }
+    }
+
+    while (i-- > 0) { if (data[i] == element) { return i; } }
+    return -1;
+}
+
+/// @brief Counts the occurances of an element within a range, (comparing a whole vector of elements
+/// at once if they're SIMD searchable).
+/// @tparam T The type of the elements.
+/// @param data A pointer to the first element of the range.
+/// @param length The amount of elements within the range.
+/// @param element The value of the desired element.
+/// @return The amount of elements that are equal to the desired one.
+template<typename T>
+size_t SearchCount(const T* data, const size_t &length, const T &element)
+{
+    size_t i = 0, count = 0;
+    if constexpr (IS_VECTOR_SEARCHABLE<T>)
+    {
+        constexpr size_t WIDTH = SEARCHING_VECTOR_SIZE / sizeof(T);
+        for (; i + WIDTH <= length; i += WIDTH) { count += PopulationCount(MatchVector(data + i, element)); }
+    }
+
+    for (; i < length; i++) { count += data[i] == element; }
+    return count;
+}
+
+/// @brief Searches for an element within a range, and writes all of its occuring indices, (comparing
+/// a whole vector of elements at once if they're SIMD searchable).
+/// @tparam T The type of the elements.
+/// @param data A pointer to the first element of the range.
+/// @param length The amount of elements within the range.
+/// @param element The value of the desired element.
+/// @param indices A pointer to the memory the indices are written to, (it must fit all of them,
+/// which SearchCount tells).
+/// @return The amount of indices that have been written.
+template<typename T>
+size_t SearchAll(const T* data, const size_t &length, const T &element, size_t* indices)
+{
+    size_t i = 0, count = 0;
+    if constexpr (IS_VECTOR_SEARCHABLE<T>)
+    {
+        constexpr size_t WIDTH = SEARCHING_VECTOR_SIZE / sizeof(T);
+        for (; i + WIDTH <= length; i += WIDTH)
+        {
+            for (uint64_t mask = MatchVector(data + i, element); mask; mask &= mask - 1)
+            { indices[count++] = i + CountTrailingZeros(mask) / (sizeof(T) * SEARCHING_BITS_PER_BYTE); }
+        }
+    }
+
+    for (; i < length; i++) { if (data[i] == element) { indices[count++] = i; } }
+    return count;
+}
+
+/// @brief Searches a sorted range for the first element that isn't less than an element, (counting a whole vector
+/// of lesser elements at once if they're SIMD searchable, which beats a binary search over a few cache lines,
+/// or binary searching otherwise).
+/// @tparam T The type of the elements.
+/// @param data A pointer to the first element of the range, (sorted in an ascending order).
+/// @param length The amount of elements within the range.
+/// @param element The value of the searched element.
+/// @return The index of the first element that isn't less than the searched one, or the length if there's none.
+template<typename T>
+size_t SearchLowerBound(const T* data, const size_t &length, const T &element)
+{
+    size_t i = 0;
+    if constexpr (IS_VECTOR_SEARCHABLE<T>)
+    {
+        constexpr size_t WIDTH = SEARCHING_VECTOR_SIZE / sizeof(T);
+        for (; i + WIDTH <= length; i += WIDTH)
+        {
+            size_t lesserCount = PopulationCount(OrderVector<false>(data + i, element));
+            if (lesserCount < WIDTH) { return i + lesserCount; }
+        }
+
+        for (; i < length && data[i] < element; i++) { }
+        return i;
+    }
+    else
+    {
+        size_t high = length;
+        while (i < high)
+        {
+            size_t middle = i + (high - i) / 2;
+            if (data[middle] < element) { i = middle + 1; }
+            else { high = middle; }
+        }
+
+        return i;
+    }
+}
+
+/// @brief Searches a sorted range for the first element that's greater than an element, (counting a whole vector
+/// of elements that aren't greater at once if they're SIMD searchable, or binary searching otherwise).
+/// @tparam T The type of the elements.
+/// @param data A pointer to the first element of the range, (sorted in an ascending order).
+/// @param length The amount of elements within the range.
+/// @param element The value of the searched element.
+/// @return The index of the first element that's greater than the searched one, or the length if there's none.
+template<typename T>
+size_t SearchUpperBound(const T* data, const size_t &length, const T &element)
+{
+    size_t i = 0;
+    if constexpr (IS_VECTOR_SEARCHABLE<T>)
+    {
+        constexpr size_t WIDTH = SEARCHING_VECTOR_SIZE / sizeof(T);
+        for (; i + WIDTH <= length; i += WIDTH)
+        {
+            size_t notGreaterCount = WIDTH - PopulationCount(OrderVector<true>(data + i, element));
+            if (notGreaterCount < WIDTH) { return i + notGreaterCount; }
+        }
+
+        for (; i < length && !(element < data[i]); i++) { }
+        return i;
+    }
+    else
+    {
+        size_t high = length;
+        while (i < high)
+        {
+            size_t middle = i + (high - i) / 2;
+            if (!(element < data[middle])) { i = middle + 1; }
+            else { high = middle; }
+        }
+
+        return i;
+    }
+}
+
+#endif
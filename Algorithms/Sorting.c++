@@ -0,0 +1,401 @@
+#include<iostream>
+
+#ifndef SORTING
+#define SORTING
+
+#include<algorithm>
+#include<cstdint>
+#include<cstring>
+#include<functional>
+#include<memory>
+#include<stdexcept>
+#include<thread>
+#include<type_traits>
+#include<utility>
+#include<vector>
+
+/// @brief The algorithm a range of elements gets sorted with.
+enum class SortingAlgorithm
+{
+    /// @brief Picks the Radix Sort for integral and floating point elements in their natural order,
+    /// the Parallel Merge Sort for large ranges, and the Intro Sort otherwise.
+    Automatic,
+    /// @brief A Quick Sort that falls back to a Heap Sort when it recurses too deep, (unstable,
+    /// in place, and never quadratic).
+    IntroSort,
+    /// @brief A bottom up Merge Sort, (stable, and takes an extra buffer as large as the range).
+    MergeSort,
+    /// @brief A least significant digit Radix Sort over the bits of the keys, (stable, linear,
+    /// and only for integral and floating point elements in their natural order).
+    RadixSort,
+    /// @brief A Merge Sort that sorts the range in chunks across threads, and merges them back
+    /// in parallel, (stable).
+    ParallelMergeSort
+};
+
+/// @brief The largest range that's sorted by an Insertion Sort instead of dividing it further.
+constexpr size_t INSERTION_SORTING_THRESHOLD = 16;
+/// @brief The smallest range that the Automatic Sorting Algorithm uses the Radix Sort for.
+constexpr size_t RADIX_SORTING_THRESHOLD = 256;
+/// @brief The smallest range that's split across threads by the Parallel Merge Sort.
+constexpr size_t PARALLEL_SORTING_THRESHOLD = 1 << 16;
+
+/// @brief Indicates whether or not the elements of a type can be sorted by the Radix Sort, (integral
+/// and floating point types of up to eight bytes, except booleans).
+/// @tparam T The type of the elements.
+template<typename T>
+constexpr bool IS_RADIX_SORTABLE = (std::is_integral_v<T> || std::is_floating_point_v<T>) && !std::is_same_v<T, bool>
+    && (sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8);
+
+/// @brief Sorts a range of elements by an Insertion Sort, (stable, and the fastest for short ranges).
+/// @tparam T The type of the elements.
+/// @tparam TComparer The function object that tells whether or not an element goes before another.
+/// @param begin A pointer to the first element of the range.
+/// @param end A pointer past the last element of the range.
+/// @param comparer The function object that tells whether or not an element goes before another.
+template<typename T, typename TComparer = std::less<T>>
+void InsertionSort(T* begin, T* end, const TComparer &comparer = TComparer())
+{
+    if (begin == end) { return; }
+
+    for (T* current = begin + 1; current < end; current++)
+    {
+        T element = std::move(*current);
+        T* hole = current;
+        for (; hole > begin && comparer(element, *(hole - 1)); hole--) { *hole = std::move(*(hole - 1)); }
+
+        *hole = std::move(element);
+    }
+}
+
+/// @brief Sorts a range of elements by a Heap Sort, (unstable, in place, and always linearithmic).
+/// @tparam T The type of the elements.
+/// @tparam TComparer The function object that tells whether or not an element goes before another.
+/// @param begin A pointer to the first element of the range.
+/// @param end A pointer past the last element of the range.
+/// @param comparer The function object that tells whether or not an element goes before another.
+template<typename T, typename TComparer = std::less<T>>
+void HeapSort(T* begin, T* end, const TComparer &comparer = TComparer())
+{
+    size_t length = end - begin;
+
+    auto siftDown = [&](size_t parent, const size_t &heapLength)
+    {
+        T element = std::move(begin[parent]);
+        for (size_t child = 2 * parent + 1; child < heapLength; child = 2 * parent + 1)
+        {
+            if (child + 1 < heapLength && comparer(begin[child], begin[child + 1])) { child++; }
+            if (!comparer(element, begin[child])) { break; }
+
+            begin[parent] = std::move(begin[child]);
+            parent = child;
+        }
+
+        begin[parent] = std::move(element);
+    };
+
+    for (size_t i = length / 2; i-- > 0;) { siftDown(i, length); }
+    for (size_t i = length; i-- > 1;)
+    {
+        std::swap(begin[0], begin[i]);
+        siftDown(0, i);
+    }
+}
+
+/// @brief Sorts the partitions of a range that are longer than the Insertion Sort threshold, by
+/// a Quick Sort with a median of three pivot, that falls back to a Heap Sort past a depth limit.
+/// @tparam T The type of the elements.
+/// @tparam TComparer The function object that tells whether or not an element goes before another.
+/// @param begin A pointer to the first element of the range.
+/// @param end A pointer past the last element of the range.
+/// @param depthLimit The amount of partitioning levels left before falling back to a Heap Sort.
+/// @param comparer The function object that tells whether or not an element goes before another.
+template<typename T, typename TComparer>
+void IntroSortPartitions(T* begin, T* end, size_t depthLimit, const TComparer &comparer)
+{
+    while ((size_t)(end - begin) > INSERTION_SORTING_THRESHOLD)
+    {
+        if (!depthLimit--) { HeapSort(begin, end, comparer); return; }
+
+        // The median of three is moved to the beginning, which leaves an element that's not greater
+        // and one that's not less than the pivot on both sides, so the partitioning needs no bound checks.
+        T* first = begin + 1, * middle = begin + (end - begin) / 2, * last = end - 1;
+        if (comparer(*middle, *first)) { std::swap(first, middle); }
+        if (comparer(*last, *middle)) { std::swap(middle, last); }
+        if (comparer(*middle, *first)) { std::swap(first, middle); }
+        std::swap(*begin, *middle);
+
+        T* left = begin + 1, * right = end;
+        while (true)
+        {
+            while (comparer(*left, *begin)) { left++; }
+            right--;
+            while (comparer(*begin, *right)) { right--; }
+            if (left >= right) { break; }
+
+            std::swap(*left, *right);
+            left++;
+        }
+
+        IntroSortPartitions(left, end, depthLimit, comparer);
+        end = left;
+    }
+}
+
+/// @brief Sorts a range of elements by an Intro Sort, (unstable, in place, and never quadratic).
+/// @tparam T The type of the elements.
+/// @tparam TComparer The function object that tells whether or not an element goes before another.
+/// @param begin A pointer to the first element of the range.
+/// @param end A pointer past the last element of the range.
+/// @param comparer The function object that tells whether or not an element goes before another.
+template<typename T, typename TComparer = std::less<T>>
+void IntroSort(T* begin, T* end, const TComparer &comparer = TComparer())
+{
+    size_t depthLimit = 0;
+    for (size_t length = end - begin; length > 1; length >>= 1) { depthLimit += 2; }
+
+    IntroSortPartitions(begin, end, depthLimit, comparer);
+    InsertionSort(begin, end, comparer);
+}
+
+/// @brief Merges two adjacent sorted ranges by moving their elements into an output range, (stable,
+/// so an element of the left range goes first when both are equivalent).
+/// @tparam T The type of the elements.
+/// @tparam TComparer The function object that tells whether or not an element goes before another.
+/// @param begin A pointer to the first element of the left range.
+/// @param middle A pointer to the first element of the right range, (and past the left range).
+/// @param end A pointer past the last element of the right range.
+/// @param output A pointer to the first element of the output range, (which mustn't overlap).
+/// @param comparer The function object that tells whether or not an element goes before another.
+template<typename T, typename TComparer>
+void MergeRanges(T* begin, T* middle, T* end, T* output, const TComparer &comparer)
+{
+    T* left = begin, * right = middle;
+    while (left < middle && right < end) { *output++ = comparer(*right, *left) ? std::move(*right++) : std::move(*left++); }
+
+    output = std::move(left, middle, output);
+    std::move(right, end, output);
+}
+
+/// @brief Sorts a range of elements by a bottom up Merge Sort, using a buffer as large as the range.
+/// @tparam T The type of the elements.
+/// @tparam TComparer The function object that tells whether or not an element goes before another.
+/// @param begin A pointer to the first element of the range.
+/// @param end A pointer past the last element of the range.
+/// @param buffer A pointer to a range of elements as long as the sorted one, (its values are overwritten).
+/// @param comparer The function object that tells whether or not an element goes before another.
+template<typename T, typename TComparer>
+void MergeSort(T* begin, T* end, T* buffer, const TComparer &comparer)
+{
+    size_t length = end - begin;
+    for (size_t i = 0; i < length; i += INSERTION_SORTING_THRESHOLD)
+    { InsertionSort(begin + i, begin + std::min(i + INSERTION_SORTING_THRESHOLD, length), comparer); }
+
+    T* source = begin, * destination = buffer;
+    for (size_t width = INSERTION_SORTING_THRESHOLD; width < length; width *= 2)
+    {
+        for (size_t i = 0; i < length; i += 2 * width)
+        {
+            size_t middle = std::min(i + width, length), last = std::min(i + 2 * width, length);
+            MergeRanges(source + i, source + middle, source + last, destination + i, comparer);
+        }
+
+        std::swap(source, destination);
+    }
+
+    if (source != begin) { std::move(source, source + length, begin); }
+}
+
+/// @brief Sorts a range of elements by a bottom up Merge Sort, (stable, and takes an extra buffer
+/// as large as the range).
+/// @tparam T The type of the elements.
+/// @tparam TComparer The function object that tells whether or not an element goes before another.
+/// @param begin A pointer to the first element of the range.
+/// @param end A pointer past the last element of the range.
+/// @param comparer The function object that tells whether or not an element goes before another.
+template<typename T, typename TComparer = std::less<T>>
+void MergeSort(T* begin, T* end, const TComparer &comparer = TComparer())
+{
+    if ((size_t)(end - begin) <= INSERTION_SORTING_THRESHOLD) { InsertionSort(begin, end, comparer); return; }
+
+    std::unique_ptr<T[]> buffer(new T[end - begin]);
+    MergeSort(begin, end, buffer.get(), comparer);
+}
+
+/// @brief Maps an element to an unsigned key of the same size, that's ordered the same way as the element,
+/// (the sign bit of the signed integers is flipped, and the negative floating points have all of their bits
+/// flipped while the positive ones only have their sign bit flipped).
+/// @tparam T The type of the elements.
+/// @param element The value of the element.
+/// @return The unsigned key of the element.
+template<typename T>
+auto RadixKey(const T &element)
+{
+    using TKey = std::conditional_t<sizeof(T) == 1, uint8_t, std::conditional_t<sizeof(T) == 2, uint16_t,
+        std::conditional_t<sizeof(T) == 4, uint32_t, uint64_t>>>;
+    constexpr TKey SIGN_BIT = (TKey)1 << (sizeof(TKey) * 8 - 1);
+
+    TKey key;
+    std::memcpy(&key, &element, sizeof(TKey));
+
+    if constexpr (std::is_floating_point_v<T>) { return (TKey)(key ^ ((key & SIGN_BIT) ? (TKey)~(TKey)0 : SIGN_BIT)); }
+    else if constexpr (std::is_signed_v<T>) { return (TKey)(key ^ SIGN_BIT); }
+    else { return key; }
+}
+
+/// @brief Sorts a range of integral or floating point elements by a least significant digit Radix Sort,
+/// using a buffer as large as the range, (the keys of four bytes or more take eleven bit digits, which saves
+/// a pass over the memory compared to bytes, and the digits that all of the elements share are skipped,
+/// so narrow ranges of values take fewer passes).
+/// @tparam T The type of the elements.
+/// @param begin A pointer to the first element of the range.
+/// @param end A pointer past the last element of the range.
+/// @param buffer A pointer to a range of elements as long as the sorted one, (its values are overwritten).
+template<typename T>
+void RadixSort(T* begin, T* end, T* buffer)
+{
+    static_assert(IS_RADIX_SORTABLE<T>, "The Radix Sort only sorts integral and floating point elements.");
+
+    constexpr size_t DIGIT_BITS = sizeof(T) >= 4 ? 11 : 8, RADIX = (size_t)1 << DIGIT_BITS;
+    constexpr size_t DIGIT_COUNT = (sizeof(T) * 8 + DIGIT_BITS - 1) / DIGIT_BITS;
+    size_t length = end - begin;
+
+    // The histograms of every digit are counted within a single pass over the elements.
+    std::unique_ptr<size_t[]> histograms(new size_t[DIGIT_COUNT * RADIX]());
+    for (T* current = begin; current < end; current++)
+    {
+        auto key = RadixKey(*current);
+        for (size_t digit = 0; digit < DIGIT_COUNT; digit++)
+        { histograms[digit * RADIX + ((key >> (digit * DIGIT_BITS)) & (RADIX - 1))]++; }
+    }
+
+    T* source = begin, * destination = buffer;
+    for (size_t digit = 0; digit < DIGIT_COUNT; digit++)
+    {
+        size_t* histogram = histograms.get() + digit * RADIX, shift = digit * DIGIT_BITS;
+        if (histogram[(RadixKey(*begin) >> shift) & (RADIX - 1)] == length) { continue; }
+
+        size_t offset = 0;
+        for (size_t i = 0; i < RADIX; i++)
+        {
+            size_t bucketLength = histogram[i];
+            histogram[i] = offset;
+            offset += bucketLength;
+        }
+
+        for (T* current = source; current < source + length; current++)
+        { destination[histogram[(RadixKey(*current) >> shift) & (RADIX - 1)]++] = *current; }
+
+        std::swap(source, destination);
+    }
+
+    if (source != begin) { std::memcpy(begin, source, length * sizeof(T)); }
+}
+
+/// @brief Sorts a range of integral or floating point elements in their natural order by a least significant
+/// digit Radix Sort, (stable, linear, and takes an extra buffer as large as the range).
+/// @tparam T The type of the elements.
+/// @param begin A pointer to the first element of the range.
+/// @param end A pointer past the last element of the range.
+template<typename T>
+void RadixSort(T* begin, T* end)
+{
+    if ((size_t)(end - begin) <= INSERTION_SORTING_THRESHOLD) { InsertionSort(begin, end); return; }
+
+    std::unique_ptr<T[]> buffer(new T[end - begin]);
+    RadixSort(begin, end, buffer.get());
+}
+
+/// @brief Sorts a range of elements by a Merge Sort, where the range is split in a chunk per thread,
+/// which are sorted at the same time, and then merged back in pairs in parallel, (stable, and ranges
+/// shorter than the parallel threshold are sorted by a single thread).
+/// @tparam T The type of the elements.
+/// @tparam TComparer The function object that tells whether or not an element goes before another.
+/// @param begin A pointer to the first element of the range.
+/// @param end A pointer past the last element of the range.
+/// @param comparer The function object that tells whether or not an element goes before another.
+/// @param threadCount The amount of threads the range is split across, (or the amount of cores if zero).
+template<typename T, typename TComparer = std::less<T>>
+void ParallelMergeSort(T* begin, T* end, const TComparer &comparer = TComparer(), size_t threadCount = 0)
+{
+    size_t length = end - begin;
+    if (!threadCount) { threadCount = std::max(std::thread::hardware_concurrency(), 1U); }
+    threadCount = std::min(threadCount, length / (PARALLEL_SORTING_THRESHOLD / 2));
+
+    if (threadCount <= 1) { MergeSort(begin, end, comparer); return; }
+
+    std::unique_ptr<T[]> buffer(new T[length]);
+    std::vector<size_t> boundaries;
+    for (size_t i = 0; i <= threadCount; i++) { boundaries.push_back(length * i / threadCount); }
+
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < threadCount; i++)
+    {
+        threads.emplace_back([&, i]
+        { MergeSort(begin + boundaries[i], begin + boundaries[i + 1], buffer.get() + boundaries[i], comparer); });
+    }
+
+    for (std::thread &thread : threads) { thread.join(); }
+
+    T* source = begin, * destination = buffer.get();
+    while (boundaries.size() > 2)
+    {
+        threads.clear();
+        std::vector<size_t> mergedBoundaries;
+
+        for (size_t i = 0; i + 1 < boundaries.size(); i += 2)
+        {
+            mergedBoundaries.push_back(boundaries[i]);
+            size_t first = boundaries[i], middle = boundaries[i + 1], last = boundaries[std::min(i + 2, boundaries.size() - 1)];
+
+            threads.emplace_back([=, &comparer]
+            { MergeRanges(source + first, source + middle, source + last, destination + first, comparer); });
+        }
+
+        for (std::thread &thread : threads) { thread.join(); }
+
+        mergedBoundaries.push_back(length);
+        boundaries = std::move(mergedBoundaries);
+        std::swap(source, destination);
+    }
+
+    if (source != begin) { std::move(source, source + length, begin); }
+}
+
+/// @brief Sorts a range of elements in place by a chosen Sorting Algorithm.
+/// @tparam T The type of the elements.
+/// @tparam TComparer The function object that tells whether or not an element goes before another.
+/// @param begin A pointer to the first element of the range.
+/// @param end A pointer past the last element of the range.
+/// @param algorithm The algorithm the range gets sorted with, (the Radix Sort only accepts integral and
+/// floating point elements in their natural order, otherwise it'll throw a "logic error" exception).
+/// @param comparer The function object that tells whether or not an element goes before another.
+template<typename T, typename TComparer = std::less<T>>
+void SortRange(T* begin, T* end, const SortingAlgorithm &algorithm = SortingAlgorithm::Automatic,
+    const TComparer &comparer = TComparer()) noexcept(false)
+{
+    constexpr bool IS_NATURALLY_RADIX_SORTABLE = IS_RADIX_SORTABLE<T> && std::is_same_v<TComparer, std::less<T>>;
+    size_t length = end - begin;
+
+    switch (algorithm)
+    {
+        case SortingAlgorithm::IntroSort: IntroSort(begin, end, comparer); return;
+        case SortingAlgorithm::MergeSort: MergeSort(begin, end, comparer); return;
+        case SortingAlgorithm::ParallelMergeSort: ParallelMergeSort(begin, end, comparer); return;
+        case SortingAlgorithm::RadixSort:
+            if constexpr (IS_NATURALLY_RADIX_SORTABLE) { RadixSort(begin, end); return; }
+            else { throw std::logic_error("The Radix Sort only sorts integral and floating point elements in their natural order."); }
+        default:
+            if constexpr (IS_NATURALLY_RADIX_SORTABLE)
+            {
+                if (length >= RADIX_SORTING_THRESHOLD) { RadixSort(begin, end); return; }
+            }
+
+            if (length >= PARALLEL_SORTING_THRESHOLD && std::thread::hardware_concurrency() > 1)
+            { ParallelMergeSort(begin, end, comparer); return; }
+
+            IntroSort(begin, end, comparer);
+    }
+}
+
+#endif
@@ -0,0 +1,104 @@
+#include<iostream>
+
+#ifndef XX_HASH
+#define XX_HASH
+
+#include<cstdint>
+
+#include "BitOperations.c++"
+
+/// @brief The primes used by the xxHash64 algorithm.
+constexpr uint64_t XX_HASH_PRIME_1 = 0x9E3779B185EBCA87ULL,
+    XX_HASH_PRIME_2 = 0xC2B2AE3D27D4EB4FULL,
+    XX_HASH_PRIME_3 = 0x165667B19E3779F9ULL,
+    XX_HASH_PRIME_4 = 0x85EBCA77C2B2AE63ULL,
+    XX_HASH_PRIME_5 = 0x27D4EB2F165667C5ULL;
+
+/// @brief Mixes a lane of 8 bytes into an accumulator of xxHash64.
+/// @param accumulator The accumulator the lane will be mixed into.
+/// @param lane The 8 bytes that'll be mixed.
+/// @return The new value of the accumulator.
+inline uint64_t XXHash64Round(uint64_t accumulator, const uint64_t &lane)
+{
+    accumulator += lane * XX_HASH_PRIME_2;
+    accumulator = RotateLeft(accumulator, 31);
+    return accumulator * XX_HASH_PRIME_1;
+}
+
+/// @brief Merges one of the four accumulators of xxHash64 into the final hashing value.
+/// @param hashValue The hashing value the accumulator will be merged into.
+/// @param accumulator The accumulator that'll be merged.
+/// @return The new hashing value.
+inline uint64_t XXHash64MergeRound(uint64_t hashValue, const uint64_t &accumulator)
+{
+    hashValue ^= XXHash64Round(0, accumulator);
+    return hashValue * XX_HASH_PRIME_1 + XX_HASH_PRIME_4;
+}
+
+/// @brief Hashes a block of bytes by its content, using the xxHash64 algorithm, (which consumes
+/// 32 bytes at a time through four independent accumulators).
+/// @param data A pointer to the first byte of the block.
+/// @param length The amount of bytes within the block.
+/// @param seed An initial value that determines the outcome of the hashing.
+/// @return The 64-bit hashing value of the block.
+inline uint64_t XXHash64(const void* data, const size_t &length, const uint64_t &seed = 0)
+{
+    const unsigned char* bytes = static_cast<const unsigned char*>(data);
+    const unsigned char* end = bytes + length;
+    uint64_t hashValue;
+
+    if (length >= 32)
+    {
+        uint64_t accumulator1 = seed + XX_HASH_PRIME_1 + XX_HASH_PRIME_2,
+            accumulator2 = seed + XX_HASH_PRIME_2,
+            accumulator3 = seed,
+            accumulator4 = seed - XX_HASH_PRIME_1;
+
+        for ( ; bytes + 32 <= end; bytes += 32)
+        {
+            accumulator1 = XXHash64Round(accumulator1, LoadUnaligned<uint64_t>(bytes));
+            accumulator2 = XXHash64Round(accumulator2, LoadUnaligned<uint64_t>(bytes + 8));
+            accumulator3 = XXHash64Round(accumulator3, LoadUnaligned<uint64_t>(bytes + 16));
+            accumulator4 = XXHash64Round(accumulator4, LoadUnaligned<uint64_t>(bytes + 24));
+        }
+
+        hashValue = RotateLeft(accumulator1, 1) + RotateLeft(accumulator2, 7) +
+            RotateLeft(accumulator3, 12) + RotateLeft(accumulator4, 18);
+
+        hashValue = XXHash64MergeRound(hashValue, accumulator1);
+        hashValue = XXHash64MergeRound(hashValue, accumulator2);
+        hashValue = XXHash64MergeRound(hashValue, accumulator3);
+        hashValue = XXHash64MergeRound(hashValue, accumulator4);
+    }
+    else { hashValue = seed + XX_HASH_PRIME_5; }
+
+    hashValue += (uint64_t)length;
+
+    for ( ; bytes + 8 <= end; bytes += 8)
+    {
+        hashValue ^= XXHash64Round(0, LoadUnaligned<uint64_t>(bytes));
+        hashValue = RotateLeft(hashValue, 27) * XX_HASH_PRIME_1 + XX_HASH_PRIME_4;
+    }
+
+    if (bytes + 4 <= end)
+    {
+        hashValue ^= (uint64_t)LoadUnaligned<uint32_t>(bytes) * XX_HASH_PRIME_1;
+        hashValue = RotateLeft(hashValue, 23) * XX_HASH_PRIME_2 + XX_HASH_PRIME_3;
+        bytes += 4;
+    }
+
+    for ( ; bytes < end; bytes++)
+    {
+        hashValue ^= *bytes * XX_HASH_PRIME_5;
+        hashValue = RotateLeft(hashValue, 11) * XX_HASH_PRIME_1;
+    }
+
+    hashValue ^= hashValue >> 33;
+    hashValue *= XX_HASH_PRIME_2;
+    hashValue ^= hashValue >> 29;
+    hashValue *= XX_HASH_PRIME_3;
+    hashValue ^= hashValue >> 32;
+    return hashValue;
+}
+
+#endif
@@ -3,6 +3,16 @@
 #ifndef ARRAY
 #define ARRAY
 
+#include<cstring>
+#include<functional>
+#include<type_traits>
+
+#include "ExecutionPolicy.c++"
+#include "Algorithms/Searching.c++"
+#include "Algorithms/Sorting.c++"
+#include "Serialization.c++"
+#include "Views.c++"
+
 /// @brief Introduces the abstraction of the Dynamic Array class to the Array class.
 /// @tparam T The type of the data stored within the Dynamic Array.
 template<typename T>
@@ -21,6 +31,8 @@ class Array
 public:
     /// @brief Makes the Dynamic Array class a friend with the Array class.
     friend class DynamicArray<T>;
+    /// @brief Makes the List class a friend with the Array class.
+    friend class List<T>;
 
     /// @brief Creates a new empty Array.
     Array() = default;
@@ -43,8 +55,12 @@ public:
     /// @brief Creates a new Array with a defined length and initial values.
     /// @param length The amount of elements that'll be stored within the Array.
     /// @param data A pointer to an array in memory, that has some values that'll be
-    /// stored within the Array.
-    Array(const size_t &length, T* data) : Array(length) { this->data = data; }
+    /// copied into the Array, (the memory itself stays owned by the caller, see Adopt).
+    Array(const size_t &length, const T* data) : Array(length)
+    {
+        for (size_t i = 0; i < length; i++)
+        { this->data[i] = data[i]; }
+    }
 
     /// @brief Creates a new Array by copying another Array as reference.
     /// @param reference The reference of the Array that'll be copied.
@@ -54,6 +70,20 @@ public:
         for (size_t i = 0; i < reference.length; i++)
         { data[i] = T(reference.data[i]); }
     }
+
+    /// @brief Creates a new Array by copying another Array as reference, following an execution policy.
+    /// @param reference The reference of the Array that'll be copied.
+    /// @param policy The way the elements are copied, (in parallel chunks for large Arrays if not sequential).
+    Array(const Array<T> &reference, const ExecutionPolicy &policy) : Array(reference.length)
+    { CopyElements(reference.data, data, length, policy); }
+
+    /// @brief Creates a new Array by taking over the memory of another Array, which is left empty.
+    /// @param reference The reference of the Array that'll be moved.
+    Array(Array<T> &&reference) noexcept : length(reference.length), data(reference.data)
+    {
+        reference.length = 0;
+        reference.data = nullptr;
+    }
     
     ~Array()
     {
@@ -68,6 +98,10 @@ private:
     /// @brief A pointer to the first element in the Array.
     T* data = nullptr;
 
+    /// @brief The amount of elements that are validated at once by the unsequenced execution policy,
+    /// (a bit for each within a mask).
+    static constexpr size_t MATCHING_BLOCK_LENGTH = 64;
+
 public:
     /// @brief The amount of elements stored within the Array.
     /// @return The length of the Array.
@@ -92,8 +126,10 @@ public:
 
     /// @brief Searches for an element in the Array, and returns all of its occuring indices.
     /// @param element The value of the desired element.
+    /// @param policy The way the elements are searched through, (the indices stay in order either way).
     /// @return An Array filled with all of the element occuring indices, or an empty Array if unfound.
-    Array<size_t> IndicesOf(const T &element) const { return IndicesOf(element, length); }
+    Array<size_t> IndicesOf(const T &element, const ExecutionPolicy &policy = ExecutionPolicy::Sequential) const
+    { return IndicesOf(element, length, policy); }
 
     /// @brief Checks for the existence of an element in the Array.
     /// @param element The value of the desired element.
@@ -101,30 +137,48 @@ public:
     bool Contains(const T &element) const { return FirstIndexOf(element) != -1; }
 
     /// @brief Searches for the first element in the Array that matches a set of conditions.
+    /// @tparam TPredicate The type of the function that validates the elements.
     /// @param predicate A function that takes an element and validates it throughout a set of conditions.
+    /// @param policy The way the elements are searched through, (the chunks after a match stop early).
     /// @return The index of the first element that matches the set of conditions, or -1 if unfound.
-    size_t First(std::function<bool(const T &element)> predicate) const { return First(predicate, length); }
+    template<typename TPredicate>
+    size_t First(const TPredicate &predicate, const ExecutionPolicy &policy = ExecutionPolicy::Sequential) const
+    { return First(predicate, length, policy); }
 
     /// @brief Searches for the last element in the Array that matches a set of conditions.
+    /// @tparam TPredicate The type of the function that validates the elements.
     /// @param predicate A function that takes an element and validates it throughout a set of conditions.
     /// @return The index of the last element that matches the set of conditions, or -1 if unfound.
-    size_t Last(std::function<bool(const T &element)> predicate) const { return Last(predicate, length); }
+    template<typename TPredicate>
+    size_t Last(const TPredicate &predicate) const { return Last(predicate, length); }
 
     /// @brief Searches for all the elements in the Array that match a set of conditions.
+    /// @tparam TPredicate The type of the function that validates the elements.
     /// @param predicate A function that takes an element and validates it throughout a set of conditions.
+    /// @param policy The way the elements are searched through, (the indices stay in order either way).
     /// @return An Array filled with all of the last elements indices that match the set of conditions,
     /// or an empty Array if unfound.
-    Array<size_t> Every(std::function<bool(const T &element)> predicate) const { return Every(predicate, length); }
+    template<typename TPredicate>
+    Array<size_t> Every(const TPredicate &predicate, const ExecutionPolicy &policy = ExecutionPolicy::Sequential) const
+    { return Every(predicate, length, policy); }
 
     /// @brief Checks if any of the Array elements matches a set of conditions.
+    /// @tparam TPredicate The type of the function that validates the elements.
     /// @param predicate A function that takes an element and validates it throughout a set of conditions.
+    /// @param policy The way the elements are checked, (every chunk stops early once a match is found).
     /// @return A boolean representing whether or not any of the Array elements matches the set of conditions.
-    bool Any(std::function<bool(const T &element)> predicate) const { return Any(predicate, length); }
+    template<typename TPredicate>
+    bool Any(const TPredicate &predicate, const ExecutionPolicy &policy = ExecutionPolicy::Sequential) const
+    { return Any(predicate, length, policy); }
 
     /// @brief Checks if all of the Array elements match a set of conditions.
+    /// @tparam TPredicate The type of the function that validates the elements.
     /// @param predicate A function that takes an element and validates it throughout a set of conditions.
+    /// @param policy The way the elements are checked, (every chunk stops early once a mismatch is found).
     /// @return A boolean representing whether or not all of the Array elements match the set of conditions.
-    bool All(std::function<bool(const T &element)> predicate) const { return All(predicate, length); }
+    template<typename TPredicate>
+    bool All(const TPredicate &predicate, const ExecutionPolicy &policy = ExecutionPolicy::Sequential) const
+    { return All(predicate, length, policy); }
 
     /// @brief Makes a copy of the Array with a new length.
     /// @param length The amount of elements is going to be stored within the array.
@@ -132,8 +186,7 @@ public:
     Array<T> Resize(const size_t &length) const
     {
         Array<T> resizedArray(length);
-        for (size_t i = 0; i < std::min(this->length, length); i++)
-        { resizedArray.data[i] = data[i]; }
+        CopyElements(data, resizedArray.data, std::min(this->length, length), ExecutionPolicy::Sequential);
         
         return resizedArray;
     }
@@ -146,9 +199,9 @@ public:
     Array<T> Resize(const size_t &length, const T &defaultValue) const
     {
         Array<T> resizedArray = Resize(length);
-        if (length <= length) { goto FINISH; }
+        if (length <= this->length) { goto FINISH; }
 
-        for (size_t i = length; i < length; i++)
+        for (size_t i = this->length; i < length; i++)
         { resizedArray.data[i] = T(defaultValue); }
         
         FINISH: return resizedArray;
@@ -156,11 +209,87 @@ public:
     
     /// @brief Makes a copy of the Array that'll have the same elements of this Array, but
     /// in a reversed order.
+    /// @param policy The way the elements are copied, (in parallel chunks for large Arrays if not sequential).
     /// @return An Array that has the same elements of this Array but in a reversed order.
-    Array<T> Reverse() const { return Reverse(length); }
+    Array<T> Reverse(const ExecutionPolicy &policy = ExecutionPolicy::Sequential) const { return Reverse(length, policy); }
+
+    /// @brief Makes a copy of the Array that'll have the same elements of this Array, but sorted
+    /// in an ascending order.
+    /// @param algorithm The algorithm the elements get sorted with.
+    /// @return An Array that has the same elements of this Array but sorted.
+    Array<T> Sort(const SortingAlgorithm &algorithm = SortingAlgorithm::Automatic) const noexcept(false)
+    {
+        Array<T> sortedArray(*this);
+        sortedArray.SortInPlace(algorithm);
+        return sortedArray;
+    }
+
+    /// @brief Makes a copy of the Array that'll have the same elements of this Array, but sorted
+    /// by a comparer.
+    /// @tparam TComparer The function object that tells whether or not an element goes before another.
+    /// @param comparer The function object that tells whether or not an element goes before another.
+    /// @param algorithm The algorithm the elements get sorted with.
+    /// @return An Array that has the same elements of this Array but sorted.
+    template<typename TComparer>
+    Array<T> Sort(const TComparer &comparer, const SortingAlgorithm &algorithm = SortingAlgorithm::Automatic) const noexcept(false)
+    {
+        Array<T> sortedArray(*this);
+        sortedArray.SortInPlace(comparer, algorithm);
+        return sortedArray;
+    }
+
+    /// @brief Sorts the elements of the Array in an ascending order, without copying the Array.
+    /// @param algorithm The algorithm the elements get sorted with.
+    void SortInPlace(const SortingAlgorithm &algorithm = SortingAlgorithm::Automatic) noexcept(false)
+    { SortRange(data, data + length, algorithm); }
+
+    /// @brief Sorts the elements of the Array by a comparer, without copying the Array.
+    /// @tparam TComparer The function object that tells whether or not an element goes before another.
+    /// @param comparer The function object that tells whether or not an element goes before another.
+    /// @param algorithm The algorithm the elements get sorted with.
+    template<typename TComparer>
+    void SortInPlace(const TComparer &comparer, const SortingAlgorithm &algorithm = SortingAlgorithm::Automatic) noexcept(false)
+    { SortRange(data, data + length, algorithm, comparer); }
+
+    /// @brief Creates a new Array that takes the ownership of an already allocated memory block,
+    /// without copying any of its elements.
+    /// @param length The amount of elements stored within the memory block.
+    /// @param data A pointer to a memory block allocated with "new T[length]", that'll be
+    /// released by the Array from now on.
+    /// @return The Array that owns the memory block.
+    static Array<T> Adopt(const size_t &length, T* data)
+    {
+        Array<T> adoptedArray;
+        adoptedArray.length = length;
+        adoptedArray.data = data;
+        return adoptedArray;
+    }
+
+    /// @brief Gives up the ownership of the Array memory block, without copying any of its elements,
+    /// and leaves the Array empty.
+    /// @return A pointer to the memory block, that must be released later with "delete[]".
+    T* Release() noexcept
+    {
+        T* releasedData = data;
+        data = nullptr;
+        length = 0;
+        return releasedData;
+    }
+
+    /// @brief Saves the elements of the Array into a binary file, as a header followed by the raw elements.
+    /// @param path The path of the file, (which is replaced if it exists).
+    void Save(const std::string &path) const noexcept(false) { SaveElements(path, data, length); }
 
-    // TODO: Sort Function Implementation.
-    Array<T> Sort() const { return this; }
+    /// @brief Loads an Array from a binary file saved by "Save", and validates its checksum, if the file
+    /// can't be read, or it's corrupted, it'll throw a "runtime error" exception.
+    /// @param path The path of the file.
+    /// @return The Array containing the loaded elements.
+    static Array<T> Load(const std::string &path) noexcept(false)
+    {
+        Array<T> loadedArray;
+        LoadElements<T>(path, [&](const size_t &count) { loadedArray = Array<T>(count); return loadedArray.data; });
+        return loadedArray;
+    }
 
     /// @brief Converts the Array into a Dynamic Array.
     /// @return A Dynamic Array containing all of the Array elements.
@@ -170,6 +299,11 @@ public:
     /// @return A List containing all of the Array elements.
     List<T> ToList() const { return List<T>(*this); }
 
+    /// @brief Makes a lazy View of the Array elements, that can be reversed, sliced, filtered or mapped
+    /// without copying them, (the Array must outlive the View).
+    /// @return A Range View of all of the Array elements.
+    RangeView<T*> View() const { return RangeView<T*>(data, data + length); }
+
     /// @brief Copies an Array into another.
     /// @param reference The reference of the Array that'll be copied.
     /// @return The result of the copying.
@@ -186,6 +320,22 @@ public:
         return *this;
     }
 
+    /// @brief Moves an Array into another, by taking over its memory.
+    /// @param reference The reference of the Array that'll be moved.
+    /// @return The result of the moving.
+    Array<T> &operator=(Array<T> &&reference) noexcept
+    {
+        if (this == &reference) { return *this; }
+
+        if (data != nullptr) { delete[] data; }
+        length = reference.length;
+        data = reference.data;
+
+        reference.length = 0;
+        reference.data = nullptr;
+        return *this;
+    }
+
     /// @brief Gets or Sets an element in the Array.
     /// @param index The order of the desired element.
     /// @return The element.
@@ -198,7 +348,7 @@ public:
     /// @brief Only Gets an element in the Array, without the ability to Set it.
     /// @param index The order of the desired element.
     /// @return The value of the element.
-    T operator[](const size_t &index) const noexcept(false)
+    const T &operator[](const size_t &index) const noexcept(false)
     {
         ValidateBoundaries(index);
         return data[index];
@@ -215,110 +365,344 @@ private:
         throw std::out_of_range("The index [" + std::to_string(index) + "] is out of the range of the Array.");
     }
 
+    /// @brief Changes the length of the Array in place, by moving the elements into a newly allocated
+    /// memory block instead of copying them twice through a resized copy.
+    /// @param length The amount of elements is going to be stored within the Array.
+    void Reallocate(const size_t &length)
+    {
+        T* reallocatedData = new T[length];
+        MoveElements(data, reallocatedData, std::min(this->length, length));
+
+        if (data != nullptr) { delete[] data; }
+        data = reallocatedData;
+        this->length = length;
+    }
+
     /// @brief Searches for an element in the Array to a specified ending, and returns its first occuring index.
     /// @param element The value of the desired element.
     /// @param end The index in which the search will end at.
     /// @return The first occuring index of the element, or -1 if unfound.
-    size_t FirstIndexOf(const T &element, const size_t &end) const
-    { return First([&](const T &element_) { return element_ == element; }, end); }
+    size_t FirstIndexOf(const T &element, const size_t &end) const { return SearchFirst(data, std::min(length, end), element); }
 
     /// @brief Searches for an element in the Array to a specified ending, and returns its last occuring index.
     /// @param element The value of the desired element.
     /// @param end The index in which the search will end at.
     /// @return The last occuring index of the element, or -1 if unfound.
-    size_t LastIndexOf(const T &element, const size_t &end) const
-    { return Last([&](const T &element_) { return element_ == element; }, end); }
+    size_t LastIndexOf(const T &element, const size_t &end) const { return SearchLast(data, std::min(length, end), element); }
 
     /// @brief Searches for an element in the Array to a specified ending, and returns all of its occuring indices.
     /// @param element The value of the desired element.
     /// @param end The index in which the search will end at.
+    /// @param policy The way the elements are searched through.
     /// @return An Array filled with all of the element occuring indices, or an empty Array if unfound.
-    Array<size_t> IndicesOf(const T &element, const size_t &end) const
-    { return Every([&](const T &element_) { return element_ == element; }, end); }
+    Array<size_t> IndicesOf(const T &element, const size_t &end, const ExecutionPolicy &policy = ExecutionPolicy::Sequential) const
+    {
+        size_t searchLength = std::min(length, end);
+        if constexpr (!IS_VECTOR_SEARCHABLE<T>) { return Every([&](const T &element_) { return element_ == element; }, end, policy); }
+        else if (!IsParallel(policy, searchLength))
+        {
+            // Counting the matches first is cheap with SIMD, so the indices are allocated once with their exact count.
+            Array<size_t> indices(SearchCount(data, searchLength, element));
+            SearchAll(data, searchLength, element, indices.begin());
+            return indices;
+        }
+        else
+        {
+            ParallelChunks<T> chunks(data, searchLength);
+            Array<size_t> offsets(chunks.Count() + 1, (size_t)0);
+
+            chunks.Run([&](const size_t &chunkIndex, const size_t &begin, const size_t &end)
+            { offsets.begin()[chunkIndex + 1] = SearchCount(data + begin, end - begin, element); });
+
+            for (size_t i = 1; i < offsets.Length(); i++) { offsets.begin()[i] += offsets.begin()[i - 1]; }
+
+            Array<size_t> indices(offsets.begin()[chunks.Count()]);
+            chunks.Run([&](const size_t &chunkIndex, const size_t &begin, const size_t &end)
+            {
+                size_t* chunkIndices = indices.begin() + offsets.begin()[chunkIndex];
+                size_t count = SearchAll(data + begin, end - begin, element, chunkIndices);
+                for (size_t i = 0; i < count; i++) { chunkIndices[i] += begin; }
+            });
+
+            return indices;
+        }
+    }
 
     /// @brief Searches for the first element in the Array that matches a set of conditions to a specified ending.
+    /// @tparam TPredicate The type of the function that validates the elements.
     /// @param predicate A function that takes an element and validates it throughout a set of conditions.
     /// @param end The index in which the search will end at.
+    /// @param policy The way the elements are searched through.
     /// @return The index of the first element that matches the set of conditions, or -1 if unfound.
-    size_t First(std::function<bool(const T &element)> predicate, const size_t &end) const
+    template<typename TPredicate>
+    size_t First(const TPredicate &predicate, const size_t &end, const ExecutionPolicy &policy = ExecutionPolicy::Sequential) const
     {
-        for (size_t i = 0; i < std::min(length, end); i++)
-        { if (predicate(data[i])) { return i; } }
+        size_t searchLength = std::min(length, end);
+        if (!IsParallel(policy, searchLength))
+        { return FirstInRange(predicate, 0, searchLength, policy == ExecutionPolicy::ParallelUnsequenced, [] { return false; }); }
 
-        return -1;
+        ParallelChunks<T> chunks(data, searchLength);
+        std::atomic<size_t> firstIndex { (size_t)-1 };
+
+        chunks.Run([&](const size_t &, const size_t &begin, const size_t &end)
+        {
+            // The chunk stops once a chunk before it has found a match, since its matches can't be the first anymore.
+            size_t index = FirstInRange(predicate, begin, end, policy == ExecutionPolicy::ParallelUnsequenced,
+                [&] { return firstIndex.load(std::memory_order_relaxed) < begin; });
+
+            size_t currentIndex = firstIndex.load(std::memory_order_relaxed);
+            while (index < currentIndex && !firstIndex.compare_exchange_weak(currentIndex, index, std::memory_order_relaxed)) { }
+        });
+
+        return firstIndex.load(std::memory_order_relaxed);
     }
 
     /// @brief Searches for the last element in the Array that matches a set of conditions to a specified ending.
+    /// @tparam TPredicate The type of the function that validates the elements.
     /// @param predicate A function that takes an element and validates it throughout a set of conditions.
     /// @param end The index in which the search will end at.
     /// @return The index of the last element that matches the set of conditions, or -1 if unfound.
-    size_t Last(std::function<bool(const T &element)> predicate, const size_t &end) const
+    template<typename TPredicate>
+    size_t Last(const TPredicate &predicate, const size_t &end) const
     {
-        for (size_t i = std::min(length, end) - 1; i >= 0; i--)
+        for (size_t i = std::min(length, end); i-- > 0;)
         { if (predicate(data[i])) { return i; } }
 
         return -1;
     }
 
     /// @brief Searches for all the elements in the Array that match a set of conditions to a specified ending.
+    /// @tparam TPredicate The type of the function that validates the elements.
     /// @param predicate A function that takes an element and validates it throughout a set of conditions.
     /// @param end The index in which the search will end at.
+    /// @param policy The way the elements are searched through.
     /// @return An Array filled with all of the last elements indices that match the set of conditions,
     /// or an empty Array if unfound.
-    Array<size_t> Every(std::function<bool(const T &element)> predicate, const size_t &end) const
+    template<typename TPredicate>
+    Array<size_t> Every(const TPredicate &predicate, const size_t &end, const ExecutionPolicy &policy = ExecutionPolicy::Sequential) const
     {
-        size_t indicesCount = 0;
-        Array<size_t> indices(std::min(length, end));
-        
-        for (size_t i = 0; i < std::min(length, end); i++)
-        { if (predicate(data[i])) { indices[indicesCount++] = i; } }
-
-        return indices.Resize(indicesCount);
+        size_t searchLength = std::min(length, end);
+        bool isUnsequenced = policy == ExecutionPolicy::ParallelUnsequenced;
+        if (!IsParallel(policy, searchLength)) { return EveryInRange(predicate, 0, searchLength, isUnsequenced); }
+
+        // Each chunk collects its own indices, which are then joined in the order of the chunks.
+        ParallelChunks<T> chunks(data, searchLength);
+        Array<Array<size_t>> chunkIndices(chunks.Count());
+        Array<size_t> offsets(chunks.Count() + 1, (size_t)0);
+
+        chunks.Run([&](const size_t &chunkIndex, const size_t &begin, const size_t &end)
+        {
+            chunkIndices.begin()[chunkIndex] = EveryInRange(predicate, begin, end, isUnsequenced);
+            offsets.begin()[chunkIndex + 1] = chunkIndices.begin()[chunkIndex].Length();
+        });
+
+        for (size_t i = 1; i < offsets.Length(); i++) { offsets.begin()[i] += offsets.begin()[i - 1]; }
+
+        Array<size_t> indices(offsets.begin()[chunks.Count()]);
+        chunks.Run([&](const size_t &chunkIndex, const size_t &, const size_t &)
+        {
+            const Array<size_t> &currentIndices = chunkIndices.begin()[chunkIndex];
+            std::copy(currentIndices.begin(), currentIndices.end(), indices.begin() + offsets.begin()[chunkIndex]);
+        });
+
+        return indices;
     }
 
     /// @brief Checks if any of the Array elements matches a set of conditions to a specified ending.
+    /// @tparam TPredicate The type of the function that validates the elements.
     /// @param predicate A function that takes an element and validates it throughout a set of conditions.
     /// @param end The index in which the checking will end at.
+    /// @param policy The way the elements are checked.
     /// @return A boolean representing whether or not any of the Array elements matches the set of conditions.
-    bool Any(std::function<bool(const T &element)> predicate, const size_t &end) const
-    { return First(predicate, end) != -1; }
+    template<typename TPredicate>
+    bool Any(const TPredicate &predicate, const size_t &end, const ExecutionPolicy &policy = ExecutionPolicy::Sequential) const
+    {
+        size_t searchLength = std::min(length, end);
+        if (!IsParallel(policy, searchLength)) { return First(predicate, end, policy) != (size_t)-1; }
+
+        ParallelChunks<T> chunks(data, searchLength);
+        std::atomic<bool> isFound { false };
+
+        chunks.Run([&](const size_t &, const size_t &begin, const size_t &end)
+        {
+            size_t index = FirstInRange(predicate, begin, end, policy == ExecutionPolicy::ParallelUnsequenced,
+                [&] { return isFound.load(std::memory_order_relaxed); });
+
+            if (index != (size_t)-1) { isFound.store(true, std::memory_order_relaxed); }
+        });
+
+        return isFound.load(std::memory_order_relaxed);
+    }
 
     /// @brief Checks if all of the Array elements match a set of conditions to a specified ending.
+    /// @tparam TPredicate The type of the function that validates the elements.
     /// @param predicate A function that takes an element and validates it throughout a set of conditions.
     /// @param end The index in which the checking will end at.
+    /// @param policy The way the elements are checked.
     /// @return A boolean representing whether or not all of the Array elements match the set of conditions.
-    bool All(std::function<bool(const T &element)> predicate, const size_t &end) const
-    {
-        for (size_t i = 0; i < std::min(length, end); i++)
-        { if (!predicate(data[i])) { return false; } }
-        
-        return true;
-    }
+    template<typename TPredicate>
+    bool All(const TPredicate &predicate, const size_t &end, const ExecutionPolicy &policy = ExecutionPolicy::Sequential) const
+    { return !Any([&](const T &element) { return !predicate(element); }, end, policy); }
 
     /// @brief Makes a copy of the Array that'll have the same elements of this Array, but
     /// in a reversed order, to a specified ending.
     /// @param end The index in which the reversing will end at.
+    /// @param policy The way the elements are copied.
     /// @return An Array that has the same elements of this Array but in a reversed order.
-    Array<T> Reverse(const size_t &end) const
+    Array<T> Reverse(const size_t &end, const ExecutionPolicy &policy = ExecutionPolicy::Sequential) const
     {
         size_t newLength = std::min(length, end);
         Array<T> reversedArray(newLength);
 
-        for (size_t i = 0; i < newLength; i++)
-        { reversedArray.data[i] = T(data[newLength - i - 1]); }
+        auto reverse = [&](const size_t &begin, const size_t &end)
+        {
+            for (size_t i = begin; i < end; i++)
+            { reversedArray.data[i] = T(data[newLength - i - 1]); }
+        };
+
+        if (!IsParallel(policy, newLength)) { reverse(0, newLength); }
+        else
+        {
+            ParallelChunks<T>(reversedArray.data, newLength)
+                .Run([&](const size_t &, const size_t &begin, const size_t &end) { reverse(begin, end); });
+        }
 
         return reversedArray;
     }
+
+    /// @brief Searches for the first element within a range of the Array that matches a set of conditions,
+    /// and gives up once it's cancelled.
+    /// @tparam TPredicate The type of the function that validates the elements.
+    /// @tparam TCancellation The type of the function that tells whether or not the search is cancelled.
+    /// @param predicate A function that takes an element and validates it throughout a set of conditions.
+    /// @param begin The index in which the search will start at.
+    /// @param end The index in which the search will end at.
+    /// @param isUnsequenced Whether or not the elements are validated in blocks without branching on each one.
+    /// @param isCancelled A function that tells whether or not the search is cancelled, (checked once per block).
+    /// @return The index of the first element that matches the set of conditions, or -1 if unfound or cancelled.
+    template<typename TPredicate, typename TCancellation>
+    size_t FirstInRange(const TPredicate &predicate, const size_t &begin, const size_t &end,
+        const bool &isUnsequenced, const TCancellation &isCancelled) const
+    {
+        for (size_t i = begin; i < end; i += MATCHING_BLOCK_LENGTH)
+        {
+            if (isCancelled()) { return -1; }
+
+            size_t blockEnd = std::min(i + MATCHING_BLOCK_LENGTH, end);
+            if (isUnsequenced)
+            {
+                uint64_t mask = MatchBlock(predicate, i, blockEnd);
+                if (mask) { return i + CountTrailingZeros(mask); }
+                continue;
+            }
+
+            for (size_t j = i; j < blockEnd; j++) { if (predicate(data[j])) { return j; } }
+        }
+
+        return -1;
+    }
+
+    /// @brief Searches for all the elements within a range of the Array that match a set of conditions.
+    /// @tparam TPredicate The type of the function that validates the elements.
+    /// @param predicate A function that takes an element and validates it throughout a set of conditions.
+    /// @param begin The index in which the search will start at.
+    /// @param end The index in which the search will end at.
+    /// @param isUnsequenced Whether or not the elements are validated in blocks without branching on each one.
+    /// @return An Array filled with all of the matching elements indices.
+    template<typename TPredicate>
+    Array<size_t> EveryInRange(const TPredicate &predicate, const size_t &begin, const size_t &end, const bool &isUnsequenced) const
+    {
+        size_t indicesCount = 0;
+
+        // The matches are marked within a bit set first, so the indices are allocated once with their exact count.
+        Array<uint64_t> matches((end - begin + MATCHING_BLOCK_LENGTH - 1) / MATCHING_BLOCK_LENGTH, (uint64_t)0);
+        for (size_t i = 0; i < matches.Length(); i++)
+        {
+            size_t blockBegin = begin + i * MATCHING_BLOCK_LENGTH, blockEnd = std::min(blockBegin + MATCHING_BLOCK_LENGTH, end);
+            uint64_t mask = 0;
+
+            if (isUnsequenced) { mask = MatchBlock(predicate, blockBegin, blockEnd); }
+            else
+            {
+                for (size_t j = blockBegin; j < blockEnd; j++)
+                { if (predicate(data[j])) { mask |= (uint64_t)1 << (j - blockBegin); } }
+            }
+
+            matches.begin()[i] = mask;
+            indicesCount += PopulationCount(mask);
+        }
+
+        Array<size_t> indices(indicesCount);
+        size_t* currentIndex = indices.begin();
+        for (size_t i = 0; i < matches.Length(); i++)
+        {
+            for (uint64_t mask = matches.begin()[i]; mask; mask &= mask - 1)
+            { *currentIndex++ = begin + i * MATCHING_BLOCK_LENGTH + CountTrailingZeros(mask); }
+        }
+
+        return indices;
+    }
+
+    /// @brief Validates a block of elements at once, without branching on the result of each one, so
+    /// simple predicates can be vectorized.
+    /// @tparam TPredicate The type of the function that validates the elements.
+    /// @param predicate A function that takes an element and validates it throughout a set of conditions.
+    /// @param begin The index of the first element of the block.
+    /// @param end The index past the last element of the block, (at most a block length after its beginning).
+    /// @return A bit mask of the elements that match the set of conditions.
+    template<typename TPredicate>
+    uint64_t MatchBlock(const TPredicate &predicate, const size_t &begin, const size_t &end) const
+    {
+        uint64_t mask = 0;
+        for (size_t i = begin; i < end; i++) { mask |= (uint64_t)(bool)predicate(data[i]) << (i - begin); }
+        return mask;
+    }
+
+    /// @brief Copies a range of elements into another, following an execution policy.
+    /// @param source A pointer to the first element that'll be copied.
+    /// @param destination A pointer to the first element that'll be overwritten, (the ranges mustn't overlap).
+    /// @param count The amount of elements that'll be copied.
+    /// @param policy The way the elements are copied, (in parallel chunks for large ranges if not sequential).
+    static void CopyElements(const T* source, T* destination, const size_t &count, const ExecutionPolicy &policy)
+    {
+        auto copy = [&](const size_t &begin, const size_t &end)
+        {
+            if constexpr (std::is_trivially_copyable_v<T>)
+            { if (begin < end) { std::memcpy(destination + begin, source + begin, (end - begin) * sizeof(T)); } }
+            else { for (size_t i = begin; i < end; i++) { destination[i] = T(source[i]); } }
+        };
+
+        if (!IsParallel(policy, count)) { copy(0, count); return; }
+
+        ParallelChunks<T>(destination, count).Run([&](const size_t &, const size_t &begin, const size_t &end) { copy(begin, end); });
+    }
+
+    /// @brief Moves a range of elements into another range, which might overlap it, (trivially copyable
+    /// elements are moved all at once by "memmove", and the others one by one in a safe direction).
+    /// @param source A pointer to the first element that'll be moved.
+    /// @param destination A pointer to the first element that'll be overwritten.
+    /// @param count The amount of elements that'll be moved.
+    static void MoveElements(T* source, T* destination, const size_t &count)
+    {
+        if (!count || source == destination) { return; }
+
+        if constexpr (std::is_trivially_copyable_v<T>) { std::memmove(destination, source, count * sizeof(T)); }
+        else if (destination < source) { for (size_t i = 0; i < count; i++) { destination[i] = std::move(source[i]); } }
+        else { for (size_t i = count; i > 0; i--) { destination[i - 1] = std::move(source[i - 1]); } }
+    }
 };
 
-/// @brief Simple shortcut of writing Two-Dimensional Array types.
-/// @tparam T The type of the data stored within the Matrix.
+/// @brief Simple shortcut of writing Two-Dimensional Array types, where each row is a separate Array,
+/// (the Matrix class keeps all of the rows within a single block of memory instead).
+/// @tparam T The type of the data stored within the Jagged Matrix.
 template<typename T>
-using Matrix = Array<Array<T>>;
+using JaggedMatrix = Array<Array<T>>;
 
-/// @brief Simple shortcut of writing Three-Dimensional Array types.
-/// @tparam T The type of the data stored within the Tensor.
+/// @brief Simple shortcut of writing Three-Dimensional Array types, where each row is a separate Array.
+/// @tparam T The type of the data stored within the Jagged Tensor.
 template<typename T>
-using Tensor = Array<Array<Array<T>>>;
+using JaggedTensor = Array<Array<Array<T>>>;
+
+#include "Matrix.c++"
 
 #endif
\ No newline at end of file
@@ -0,0 +1,125 @@
+#include<iostream>
+
+#ifndef ARRAY_VIEW
+#define ARRAY_VIEW
+
+#include<iterator>
+#include<stdexcept>
+#include<string>
+
+#include "Array.c++"
+
+/// @brief A non-owning view of elements that are equally spaced in memory, like a row or a column of
+/// a Matrix, where changing an element changes the memory it views, (the memory must outlive the view).
+/// @tparam T The type of the data viewed by the Array View.
+template<typename T>
+class ArrayView
+{
+public:
+    /// @brief Walks through the elements of an Array View, by skipping a stride of elements at each step.
+    class Iterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = T*;
+        using reference = T&;
+
+        /// @brief Creates a new Iterator at an element.
+        /// @param element A pointer to the current element.
+        /// @param stride The distance between two elements.
+        Iterator(T* element, const size_t &stride) : element(element), stride(stride) { }
+
+        T &operator*() const { return *element; }
+        T* operator->() const { return element; }
+        Iterator &operator++() { element += stride; return *this; }
+        Iterator operator++(int) { Iterator iterator = *this; element += stride; return iterator; }
+        bool operator==(const Iterator &iterator) const { return element == iterator.element; }
+        bool operator!=(const Iterator &iterator) const { return element != iterator.element; }
+
+    private:
+        /// @brief A pointer to the current element.
+        T* element;
+        /// @brief The distance between two elements.
+        size_t stride;
+    };
+
+    /// @brief Creates a new empty Array View.
+    ArrayView() = default;
+
+    /// @brief Creates a new Array View of elements in memory.
+    /// @param data A pointer to the first viewed element.
+    /// @param length The amount of viewed elements.
+    /// @param stride The distance between two viewed elements, (one if they're contiguous).
+    ArrayView(T* data, const size_t &length, const size_t &stride = 1) : data(data), length(length), stride(stride) { }
+
+    /// @brief Creates a new Array View of all of the elements of an Array.
+    /// @param array The Array that'll be viewed.
+    ArrayView(const Array<T> &array) : ArrayView(array.begin(), array.Length()) { }
+
+private:
+    /// @brief A pointer to the first viewed element.
+    T* data = nullptr;
+    /// @brief The amount of viewed elements.
+    size_t length = 0;
+    /// @brief The distance between two viewed elements.
+    size_t stride = 1;
+
+public:
+    /// @brief The amount of elements viewed by the Array View.
+    /// @return The length of the Array View.
+    size_t Length() const { return length; }
+    /// @brief The distance between two elements viewed by the Array View.
+    /// @return The stride of the Array View, (one if its elements are contiguous).
+    size_t Stride() const { return stride; }
+    /// @brief Indicates whether or not the elements viewed by the Array View are next to each other.
+    /// @return A boolean representing whether or not the Array View is contiguous.
+    bool IsContiguous() const { return stride == 1; }
+    /// @brief The memory viewed by the Array View.
+    /// @return A pointer to the first viewed element.
+    T* Data() const { return data; }
+
+    /// @brief The beginning of the Array View.
+    /// @return An Iterator at the first viewed element.
+    Iterator begin() const { return Iterator(data, stride); }
+    /// @brief The end of the Array View.
+    /// @return An Iterator past the last viewed element.
+    Iterator end() const { return Iterator(data + length * stride, stride); }
+
+    /// @brief Makes a view of a part of the Array View.
+    /// @param index The index of the first element of the part.
+    /// @param length The amount of elements within the part.
+    /// @return An Array View of the part.
+    ArrayView<T> Slice(const size_t &index, const size_t &length) const noexcept(false)
+    {
+        if (index > this->length || length > this->length - index)
+        { throw std::out_of_range("The slice [" + std::to_string(index) + ", " + std::to_string(index + length) + ") is out of the range of the Array View."); }
+
+        return ArrayView<T>(data + index * stride, length, stride);
+    }
+
+    /// @brief Sets every viewed element to a value.
+    /// @param value The value that'll be set to each element.
+    void Fill(const T &value) { for (T &element : *this) { element = value; } }
+
+    /// @brief Copies the viewed elements into an Array.
+    /// @return An Array consisting of all of the viewed elements.
+    Array<T> ToArray() const
+    {
+        Array<T> array(length);
+        for (size_t i = 0; i < length; i++) { array.begin()[i] = data[i * stride]; }
+        return array;
+    }
+
+    /// @brief Gets or Sets a viewed element.
+    /// @param index The order of the desired element.
+    /// @return The element.
+    T &operator[](const size_t &index) const noexcept(false)
+    {
+        if (index >= length) { throw std::out_of_range("The index [" + std::to_string(index) + "] is out of the range of the Array View."); }
+        return data[index * stride];
+    }
+};
+
+#endif
@@ -0,0 +1,859 @@
+#include<iostream>
+
+#ifndef B_PLUS_TREE
+#define B_PLUS_TREE
+
+#include<algorithm>
+#include<cstddef>
+#include<functional>
+#include<iterator>
+#include<stdexcept>
+#include<string>
+#include<type_traits>
+#include<utility>
+
+#include "Array.c++"
+#include "CacheLine.c++"
+#include "KeyValuePair.c++"
+#include "Views.c++"
+#include "Algorithms/Searching.c++"
+
+/// @brief A reference to a key and its associated value within an ordered associative data structure,
+/// (which stores them apart, so they can't be accessed as a single Key Value Pair).
+/// @tparam TKey The type of the key.
+/// @tparam TValue The type of the value associated with the key.
+template<typename TKey, typename TValue>
+struct KeyValueReference
+{
+    /// @brief The key that's used to access the value, (it can't be changed as the order depends on it).
+    const TKey &Key;
+    /// @brief The value that's associated with the key.
+    TValue &Value;
+
+    /// @brief Copies the referred key and value into a Key Value Pair.
+    /// @return The Key Value Pair of the referred key and value.
+    operator KeyValuePair<TKey, TValue>() const { return KeyValuePair<TKey, TValue> { Key, Value }; }
+};
+
+/// @brief The values held by a leaf Node of a B+ Tree, next to its keys.
+/// @tparam TValue The type of the values, (void if the B+ Tree only holds keys).
+/// @tparam CAPACITY The maximum amount of values of a leaf Node.
+template<typename TValue, size_t CAPACITY>
+struct BPlusTreeLeafValues
+{
+    /// @brief The values associated with the keys of the leaf Node, in the same order.
+    TValue Values[CAPACITY];
+};
+
+/// @brief The values held by a leaf Node of a B+ Tree that only holds keys, (which are none).
+/// @tparam CAPACITY The maximum amount of values of a leaf Node.
+template<size_t CAPACITY>
+struct BPlusTreeLeafValues<void, CAPACITY> { };
+
+/// @brief An ordered associative data structure that keeps the keys sorted within wide Nodes, which are a few cache
+/// lines each, so a lookup only touches a Node per level of a shallow tree, and searches within each Node by SIMD
+/// instructions for the arithmetic keys, (the leaf Nodes hold every key and are linked, so walking through a range
+/// of keys is sequential), which is the shared implementation of the Sorted Set and the Sorted Map.
+/// @tparam TKey The type of the keys, (which must be default constructible).
+/// @tparam TValue The type of the values associated with the keys, (void if only the keys are held).
+/// @tparam TComparer The type of the comparer that orders the keys, (a strict weak ordering).
+template<typename TKey, typename TValue = void, typename TComparer = std::less<TKey>>
+class BPlusTree
+{
+public:
+    /// @brief The amount of bytes the keys of a Node take, (a few cache lines, which are prefetched together
+    /// by the hardware, so a wider Node is searched about as fast as a single cache line).
+    static constexpr size_t NODE_SIZE = 4 * CACHE_LINE_SIZE;
+    /// @brief The maximum amount of keys a Node can hold.
+    static constexpr size_t NODE_CAPACITY = std::max<size_t>(NODE_SIZE / sizeof(TKey), 4);
+    /// @brief The maximum amount of levels of a B+ Tree, (which only its address space limits).
+    static constexpr size_t MAXIMUM_HEIGHT = 64;
+
+private:
+    /// @brief Whether or not the keys hold values too.
+    static constexpr bool IS_MAPPED = !std::is_void_v<TValue>;
+    /// @brief Whether or not the keys are searched within a Node by SIMD instructions, (their comparer must
+    /// be the natural order, which the instructions implement).
+    static constexpr bool IS_VECTOR_ORDERED = IS_VECTOR_SEARCHABLE<TKey> && std::is_same_v<TComparer, std::less<TKey>>;
+    /// @brief The minimum amount of keys a leaf Node that isn't the root holds.
+    static constexpr size_t MINIMUM_LEAF_COUNT = NODE_CAPACITY / 2;
+    /// @brief The minimum amount of keys an inner Node that isn't the root holds.
+    static constexpr size_t MINIMUM_INNER_COUNT = (NODE_CAPACITY - 1) / 2;
+
+    /// @brief The keys shared by both kinds of Nodes, (aligned to a cache line, so every Node spans
+    /// the fewest cache lines).
+    struct alignas(CACHE_LINE_SIZE) BaseNode
+    {
+        /// @brief The amount of keys the Node holds.
+        size_t Count = 0;
+        /// @brief Whether the Node is a leaf, or an inner Node.
+        bool IsLeaf;
+        /// @brief The keys of the Node, in an ascending order, (the keys of an inner Node are the separators of
+        /// its children, each is less than or equal to every key within the child after it).
+        TKey Keys[NODE_CAPACITY];
+
+        /// @brief Creates a new empty Node.
+        /// @param isLeaf Whether the Node is a leaf, or an inner Node.
+        explicit BaseNode(const bool &isLeaf) : IsLeaf(isLeaf) { }
+    };
+
+    /// @brief A Node that separates the keys of its children.
+    struct InnerNode : BaseNode
+    {
+        /// @brief The children of the Node, (one more than its keys).
+        BaseNode* Children[NODE_CAPACITY + 1];
+
+        /// @brief Creates a new empty inner Node.
+        InnerNode() : BaseNode(false) { }
+    };
+
+    /// @brief A Node that holds the keys, (and their values), linked to its adjacent leaf Nodes.
+    struct LeafNode : BaseNode, BPlusTreeLeafValues<TValue, NODE_CAPACITY>
+    {
+        /// @brief A pointer to the previous leaf Node, or null pointer if it's the first one.
+        LeafNode* Previous = nullptr;
+        /// @brief A pointer to the next leaf Node, or null pointer if it's the last one.
+        LeafNode* Next = nullptr;
+
+        /// @brief Creates a new empty leaf Node.
+        LeafNode() : BaseNode(true) { }
+    };
+
+    /// @brief The result of inserting into a Node that had to be split.
+    struct Split
+    {
+        /// @brief A pointer to the new Node to the right of the split one, or null pointer if none was split.
+        BaseNode* Right = nullptr;
+        /// @brief The key that separates the split Node from the new one.
+        TKey Separator = TKey();
+    };
+
+public:
+    /// @brief An Iterator that walks through the keys of a B+ Tree in an ascending order.
+    class Iterator
+    {
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = std::conditional_t<IS_MAPPED, KeyValuePair<TKey, TValue>, TKey>;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = std::conditional_t<IS_MAPPED, KeyValueReference<TKey, TValue>, const TKey &>;
+
+        /// @brief Creates a new Iterator at a key within a leaf Node.
+        /// @param leaf A pointer to the current leaf Node, or null pointer if it's past the last key.
+        /// @param index The index of the current key within the leaf Node.
+        /// @param lastLeaf A pointer to the last leaf Node, that's reached by stepping back from the end.
+        Iterator(LeafNode* leaf, const size_t &index, LeafNode* lastLeaf) : leaf(leaf), index(index), lastLeaf(lastLeaf) { }
+
+        /// @brief Accesses the current key, (and its value).
+        /// @return The reference of the key, or a reference to both the key and its value.
+        reference operator*() const
+        {
+            if constexpr (IS_MAPPED) { return reference { leaf->Keys[index], leaf->Values[index] }; }
+            else { return leaf->Keys[index]; }
+        }
+
+        /// @brief Accesses the current key.
+        /// @return The reference of the key.
+        const TKey &Key() const { return leaf->Keys[index]; }
+        /// @brief Accesses the value of the current key.
+        /// @return The reference of the value.
+        template<typename T = TValue>
+        T &Value() const { return leaf->Values[index]; }
+
+        Iterator &operator++()
+        {
+            if (++index == leaf->Count) { leaf = leaf->Next; index = 0; }
+            return *this;
+        }
+        Iterator operator++(int) { Iterator iterator = *this; ++*this; return iterator; }
+        Iterator &operator--()
+        {
+            if (!leaf) { leaf = lastLeaf; index = leaf->Count - 1; }
+            else if (index) { index--; }
+            else { leaf = leaf->Previous; index = leaf->Count - 1; }
+
+            return *this;
+        }
+        Iterator operator--(int) { Iterator iterator = *this; --*this; return iterator; }
+        bool operator==(const Iterator &iterator) const { return leaf == iterator.leaf && index == iterator.index; }
+        bool operator!=(const Iterator &iterator) const { return !(*this == iterator); }
+
+    private:
+        /// @brief A pointer to the current leaf Node.
+        LeafNode* leaf;
+        /// @brief The index of the current key within the leaf Node.
+        size_t index;
+        /// @brief A pointer to the last leaf Node of the B+ Tree.
+        LeafNode* lastLeaf;
+    };
+
+    /// @brief Creates a new empty B+ Tree.
+    /// @param comparer The comparer that'll order the keys.
+    explicit BPlusTree(const TComparer &comparer = TComparer()) : comparer(comparer) { }
+
+    /// @brief Creates a new B+ Tree by copying another B+ Tree as reference, (its keys are bulk loaded,
+    /// so the copy has full leaf Nodes).
+    /// @param reference The reference of the B+ Tree that'll be copied.
+    BPlusTree(const BPlusTree<TKey, TValue, TComparer> &reference) : comparer(reference.comparer)
+    {
+        Array<TKey> keys(reference.count);
+        size_t i = 0;
+        for (LeafNode* leaf = reference.firstLeaf; leaf; leaf = leaf->Next)
+        { for (size_t j = 0; j < leaf->Count; j++, i++) { keys.begin()[i] = leaf->Keys[j]; } }
+
+        if constexpr (IS_MAPPED)
+        {
+            Array<TValue> values(reference.count);
+            i = 0;
+            for (LeafNode* leaf = reference.firstLeaf; leaf; leaf = leaf->Next)
+            { for (size_t j = 0; j < leaf->Count; j++, i++) { values.begin()[i] = leaf->Values[j]; } }
+
+            Load(keys.begin(), values.begin(), keys.Length());
+        }
+        else { Load(keys.begin(), nullptr, keys.Length()); }
+    }
+
+    /// @brief Creates a new B+ Tree by taking over the Nodes of another B+ Tree, which is left empty.
+    /// @param reference The reference of the B+ Tree that'll be moved.
+    BPlusTree(BPlusTree<TKey, TValue, TComparer> &&reference) noexcept
+        : root(reference.root), firstLeaf(reference.firstLeaf), lastLeaf(reference.lastLeaf),
+        count(reference.count), height(reference.height), comparer(std::move(reference.comparer))
+    {
+        reference.root = nullptr;
+        reference.firstLeaf = reference.lastLeaf = nullptr;
+        reference.count = reference.height = 0;
+    }
+
+    ~BPlusTree() { Free(root); }
+
+    BPlusTree<TKey, TValue, TComparer> &operator=(const BPlusTree<TKey, TValue, TComparer> &reference)
+    {
+        if (this == &reference) { return *this; }
+
+        BPlusTree<TKey, TValue, TComparer> copy(reference);
+        return *this = std::move(copy);
+    }
+
+    BPlusTree<TKey, TValue, TComparer> &operator=(BPlusTree<TKey, TValue, TComparer> &&reference) noexcept
+    {
+        if (this == &reference) { return *this; }
+
+        Free(root);
+        root = reference.root;
+        firstLeaf = reference.firstLeaf;
+        lastLeaf = reference.lastLeaf;
+        count = reference.count;
+        height = reference.height;
+        comparer = std::move(reference.comparer);
+
+        reference.root = nullptr;
+        reference.firstLeaf = reference.lastLeaf = nullptr;
+        reference.count = reference.height = 0;
+        return *this;
+    }
+
+protected:
+    /// @brief A pointer to the root Node, or null pointer if the B+ Tree is empty.
+    BaseNode* root = nullptr;
+    /// @brief A pointer to the first leaf Node.
+    LeafNode* firstLeaf = nullptr;
+    /// @brief A pointer to the last leaf Node.
+    LeafNode* lastLeaf = nullptr;
+    /// @brief The amount of keys within the B+ Tree.
+    size_t count = 0;
+    /// @brief The amount of levels of the B+ Tree, (zero if it's empty).
+    size_t height = 0;
+    /// @brief The comparer that orders the keys.
+    TComparer comparer;
+
+    /// @brief Replaces the keys of the B+ Tree by bulk loading a sorted range of keys, which fills the leaf Nodes
+    /// evenly and builds every inner level over them at once, (in a linear time with no splitting), and skips
+    /// the repetitions of a key, keeping the first one, (if the range isn't sorted, it'll throw a "logic error"
+    /// exception).
+    /// @tparam TValuePointer The type of the pointer to the values, (null pointer if only the keys are held).
+    /// @param keys A pointer to the first key of the range, (its keys are moved).
+    /// @param values A pointer to the first value of the range, (which is ignored if only the keys are held).
+    /// @param length The amount of keys within the range.
+    template<typename TValuePointer>
+    void Load(TKey* keys, TValuePointer values, const size_t &length) noexcept(false)
+    {
+        for (size_t i = 1; i < length; i++)
+        {
+            if (comparer(keys[i], keys[i - 1]))
+            { throw std::logic_error("The key at the index [" + std::to_string(i) + "] is out of order."); }
+        }
+
+        Clear();
+
+        Array<size_t> uniqueIndices(length);
+        size_t uniqueCount = 0;
+        for (size_t i = 0; i < length; i++)
+        { if (!i || comparer(keys[i - 1], keys[i])) { uniqueIndices.begin()[uniqueCount++] = i; } }
+
+        if (!uniqueCount) { return; }
+
+        // The keys are spread evenly, so even the last leaf Node holds at least half of a full one.
+        size_t leafCount = (uniqueCount + NODE_CAPACITY - 1) / NODE_CAPACITY;
+        Array<BaseNode*> level(leafCount);
+        Array<TKey*> minimums(leafCount);
+        for (size_t i = 0, k = 0; i < leafCount; i++)
+        {
+            LeafNode* leaf = new LeafNode();
+            leaf->Count = uniqueCount / leafCount + (i < uniqueCount % leafCount);
+            for (size_t j = 0; j < leaf->Count; j++, k++)
+            {
+                size_t index = uniqueIndices.begin()[k];
+                leaf->Keys[j] = std::move(keys[index]);
+                if constexpr (IS_MAPPED) { leaf->Values[j] = std::move(values[index]); }
+            }
+
+            leaf->Previous = lastLeaf;
+            if (lastLeaf) { lastLeaf->Next = leaf; }
+            else { firstLeaf = leaf; }
+            lastLeaf = leaf;
+
+            level.begin()[i] = leaf;
+            minimums.begin()[i] = &leaf->Keys[0];
+        }
+
+        count = uniqueCount;
+        height = 1;
+        while (level.Length() > 1)
+        {
+            size_t nodeCount = (level.Length() + NODE_CAPACITY) / (NODE_CAPACITY + 1);
+            Array<BaseNode*> parents(nodeCount);
+            Array<TKey*> parentMinimums(nodeCount);
+            for (size_t i = 0, k = 0; i < nodeCount; i++)
+            {
+                InnerNode* node = new InnerNode();
+                size_t childCount = level.Length() / nodeCount + (i < level.Length() % nodeCount);
+                for (size_t j = 0; j < childCount; j++, k++)
+                {
+                    node->Children[j] = level.begin()[k];
+                    if (j) { node->Keys[j - 1] = *minimums.begin()[k]; }
+                }
+
+                node->Count = childCount - 1;
+                parents.begin()[i] = node;
+                parentMinimums.begin()[i] = minimums.begin()[k - childCount];
+            }
+
+            level = std::move(parents);
+            minimums = std::move(parentMinimums);
+            height++;
+        }
+
+        root = level.begin()[0];
+    }
+
+    /// @brief Searches for the first key that isn't less than a key within a Node.
+    /// @param node A pointer to the searched Node.
+    /// @param key The searched key.
+    /// @return The index of the first key that isn't less, or the amount of keys of the Node if there's none.
+    size_t LowerBoundIn(const BaseNode* node, const TKey &key) const
+    {
+        if constexpr (IS_VECTOR_ORDERED) { return SearchLowerBound(node->Keys, node->Count, key); }
+        else
+        {
+            size_t low = 0, high = node->Count;
+            while (low < high)
+            {
+                size_t middle = low + (high - low) / 2;
+                if (comparer(node->Keys[middle], key)) { low = middle + 1; }
+                else { high = middle; }
+            }
+
+            return low;
+        }
+    }
+
+    /// @brief Searches for the first key that's greater than a key within a Node.
+    /// @param node A pointer to the searched Node.
+    /// @param key The searched key.
+    /// @return The index of the first key that's greater, or the amount of keys of the Node if there's none.
+    size_t UpperBoundIn(const BaseNode* node, const TKey &key) const
+    {
+        if constexpr (IS_VECTOR_ORDERED) { return SearchUpperBound(node->Keys, node->Count, key); }
+        else
+        {
+            size_t low = 0, high = node->Count;
+            while (low < high)
+            {
+                size_t middle = low + (high - low) / 2;
+                if (!comparer(key, node->Keys[middle])) { low = middle + 1; }
+                else { high = middle; }
+            }
+
+            return low;
+        }
+    }
+
+    /// @brief Descends from the root to the leaf Node whose range of keys includes a key.
+    /// @param key The searched key.
+    /// @return A pointer to the leaf Node, or null pointer if the B+ Tree is empty.
+    LeafNode* LeafOf(const TKey &key) const
+    {
+        BaseNode* node = root;
+        if (!node) { return nullptr; }
+
+        while (!node->IsLeaf) { node = static_cast<InnerNode*>(node)->Children[UpperBoundIn(node, key)]; }
+        return static_cast<LeafNode*>(node);
+    }
+
+    /// @brief Creates an Iterator at a key within a leaf Node, moving to the next leaf Node if the index
+    /// is past the keys of the leaf Node.
+    /// @param leaf A pointer to the leaf Node.
+    /// @param index The index of the key within the leaf Node.
+    /// @return The Iterator at the key.
+    Iterator IteratorAt(LeafNode* leaf, const size_t &index) const
+    {
+        if (!leaf) { return end(); }
+        if (index == leaf->Count) { return Iterator(leaf->Next, 0, lastLeaf); }
+        return Iterator(leaf, index, lastLeaf);
+    }
+
+    /// @brief Searches for a key within the B+ Tree.
+    /// @param key The searched key.
+    /// @param index A reference to a variable that'll receive the index of the key within its leaf Node.
+    /// @return A pointer to the leaf Node of the key, or null pointer if the key isn't there.
+    LeafNode* Search(const TKey &key, size_t &index) const
+    {
+        LeafNode* leaf = LeafOf(key);
+        if (!leaf) { return nullptr; }
+
+        index = LowerBoundIn(leaf, key);
+        return index < leaf->Count && !comparer(key, leaf->Keys[index]) ? leaf : nullptr;
+    }
+
+    /// @brief Inserts a key into the B+ Tree if it isn't there yet, (with a default value), splitting every
+    /// full Node on its path bottom up.
+    /// @tparam TKeyArgument The type of the reference of the key, (it's moved if it's an rvalue).
+    /// @param key The key that'll be inserted.
+    /// @param index A reference to a variable that'll receive the index of the key within its leaf Node.
+    /// @param isInserted A reference to a variable that'll receive whether or not the key has been inserted.
+    /// @return A pointer to the leaf Node of the key.
+    template<typename TKeyArgument>
+    LeafNode* Insert(TKeyArgument &&key, size_t &index, bool &isInserted)
+    {
+        if (!root)
+        {
+            root = firstLeaf = lastLeaf = new LeafNode();
+            height = 1;
+        }
+
+        InnerNode* path[MAXIMUM_HEIGHT];
+        size_t childIndices[MAXIMUM_HEIGHT];
+        size_t depth = 0;
+
+        BaseNode* node = root;
+        for (; !node->IsLeaf; depth++)
+        {
+            path[depth] = static_cast<InnerNode*>(node);
+            childIndices[depth] = UpperBoundIn(node, key);
+            node = path[depth]->Children[childIndices[depth]];
+        }
+
+        LeafNode* leaf = static_cast<LeafNode*>(node);
+        index = LowerBoundIn(leaf, key);
+        isInserted = index == leaf->Count || comparer(key, leaf->Keys[index]);
+        if (!isInserted) { return leaf; }
+
+        Split split;
+        leaf = InsertIntoLeaf(leaf, index, std::forward<TKeyArgument>(key), split);
+        count++;
+
+        while (split.Right && depth--) { split = InsertIntoInner(path[depth], childIndices[depth], split); }
+        if (split.Right)
+        {
+            InnerNode* newRoot = new InnerNode();
+            newRoot->Keys[0] = std::move(split.Separator);
+            newRoot->Children[0] = root;
+            newRoot->Children[1] = split.Right;
+            newRoot->Count = 1;
+
+            root = newRoot;
+            height++;
+        }
+
+        return leaf;
+    }
+
+    /// @brief Erases a key from the B+ Tree, refilling every Node that falls below its minimum on the path bottom up,
+    /// by borrowing a key from an adjacent Node, or merging with it.
+    /// @param key The key that'll be erased.
+    /// @return A boolean representing whether or not the key has been erased.
+    bool Remove(const TKey &key)
+    {
+        if (!root) { return false; }
+
+        InnerNode* path[MAXIMUM_HEIGHT];
+        size_t childIndices[MAXIMUM_HEIGHT];
+        size_t depth = 0;
+
+        BaseNode* node = root;
+        for (; !node->IsLeaf; depth++)
+        {
+            path[depth] = static_cast<InnerNode*>(node);
+            childIndices[depth] = UpperBoundIn(node, key);
+            node = path[depth]->Children[childIndices[depth]];
+        }
+
+        LeafNode* leaf = static_cast<LeafNode*>(node);
+        size_t index = LowerBoundIn(leaf, key);
+        if (index == leaf->Count || comparer(key, leaf->Keys[index])) { return false; }
+
+        MoveEntries(leaf, index, leaf, index + 1, leaf->Count - index - 1);
+        ResetEntry(leaf, --leaf->Count);
+        count--;
+
+        while (depth--)
+        {
+            BaseNode* child = path[depth]->Children[childIndices[depth]];
+            if (child->Count >= (child->IsLeaf ? MINIMUM_LEAF_COUNT : MINIMUM_INNER_COUNT)) { break; }
+
+            Refill(path[depth], childIndices[depth]);
+        }
+
+        if (!root->Count)
+        {
+            if (root->IsLeaf) { delete static_cast<LeafNode*>(root); root = nullptr; firstLeaf = lastLeaf = nullptr; }
+            else
+            {
+                InnerNode* oldRoot = static_cast<InnerNode*>(root);
+                root = oldRoot->Children[0];
+                delete oldRoot;
+            }
+
+            height--;
+        }
+
+        return true;
+    }
+
+private:
+    /// @brief Moves a range of keys, (and their values), between leaf Nodes, or within one, (the ranges may overlap).
+    /// @param target A pointer to the leaf Node the keys are moved to.
+    /// @param targetIndex The index the first moved key will be at.
+    /// @param source A pointer to the leaf Node the keys are moved from.
+    /// @param sourceIndex The index of the first moved key.
+    /// @param length The amount of the moved keys.
+    static void MoveEntries(LeafNode* target, const size_t &targetIndex, LeafNode* source, const size_t &sourceIndex, const size_t &length)
+    {
+        if (target != source || targetIndex < sourceIndex)
+        {
+            std::move(source->Keys + sourceIndex, source->Keys + sourceIndex + length, target->Keys + targetIndex);
+            if constexpr (IS_MAPPED)
+            { std::move(source->Values + sourceIndex, source->Values + sourceIndex + length, target->Values + targetIndex); }
+        }
+        else
+        {
+            std::move_backward(source->Keys + sourceIndex, source->Keys + sourceIndex + length, target->Keys + targetIndex + length);
+            if constexpr (IS_MAPPED)
+            {
+                std::move_backward(source->Values + sourceIndex, source->Values + sourceIndex + length,
+                    target->Values + targetIndex + length);
+            }
+        }
+    }
+
+    /// @brief Releases the resources of a vacated key, (and its value), of a leaf Node, if they hold any.
+    /// @param leaf A pointer to the leaf Node.
+    /// @param index The index of the vacated key.
+    static void ResetEntry(LeafNode* leaf, const size_t &index)
+    {
+        if constexpr (!std::is_trivially_destructible_v<TKey>) { leaf->Keys[index] = TKey(); }
+        if constexpr (IS_MAPPED)
+        { if constexpr (!std::is_trivially_destructible_v<TValue>) { leaf->Values[index] = TValue(); } }
+    }
+
+    /// @brief Inserts a key into a leaf Node, splitting it in half if it's full.
+    /// @tparam TKeyArgument The type of the reference of the key, (it's moved if it's an rvalue).
+    /// @param leaf A pointer to the leaf Node.
+    /// @param index The index the key will be at.
+    /// @param key The key that'll be inserted.
+    /// @param split A reference to a variable that'll receive the new leaf Node if it has been split.
+    /// @return A pointer to the leaf Node that holds the key after inserting, (where the index is updated too).
+    template<typename TKeyArgument>
+    LeafNode* InsertIntoLeaf(LeafNode* leaf, size_t &index, TKeyArgument &&key, Split &split)
+    {
+        LeafNode* target = leaf;
+        if (leaf->Count == NODE_CAPACITY)
+        {
+            LeafNode* right = new LeafNode();
+            constexpr size_t LEFT_COUNT = (NODE_CAPACITY + 1) / 2;
+
+            // The key that'll be inserted counts for the half it falls in, so both halves end up balanced.
+            size_t movedIndex = index < LEFT_COUNT ? LEFT_COUNT - 1 : LEFT_COUNT;
+            MoveEntries(right, 0, leaf, movedIndex, NODE_CAPACITY - movedIndex);
+            for (size_t i = movedIndex; i < NODE_CAPACITY; i++) { ResetEntry(leaf, i); }
+            right->Count = NODE_CAPACITY - movedIndex;
+            leaf->Count = movedIndex;
+
+            right->Previous = leaf;
+            right->Next = leaf->Next;
+            if (leaf->Next) { leaf->Next->Previous = right; }
+            else { lastLeaf = right; }
+            leaf->Next = right;
+
+            if (index >= LEFT_COUNT) { target = right; index -= LEFT_COUNT; }
+            split.Right = right;
+        }
+
+        MoveEntries(target, index + 1, target, index, target->Count - index);
+        target->Keys[index] = std::forward<TKeyArgument>(key);
+        if constexpr (IS_MAPPED) { target->Values[index] = TValue(); }
+        target->Count++;
+
+        if (split.Right) { split.Separator = split.Right->Keys[0]; }
+        return target;
+    }
+
+    /// @brief Inserts a separator and its right child into an inner Node after a child of it has been split,
+    /// splitting the inner Node around its middle key if it's full.
+    /// @param node A pointer to the inner Node.
+    /// @param index The index of the child that has been split.
+    /// @param childSplit The result of splitting the child.
+    /// @return The result of splitting the inner Node, (whose new Node is null pointer if it hasn't been split).
+    Split InsertIntoInner(InnerNode* node, const size_t &index, Split &childSplit)
+    {
+        if (node->Count < NODE_CAPACITY)
+        {
+            std::move_backward(node->Keys + index, node->Keys + node->Count, node->Keys + node->Count + 1);
+            std::move_backward(node->Children + index + 1, node->Children + node->Count + 1, node->Children + node->Count + 2);
+            node->Keys[index] = std::move(childSplit.Separator);
+            node->Children[index + 1] = childSplit.Right;
+            node->Count++;
+            return Split();
+        }
+
+        Array<TKey> keys(NODE_CAPACITY + 1);
+        BaseNode* children[NODE_CAPACITY + 2];
+        std::move(node->Keys, node->Keys + index, keys.begin());
+        keys.begin()[index] = std::move(childSplit.Separator);
+        std::move(node->Keys + index, node->Keys + NODE_CAPACITY, keys.begin() + index + 1);
+        std::copy(node->Children, node->Children + index + 1, children);
+        children[index + 1] = childSplit.Right;
+        std::copy(node->Children + index + 1, node->Children + NODE_CAPACITY + 1, children + index + 2);
+
+        constexpr size_t MIDDLE = (NODE_CAPACITY + 1) / 2;
+        InnerNode* right = new InnerNode();
+        std::move(keys.begin(), keys.begin() + MIDDLE, node->Keys);
+        std::copy(children, children + MIDDLE + 1, node->Children);
+        node->Count = MIDDLE;
+
+        std::move(keys.begin() + MIDDLE + 1, keys.end(), right->Keys);
+        std::copy(children + MIDDLE + 1, children + NODE_CAPACITY + 2, right->Children);
+        right->Count = NODE_CAPACITY - MIDDLE;
+
+        Split split;
+        split.Right = right;
+        split.Separator = std::move(keys.begin()[MIDDLE]);
+        return split;
+    }
+
+    /// @brief Refills a child of an inner Node that has fallen below its minimum, by borrowing a key from one
+    /// of its adjacent siblings that has a spare one, or merging it with one of them otherwise.
+    /// @param parent A pointer to the inner Node.
+    /// @param index The index of the child.
+    void Refill(InnerNode* parent, const size_t &index)
+    {
+        BaseNode* child = parent->Children[index];
+        BaseNode* left = index ? parent->Children[index - 1] : nullptr;
+        BaseNode* right = index < parent->Count ? parent->Children[index + 1] : nullptr;
+        size_t minimumCount = child->IsLeaf ? MINIMUM_LEAF_COUNT : MINIMUM_INNER_COUNT;
+
+        if (left && left->Count > minimumCount) { BorrowFromLeft(parent, index); }
+        else if (right && right->Count > minimumCount) { BorrowFromRight(parent, index); }
+        else if (left) { Merge(parent, index - 1); }
+        else { Merge(parent, index); }
+    }
+
+    /// @brief Moves the last key of the left sibling of a child into the child.
+    /// @param parent A pointer to the inner Node of the child.
+    /// @param index The index of the child.
+    void BorrowFromLeft(InnerNode* parent, const size_t &index)
+    {
+        BaseNode* child = parent->Children[index];
+        BaseNode* left = parent->Children[index - 1];
+
+        if (child->IsLeaf)
+        {
+            LeafNode* childLeaf = static_cast<LeafNode*>(child);
+            LeafNode* leftLeaf = static_cast<LeafNode*>(left);
+
+            MoveEntries(childLeaf, 1, childLeaf, 0, childLeaf->Count);
+            MoveEntries(childLeaf, 0, leftLeaf, leftLeaf->Count - 1, 1);
+            ResetEntry(leftLeaf, leftLeaf->Count - 1);
+            parent->Keys[index - 1] = childLeaf->Keys[0];
+        }
+        else
+        {
+            InnerNode* childInner = static_cast<InnerNode*>(child);
+            InnerNode* leftInner = static_cast<InnerNode*>(left);
+
+            std::move_backward(childInner->Keys, childInner->Keys + childInner->Count, childInner->Keys + childInner->Count + 1);
+            std::move_backward(childInner->Children, childInner->Children + childInner->Count + 1,
+                childInner->Children + childInner->Count + 2);
+            childInner->Keys[0] = std::move(parent->Keys[index - 1]);
+            childInner->Children[0] = leftInner->Children[leftInner->Count];
+            parent->Keys[index - 1] = std::move(leftInner->Keys[leftInner->Count - 1]);
+        }
+
+        child->Count++;
+        left->Count--;
+    }
+
+    /// @brief Moves the first key of the right sibling of a child into the child.
+    /// @param parent A pointer to the inner Node of the child.
+    /// @param index The index of the child.
+    void BorrowFromRight(InnerNode* parent, const size_t &index)
+    {
+        BaseNode* child = parent->Children[index];
+        BaseNode* right = parent->Children[index + 1];
+
+        if (child->IsLeaf)
+        {
+            LeafNode* childLeaf = static_cast<LeafNode*>(child);
+            LeafNode* rightLeaf = static_cast<LeafNode*>(right);
+
+            MoveEntries(childLeaf, childLeaf->Count, rightLeaf, 0, 1);
+            MoveEntries(rightLeaf, 0, rightLeaf, 1, rightLeaf->Count - 1);
+            ResetEntry(rightLeaf, rightLeaf->Count - 1);
+            parent->Keys[index] = rightLeaf->Keys[0];
+        }
+        else
+        {
+            InnerNode* childInner = static_cast<InnerNode*>(child);
+            InnerNode* rightInner = static_cast<InnerNode*>(right);
+
+            childInner->Keys[childInner->Count] = std::move(parent->Keys[index]);
+            childInner->Children[childInner->Count + 1] = rightInner->Children[0];
+            parent->Keys[index] = std::move(rightInner->Keys[0]);
+            std::move(rightInner->Keys + 1, rightInner->Keys + rightInner->Count, rightInner->Keys);
+            std::move(rightInner->Children + 1, rightInner->Children + rightInner->Count + 1, rightInner->Children);
+        }
+
+        child->Count++;
+        right->Count--;
+    }
+
+    /// @brief Merges a child of an inner Node with its right sibling, and removes their separator.
+    /// @param parent A pointer to the inner Node of the children.
+    /// @param index The index of the left child.
+    void Merge(InnerNode* parent, const size_t &index)
+    {
+        BaseNode* left = parent->Children[index];
+        BaseNode* right = parent->Children[index + 1];
+
+        if (left->IsLeaf)
+        {
+            LeafNode* leftLeaf = static_cast<LeafNode*>(left);
+            LeafNode* rightLeaf = static_cast<LeafNode*>(right);
+
+            MoveEntries(leftLeaf, leftLeaf->Count, rightLeaf, 0, rightLeaf->Count);
+            leftLeaf->Count += rightLeaf->Count;
+
+            leftLeaf->Next = rightLeaf->Next;
+            if (rightLeaf->Next) { rightLeaf->Next->Previous = leftLeaf; }
+            else { lastLeaf = leftLeaf; }
+            delete rightLeaf;
+        }
+        else
+        {
+            InnerNode* leftInner = static_cast<InnerNode*>(left);
+            InnerNode* rightInner = static_cast<InnerNode*>(right);
+
+            leftInner->Keys[leftInner->Count] = std::move(parent->Keys[index]);
+            std::move(rightInner->Keys, rightInner->Keys + rightInner->Count, leftInner->Keys + leftInner->Count + 1);
+            std::copy(rightInner->Children, rightInner->Children + rightInner->Count + 1, leftInner->Children + leftInner->Count + 1);
+            leftInner->Count += rightInner->Count + 1;
+            delete rightInner;
+        }
+
+        std::move(parent->Keys + index + 1, parent->Keys + parent->Count, parent->Keys + index);
+        std::move(parent->Children + index + 2, parent->Children + parent->Count + 1, parent->Children + index + 1);
+        parent->Count--;
+    }
+
+    /// @brief Deletes a Node and every Node under it.
+    /// @param node A pointer to the Node, or null pointer.
+    static void Free(BaseNode* node)
+    {
+        if (!node) { return; }
+        if (node->IsLeaf) { delete static_cast<LeafNode*>(node); return; }
+
+        InnerNode* inner = static_cast<InnerNode*>(node);
+        for (size_t i = 0; i <= inner->Count; i++) { Free(inner->Children[i]); }
+        delete inner;
+    }
+
+public:
+    /// @brief Gets the amount of keys within the B+ Tree.
+    /// @return The amount of keys within the B+ Tree.
+    size_t Count() const { return count; }
+
+    /// @brief Checks whether or not the B+ Tree is empty.
+    /// @return A boolean representing whether or not the B+ Tree is empty.
+    bool IsEmpty() const { return !count; }
+
+    /// @brief Gets the amount of levels of the B+ Tree, which is the amount of Nodes a lookup touches.
+    /// @return The amount of levels of the B+ Tree, (zero if it's empty).
+    size_t Height() const { return height; }
+
+    /// @brief The beginning of the B+ Tree.
+    /// @return The Iterator at the least key.
+    Iterator begin() const { return Iterator(firstLeaf, 0, lastLeaf); }
+    /// @brief The end of the B+ Tree.
+    /// @return The Iterator past the greatest key.
+    Iterator end() const { return Iterator(nullptr, 0, lastLeaf); }
+
+    /// @brief Searches for the first key that isn't less than a key.
+    /// @param key The searched key.
+    /// @return The Iterator at the first key that isn't less, or the end if there's none.
+    Iterator LowerBound(const TKey &key) const
+    {
+        LeafNode* leaf = LeafOf(key);
+        return IteratorAt(leaf, leaf ? LowerBoundIn(leaf, key) : 0);
+    }
+
+    /// @brief Searches for the first key that's greater than a key.
+    /// @param key The searched key.
+    /// @return The Iterator at the first key that's greater, or the end if there's none.
+    Iterator UpperBound(const TKey &key) const
+    {
+        LeafNode* leaf = LeafOf(key);
+        return IteratorAt(leaf, leaf ? UpperBoundIn(leaf, key) : 0);
+    }
+
+    /// @brief Makes a lazy View of the keys within a range, which walks through its leaf Nodes in order.
+    /// @param low The least key of the range, (it's included).
+    /// @param high The key past the range, (it's excluded).
+    /// @return The Range View of the keys that aren't less than the low key and are less than the high one.
+    RangeView<Iterator> Range(const TKey &low, const TKey &high) const
+    {
+        if (!comparer(low, high)) { return RangeView<Iterator>(end(), end()); }
+        return RangeView<Iterator>(LowerBound(low), LowerBound(high));
+    }
+
+    /// @brief Searches for a key within the B+ Tree.
+    /// @param key The searched key.
+    /// @return The Iterator at the key, or the end if it isn't there.
+    Iterator Find(const TKey &key) const
+    {
+        size_t index = 0;
+        LeafNode* leaf = Search(key, index);
+        return leaf ? Iterator(leaf, index, lastLeaf) : end();
+    }
+
+    /// @brief Removes every key from the B+ Tree.
+    void Clear()
+    {
+        Free(root);
+        root = nullptr;
+        firstLeaf = lastLeaf = nullptr;
+        count = height = 0;
+    }
+};
+
+#endif
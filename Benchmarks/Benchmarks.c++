@@ -0,0 +1,1101 @@
+#include<iostream>
+
+#include<algorithm>
+#include<atomic>
+#include<chrono>
+#include<cstdint>
+#include<fstream>
+#include<functional>
+#include<iterator>
+#include<list>
+#include<map>
+#include<mutex>
+#include<numeric>
+#include<queue>
+#include<random>
+#include<set>
+#include<stack>
+#include<string>
+#include<thread>
+#include<unordered_map>
+#include<unordered_set>
+#include<vector>
+
+#include "../Array.c++"
+#include "../DynamicArray.c++"
+#include "../LinkedList.c++"
+#include "../LruCache.c++"
+#include "../HashTable.c++"
+#include "../ConcurrentHashTable.c++"
+#include "../BloomFilter.c++"
+#include "../CuckooFilter.c++"
+#include "../PriorityQueue.c++"
+#include "../Queue.c++"
+#include "../Stack.c++"
+#include "../SmallList.c++"
+#include "../SortedMap.c++"
+#include "../SortedSet.c++"
+#include "../SparseArray.c++"
+#include "../Algorithms/MurmurHashingAlgorithm.c++"
+
+/// @brief The least amount of measured time a benchmark is repeated for at each size, so the results
+/// of the smaller sizes aren't just the noise of the clock.
+constexpr double MINIMUM_MEASURING_SECONDS = 0.05;
+/// @brief The most times a benchmark is repeated at each size.
+constexpr size_t MAXIMUM_REPETITION_COUNT = 1000;
+/// @brief The amount of elements the operations that go through a container, (like inserting in the middle),
+/// walk through in total at each size, so the larger sizes run fewer of them instead of running for hours.
+constexpr size_t LINEAR_WORK_LENGTH = 1 << 24;
+/// @brief The largest size of the containers that allocate a node for each element, which would take
+/// gigabytes of memory beyond it.
+constexpr size_t MAXIMUM_NODE_CONTAINER_SIZE = 10000000;
+
+/// @brief The measurement of a single operation of a container at a single size.
+struct BenchmarkResult
+{
+    /// @brief The name of the measured operation.
+    std::string Name;
+    /// @brief The container that ran the operation, (either "DataStructures" or its "std" equivalent).
+    std::string Implementation;
+    /// @brief The amount of elements within the container.
+    size_t Size;
+    /// @brief The amount of operations run within each repetition.
+    size_t OperationCount;
+    /// @brief The amount of times the operations have been repeated.
+    size_t RepetitionCount;
+    /// @brief The average time of a single operation.
+    double NanosecondsPerOperation;
+};
+
+/// @brief Measures the time of the parts of a benchmark that are run between its starts and stops,
+/// so preparing the containers isn't measured.
+class Stopwatch
+{
+public:
+    /// @brief Starts measuring the time.
+    void Start() { start = std::chrono::steady_clock::now(); }
+    /// @brief Stops measuring the time, and adds the time since the last start to the total.
+    void Stop() { seconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count(); }
+    /// @brief The total measured time.
+    /// @return The seconds measured by the Stopwatch.
+    double Seconds() const { return seconds; }
+
+private:
+    /// @brief The time of the last start.
+    std::chrono::steady_clock::time_point start;
+    /// @brief The total measured time.
+    double seconds = 0;
+};
+
+/// @brief A benchmark of an operation, that's run for every size.
+struct Benchmark
+{
+    /// @brief The name of the measured operation.
+    std::string Name;
+    /// @brief The largest size the benchmark is run at.
+    size_t MaximumSize;
+    /// @brief A function that takes a size, and measures both the container and its "std" equivalent at it.
+    std::function<void(const size_t &size, std::vector<BenchmarkResult> &results)> Run;
+};
+
+/// @brief Keeps the compiler from optimizing a value, (and the work that computed it), away.
+/// @tparam T The type of the value.
+/// @param value The value that'll be kept.
+template<typename T>
+inline void KeepValue(const T &value)
+{
+#if defined(__GNUC__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    static volatile const void* keptValue;
+    keptValue = &value;
+#endif
+}
+
+/// @brief Runs a benchmark body repeatedly until enough time has been measured, and records the result.
+/// @tparam TBody The type of the function that runs the operations once.
+/// @param results The results the measurement is added to.
+/// @param name The name of the measured operation.
+/// @param implementation The container that runs the operation.
+/// @param size The amount of elements within the container.
+/// @param operationCount The amount of operations that the body runs.
+/// @param body A function that takes a Stopwatch, and runs the operations between its start and stop.
+template<typename TBody>
+void Measure(std::vector<BenchmarkResult> &results, const std::string &name, const std::string &implementation,
+    const size_t &size, const size_t &operationCount, const TBody &body)
+{
+    Stopwatch stopwatch;
+    size_t repetitionCount = 0;
+    while (stopwatch.Seconds() < MINIMUM_MEASURING_SECONDS && repetitionCount < MAXIMUM_REPETITION_COUNT)
+    {
+        body(stopwatch);
+        repetitionCount++;
+    }
+
+    results.push_back({ name, implementation, size, operationCount, repetitionCount,
+        stopwatch.Seconds() * 1e9 / (double)(repetitionCount * std::max(operationCount, (size_t)1)) });
+}
+
+/// @brief The amount of operations that go through a container to run at a size.
+/// @param size The amount of elements within the container.
+/// @return The amount of operations.
+size_t LinearOperationCount(const size_t &size) { return std::clamp(LINEAR_WORK_LENGTH / size, (size_t)1, size); }
+
+/// @brief Makes random numbers that are the same for every run.
+/// @param count The amount of numbers.
+/// @param limit The number that all of them are below, (or any number if zero).
+/// @return A vector of the random numbers.
+std::vector<long> RandomNumbers(const size_t &count, const uint64_t &limit = 0)
+{
+    std::mt19937_64 random(count);
+    std::vector<long> numbers(count);
+    for (long &number : numbers) { number = (long)(limit ? random() % limit : random() >> 1); }
+    return numbers;
+}
+
+/// @brief Makes all of the benchmarks, one for each measured operation.
+/// @return A vector of the benchmarks.
+std::vector<Benchmark> MakeBenchmarks()
+{
+    using Results = std::vector<BenchmarkResult>;
+    std::vector<Benchmark> benchmarks;
+
+    benchmarks.push_back({ "DynamicArray::Add", SIZE_MAX, [](const size_t &size, Results &results)
+    {
+        Measure(results, "DynamicArray::Add", "DataStructures", size, size, [&](Stopwatch &stopwatch)
+        {
+            stopwatch.Start();
+            DynamicArray<int> dynamicArray;
+            for (size_t i = 0; i < size; i++) { dynamicArray.Add((int)i); }
+            KeepValue(dynamicArray.begin()[size - 1]);
+            stopwatch.Stop();
+        });
+
+        Measure(results, "DynamicArray::Add", "std", size, size, [&](Stopwatch &stopwatch)
+        {
+            stopwatch.Start();
+            std::vector<int> vector;
+            for (size_t i = 0; i < size; i++) { vector.push_back((int)i); }
+            KeepValue(vector[size - 1]);
+            stopwatch.Stop();
+        });
+    } });
+
+    benchmarks.push_back({ "DynamicArray::Insert", SIZE_MAX, [](const size_t &size, Results &results)
+    {
+        size_t operationCount = LinearOperationCount(size);
+        Array<int> elements(size, 1);
+
+        Measure(results, "DynamicArray::Insert", "DataStructures", size, operationCount, [&](Stopwatch &stopwatch)
+        {
+            DynamicArray<int> dynamicArray(elements);
+            stopwatch.Start();
+            for (size_t i = 0; i < operationCount; i++) { dynamicArray.Insert((int)i, (size + i) / 2); }
+            stopwatch.Stop();
+            KeepValue(dynamicArray.begin()[0]);
+        });
+
+        Measure(results, "DynamicArray::Insert", "std", size, operationCount, [&](Stopwatch &stopwatch)
+        {
+            std::vector<int> vector(elements.begin(), elements.end());
+            stopwatch.Start();
+            for (size_t i = 0; i < operationCount; i++) { vector.insert(vector.begin() + (size + i) / 2, (int)i); }
+            stopwatch.Stop();
+            KeepValue(vector[0]);
+        });
+    } });
+
+    benchmarks.push_back({ "DynamicArray::RemoveAt", SIZE_MAX, [](const size_t &size, Results &results)
+    {
+        size_t operationCount = LinearOperationCount(size);
+        Array<int> elements(size, 1);
+
+        Measure(results, "DynamicArray::RemoveAt", "DataStructures", size, operationCount, [&](Stopwatch &stopwatch)
+        {
+            DynamicArray<int> dynamicArray(elements);
+            stopwatch.Start();
+            for (size_t i = 0; i < operationCount; i++) { dynamicArray.RemoveAt((size - i) / 2); }
+            stopwatch.Stop();
+            KeepValue(dynamicArray.Count());
+        });
+
+        Measure(results, "DynamicArray::RemoveAt", "std", size, operationCount, [&](Stopwatch &stopwatch)
+        {
+            std::vector<int> vector(elements.begin(), elements.end());
+            stopwatch.Start();
+            for (size_t i = 0; i < operationCount; i++) { vector.erase(vector.begin() + (size - i) / 2); }
+            stopwatch.Stop();
+            KeepValue(vector.size());
+        });
+    } });
+
+    benchmarks.push_back({ "LinkedList::Add", MAXIMUM_NODE_CONTAINER_SIZE, [](const size_t &size, Results &results)
+    {
+        Measure(results, "LinkedList::Add", "DataStructures", size, size, [&](Stopwatch &stopwatch)
+        {
+            LinkedList<int> linkedList;
+            stopwatch.Start();
+            for (size_t i = 0; i < size; i++) { linkedList.Add((int)i); }
+            stopwatch.Stop();
+            KeepValue(linkedList.Tail()->Data);
+        });
+
+        Measure(results, "LinkedList::Add", "std", size, size, [&](Stopwatch &stopwatch)
+        {
+            std::list<int> list;
+            stopwatch.Start();
+            for (size_t i = 0; i < size; i++) { list.push_back((int)i); }
+            stopwatch.Stop();
+            KeepValue(list.back());
+        });
+    } });
+
+    benchmarks.push_back({ "LinkedList::NodeAt", MAXIMUM_NODE_CONTAINER_SIZE, [](const size_t &size, Results &results)
+    {
+        size_t operationCount = LinearOperationCount(size);
+        std::vector<long> indices = RandomNumbers(operationCount, size);
+
+        LinkedList<int> linkedList;
+        std::list<int> list;
+        for (size_t i = 0; i < size; i++) { linkedList.Add((int)i); list.push_back((int)i); }
+
+        Measure(results, "LinkedList::NodeAt", "DataStructures", size, operationCount, [&](Stopwatch &stopwatch)
+        {
+            stopwatch.Start();
+            for (long index : indices) { KeepValue(linkedList.NodeAt((size_t)index)->Data); }
+            stopwatch.Stop();
+        });
+
+        Measure(results, "LinkedList::NodeAt", "std", size, operationCount, [&](Stopwatch &stopwatch)
+        {
+            stopwatch.Start();
+            for (long index : indices) { KeepValue(*std::next(list.begin(), index)); }
+            stopwatch.Stop();
+        });
+    } });
+
+    benchmarks.push_back({ "LinkedList::Singularize", MAXIMUM_NODE_CONTAINER_SIZE, [](const size_t &size, Results &results)
+    {
+        // About a tenth of the values are distinct, so most of the Nodes get removed.
+        std::vector<long> numbers = RandomNumbers(size, std::max(size / 10, (size_t)1));
+
+        Measure(results, "LinkedList::Singularize", "DataStructures", size, size, [&](Stopwatch &stopwatch)
+        {
+            LinkedList<long> linkedList;
+            for (long number : numbers) { linkedList.Add(number); }
+            stopwatch.Start();
+            KeepValue(linkedList.Singularize());
+            stopwatch.Stop();
+        });
+
+        Measure(results, "LinkedList::Singularize", "std", size, size, [&](Stopwatch &stopwatch)
+        {
+            std::list<long> list(numbers.begin(), numbers.end());
+            stopwatch.Start();
+            std::unordered_set<long> seenNumbers;
+            list.remove_if([&](const long &number) { return !seenNumbers.insert(number).second; });
+            KeepValue(list.size());
+            stopwatch.Stop();
+        });
+    } });
+
+    benchmarks.push_back({ "LinkedList::Remove", MAXIMUM_NODE_CONTAINER_SIZE, [](const size_t &size, Results &results)
+    {
+        size_t operationCount = LinearOperationCount(size);
+        std::vector<long> values = RandomNumbers(operationCount, size);
+
+        Measure(results, "LinkedList::Remove", "DataStructures", size, operationCount, [&](Stopwatch &stopwatch)
+        {
+            LinkedList<int> linkedList;
+            for (size_t i = 0; i < size; i++) { linkedList.Add((int)i); }
+
+            stopwatch.Start();
+            for (long value : values) { KeepValue(linkedList.Remove((int)value)); }
+            stopwatch.Stop();
+        });
+
+        Measure(results, "LinkedList::Remove", "std", size, operationCount, [&](Stopwatch &stopwatch)
+        {
+            std::list<int> list;
+            for (size_t i = 0; i < size; i++) { list.push_back((int)i); }
+
+            stopwatch.Start();
+            for (long value : values)
+            {
+                auto iterator = std::find(list.begin(), list.end(), (int)value);
+                if (iterator != list.end()) { list.erase(iterator); }
+            }
+            stopwatch.Stop();
+            KeepValue(list.size());
+        });
+    } });
+
+    benchmarks.push_back({ "HashTable::Set", MAXIMUM_NODE_CONTAINER_SIZE, [](const size_t &size, Results &results)
+    {
+        std::vector<long> keys = RandomNumbers(size);
+
+        Measure(results, "HashTable::Set", "DataStructures", size, size, [&](Stopwatch &stopwatch)
+        {
+            stopwatch.Start();
+            HashTable<long, long> hashTable;
+            for (long key : keys) { hashTable.Set(key, key); }
+            KeepValue(hashTable.Count());
+            stopwatch.Stop();
+        });
+
+        Measure(results, "HashTable::Set", "std", size, size, [&](Stopwatch &stopwatch)
+        {
+            stopwatch.Start();
+            std::unordered_map<long, long> unorderedMap;
+            for (long key : keys) { unorderedMap.insert_or_assign(key, key); }
+            KeepValue(unorderedMap.size());
+            stopwatch.Stop();
+        });
+    } });
+
+    benchmarks.push_back({ "HashTable::Get", MAXIMUM_NODE_CONTAINER_SIZE, [](const size_t &size, Results &results)
+    {
+        std::vector<long> keys = RandomNumbers(size), shuffledKeys = keys;
+        std::shuffle(shuffledKeys.begin(), shuffledKeys.end(), std::mt19937_64(size));
+
+        HashTable<long, long> hashTable;
+        std::unordered_map<long, long> unorderedMap;
+        for (long key : keys) { hashTable.Set(key, key); unorderedMap.insert_or_assign(key, key); }
+
+        Measure(results, "HashTable::Get", "DataStructures", size, size, [&](Stopwatch &stopwatch)
+        {
+            const HashTable<long, long> &constHashTable = hashTable;
+            stopwatch.Start();
+            for (long key : shuffledKeys) { KeepValue(constHashTable.Get(key)); }
+            stopwatch.Stop();
+        });
+
+        Measure(results, "HashTable::Get", "std", size, size, [&](Stopwatch &stopwatch)
+        {
+            stopwatch.Start();
+            for (long key : shuffledKeys) { KeepValue(unorderedMap.find(key)->second); }
+            stopwatch.Stop();
+        });
+    } });
+
+    benchmarks.push_back({ "HashTable::GetMany", MAXIMUM_NODE_CONTAINER_SIZE, [](const size_t &size, Results &results)
+    {
+        std::vector<long> keys = RandomNumbers(size), shuffledKeys = keys;
+        std::shuffle(shuffledKeys.begin(), shuffledKeys.end(), std::mt19937_64(size));
+
+        HashTable<long, long> hashTable;
+        for (long key : keys) { hashTable.Set(key, key); }
+
+        // The lookups go in batches of a thousand keys, like a request handler would issue them.
+        constexpr size_t BATCH_LENGTH = 1024;
+        Array<long> batchKeys(std::min(size, BATCH_LENGTH)), batchValues;
+        size_t batchCount = size / batchKeys.Length();
+
+        Measure(results, "HashTable::GetMany", "DataStructures", size, batchCount * batchKeys.Length(), [&](Stopwatch &stopwatch)
+        {
+            stopwatch.Start();
+            for (size_t i = 0; i < batchCount; i++)
+            {
+                std::copy_n(shuffledKeys.begin() + i * batchKeys.Length(), batchKeys.Length(), batchKeys.begin());
+                hashTable.GetMany(batchKeys, batchValues);
+                KeepValue(batchValues.begin()[0]);
+            }
+            stopwatch.Stop();
+        });
+
+        Measure(results, "HashTable::GetMany", "Get", size, batchCount * batchKeys.Length(), [&](Stopwatch &stopwatch)
+        {
+            const HashTable<long, long> &constHashTable = hashTable;
+            stopwatch.Start();
+            for (size_t i = 0; i < batchCount; i++)
+            {
+                std::copy_n(shuffledKeys.begin() + i * batchKeys.Length(), batchKeys.Length(), batchKeys.begin());
+                for (long key : batchKeys) { KeepValue(constHashTable.Get(key)); }
+            }
+            stopwatch.Stop();
+        });
+    } });
+
+    benchmarks.push_back({ "HashTable::Has", MAXIMUM_NODE_CONTAINER_SIZE, [](const size_t &size, Results &results)
+    {
+        // Every other searched key is missing, (the odd keys are never set).
+        std::vector<long> keys = RandomNumbers(size);
+        for (long &key : keys) { key &= ~1L; }
+
+        HashTable<long, long> hashTable;
+        std::unordered_map<long, long> unorderedMap;
+        for (long key : keys) { hashTable.Set(key, key); unorderedMap.insert_or_assign(key, key); }
+
+        Measure(results, "HashTable::Has", "DataStructures", size, size, [&](Stopwatch &stopwatch)
+        {
+            const HashTable<long, long> &constHashTable = hashTable;
+            stopwatch.Start();
+            for (size_t i = 0; i < size; i++) { KeepValue(constHashTable.Has(keys[i] | (long)(i & 1))); }
+            stopwatch.Stop();
+        });
+
+        Measure(results, "HashTable::Has", "std", size, size, [&](Stopwatch &stopwatch)
+        {
+            stopwatch.Start();
+            for (size_t i = 0; i < size; i++) { KeepValue(unorderedMap.count(keys[i] | (long)(i & 1))); }
+            stopwatch.Stop();
+        });
+    } });
+
+    benchmarks.push_back({ "HashTable::Has (Mostly Missing)", MAXIMUM_NODE_CONTAINER_SIZE, [](const size_t &size, Results &results)
+    {
+        // Nine of every ten searched keys are missing, (only the keys that are multiples of ten are set).
+        std::vector<long> keys = RandomNumbers(size);
+        for (long &key : keys) { key -= key % 10; }
+
+        HashTable<long, long> hashTable, filteredHashTable;
+        std::unordered_map<long, long> unorderedMap;
+        for (long key : keys) { hashTable.Set(key, key); filteredHashTable.Set(key, key); unorderedMap.insert_or_assign(key, key); }
+        filteredHashTable.EnableFilter();
+
+        auto measure = [&](const std::string &implementation, const HashTable<long, long> &table)
+        {
+            Measure(results, "HashTable::Has (Mostly Missing)", implementation, size, size, [&](Stopwatch &stopwatch)
+            {
+                stopwatch.Start();
+                for (size_t i = 0; i < size; i++) { KeepValue(table.Has(keys[i] + (long)(i % 10))); }
+                stopwatch.Stop();
+            });
+        };
+
+        measure("DataStructures", hashTable);
+        measure("DataStructures Filtered", filteredHashTable);
+
+        Measure(results, "HashTable::Has (Mostly Missing)", "std", size, size, [&](Stopwatch &stopwatch)
+        {
+            stopwatch.Start();
+            for (size_t i = 0; i < size; i++) { KeepValue(unorderedMap.count(keys[i] + (long)(i % 10))); }
+            stopwatch.Stop();
+        });
+    } });
+
+    benchmarks.push_back({ "Filter::MayContain", SIZE_MAX, [](const size_t &size, Results &results)
+    {
+        // Every other checked element is missing, (the odd elements are never added).
+        std::vector<long> elements = RandomNumbers(size);
+        for (long &element : elements) { element &= ~1L; }
+
+        BloomFilter<long> bloomFilter(size);
+        CuckooFilter<long> cuckooFilter(size);
+        std::unordered_set<long> unorderedSet;
+        for (long element : elements) { bloomFilter.Add(element); cuckooFilter.Add(element); unorderedSet.insert(element); }
+
+        Measure(results, "Filter::MayContain", "BloomFilter", size, size, [&](Stopwatch &stopwatch)
+        {
+            stopwatch.Start();
+            for (size_t i = 0; i < size; i++) { KeepValue(bloomFilter.MayContain(elements[i] | (long)(i & 1))); }
+            stopwatch.Stop();
+        });
+
+        Measure(results, "Filter::MayContain", "CuckooFilter", size, size, [&](Stopwatch &stopwatch)
+        {
+            stopwatch.Start();
+            for (size_t i = 0; i < size; i++) { KeepValue(cuckooFilter.MayContain(elements[i] | (long)(i & 1))); }
+            stopwatch.Stop();
+        });
+
+        Measure(results, "Filter::MayContain", "std", size, size, [&](Stopwatch &stopwatch)
+        {
+            stopwatch.Start();
+            for (size_t i = 0; i < size; i++) { KeepValue(unorderedSet.count(elements[i] | (long)(i & 1))); }
+            stopwatch.Stop();
+        });
+    } });
+
+    benchmarks.push_back({ "ConcurrentHashTable::Mixed", 1000000, [](const size_t &size, Results &results)
+    {
+        std::vector<long> keys = RandomNumbers(size);
+        ConcurrentHashTable<long, long> concurrentHashTable(size);
+        HashTable<long, long> hashTable;
+        std::mutex mutex;
+        for (long key : keys) { concurrentHashTable.Set(key, key); hashTable.Set(key, key); }
+
+        // The threads share a fixed amount of operations, so the time of an operation falls as they scale.
+        constexpr size_t OPERATION_COUNT = 1 << 18;
+
+        // Runs the operations on a few threads that are all started at once, where each one reads
+        // a percentage of the time, and writes the rest of it.
+        auto measureThreads = [&](const std::string &implementation, const size_t &threadCount, const size_t &readPercentage,
+            const std::function<void(const long &key, const bool &isRead)> &operation)
+        {
+            Measure(results, "ConcurrentHashTable::Mixed", implementation + " " + std::to_string(threadCount) + " threads "
+                + std::to_string(readPercentage) + "% reads", size, OPERATION_COUNT, [&](Stopwatch &stopwatch)
+            {
+                std::atomic<bool> isStarted(false);
+                std::vector<std::thread> threads;
+                for (size_t t = 0; t < threadCount; t++)
+                {
+                    threads.emplace_back([&, t]()
+                    {
+                        std::mt19937_64 random(t);
+                        while (!isStarted.load(std::memory_order_acquire)) { std::this_thread::yield(); }
+                        for (size_t i = t; i < OPERATION_COUNT; i += threadCount)
+                        { operation(keys[random() % keys.size()], random() % 100 < readPercentage); }
+                    });
+                }
+
+                stopwatch.Start();
+                isStarted.store(true, std::memory_order_release);
+                for (std::thread &thread : threads) { thread.join(); }
+                stopwatch.Stop();
+            });
+        };
+
+        for (size_t readPercentage : { 50, 90, 99 })
+        {
+            for (size_t threadCount = 1; threadCount <= 64; threadCount *= 2)
+            {
+                measureThreads("DataStructures", threadCount, readPercentage, [&](const long &key, const bool &isRead)
+                {
+                    if (isRead) { long value; KeepValue(concurrentHashTable.TryGet(key, value)); }
+                    else { concurrentHashTable.Update(key, [](long &value) { value++; }); }
+                });
+
+                measureThreads("Mutex", threadCount, readPercentage, [&](const long &key, const bool &isRead)
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    if (isRead) { KeepValue(hashTable.Has(key)); }
+                    else { hashTable.Set(key, key + 1); }
+                });
+            }
+        }
+    } });
+
+    benchmarks.push_back({ "LruCache::Get/Put", MAXIMUM_NODE_CONTAINER_SIZE, [](const size_t &size, Results &results)
+    {
+        // The keys are drawn from twice the capacity, skewed towards the smaller ones, so about half of the
+        // lookups miss and put their key, evicting the least recently used one.
+        size_t operationCount = std::min(size, (size_t)1 << 20);
+        std::vector<long> keys = RandomNumbers(operationCount, size);
+        for (long &key : keys) { key = key * key / (long)size * 2; }
+
+        Measure(results, "LruCache::Get/Put", "DataStructures", size, operationCount, [&](Stopwatch &stopwatch)
+        {
+            LruCache<long, long> cache(size);
+            stopwatch.Start();
+            for (long key : keys)
+            {
+                long* value = cache.Find(key);
+                if (value) { KeepValue(*value); }
+                else { cache.Put(key, key); }
+            }
+            stopwatch.Stop();
+        });
+
+        Measure(results, "LruCache::Get/Put", "std", size, operationCount, [&](Stopwatch &stopwatch)
+        {
+            std::list<std::pair<long, long>> entries;
+            std::unordered_map<long, std::list<std::pair<long, long>>::iterator> index;
+            stopwatch.Start();
+            for (long key : keys)
+            {
+                auto found = index.find(key);
+                if (found != index.end())
+                {
+                    entries.splice(entries.end(), entries, found->second);
+                    KeepValue(found->second->second);
+                    continue;
+                }
+
+                if (entries.size() == size) { index.erase(entries.front().first); entries.pop_front(); }
+                index.emplace(key, entries.insert(entries.end(), { key, key }));
+            }
+            stopwatch.Stop();
+        });
+    } });
+
+    benchmarks.push_back({ "SortedMap::Set", MAXIMUM_NODE_CONTAINER_SIZE, [](const size_t &size, Results &results)
+    {
+        std::vector<long> keys = RandomNumbers(size);
+
+        Measure(results, "SortedMap::Set", "DataStructures", size, size, [&](Stopwatch &stopwatch)
+        {
+            stopwatch.Start();
+            SortedMap<long, long> sortedMap;
+            for (long key : keys) { sortedMap.Set(key, key); }
+            KeepValue(sortedMap.Count());
+            stopwatch.Stop();
+        });
+
+        Measure(results, "SortedMap::Set", "std", size, size, [&](Stopwatch &stopwatch)
+        {
+            stopwatch.Start();
+            std::map<long, long> map;
+            for (long key : keys) { map.insert_or_assign(key, key); }
+            KeepValue(map.size());
+            stopwatch.Stop();
+        });
+    } });
+
+    benchmarks.push_back({ "SortedMap::LowerBound", MAXIMUM_NODE_CONTAINER_SIZE, [](const size_t &size, Results &results)
+    {
+        // The searched keys are mostly missing, so every lookup descends down to a leaf Node.
+        std::vector<long> keys = RandomNumbers(size), searchedKeys(keys.rbegin(), keys.rend());
+        for (long &key : searchedKeys) { key++; }
+
+        SortedMap<long, long> sortedMap;
+        std::map<long, long> map;
+        for (long key : keys) { sortedMap.Set(key, key); map.insert_or_assign(key, key); }
+
+        Measure(results, "SortedMap::LowerBound", "DataStructures", size, size, [&](Stopwatch &stopwatch)
+        {
+            stopwatch.Start();
+            for (long key : searchedKeys)
+            {
+                SortedMap<long, long>::Iterator iterator = sortedMap.LowerBound(key);
+                KeepValue(iterator != sortedMap.end() ? iterator.Value() : 0);
+            }
+            stopwatch.Stop();
+        });
+
+        Measure(results, "SortedMap::LowerBound", "std", size, size, [&](Stopwatch &stopwatch)
+        {
+            stopwatch.Start();
+            for (long key : searchedKeys)
+            {
+                std::map<long, long>::iterator iterator = map.lower_bound(key);
+                KeepValue(iterator != map.end() ? iterator->second : 0);
+            }
+            stopwatch.Stop();
+        });
+    } });
+
+    benchmarks.push_back({ "SortedSet::Range", MAXIMUM_NODE_CONTAINER_SIZE, [](const size_t &size, Results &results)
+    {
+        // Each range spans about a hundred elements, which walks through the linked leaf Nodes.
+        constexpr long RANGE_WIDTH = 100;
+        std::vector<long> elements = RandomNumbers(size, size), lows(elements.rbegin(), elements.rend());
+        size_t operationCount = LinearOperationCount(size / (size_t)RANGE_WIDTH + 1);
+
+        std::sort(elements.begin(), elements.end());
+        SortedSet<long> sortedSet(Array<long>(elements.size(), elements.data()));
+        std::set<long> set(elements.begin(), elements.end());
+
+        Measure(results, "SortedSet::Range", "DataStructures", size, operationCount, [&](Stopwatch &stopwatch)
+        {
+            stopwatch.Start();
+            for (size_t i = 0; i < operationCount; i++)
+            {
+                long low = lows[i % lows.size()], sum = 0;
+                for (long element : sortedSet.Range(low, low + RANGE_WIDTH)) { sum += element; }
+                KeepValue(sum);
+            }
+            stopwatch.Stop();
+        });
+
+        Measure(results, "SortedSet::Range", "std", size, operationCount, [&](Stopwatch &stopwatch)
+        {
+            stopwatch.Start();
+            for (size_t i = 0; i < operationCount; i++)
+            {
+                long low = lows[i % lows.size()], sum = 0;
+                for (auto iterator = set.lower_bound(low), last = set.lower_bound(low + RANGE_WIDTH); iterator != last; ++iterator)
+                { sum += *iterator; }
+                KeepValue(sum);
+            }
+            stopwatch.Stop();
+        });
+    } });
+
+    benchmarks.push_back({ "Queue::Push/Pop", SIZE_MAX, [](const size_t &size, Results &results)
+    {
+        Measure(results, "Queue::Push/Pop", "DataStructures", size, size * 2, [&](Stopwatch &stopwatch)
+        {
+            stopwatch.Start();
+            Queue<int> queue;
+            for (size_t i = 0; i < size; i++) { queue.Push((int)i); }
+            for (size_t i = 0; i < size; i++) { KeepValue(queue.Pop()); }
+            stopwatch.Stop();
+        });
+
+        Measure(results, "Queue::Push/Pop", "std", size, size * 2, [&](Stopwatch &stopwatch)
+        {
+            stopwatch.Start();
+            std::queue<int> queue;
+            for (size_t i = 0; i < size; i++) { queue.push((int)i); }
+            for (size_t i = 0; i < size; i++) { KeepValue(queue.front()); queue.pop(); }
+            stopwatch.Stop();
+        });
+    } });
+
+    benchmarks.push_back({ "PriorityQueue::Push/Pop", SIZE_MAX, [](const size_t &size, Results &results)
+    {
+        std::vector<long> values = RandomNumbers(size, size);
+
+        Measure(results, "PriorityQueue::Push/Pop", "DataStructures", size, size * 2, [&](Stopwatch &stopwatch)
+        {
+            stopwatch.Start();
+            PriorityQueue<long> queue;
+            for (size_t i = 0; i < size; i++) { queue.Push(values[i]); }
+            for (size_t i = 0; i < size; i++) { KeepValue(queue.Pop()); }
+            stopwatch.Stop();
+        });
+
+        Measure(results, "PriorityQueue::Push/Pop", "std", size, size * 2, [&](Stopwatch &stopwatch)
+        {
+            stopwatch.Start();
+            std::priority_queue<long, std::vector<long>, std::greater<long>> queue;
+            for (size_t i = 0; i < size; i++) { queue.push(values[i]); }
+            for (size_t i = 0; i < size; i++) { KeepValue(queue.top()); queue.pop(); }
+            stopwatch.Stop();
+        });
+    } });
+
+    benchmarks.push_back({ "IndexedPriorityQueue::DecreaseKey", SIZE_MAX, [](const size_t &size, Results &results)
+    {
+        // Every element gets its key decreased once before all of them are popped, (like the relaxations of Dijkstra's
+        // algorithm), where std::priority_queue pushes the decreased keys again and skips the stale ones.
+        std::vector<long> values = RandomNumbers(size, size), decreases(values.rbegin(), values.rend());
+
+        Measure(results, "IndexedPriorityQueue::DecreaseKey", "DataStructures", size, size * 3, [&](Stopwatch &stopwatch)
+        {
+            stopwatch.Start();
+            IndexedPriorityQueue<long> queue(size);
+            for (size_t i = 0; i < size; i++) { queue.Push(values[i]); }
+            for (size_t i = 0; i < size; i++) { queue.DecreaseKey(i, queue.Get(i) - decreases[i]); }
+            for (size_t i = 0; i < size; i++) { KeepValue(queue.Pop()); }
+            stopwatch.Stop();
+        });
+
+        Measure(results, "IndexedPriorityQueue::DecreaseKey", "std", size, size * 3, [&](Stopwatch &stopwatch)
+        {
+            stopwatch.Start();
+            std::vector<long> keys(values);
+            std::priority_queue<std::pair<long, size_t>, std::vector<std::pair<long, size_t>>, std::greater<std::pair<long, size_t>>> queue;
+            for (size_t i = 0; i < size; i++) { queue.push({ keys[i], i }); }
+            for (size_t i = 0; i < size; i++) { keys[i] -= decreases[i]; queue.push({ keys[i], i }); }
+            while (!queue.empty())
+            {
+                std::pair<long, size_t> top = queue.top();
+                queue.pop();
+                if (top.first == keys[top.second]) { KeepValue(top.first); }
+            }
+            stopwatch.Stop();
+        });
+    } });
+
+    benchmarks.push_back({ "Stack::Push/Pop", SIZE_MAX, [](const size_t &size, Results &results)
+    {
+        Measure(results, "Stack::Push/Pop", "DataStructures", size, size * 2, [&](Stopwatch &stopwatch)
+        {
+            stopwatch.Start();
+            Stack<int> stack;
+            for (size_t i = 0; i < size; i++) { stack.Push((int)i); }
+            for (size_t i = 0; i < size; i++) { KeepValue(stack.Pop()); }
+            stopwatch.Stop();
+        });
+
+        Measure(results, "Stack::Push/Pop", "std", size, size * 2, [&](Stopwatch &stopwatch)
+        {
+            stopwatch.Start();
+            std::stack<int, std::vector<int>> stack;
+            for (size_t i = 0; i < size; i++) { stack.push((int)i); }
+            for (size_t i = 0; i < size; i++) { KeepValue(stack.top()); stack.pop(); }
+            stopwatch.Stop();
+        });
+    } });
+
+    benchmarks.push_back({ "SmallList::ShortLived", SIZE_MAX, [](const size_t &size, Results &results)
+    {
+        // Each operation builds and drops a List of a few elements, which is dominated by its allocation.
+        size_t operationCount = LinearOperationCount(size);
+
+        Measure(results, "SmallList::ShortLived", "DataStructures", size, operationCount, [&](Stopwatch &stopwatch)
+        {
+            stopwatch.Start();
+            for (size_t i = 0; i < operationCount; i++)
+            {
+                SmallList<int, 8> list;
+                for (int j = 0; j < 4; j++) { list.Add((int)i + j); }
+                KeepValue(list.begin()[3]);
+            }
+            stopwatch.Stop();
+        });
+
+        Measure(results, "SmallList::ShortLived", "List", size, operationCount, [&](Stopwatch &stopwatch)
+        {
+            stopwatch.Start();
+            for (size_t i = 0; i < operationCount; i++)
+            {
+                List<int> list;
+                for (int j = 0; j < 4; j++) { list.Add((int)i + j); }
+                KeepValue(list.begin()[3]);
+            }
+            stopwatch.Stop();
+        });
+
+        Measure(results, "SmallList::ShortLived", "std", size, operationCount, [&](Stopwatch &stopwatch)
+        {
+            stopwatch.Start();
+            for (size_t i = 0; i < operationCount; i++)
+            {
+                std::vector<int> vector;
+                for (int j = 0; j < 4; j++) { vector.push_back((int)i + j); }
+                KeepValue(vector[3]);
+            }
+            stopwatch.Stop();
+        });
+    } });
+
+    benchmarks.push_back({ "SparseArray::Set", SIZE_MAX, [](const size_t &size, Results &results)
+    {
+        // A density of one percent, but each unsorted Set moves the greater indices, so they're capped.
+        size_t operationCount = std::clamp(size / 100, (size_t)1, (size_t)1 << 15);
+        std::vector<long> indices = RandomNumbers(operationCount, size);
+
+        Measure(results, "SparseArray::Set", "DataStructures", size, operationCount, [&](Stopwatch &stopwatch)
+        {
+            stopwatch.Start();
+            SparseArray<double> sparseArray(size);
+            for (long index : indices) { sparseArray.Set(1.0, (size_t)index); }
+            KeepValue(sparseArray.ActualLength());
+            stopwatch.Stop();
+        });
+
+        Measure(results, "SparseArray::Set", "std", size, operationCount, [&](Stopwatch &stopwatch)
+        {
+            stopwatch.Start();
+            std::map<size_t, double> map;
+            for (long index : indices) { map[(size_t)index] = 1.0; }
+            KeepValue(map.size());
+            stopwatch.Stop();
+        });
+    } });
+
+    benchmarks.push_back({ "MurmurHashingAlgorithm", SIZE_MAX, [](const size_t &size, Results &results)
+    {
+        Measure(results, "MurmurHashingAlgorithm", "DataStructures", size, size, [&](Stopwatch &stopwatch)
+        {
+            long hashing = 0;
+            stopwatch.Start();
+            for (size_t i = 0; i < size; i++) { hashing ^= MurmurHashingAlgorithm((long)i); }
+            stopwatch.Stop();
+            KeepValue(hashing);
+        });
+
+        Measure(results, "MurmurHashingAlgorithm", "std", size, size, [&](Stopwatch &stopwatch)
+        {
+            size_t hashing = 0;
+            stopwatch.Start();
+            for (size_t i = 0; i < size; i++) { hashing ^= std::hash<long>()((long)i); }
+            stopwatch.Stop();
+            KeepValue(hashing);
+        });
+    } });
+
+    benchmarks.push_back({ "Array::FirstIndexOf", SIZE_MAX, [](const size_t &size, Results &results)
+    {
+        Array<int> array(size, 0);
+        array.begin()[size - 1] = 1;
+
+        Measure(results, "Array::FirstIndexOf", "DataStructures", size, size, [&](Stopwatch &stopwatch)
+        {
+            stopwatch.Start();
+            KeepValue(array.FirstIndexOf(1));
+            stopwatch.Stop();
+        });
+
+        Measure(results, "Array::FirstIndexOf", "std", size, size, [&](Stopwatch &stopwatch)
+        {
+            stopwatch.Start();
+            KeepValue(std::find(array.begin(), array.end(), 1));
+            stopwatch.Stop();
+        });
+    } });
+
+    benchmarks.push_back({ "Array::IndicesOf", SIZE_MAX, [](const size_t &size, Results &results)
+    {
+        Array<int> array(size);
+        std::vector<long> numbers = RandomNumbers(size, 100);
+        std::copy(numbers.begin(), numbers.end(), array.begin());
+
+        Measure(results, "Array::IndicesOf", "DataStructures", size, size, [&](Stopwatch &stopwatch)
+        {
+            stopwatch.Start();
+            KeepValue(array.IndicesOf(0).Length());
+            stopwatch.Stop();
+        });
+
+        Measure(results, "Array::IndicesOf", "std", size, size, [&](Stopwatch &stopwatch)
+        {
+            stopwatch.Start();
+            std::vector<size_t> indices;
+            for (size_t i = 0; i < size; i++) { if (array.begin()[i] == 0) { indices.push_back(i); } }
+            KeepValue(indices.size());
+            stopwatch.Stop();
+        });
+    } });
+
+    benchmarks.push_back({ "Array::Any", SIZE_MAX, [](const size_t &size, Results &results)
+    {
+        Array<int> array(size, 0);
+        auto isNegative = [](const int &element) { return element < 0; };
+
+        Measure(results, "Array::Any", "DataStructures", size, size, [&](Stopwatch &stopwatch)
+        {
+            stopwatch.Start();
+            KeepValue(array.Any(isNegative));
+            stopwatch.Stop();
+        });
+
+        Measure(results, "Array::Any", "std", size, size, [&](Stopwatch &stopwatch)
+        {
+            stopwatch.Start();
+            KeepValue(std::any_of(array.begin(), array.end(), isNegative));
+            stopwatch.Stop();
+        });
+    } });
+
+    benchmarks.push_back({ "Array::Every", SIZE_MAX, [](const size_t &size, Results &results)
+    {
+        Array<int> array(size);
+        std::vector<long> numbers = RandomNumbers(size, 100);
+        std::copy(numbers.begin(), numbers.end(), array.begin());
+        auto isZero = [](const int &element) { return element == 0; };
+
+        Measure(results, "Array::Every", "DataStructures", size, size, [&](Stopwatch &stopwatch)
+        {
+            stopwatch.Start();
+            KeepValue(array.Every(isZero).Length());
+            stopwatch.Stop();
+        });
+
+        Measure(results, "Array::Every", "std", size, size, [&](Stopwatch &stopwatch)
+        {
+            stopwatch.Start();
+            std::vector<size_t> indices;
+            for (size_t i = 0; i < size; i++) { if (isZero(array.begin()[i])) { indices.push_back(i); } }
+            KeepValue(indices.size());
+            stopwatch.Stop();
+        });
+    } });
+
+    benchmarks.push_back({ "Array::Reverse/Filter/Map", SIZE_MAX, [](const size_t &size, Results &results)
+    {
+        Array<long> array(size);
+        std::vector<long> numbers = RandomNumbers(size, 1000);
+        std::copy(numbers.begin(), numbers.end(), array.begin());
+        auto isEven = [](const long &element) { return element % 2 == 0; };
+        auto square = [](const long &element) { return element * element; };
+
+        Measure(results, "Array::Reverse/Filter/Map", "View", size, size, [&](Stopwatch &stopwatch)
+        {
+            stopwatch.Start();
+            long sum = 0;
+            for (long element : array.View().Reverse().Filter(isEven).Map(square)) { sum += element; }
+            KeepValue(sum);
+            stopwatch.Stop();
+        });
+
+        Measure(results, "Array::Reverse/Filter/Map", "DataStructures", size, size, [&](Stopwatch &stopwatch)
+        {
+            stopwatch.Start();
+            long sum = 0;
+            Array<long> reversedArray = array.Reverse();
+            for (size_t index : reversedArray.Every(isEven)) { sum += square(reversedArray.begin()[index]); }
+            KeepValue(sum);
+            stopwatch.Stop();
+        });
+    } });
+
+    benchmarks.push_back({ "Array::Sort", SIZE_MAX, [](const size_t &size, Results &results)
+    {
+        std::vector<long> numbers = RandomNumbers(size);
+
+        Measure(results, "Array::Sort", "DataStructures", size, size, [&](Stopwatch &stopwatch)
+        {
+            Array<long> array(size);
+            std::copy(numbers.begin(), numbers.end(), array.begin());
+            stopwatch.Start();
+            array.SortInPlace();
+            stopwatch.Stop();
+            KeepValue(array.begin()[0]);
+        });
+
+        Measure(results, "Array::Sort", "std", size, size, [&](Stopwatch &stopwatch)
+        {
+            std::vector<long> vector = numbers;
+            stopwatch.Start();
+            std::sort(vector.begin(), vector.end());
+            stopwatch.Stop();
+            KeepValue(vector[0]);
+        });
+    } });
+
+    return benchmarks;
+}
+
+/// @brief Writes the results as a JSON document, so the runs of different versions can be compared.
+/// @param output The Output Stream the document is written to.
+/// @param results The results of all of the benchmarks.
+void WriteResults(std::ostream &output, const std::vector<BenchmarkResult> &results)
+{
+    output << "{\n  \"context\": {\n";
+#if defined(__VERSION__)
+    output << "    \"compiler\": \"" << __VERSION__ << "\",\n";
+#endif
+    output << "    \"cplusplus\": " << __cplusplus << ",\n";
+    output << "    \"threads\": " << std::max(std::thread::hardware_concurrency(), 1U) << "\n  },\n";
+    output << "  \"benchmarks\": [";
+
+    for (size_t i = 0; i < results.size(); i++)
+    {
+        const BenchmarkResult &result = results[i];
+        output << (i ? ",\n" : "\n") << "    { \"name\": \"" << result.Name << "\", \"implementation\": \"" << result.Implementation
+            << "\", \"size\": " << result.Size << ", \"operations\": " << result.OperationCount << ", \"repetitions\": "
+            << result.RepetitionCount << ", \"nanoseconds_per_operation\": " << result.NanosecondsPerOperation << " }";
+    }
+
+    output << "\n  ]\n}\n";
+}
+
+/// @brief Runs every benchmark whose name contains the filter, at every power of ten within the sizes, and
+/// writes the results as JSON, (to the standard output unless an output file is given).
+int main(int argumentCount, char** arguments)
+{
+    size_t minimumSize = 100, maximumSize = 100000000;
+    std::string filter, outputPath;
+
+    try
+    {
+        for (int i = 1; i < argumentCount; i++)
+        {
+            std::string argument = arguments[i];
+            bool hasValue = i + 1 < argumentCount;
+
+            if (argument == "--min-size" && hasValue) { minimumSize = (size_t)std::stod(arguments[++i]); }
+            else if (argument == "--max-size" && hasValue) { maximumSize = (size_t)std::stod(arguments[++i]); }
+            else if (argument == "--filter" && hasValue) { filter = arguments[++i]; }
+            else if (argument == "--output" && hasValue) { outputPath = arguments[++i]; }
+            else { throw std::invalid_argument(argument); }
+        }
+    }
+    catch (const std::exception &)
+    {
+        std::cerr << "Usage: " << arguments[0] << " [--min-size 1e2] [--max-size 1e8] [--filter NAME] [--output FILE]\n";
+        return 1;
+    }
+
+    std::vector<BenchmarkResult> results;
+    for (const Benchmark &benchmark : MakeBenchmarks())
+    {
+        if (benchmark.Name.find(filter) == std::string::npos) { continue; }
+
+        for (size_t size = std::max(minimumSize, (size_t)1); size <= std::min(maximumSize, benchmark.MaximumSize); size *= 10)
+        {
+            std::cerr << benchmark.Name << " at " << size << " elements\n";
+            benchmark.Run(size, results);
+        }
+    }
+
+    if (outputPath.empty()) { WriteResults(std::cout, results); return 0; }
+
+    std::ofstream output(outputPath);
+    WriteResults(output, results);
+    return output ? 0 : 1;
+}
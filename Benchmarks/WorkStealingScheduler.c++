@@ -0,0 +1,120 @@
+#include<iostream>
+
+#include<atomic>
+#include<chrono>
+#include<cstdint>
+#include<random>
+#include<thread>
+#include<vector>
+
+#include "../WorkStealingDeque.c++"
+
+/// @brief A range of numbers to be checked for primality, which is the task of the scheduler.
+struct PrimeRange
+{
+    /// @brief The first number of the range.
+    uint32_t Begin;
+    /// @brief The number past the last one of the range.
+    uint32_t End;
+};
+
+/// @brief The largest range that a worker checks by itself instead of splitting it.
+constexpr uint32_t LEAF_RANGE_LENGTH = 2048;
+
+/// @brief Checks whether or not a number is prime by trial division, (so larger numbers take longer,
+/// and the tasks are uneven enough for the workers to need stealing).
+/// @param number The number that'll be checked.
+/// @return A boolean representing whether or not the number is prime.
+bool IsPrime(const uint32_t &number)
+{
+    if (number < 2) { return false; }
+    for (uint32_t divisor = 2; divisor * divisor <= number; divisor++)
+    {
+        if (number % divisor == 0) { return false; }
+    }
+
+    return true;
+}
+
+/// @brief Counts the primes below a limit with a pool of workers, each one owning a Work Stealing Deque,
+/// that splits its ranges in halves, pushing one half and working on the other, and steals from a random
+/// victim when it runs out of work.
+/// @param limit The number that the primes counted are below.
+/// @param workerCount The amount of threads working on the ranges.
+/// @return The amount of primes below the limit.
+uint64_t CountPrimes(const uint32_t &limit, const size_t &workerCount)
+{
+    std::vector<WorkStealingDeque<PrimeRange>*> deques;
+    for (size_t i = 0; i < workerCount; i++) { deques.push_back(new WorkStealingDeque<PrimeRange>()); }
+
+    std::atomic<uint64_t> primeCount { 0 };
+    // The amount of ranges that have been pushed but not checked yet, which ends the workers when it reaches zero.
+    std::atomic<size_t> pendingRangeCount { 1 };
+    deques[0]->Push(PrimeRange { 0, limit });
+
+    auto work = [&](const size_t &workerIndex)
+    {
+        WorkStealingDeque<PrimeRange> &deque = *deques[workerIndex];
+        std::minstd_rand random((unsigned)workerIndex + 1);
+        uint64_t localPrimeCount = 0;
+        PrimeRange range;
+
+        while (pendingRangeCount.load(std::memory_order_acquire))
+        {
+            if (!deque.TryPop(range))
+            {
+                size_t victimIndex = random() % workerCount;
+                if (victimIndex == workerIndex || !deques[victimIndex]->Steal(range))
+                {
+                    std::this_thread::yield();
+                    continue;
+                }
+            }
+
+            while (range.End - range.Begin > LEAF_RANGE_LENGTH)
+            {
+                uint32_t middle = range.Begin + (range.End - range.Begin) / 2;
+                pendingRangeCount.fetch_add(1, std::memory_order_relaxed);
+                deque.Push(PrimeRange { middle, range.End });
+                range.End = middle;
+            }
+
+            for (uint32_t number = range.Begin; number < range.End; number++) { localPrimeCount += IsPrime(number); }
+            pendingRangeCount.fetch_sub(1, std::memory_order_acq_rel);
+        }
+
+        primeCount.fetch_add(localPrimeCount, std::memory_order_relaxed);
+    };
+
+    std::vector<std::thread> workers;
+    for (size_t i = 1; i < workerCount; i++) { workers.emplace_back(work, i); }
+    work(0);
+    for (std::thread &worker : workers) { worker.join(); }
+
+    for (WorkStealingDeque<PrimeRange>* deque : deques) { delete deque; }
+    return primeCount.load();
+}
+
+/// @brief Runs the scheduler from one worker up to a worker per core, and prints how it scales.
+int main(int argumentCount, char** arguments)
+{
+    uint32_t limit = argumentCount > 1 ? (uint32_t)std::stoul(arguments[1]) : 20000000;
+    size_t maximumWorkerCount = std::max(std::thread::hardware_concurrency(), 1U);
+    double singleWorkerSeconds = 0;
+
+    std::cout << "Counting the primes below " << limit << " with up to " << maximumWorkerCount << " workers.\n";
+    for (size_t workerCount = 1; workerCount <= maximumWorkerCount; workerCount *= 2)
+    {
+        auto start = std::chrono::steady_clock::now();
+        uint64_t primeCount = CountPrimes(limit, workerCount);
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        if (workerCount == 1) { singleWorkerSeconds = seconds; }
+
+        std::cout << workerCount << " workers: " << primeCount << " primes in " << seconds << " s, (speedup "
+            << singleWorkerSeconds / seconds << "x)\n";
+
+        if (workerCount < maximumWorkerCount && workerCount * 2 > maximumWorkerCount) { workerCount = maximumWorkerCount / 2; }
+    }
+
+    return 0;
+}
@@ -0,0 +1,258 @@
+#include<iostream>
+
+#ifndef BLOOM_FILTER
+#define BLOOM_FILTER
+
+#include<algorithm>
+#include<cmath>
+#include<cstdint>
+#include<stdexcept>
+#include<string>
+
+#include "Array.c++"
+#include "CacheLine.c++"
+#include "Algorithms/BitOperations.c++"
+#include "Algorithms/Hasher.c++"
+
+/// @brief Introduces the abstraction of the Hash Table class to the Bloom Filter class.
+/// @tparam TKey The type of the keys stored within the Hash Table.
+/// @tparam TValue The type of the values stored within the Hash Table.
+/// @tparam THasher The function object that hashes the keys by their values.
+template<typename TKey, typename TValue, typename THasher>
+class HashTable;
+
+/// @brief A probabilistic set that tells whether an element is definitely not presented, or might be presented,
+/// where every element sets a few bits within a single cache-line-sized block, so each check loads only one cache
+/// line, (the elements can't be removed, and no false negatives ever happen).
+/// @tparam T The type of the elements.
+/// @tparam THasher The function object that hashes the elements by their values.
+template<typename T, typename THasher = Hasher<T>>
+class BloomFilter
+{
+public:
+    /// @brief Makes the Hash Table class a friend with the Bloom Filter class, so it can reuse the hashing
+    /// values of its keys.
+    template<typename TKey, typename TValue, typename THasher_>
+    friend class HashTable;
+
+    /// @brief The false positive rate of a Bloom Filter if unspecified by the consumer.
+    static constexpr double DEFAULT_FALSE_POSITIVE_RATE = 0.01;
+    /// @brief The maximum amount of bits each element sets within its block.
+    static constexpr size_t MAXIMUM_HASH_COUNT = 16;
+
+    /// @brief Creates a new Bloom Filter without any bits, that reports every element as possibly presented
+    /// until it's replaced by a sized one.
+    BloomFilter() = default;
+
+    /// @brief Creates a new empty Bloom Filter sized to hold an expected amount of elements under a false positive rate.
+    /// @param expectedCount The amount of elements that'll be added to the Bloom Filter.
+    /// @param falsePositiveRate The approximate chance of an unadded element to be reported as presented, once the
+    /// expected amount of elements is added, (it's between 0 and 1).
+    /// @param hasher The function object that'll be used to hash the elements by their values.
+    /// @param hashingSeed An initial value that determines the outcome of the hasher.
+    explicit BloomFilter(const size_t &expectedCount, const double &falsePositiveRate = DEFAULT_FALSE_POSITIVE_RATE,
+        const THasher &hasher = THasher(), const size_t &hashingSeed = 0) noexcept(false)
+        : falsePositiveRate(falsePositiveRate), hasher(hasher), hashingSeed(hashingSeed)
+    {
+        if (!(0 < falsePositiveRate && falsePositiveRate < 1))
+        { throw std::out_of_range("The false positive rate [" + std::to_string(falsePositiveRate) + "] is out of the range of (0, 1)."); }
+
+        // A standard Bloom Filter needs -ln(p) / ln(2)² bits for each element, but the elements spread unevenly over
+        // the blocks, so the bits grow until the rate of the blocked layout meets the target too.
+        double bitsPerElement = -std::log(falsePositiveRate) / (std::log(2.0) * std::log(2.0));
+        while (bitsPerElement < MAXIMUM_BITS_PER_ELEMENT && BlockedFalsePositiveRate(bitsPerElement) > falsePositiveRate)
+        { bitsPerElement += BITS_PER_ELEMENT_STEP; }
+
+        hashCount = HashCountFor(bitsPerElement);
+
+        size_t blockCount = std::max((size_t)std::ceil(std::max(expectedCount, (size_t)1) * bitsPerElement / BLOCK_BIT_COUNT), (size_t)1);
+        blocks = Array<Block>(blockCount, Block());
+    }
+
+    /// @brief Creates a new Bloom Filter by copying another Bloom Filter as reference.
+    /// @param reference The reference of the Bloom Filter that'll be copied.
+    BloomFilter(const BloomFilter<T, THasher> &reference) = default;
+
+    /// @brief Creates a new Bloom Filter by taking over the blocks of another Bloom Filter.
+    /// @param reference The reference of the Bloom Filter that'll be moved.
+    BloomFilter(BloomFilter<T, THasher> &&reference) noexcept = default;
+
+    /// @brief Copies a Bloom Filter into another.
+    /// @param reference The reference of the Bloom Filter that'll be copied.
+    /// @return The result of the copying.
+    BloomFilter<T, THasher> &operator=(const BloomFilter<T, THasher> &reference) = default;
+
+    /// @brief Moves a Bloom Filter into another, by taking over its blocks.
+    /// @param reference The reference of the Bloom Filter that'll be moved.
+    /// @return The result of the moving.
+    BloomFilter<T, THasher> &operator=(BloomFilter<T, THasher> &&reference) noexcept = default;
+
+private:
+    /// @brief The amount of bits within each block, (a whole cache line).
+    static constexpr size_t BLOCK_BIT_COUNT = CACHE_LINE_SIZE * 8;
+    /// @brief The amount of bits of an index of a bit within a block.
+    static constexpr size_t BIT_INDEX_WIDTH = 9;
+    /// @brief The amount of bit indices sliced out of each mixed value.
+    static constexpr size_t BIT_INDICES_PER_MIXING = 64 / BIT_INDEX_WIDTH;
+
+    static_assert(BLOCK_BIT_COUNT == (size_t)1 << BIT_INDEX_WIDTH, "The bit indices must cover a block exactly.");
+    /// @brief The most bits for each element the Bloom Filter is sized with, no matter how low its false positive rate is.
+    static constexpr double MAXIMUM_BITS_PER_ELEMENT = 64;
+    /// @brief The amount of bits for each element that's added while sizing, until the false positive rate is met.
+    static constexpr double BITS_PER_ELEMENT_STEP = 0.25;
+
+    /// @brief The bits of the elements that are hashed into the same cache line.
+    struct alignas(CACHE_LINE_SIZE) Block
+    {
+        /// @brief The words that hold the bits of the block.
+        uint64_t Words[CACHE_LINE_SIZE / sizeof(uint64_t)] = { };
+    };
+
+    /// @brief The blocks that hold the bits of the elements.
+    Array<Block> blocks;
+    /// @brief The amount of bits each element sets within its block.
+    size_t hashCount = 1;
+    /// @brief The amount of elements that have been added.
+    size_t count = 0;
+    /// @brief The false positive rate the Bloom Filter has been sized for.
+    double falsePositiveRate = DEFAULT_FALSE_POSITIVE_RATE;
+    /// @brief The function object that'll be used for hashing the elements.
+    THasher hasher;
+    /// @brief The initial value that determines the outcome of the hasher.
+    size_t hashingSeed = 0;
+
+public:
+    /// @brief The amount of elements that have been added to the Bloom Filter, (including the repeated ones).
+    /// @return The elements count of the Bloom Filter.
+    size_t Count() const { return count; }
+    /// @brief The amount of bits of the Bloom Filter.
+    /// @return The bits count of the Bloom Filter.
+    size_t BitCount() const { return blocks.Length() * BLOCK_BIT_COUNT; }
+    /// @brief The amount of bits each element sets within its block.
+    /// @return The hash count of the Bloom Filter.
+    size_t HashCount() const { return hashCount; }
+    /// @brief The false positive rate the Bloom Filter has been sized for.
+    /// @return The false positive rate of the Bloom Filter.
+    double FalsePositiveRate() const { return falsePositiveRate; }
+
+    /// @brief Indicates whether or not no elements have been added to the Bloom Filter.
+    /// @return A boolean representing whether or not the Bloom Filter is empty.
+    bool IsEmpty() const { return !count; }
+
+    /// @brief Estimates the current chance of an unadded element to be reported as presented, by averaging the
+    /// chances of the blocks, since an unadded element checks its bits within a single block, and the blocks that got
+    /// more elements have more of their bits set, (it grows past the sized false positive rate once more elements
+    /// are added).
+    /// @return The estimated false positive rate of the Bloom Filter.
+    double EstimatedFalsePositiveRate() const
+    {
+        if (!blocks.Length()) { return 1; }
+
+        double rate = 0;
+        for (const Block &block : blocks)
+        {
+            size_t setBitCount = 0;
+            for (const uint64_t &word : block.Words) { setBitCount += PopulationCount(word); }
+
+            rate += std::pow(setBitCount / (double)BLOCK_BIT_COUNT, (double)hashCount);
+        }
+
+        return rate / blocks.Length();
+    }
+
+    /// @brief Adds an element to the Bloom Filter.
+    /// @param element The element that'll be added.
+    void Add(const T &element) { AddHash(hasher(element, hashingSeed)); }
+
+    /// @brief Checks whether or not an element might be presented within the Bloom Filter.
+    /// @param element The element that'll be checked.
+    /// @return False if the element has definitely not been added, or true if it might have been.
+    bool MayContain(const T &element) const { return MayContainHash(hasher(element, hashingSeed)); }
+
+    /// @brief Clears every element from the Bloom Filter, (without releasing its memory).
+    void Clear()
+    {
+        for (Block &block : blocks) { block = Block(); }
+        count = 0;
+    }
+
+private:
+    /// @brief Computes the optimal amount of bits each element sets, for a defined amount of bits for each element.
+    /// @param bitsPerElement The amount of bits for each element.
+    /// @return The hash count, (ln(2) bits for each bit of an element).
+    static size_t HashCountFor(const double &bitsPerElement)
+    { return std::clamp((size_t)std::lround(bitsPerElement * std::log(2.0)), (size_t)1, MAXIMUM_HASH_COUNT); }
+
+    /// @brief Computes the false positive rate of the blocked layout, by averaging the rates of the blocks over
+    /// their amounts of elements, which follow a Poisson distribution.
+    /// @param bitsPerElement The amount of bits for each element.
+    /// @return The expected false positive rate.
+    static double BlockedFalsePositiveRate(const double &bitsPerElement)
+    {
+        double elementsPerBlock = BLOCK_BIT_COUNT / bitsPerElement, hashCount = (double)HashCountFor(bitsPerElement);
+        double spread = 10 * std::sqrt(elementsPerBlock) + 10, rate = 0;
+
+        size_t lastCount = (size_t)(elementsPerBlock + spread);
+        for (size_t j = (size_t)std::max(elementsPerBlock - spread, 0.0); j <= lastCount; j++)
+        {
+            double probability = std::exp(j * std::log(elementsPerBlock) - elementsPerBlock - std::lgamma(j + 1.0));
+            rate += probability * std::pow(1 - std::pow(1 - 1.0 / BLOCK_BIT_COUNT, j * hashCount), hashCount);
+        }
+
+        return rate;
+    }
+
+    /// @brief Finds the block of an element by the upper half of its hashing value, (multiplying it by the blocks
+    /// count maps it over any amount of blocks without a division).
+    /// @param hashingValue The hashing value of the element.
+    /// @return A pointer to the block of the element.
+    Block* BlockOf(const size_t &hashingValue) const
+    { return blocks.begin() + (((uint64_t)hashingValue >> 32) * blocks.Length() >> 32); }
+
+    /// @brief Walks through the bits of an element within its block, where the bits are sliced out of its remixed
+    /// hashing value, (a double hashing would be cheaper, but its correlated bits raise the false positive rate
+    /// several times over).
+    /// @tparam TVisit The type of the function that visits each bit.
+    /// @param hashingValue The hashing value of the element.
+    /// @param visit A function that takes the word of a bit and its mask.
+    template<typename TVisit>
+    void VisitBits(const size_t &hashingValue, const TVisit &visit) const
+    {
+        uint64_t* words = BlockOf(hashingValue)->Words;
+        uint64_t mixedValue = MixBits(hashingValue), bitIndices = mixedValue;
+
+        for (size_t i = 0; i < hashCount; i++, bitIndices >>= BIT_INDEX_WIDTH)
+        {
+            // Each mixed value is sliced into seven 9-bit indices, then it's remixed for the next seven.
+            if (i && !(i % BIT_INDICES_PER_MIXING)) { bitIndices = mixedValue = MixBits(mixedValue); }
+
+            size_t bit = bitIndices & (BLOCK_BIT_COUNT - 1);
+            visit(words[bit >> 6], (uint64_t)1 << (bit & 63));
+        }
+    }
+
+    /// @brief Adds an element that has been already hashed by the same hasher and seed.
+    /// @param hashingValue The hashing value of the element.
+    void AddHash(const size_t &hashingValue)
+    {
+        count++;
+        if (!blocks.Length()) { return; }
+
+        VisitBits(hashingValue, [](uint64_t &word, const uint64_t &mask) { word |= mask; });
+    }
+
+    /// @brief Checks an element that has been already hashed by the same hasher and seed, by gathering its missing
+    /// bits instead of stopping at the first one, (which would mispredict on about every other missing element).
+    /// @param hashingValue The hashing value of the element.
+    /// @return False if the element has definitely not been added, or true if it might have been.
+    bool MayContainHash(const size_t &hashingValue) const
+    {
+        if (!blocks.Length()) { return true; }
+
+        uint64_t missingBits = 0;
+        VisitBits(hashingValue, [&](const uint64_t &word, const uint64_t &mask) { missingBits |= mask & ~word; });
+        return !missingBits;
+    }
+};
+
+#endif
@@ -0,0 +1,40 @@
+#include<iostream>
+
+#ifndef CACHE_LINE
+#define CACHE_LINE
+
+#include<cstddef>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include<xmmintrin.h>
+#endif
+
+/// @brief The size of a cache line in bytes, which is the granularity the cores share memory at,
+/// (so data written by different threads is kept this far apart to avoid false sharing).
+constexpr size_t CACHE_LINE_SIZE = 64;
+
+/// @brief A value that takes a whole cache line by itself, so writing it never invalidates
+/// the cache line of a neighbouring value.
+/// @tparam T The type of the padded value.
+template<typename T>
+struct alignas(CACHE_LINE_SIZE) CacheLinePadded
+{
+    /// @brief The padded value.
+    T Value;
+};
+
+/// @brief Hints the processor to start loading the cache line of an address, so a later access doesn't stall
+/// on it, (it never faults, so the address may be null or past the end of an allocation).
+/// @param address The address whose cache line will be accessed soon.
+inline void Prefetch(const void* address)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch(address);
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    _mm_prefetch(static_cast<const char*>(address), _MM_HINT_T0);
+#else
+    (void)address;
+#endif
+}
+
+#endif
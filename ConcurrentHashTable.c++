@@ -0,0 +1,316 @@
+#include<iostream>
+
+#ifndef CONCURRENT_HASH_TABLE
+#define CONCURRENT_HASH_TABLE
+
+#include<functional>
+#include<mutex>
+#include<shared_mutex>
+
+#include "Array.c++"
+#include "CacheLine.c++"
+#include "FlatHashTable.c++"
+#include "GrowthPolicy.c++"
+#include "Algorithms/BitOperations.c++"
+
+/// @brief A Hash Table that's safe to be used by many threads at the same time, where the pairs are split
+/// into shards by the highest bits of their hashing values, and each shard is a Flat Hash Table of its own,
+/// guarded by a reader-writer lock, so the readers never block each other, and the writers only block
+/// the pairs of a single shard, (which also resizes on its own).
+/// @tparam TKey The type of the keys stored within the Concurrent Hash Table.
+/// @tparam TValue The type of the values stored within the Concurrent Hash Table.
+/// @tparam THasher The function object that hashes the keys by their values.
+template<typename TKey, typename TValue, typename THasher = Hasher<TKey>>
+class ConcurrentHashTable
+{
+public:
+    /// @brief Creates a new empty Concurrent Hash Table with the default amount of shards.
+    ConcurrentHashTable() : ConcurrentHashTable(0) { }
+
+    /// @brief Creates a new Concurrent Hash Table that can hold a defined amount of pairs without rehashing.
+    /// @param capacity The amount of pairs that'll be stored within the Concurrent Hash Table.
+    /// @param shardCount The amount of independently locked shards, (it's rounded up to the closest power of two,
+    /// and it should be a few times the amount of the threads that use the Concurrent Hash Table).
+    /// @param hasher The function object that'll be used to hash the keys by their values.
+    /// @param hashingSeed An initial value that determines the outcome of the hasher,
+    /// (usually, it's set to zero).
+    explicit ConcurrentHashTable(const size_t &capacity, const size_t &shardCount = DEFAULT_SHARD_COUNT,
+        const THasher &hasher = THasher(), const size_t &hashingSeed = 0)
+        : shards(GrowthPolicy::NextPowerOfTwo(std::max(shardCount, (size_t)1))),
+        shardBits(CountTrailingZeros((uint64_t)shards.Length())), hasher(hasher), hashingSeed(hashingSeed)
+    {
+        size_t shardCapacity = (capacity + shards.Length() - 1) / shards.Length();
+        for (Shard &shard : shards) { shard.Table = FlatHashTable<TKey, TValue, THasher>(shardCapacity, hasher, hashingSeed); }
+    }
+
+    /// @brief Concurrent Hash Tables can't be copied, since other threads might be using them.
+    ConcurrentHashTable(const ConcurrentHashTable<TKey, TValue, THasher> &reference) = delete;
+
+    ~ConcurrentHashTable() = default;
+
+private:
+    /// @brief A part of the pairs, that's locked independently of the other parts, (each one takes
+    /// its own cache lines, so taking one lock never invalidates the lock of a neighbouring shard).
+    struct alignas(CACHE_LINE_SIZE) Shard
+    {
+        /// @brief The lock that's shared by the readers of the shard, and exclusively owned by its writers.
+        mutable std::shared_mutex Lock;
+        /// @brief The pairs of the shard.
+        FlatHashTable<TKey, TValue, THasher> Table;
+    };
+
+    /// @brief The shards of the pairs, (their count is always a power of two).
+    Array<Shard> shards;
+    /// @brief The amount of the highest bits of a hashing value that select its shard.
+    size_t shardBits;
+    /// @brief The function object that'll be used for hashing the keys of the Concurrent Hash Table.
+    THasher hasher;
+    /// @brief The initial value that determines the outcome of the hasher.
+    size_t hashingSeed;
+
+public:
+    /// @brief The amount of shards if unspecified by the consumer.
+    static constexpr size_t DEFAULT_SHARD_COUNT = 64;
+
+    /// @brief The amount of independently locked shards.
+    /// @return The shards count of the Concurrent Hash Table.
+    size_t ShardCount() const { return shards.Length(); }
+
+    /// @brief The amount of pairs stored within the Concurrent Hash Table, (it may be outdated as soon as
+    /// it's returned if other threads are writing, since the shards are counted one at a time).
+    /// @return The pairs count of the Concurrent Hash Table.
+    size_t Count() const
+    {
+        size_t count = 0;
+        for (const Shard &shard : shards)
+        {
+            std::shared_lock<std::shared_mutex> lock(shard.Lock);
+            count += shard.Table.Count();
+        }
+
+        return count;
+    }
+
+    /// @brief Indicates whether or not the Concurrent Hash Table has currently no pairs.
+    /// @return A boolean representing whether or not the Concurrent Hash Table is empty.
+    bool IsEmpty() const { return !Count(); }
+
+    /// @brief Sets a pair within the Concurrent Hash Table, (or replaces the value if the key already exists).
+    /// @param key The key of the pair that'll be used to access the value its associated with.
+    /// @param value The value that'll be copied and associated with the key.
+    void Set(const TKey &key, const TValue &value) { SetPair(key, value); }
+
+    /// @brief Sets a pair within the Concurrent Hash Table, (or replaces the value if the key already exists).
+    /// @param key The key of the pair that'll be used to access the value its associated with.
+    /// @param value The value that'll be moved and associated with the key.
+    void Set(const TKey &key, TValue &&value) { SetPair(key, std::move(value)); }
+
+    /// @brief Gets a copy of the value that's associated with a key, (a reference couldn't outlive the lock
+    /// of its shard), if the key doesn't exist, it'll throw an "out of range" exception.
+    /// @param key The key of the pair that'll be searched for.
+    /// @return The value associated with the key.
+    TValue Get(const TKey &key) const noexcept(false)
+    {
+        TValue value;
+        if (TryGet(key, value)) { return value; }
+
+        throw std::out_of_range("The provided key doesn't exist within the Concurrent Hash Table.");
+    }
+
+    /// @brief Copies the value that's associated with a key if the key exists.
+    /// @param key The key of the pair that'll be searched for.
+    /// @param value The reference that'll be assigned the value associated with the key.
+    /// @return A boolean representing whether or not the key has been found.
+    bool TryGet(const TKey &key, TValue &value) const
+    {
+        size_t hashingValue = Hash(key);
+        const Shard &shard = ShardOf(hashingValue);
+        std::shared_lock<std::shared_mutex> lock(shard.Lock);
+
+        const TValue* foundValue = FindValue(shard.Table, key, hashingValue);
+        if (foundValue == nullptr) { return false; }
+
+        value = *foundValue;
+        return true;
+    }
+
+    /// @brief Checks for a key within the Concurrent Hash Table.
+    /// @param key The key of the pair that'll be searched for.
+    /// @return A boolean value representing whether or not the key is presented in the Concurrent Hash Table.
+    bool Has(const TKey &key) const
+    {
+        size_t hashingValue = Hash(key);
+        const Shard &shard = ShardOf(hashingValue);
+        std::shared_lock<std::shared_mutex> lock(shard.Lock);
+
+        return FindValue(shard.Table, key, hashingValue) != nullptr;
+    }
+
+    /// @brief Gets the value that's associated with a key, or sets the key with a value if it doesn't exist yet,
+    /// as a single atomic operation, (so only one of the racing threads sets the key, and all of them get its value).
+    /// @param key The key of the pair that'll be searched for.
+    /// @param value The value that'll be associated with the key if it doesn't exist.
+    /// @return A copy of the value associated with the key after the operation.
+    TValue GetOrSet(const TKey &key, const TValue &value)
+    {
+        size_t hashingValue = Hash(key);
+        Shard &shard = ShardOf(hashingValue);
+
+        // Most of the calls find the key, so they're tried under the shared lock first.
+        {
+            std::shared_lock<std::shared_mutex> lock(shard.Lock);
+            const TValue* foundValue = FindValue(shard.Table, key, hashingValue);
+            if (foundValue != nullptr) { return *foundValue; }
+        }
+
+        // Another thread might have set the key between releasing the shared lock and taking the exclusive one.
+        std::unique_lock<std::shared_mutex> lock(shard.Lock);
+        const TValue* foundValue = FindValue(shard.Table, key, hashingValue);
+        if (foundValue != nullptr) { return *foundValue; }
+
+        shard.Table.SetPair(key, hashingValue, value);
+        return value;
+    }
+
+    /// @brief Updates the value that's associated with a key in place as a single atomic operation, while no other
+    /// thread can access the shard of the key, (so the updater must not use the Concurrent Hash Table).
+    /// @tparam TUpdater The type of the function that updates the value.
+    /// @param key The key of the pair that'll be updated.
+    /// @param updater A function that takes the reference of the value associated with the key, and updates it.
+    /// @return A boolean representing whether or not the key has been found and updated.
+    template<typename TUpdater>
+    bool Update(const TKey &key, const TUpdater &updater)
+    {
+        size_t hashingValue = Hash(key);
+        Shard &shard = ShardOf(hashingValue);
+        std::unique_lock<std::shared_mutex> lock(shard.Lock);
+
+        TValue* foundValue = FindValue(shard.Table, key, hashingValue);
+        if (foundValue == nullptr) { return false; }
+
+        updater(*foundValue);
+        return true;
+    }
+
+    /// @brief Sets a key with a value if it doesn't exist yet, or updates its value in place otherwise,
+    /// as a single atomic operation, (so the updater must not use the Concurrent Hash Table).
+    /// @tparam TUpdater The type of the function that updates the value.
+    /// @param key The key of the pair that'll be set or updated.
+    /// @param value The value that'll be associated with the key if it doesn't exist.
+    /// @param updater A function that takes the reference of the value associated with the key, and updates it.
+    /// @return A boolean representing whether or not the key has been set, (rather than updated).
+    template<typename TUpdater>
+    bool SetOrUpdate(const TKey &key, const TValue &value, const TUpdater &updater)
+    {
+        size_t hashingValue = Hash(key);
+        Shard &shard = ShardOf(hashingValue);
+        std::unique_lock<std::shared_mutex> lock(shard.Lock);
+
+        TValue* foundValue = FindValue(shard.Table, key, hashingValue);
+        if (foundValue != nullptr) { updater(*foundValue); return false; }
+
+        shard.Table.SetPair(key, hashingValue, value);
+        return true;
+    }
+
+    /// @brief Erases a pair from the Concurrent Hash Table using its key.
+    /// @param key The key of the pair that'll be erased.
+    /// @return A boolean representing whether or not the pair has been erased.
+    bool Erase(const TKey &key)
+    {
+        size_t hashingValue = Hash(key);
+        Shard &shard = ShardOf(hashingValue);
+        std::unique_lock<std::shared_mutex> lock(shard.Lock);
+
+        return shard.Table.Erase(key, hashingValue);
+    }
+
+    /// @brief Clears every pair from the Concurrent Hash Table, one shard at a time.
+    void Clear()
+    {
+        for (Shard &shard : shards)
+        {
+            std::unique_lock<std::shared_mutex> lock(shard.Lock);
+            shard.Table.Clear();
+        }
+    }
+
+    /// @brief Makes sure the Concurrent Hash Table can hold a defined amount of pairs without rehashing,
+    /// (assuming the keys are spread evenly among the shards).
+    /// @param capacity The amount of pairs the Concurrent Hash Table will be able to hold.
+    void Reserve(const size_t &capacity)
+    {
+        size_t shardCapacity = (capacity + shards.Length() - 1) / shards.Length();
+        for (Shard &shard : shards)
+        {
+            std::unique_lock<std::shared_mutex> lock(shard.Lock);
+            shard.Table.Reserve(shardCapacity);
+        }
+    }
+
+    /// @brief Applies a callback Function for each pair in the Concurrent Hash Table, while the shard of
+    /// the pair is locked for reading, (so the callback must not write to the Concurrent Hash Table, and the
+    /// pairs that are written to the other shards meanwhile might be missed).
+    /// @param callback The function that'll be applied to all pairs, that takes the key and the value of it.
+    void Foreach(std::function<void(const TKey &key, const TValue &value)> callback) const
+    {
+        for (const Shard &shard : shards)
+        {
+            std::shared_lock<std::shared_mutex> lock(shard.Lock);
+            for (const auto &pair : shard.Table) { callback(pair.Key, pair.Value); }
+        }
+    }
+
+    /// @brief Concurrent Hash Tables can't be copied, since other threads might be using them.
+    ConcurrentHashTable<TKey, TValue, THasher> &operator=(const ConcurrentHashTable<TKey, TValue, THasher> &reference) = delete;
+
+private:
+    /// @brief Hashes a key by its value, (once for both selecting its shard and probing it).
+    /// @param key The key that'll be hashed.
+    /// @return The hashing value of the key.
+    size_t Hash(const TKey &key) const { return hasher(key, hashingSeed); }
+
+    /// @brief Selects the shard of a key by the highest bits of its hashing value, since the Flat Hash Tables
+    /// probe by the lowest ones, (so the pairs of one shard are still spread over all of its groups).
+    /// @param hashingValue The hashing value of the key.
+    /// @return The reference of the shard that holds the key.
+    Shard &ShardOf(const size_t &hashingValue) { return shards.begin()[ShardIndex(hashingValue)]; }
+
+    /// @brief Selects the shard of a key by the highest bits of its hashing value.
+    /// @param hashingValue The hashing value of the key.
+    /// @return The reference of the shard that holds the key, without the ability to set it.
+    const Shard &ShardOf(const size_t &hashingValue) const { return shards.begin()[ShardIndex(hashingValue)]; }
+
+    /// @brief The index of the shard that a hashing value belongs to.
+    /// @param hashingValue The hashing value of the key.
+    /// @return The highest bits of the hashing value, (or zero if there's a single shard).
+    size_t ShardIndex(const size_t &hashingValue) const
+    { return shardBits ? (size_t)((uint64_t)hashingValue >> (64 - shardBits)) : 0; }
+
+    /// @brief Searches a shard for the value that's associated with an already hashed key, (its lock must be held).
+    /// @param table The table of the shard.
+    /// @param key The key of the pair that'll be searched for.
+    /// @param hashingValue The hashing value of the key.
+    /// @return A pointer to the value associated with the key, or null pointer if unfound.
+    static TValue* FindValue(const FlatHashTable<TKey, TValue, THasher> &table, const TKey &key, const size_t &hashingValue)
+    {
+        size_t index = table.FindIndex(key, hashingValue);
+        return index != FlatHashTable<TKey, TValue, THasher>::NOT_FOUND ? &table.slots.begin()[index].Value : nullptr;
+    }
+
+    /// @brief Sets a pair within the Concurrent Hash Table, by either copying or moving the value.
+    /// @tparam TValue_ The type of the given value reference.
+    /// @param key The key of the pair that'll be used to access the value its associated with.
+    /// @param value The value that'll be associated with the key.
+    template<typename TValue_>
+    void SetPair(const TKey &key, TValue_ &&value)
+    {
+        size_t hashingValue = Hash(key);
+        Shard &shard = ShardOf(hashingValue);
+        std::unique_lock<std::shared_mutex> lock(shard.Lock);
+
+        shard.Table.SetPair(key, hashingValue, std::forward<TValue_>(value));
+    }
+};
+
+#endif
@@ -0,0 +1,568 @@
+#include<iostream>
+
+#ifndef CONCURRENT_QUEUE
+#define CONCURRENT_QUEUE
+
+#include<atomic>
+#include<cstdint>
+#include<cstring>
+#include<new>
+#include<thread>
+#include<type_traits>
+
+#include "Array.c++"
+#include "CacheLine.c++"
+#include "Algorithms/BitOperations.c++"
+#include "GrowthPolicy.c++"
+
+/// @brief A bounded Queue that's safe to be used by one producer thread and one consumer thread at
+/// the same time without locks, where the elements are stored within a circular buffer, and each
+/// side keeps a cached copy of the other side position so it rarely reads the other cache line.
+/// @tparam T The type of the data stored within the Queue.
+template<typename T>
+class SpscQueue
+{
+public:
+    /// @brief Creates a new empty Queue with a defined capacity.
+    /// @param capacity The amount of elements that can be stored at once, (it's rounded up to the
+    /// closest power of two).
+    explicit SpscQueue(const size_t &capacity = INITIAL_CAPACITY)
+        : buffer(GrowthPolicy::NextPowerOfTwo(std::max(capacity, (size_t)2))) { }
+
+    /// @brief Concurrent Queues can't be copied, since other threads might be using them.
+    SpscQueue(const SpscQueue<T> &reference) = delete;
+
+    ~SpscQueue() = default;
+
+private:
+    /// @brief The circular buffer that holds the elements, (its length is always a power of two).
+    Array<T> buffer;
+    /// @brief The position of the next element to be popped, written by the consumer only.
+    alignas(CACHE_LINE_SIZE) std::atomic<size_t> head { 0 };
+    /// @brief The last position of the tail seen by the consumer.
+    size_t cachedTail = 0;
+    /// @brief The position of the next element to be pushed, written by the producer only.
+    alignas(CACHE_LINE_SIZE) std::atomic<size_t> tail { 0 };
+    /// @brief The last position of the head seen by the producer.
+    size_t cachedHead = 0;
+
+public:
+    /// @brief The initial value of the Queue capacity if unspecified by the consumer.
+    static constexpr size_t INITIAL_CAPACITY = 1024;
+
+    /// @brief The amount of elements the Queue can hold at once.
+    /// @return The capacity of the Queue.
+    size_t Capacity() const { return buffer.Length(); }
+    /// @brief The amount of elements currently stored within the Queue, (it may be outdated
+    /// as soon as it's returned if the other thread is active).
+    /// @return The elements count of the Queue.
+    size_t Count() const { return tail.load(std::memory_order_acquire) - head.load(std::memory_order_acquire); }
+    /// @brief Indicates whether or not the Queue has currently no elements.
+    /// @return A boolean representing whether or not the Queue is empty.
+    bool IsEmpty() const { return !Count(); }
+
+    /// @brief Adds an element to the front of the Queue if there's space, (producer only).
+    /// @param element The value of the element that'll be copied into the Queue.
+    /// @return A boolean representing whether or not the element has been added.
+    bool TryPush(const T &element) { return TryEmplace(element); }
+
+    /// @brief Adds an element to the front of the Queue if there's space, (producer only).
+    /// @param element The value of the element that'll be moved into the Queue.
+    /// @return A boolean representing whether or not the element has been added.
+    bool TryPush(T &&element) { return TryEmplace(std::move(element)); }
+
+    /// @brief Adds an element to the front of the Queue, waiting for space if it's full, (producer only).
+    /// @param element The value of the element that'll be copied into the Queue.
+    void Push(const T &element) { while (!TryPush(element)) { std::this_thread::yield(); } }
+
+    /// @brief Adds an element to the front of the Queue, waiting for space if it's full, (producer only).
+    /// @param element The value of the element that'll be moved into the Queue.
+    void Push(T &&element) { while (!TryPush(std::move(element))) { std::this_thread::yield(); } }
+
+    /// @brief Adds an Array to the front of the Queue, publishing as many elements at once as
+    /// there's space for, (producer only).
+    /// @param array The Array that'll be added to the front of the Queue.
+    void PushRange(const Array<T> &array) { PushRange(array.Length(), array.begin()); }
+
+    /// @brief Adds a range of elements to the front of the Queue, publishing as many elements at once as
+    /// there's space for, (producer only).
+    /// @param length The amount of elements that'll be added to the front of the Queue.
+    /// @param data A pointer to an array in memory, that has some values that'll be added to the front of the Queue.
+    void PushRange(const size_t &length, const T* data)
+    {
+        for (size_t pushedCount = 0; pushedCount < length; )
+        {
+            size_t currentTail = tail.load(std::memory_order_relaxed);
+            if (currentTail - cachedHead == buffer.Length())
+            {
+                cachedHead = head.load(std::memory_order_acquire);
+                if (currentTail - cachedHead == buffer.Length()) { std::this_thread::yield(); continue; }
+            }
+
+            size_t batchLength = std::min(length - pushedCount, buffer.Length() - (currentTail - cachedHead));
+            for (size_t i = 0; i < batchLength; i++)
+            { buffer.begin()[(currentTail + i) & (buffer.Length() - 1)] = data[pushedCount + i]; }
+
+            tail.store(currentTail + batchLength, std::memory_order_release);
+            pushedCount += batchLength;
+        }
+    }
+
+    /// @brief Retrieves the element that is at the back of the Queue if there's any, (consumer only).
+    /// @param element The reference that'll be assigned the value of the popped element.
+    /// @return A boolean representing whether or not an element has been popped.
+    bool TryPop(T &element)
+    {
+        size_t currentHead = head.load(std::memory_order_relaxed);
+        if (currentHead == cachedTail)
+        {
+            cachedTail = tail.load(std::memory_order_acquire);
+            if (currentHead == cachedTail) { return false; }
+        }
+
+        element = std::move(buffer.begin()[currentHead & (buffer.Length() - 1)]);
+        head.store(currentHead + 1, std::memory_order_release);
+        return true;
+    }
+
+    /// @brief Retrieves the element that is at the back of the Queue, waiting for one if it's empty,
+    /// (consumer only).
+    /// @return The value of the element that was at the back of the Queue.
+    T Pop()
+    {
+        T element;
+        while (!TryPop(element)) { std::this_thread::yield(); }
+        return element;
+    }
+
+    /// @brief Concurrent Queues can't be copied, since other threads might be using them.
+    SpscQueue<T> &operator=(const SpscQueue<T> &reference) = delete;
+
+private:
+    /// @brief Adds an element to the front of the Queue if there's space.
+    /// @tparam T_ The type of the given element reference.
+    /// @param element The value of the element that'll be added.
+    /// @return A boolean representing whether or not the element has been added.
+    template<typename T_>
+    bool TryEmplace(T_ &&element)
+    {
+        size_t currentTail = tail.load(std::memory_order_relaxed);
+        if (currentTail - cachedHead == buffer.Length())
+        {
+            cachedHead = head.load(std::memory_order_acquire);
+            if (currentTail - cachedHead == buffer.Length()) { return false; }
+        }
+
+        buffer.begin()[currentTail & (buffer.Length() - 1)] = std::forward<T_>(element);
+        tail.store(currentTail + 1, std::memory_order_release);
+        return true;
+    }
+};
+
+/// @brief A bounded Queue that's safe to be used by many producer and consumer threads at the same time
+/// without locks, where each slot of the circular buffer carries a sequence number telling whether it's
+/// ready to be written or read for a given round, (Vyukov's bounded queue).
+/// @tparam T The type of the data stored within the Queue.
+template<typename T>
+class MpmcQueue
+{
+public:
+    /// @brief Creates a new empty Queue with a defined capacity.
+    /// @param capacity The amount of elements that can be stored at once, (it's rounded up to the
+    /// closest power of two).
+    explicit MpmcQueue(const size_t &capacity = INITIAL_CAPACITY)
+        : cells(GrowthPolicy::NextPowerOfTwo(std::max(capacity, (size_t)2)))
+    { for (size_t i = 0; i < cells.Length(); i++) { cells.begin()[i].Sequence.store(i, std::memory_order_relaxed); } }
+
+    /// @brief Concurrent Queues can't be copied, since other threads might be using them.
+    MpmcQueue(const MpmcQueue<T> &reference) = delete;
+
+    ~MpmcQueue() = default;
+
+private:
+    /// @brief A slot of the circular buffer, along with the round it's ready for.
+    struct Cell
+    {
+        /// @brief Equals the position of a push that can write this slot, or that position plus one
+        /// once it's been written and can be read.
+        std::atomic<size_t> Sequence;
+        /// @brief The element stored within the slot.
+        T Data;
+    };
+
+    /// @brief The circular buffer of slots, (its length is always a power of two).
+    Array<Cell> cells;
+    /// @brief The position of the next push.
+    alignas(CACHE_LINE_SIZE) std::atomic<size_t> enqueuePosition { 0 };
+    /// @brief The position of the next pop.
+    alignas(CACHE_LINE_SIZE) std::atomic<size_t> dequeuePosition { 0 };
+
+public:
+    /// @brief The initial value of the Queue capacity if unspecified by the consumer.
+    static constexpr size_t INITIAL_CAPACITY = 1024;
+
+    /// @brief The amount of elements the Queue can hold at once.
+    /// @return The capacity of the Queue.
+    size_t Capacity() const { return cells.Length(); }
+    /// @brief The amount of elements currently stored within the Queue, (it may be outdated
+    /// as soon as it's returned if other threads are active).
+    /// @return The elements count of the Queue.
+    size_t Count() const
+    {
+        size_t dequeued = dequeuePosition.load(std::memory_order_acquire),
+            enqueued = enqueuePosition.load(std::memory_order_acquire);
+        return enqueued > dequeued ? enqueued - dequeued : 0;
+    }
+    /// @brief Indicates whether or not the Queue has currently no elements.
+    /// @return A boolean representing whether or not the Queue is empty.
+    bool IsEmpty() const { return !Count(); }
+
+    /// @brief Adds an element to the front of the Queue if there's space.
+    /// @param element The value of the element that'll be copied into the Queue.
+    /// @return A boolean representing whether or not the element has been added.
+    bool TryPush(const T &element) { return TryEmplace(element); }
+
+    /// @brief Adds an element to the front of the Queue if there's space.
+    /// @param element The value of the element that'll be moved into the Queue.
+    /// @return A boolean representing whether or not the element has been added.
+    bool TryPush(T &&element) { return TryEmplace(std::move(element)); }
+
+    /// @brief Adds an element to the front of the Queue, waiting for space if it's full.
+    /// @param element The value of the element that'll be copied into the Queue.
+    void Push(const T &element) { while (!TryPush(element)) { std::this_thread::yield(); } }
+
+    /// @brief Adds an element to the front of the Queue, waiting for space if it's full.
+    /// @param element The value of the element that'll be moved into the Queue.
+    void Push(T &&element) { while (!TryPush(std::move(element))) { std::this_thread::yield(); } }
+
+    /// @brief Adds an Array to the front of the Queue, (the elements of different producers may interleave).
+    /// @param array The Array that'll be added to the front of the Queue.
+    void PushRange(const Array<T> &array) { PushRange(array.Length(), array.begin()); }
+
+    /// @brief Adds a range of elements to the front of the Queue, (the elements of different producers may interleave).
+    /// @param length The amount of elements that'll be added to the front of the Queue.
+    /// @param data A pointer to an array in memory, that has some values that'll be added to the front of the Queue.
+    void PushRange(const size_t &length, const T* data) { for (size_t i = 0; i < length; i++) { Push(data[i]); } }
+
+    /// @brief Retrieves the element that is at the back of the Queue if there's any.
+    /// @param element The reference that'll be assigned the value of the popped element.
+    /// @return A boolean representing whether or not an element has been popped.
+    bool TryPop(T &element)
+    {
+        size_t position = dequeuePosition.load(std::memory_order_relaxed);
+        Cell* cell;
+
+        for ( ; ; )
+        {
+            cell = cells.begin() + (position & (cells.Length() - 1));
+            intptr_t difference = (intptr_t)cell->Sequence.load(std::memory_order_acquire) - (intptr_t)(position + 1);
+
+            if (!difference)
+            { if (dequeuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) { break; } }
+            else if (difference < 0) { return false; }
+            else { position = dequeuePosition.load(std::memory_order_relaxed); }
+        }
+
+        element = std::move(cell->Data);
+        cell->Sequence.store(position + cells.Length(), std::memory_order_release);
+        return true;
+    }
+
+    /// @brief Retrieves the element that is at the back of the Queue, waiting for one if it's empty.
+    /// @return The value of the element that was at the back of the Queue.
+    T Pop()
+    {
+        T element;
+        while (!TryPop(element)) { std::this_thread::yield(); }
+        return element;
+    }
+
+    /// @brief Concurrent Queues can't be copied, since other threads might be using them.
+    MpmcQueue<T> &operator=(const MpmcQueue<T> &reference) = delete;
+
+private:
+    /// @brief Adds an element to the front of the Queue if there's space, by claiming the slot of
+    /// the next push position once its sequence says it's free for this round.
+    /// @tparam T_ The type of the given element reference.
+    /// @param element The value of the element that'll be added.
+    /// @return A boolean representing whether or not the element has been added.
+    template<typename T_>
+    bool TryEmplace(T_ &&element)
+    {
+        size_t position = enqueuePosition.load(std::memory_order_relaxed);
+        Cell* cell;
+
+        for ( ; ; )
+        {
+            cell = cells.begin() + (position & (cells.Length() - 1));
+            intptr_t difference = (intptr_t)cell->Sequence.load(std::memory_order_acquire) - (intptr_t)position;
+
+            if (!difference)
+            { if (enqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) { break; } }
+            else if (difference < 0) { return false; }
+            else { position = enqueuePosition.load(std::memory_order_relaxed); }
+        }
+
+        cell->Data = std::forward<T_>(element);
+        cell->Sequence.store(position + 1, std::memory_order_release);
+        return true;
+    }
+};
+
+/// @brief An unbounded Queue that's safe to be used by many producer and consumer threads at the same
+/// time without locks, made out of linked Nodes (Michael-Scott's queue), where the Nodes are carved out
+/// of geometrically growing segments and recycled through a lock-free free list, (a concurrent version
+/// of the Node Pool), and are never returned to the system until the Queue is destroyed, so a thread
+/// that's been overtaken may still safely read a recycled Node, and notices it with the tags.
+/// @tparam T The type of the data stored within the Queue, (it must be trivially copyable, since a
+/// recycled Node might be read by an overtaken thread while being written by another, so the data is
+/// stored as atomic words).
+template<typename T>
+class ConcurrentLinkedQueue
+{
+    static_assert(std::is_trivially_copyable_v<T>, "The data of a Concurrent Linked Queue must be trivially copyable.");
+
+    /// @brief The amount of the atomic words the data of a Node is stored within.
+    static constexpr size_t DATA_WORD_COUNT = (sizeof(T) + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+
+public:
+    /// @brief Creates a new empty Queue, with a dummy Node that its head and tail point to.
+    ConcurrentLinkedQueue()
+    {
+        uint32_t dummyIndex = AllocateNode();
+        head.store(Pack(dummyIndex, 0), std::memory_order_relaxed);
+        tail.store(Pack(dummyIndex, 0), std::memory_order_relaxed);
+    }
+
+    /// @brief Concurrent Queues can't be copied, since other threads might be using them.
+    ConcurrentLinkedQueue(const ConcurrentLinkedQueue<T> &reference) = delete;
+
+    ~ConcurrentLinkedQueue()
+    { for (auto &&segment : segments) { delete[] segment.load(std::memory_order_relaxed); } }
+
+private:
+    /// @brief A linked block of the Queue, that's referred to by its index within the segments.
+    struct Node
+    {
+        /// @brief The tagged index of the next Node within the Queue.
+        std::atomic<uint64_t> Next { Pack(NULL_INDEX, 0) };
+        /// @brief The index of the next Node within the free list.
+        std::atomic<uint32_t> NextFree { NULL_INDEX };
+        /// @brief The words of the data stored within the Node, which are atomic, since an overtaken consumer
+        /// may read them while a producer writes them after the Node has been recycled.
+        std::atomic<uint64_t> DataWords[DATA_WORD_COUNT] = { };
+
+        /// @brief Stores data within the Node, (the storing is published by the release of its linking).
+        /// @param data The value of the data.
+        void StoreData(const T &data)
+        {
+            uint64_t words[DATA_WORD_COUNT] = { };
+            std::memcpy(words, &data, sizeof(T));
+            for (size_t i = 0; i < DATA_WORD_COUNT; i++) { DataWords[i].store(words[i], std::memory_order_relaxed); }
+        }
+
+        /// @brief Loads the data stored within the Node, (it may be torn if the Node has been recycled
+        /// meanwhile, which the tag of the head tells before the data is used).
+        /// @return The value of the data.
+        T LoadData() const
+        {
+            uint64_t words[DATA_WORD_COUNT];
+            for (size_t i = 0; i < DATA_WORD_COUNT; i++) { words[i] = DataWords[i].load(std::memory_order_relaxed); }
+
+            T data;
+            std::memcpy(&data, words, sizeof(T));
+            return data;
+        }
+    };
+
+    /// @brief The index that refers to no Node.
+    static constexpr uint32_t NULL_INDEX = UINT32_MAX;
+    /// @brief The amount of Nodes within the first segment, (each segment afterwards is twice as large).
+    static constexpr uint32_t INITIAL_SEGMENT_LENGTH = 64;
+    /// @brief The maximum amount of segments, which covers every possible index.
+    static constexpr size_t SEGMENT_COUNT = 32;
+
+    /// @brief The tagged index of the dummy Node, that the next Node of is the first to leave.
+    alignas(CACHE_LINE_SIZE) std::atomic<uint64_t> head { 0 };
+    /// @brief The tagged index of the last Node, (or the one before it if it's lagging behind).
+    alignas(CACHE_LINE_SIZE) std::atomic<uint64_t> tail { 0 };
+    /// @brief The tagged index of the first Node within the free list.
+    alignas(CACHE_LINE_SIZE) std::atomic<uint64_t> freeNodes { Pack(NULL_INDEX, 0) };
+    /// @brief The index of the first Node that has never been used.
+    std::atomic<uint32_t> nextUnusedIndex { 0 };
+    /// @brief The segments of Nodes, which are allocated once they're first needed.
+    std::atomic<Node*> segments[SEGMENT_COUNT] = { };
+
+public:
+    /// @brief Indicates whether or not the Queue has currently no elements, (it may be outdated
+    /// as soon as it's returned if other threads are active).
+    /// @return A boolean representing whether or not the Queue is empty.
+    bool IsEmpty() const
+    { return IndexOf(NodeAt(IndexOf(head.load(std::memory_order_acquire))).Next.load(std::memory_order_acquire)) == NULL_INDEX; }
+
+    /// @brief Adds an element to the front of the Queue.
+    /// @param element The value of the element that'll be copied into the Queue.
+    void Push(const T &element)
+    {
+        uint32_t index = AllocateNode();
+        Node &node = NodeAt(index);
+
+        node.StoreData(element);
+        node.Next.store(Pack(NULL_INDEX, TagOf(node.Next.load(std::memory_order_relaxed)) + 1), std::memory_order_relaxed);
+
+        for ( ; ; )
+        {
+            uint64_t currentTail = tail.load(std::memory_order_acquire);
+            Node &tailNode = NodeAt(IndexOf(currentTail));
+            uint64_t next = tailNode.Next.load(std::memory_order_acquire);
+
+            if (currentTail != tail.load(std::memory_order_acquire)) { continue; }
+
+            if (IndexOf(next) != NULL_INDEX)
+            {
+                // The tail is lagging behind, so it's helped forward before trying again.
+                tail.compare_exchange_weak(currentTail, Pack(IndexOf(next), TagOf(currentTail) + 1), std::memory_order_release, std::memory_order_relaxed);
+                continue;
+            }
+
+            if (tailNode.Next.compare_exchange_weak(next, Pack(index, TagOf(next) + 1), std::memory_order_release, std::memory_order_relaxed))
+            {
+                tail.compare_exchange_strong(currentTail, Pack(index, TagOf(currentTail) + 1), std::memory_order_release, std::memory_order_relaxed);
+                return;
+            }
+        }
+    }
+
+    /// @brief Adds an Array to the front of the Queue, (the elements of different producers may interleave).
+    /// @param array The Array that'll be added to the front of the Queue.
+    void PushRange(const Array<T> &array) { PushRange(array.Length(), array.begin()); }
+
+    /// @brief Adds a range of elements to the front of the Queue, (the elements of different producers may interleave).
+    /// @param length The amount of elements that'll be added to the front of the Queue.
+    /// @param data A pointer to an array in memory, that has some values that'll be added to the front of the Queue.
+    void PushRange(const size_t &length, const T* data) { for (size_t i = 0; i < length; i++) { Push(data[i]); } }
+
+    /// @brief Retrieves the element that is at the back of the Queue if there's any.
+    /// @param element The reference that'll be assigned the value of the popped element.
+    /// @return A boolean representing whether or not an element has been popped.
+    bool TryPop(T &element)
+    {
+        for ( ; ; )
+        {
+            uint64_t currentHead = head.load(std::memory_order_acquire),
+                currentTail = tail.load(std::memory_order_acquire),
+                next = NodeAt(IndexOf(currentHead)).Next.load(std::memory_order_acquire);
+
+            if (currentHead != head.load(std::memory_order_acquire)) { continue; }
+
+            if (IndexOf(currentHead) == IndexOf(currentTail))
+            {
+                if (IndexOf(next) == NULL_INDEX) { return false; }
+
+                tail.compare_exchange_weak(currentTail, Pack(IndexOf(next), TagOf(currentTail) + 1), std::memory_order_release, std::memory_order_relaxed);
+                continue;
+            }
+
+            // The data is read before claiming the Node, since it may be recycled right after, (the read is atomic,
+            // so a racing producer only tears it, and the failing exchange discards it then).
+            T data = NodeAt(IndexOf(next)).LoadData();
+            if (head.compare_exchange_weak(currentHead, Pack(IndexOf(next), TagOf(currentHead) + 1), std::memory_order_acq_rel, std::memory_order_relaxed))
+            {
+                element = data;
+                FreeNode(IndexOf(currentHead));
+                return true;
+            }
+        }
+    }
+
+    /// @brief Retrieves the element that is at the back of the Queue, waiting for one if it's empty.
+    /// @return The value of the element that was at the back of the Queue.
+    T Pop()
+    {
+        T element;
+        while (!TryPop(element)) { std::this_thread::yield(); }
+        return element;
+    }
+
+    /// @brief Concurrent Queues can't be copied, since other threads might be using them.
+    ConcurrentLinkedQueue<T> &operator=(const ConcurrentLinkedQueue<T> &reference) = delete;
+
+private:
+    /// @brief Packs an index with a tag, that's incremented on every change so a stale index can't be
+    /// mistaken for a current one, (the ABA problem).
+    /// @param index The index of the Node.
+    /// @param tag The tag of the index.
+    /// @return The tagged index.
+    static constexpr uint64_t Pack(const uint32_t &index, const uint64_t &tag) { return (tag << 32) | index; }
+    /// @brief Extracts the index out of a tagged index.
+    /// @param taggedIndex The tagged index.
+    /// @return The index of the Node.
+    static uint32_t IndexOf(const uint64_t &taggedIndex) { return (uint32_t)taggedIndex; }
+    /// @brief Extracts the tag out of a tagged index.
+    /// @param taggedIndex The tagged index.
+    /// @return The tag of the index.
+    static uint64_t TagOf(const uint64_t &taggedIndex) { return taggedIndex >> 32; }
+
+    /// @brief Finds the segment that a Node index belongs to.
+    /// @param index The index of the Node.
+    /// @param offset The reference that'll be assigned the position of the Node within its segment.
+    /// @return The index of the segment.
+    static size_t SegmentOf(const uint32_t &index, size_t &offset)
+    {
+        uint64_t shiftedIndex = (uint64_t)index + INITIAL_SEGMENT_LENGTH;
+        size_t segment = 63 - CountLeadingZeros(shiftedIndex) - 6;
+
+        offset = shiftedIndex - ((uint64_t)INITIAL_SEGMENT_LENGTH << segment);
+        return segment;
+    }
+
+    /// @brief Accesses a Node by its index.
+    /// @param index The index of the Node, (its segment must have been allocated).
+    /// @return The reference of the Node.
+    Node &NodeAt(const uint32_t &index) const
+    {
+        size_t offset, segment = SegmentOf(index, offset);
+        return segments[segment].load(std::memory_order_acquire)[offset];
+    }
+
+    /// @brief Takes a Node out of the free list, or claims a Node that has never been used, (allocating
+    /// its segment if it's the first to need it).
+    /// @return The index of the Node.
+    uint32_t AllocateNode()
+    {
+        uint64_t firstFree = freeNodes.load(std::memory_order_acquire);
+        while (IndexOf(firstFree) != NULL_INDEX)
+        {
+            uint32_t nextFree = NodeAt(IndexOf(firstFree)).NextFree.load(std::memory_order_relaxed);
+            if (freeNodes.compare_exchange_weak(firstFree, Pack(nextFree, TagOf(firstFree) + 1), std::memory_order_acquire, std::memory_order_acquire))
+            { return IndexOf(firstFree); }
+        }
+
+        uint32_t index = nextUnusedIndex.fetch_add(1, std::memory_order_relaxed);
+        if (index == NULL_INDEX) { throw std::bad_alloc(); }
+
+        size_t offset, segment = SegmentOf(index, offset);
+        if (!segments[segment].load(std::memory_order_acquire))
+        {
+            Node* newSegment = new Node[(size_t)INITIAL_SEGMENT_LENGTH << segment];
+            Node* expectedSegment = nullptr;
+            if (!segments[segment].compare_exchange_strong(expectedSegment, newSegment, std::memory_order_acq_rel))
+            { delete[] newSegment; }
+        }
+
+        return index;
+    }
+
+    /// @brief Puts a Node within the free list, to be reused by the next push.
+    /// @param index The index of the Node.
+    void FreeNode(const uint32_t &index)
+    {
+        Node &node = NodeAt(index);
+        uint64_t firstFree = freeNodes.load(std::memory_order_relaxed);
+
+        do { node.NextFree.store(IndexOf(firstFree), std::memory_order_relaxed); }
+        while (!freeNodes.compare_exchange_weak(firstFree, Pack(index, TagOf(firstFree) + 1), std::memory_order_release, std::memory_order_relaxed));
+    }
+};
+
+#endif
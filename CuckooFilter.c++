@@ -0,0 +1,265 @@
+#include<iostream>
+
+#ifndef CUCKOO_FILTER
+#define CUCKOO_FILTER
+
+#include<algorithm>
+#include<cmath>
+#include<cstdint>
+#include<type_traits>
+#include<utility>
+
+#include "Array.c++"
+#include "GrowthPolicy.c++"
+#include "Algorithms/Hasher.c++"
+
+/// @brief A probabilistic set that tells whether an element is definitely not presented, or might be presented,
+/// by keeping a short fingerprint of every element within one of two buckets, (unlike a Bloom Filter, the elements
+/// can be removed, and no false negatives ever happen as long as only added elements are removed).
+/// @tparam T The type of the elements.
+/// @tparam TFingerprint The unsigned integral type of the fingerprints, (each bit of them halves the false positive rate).
+/// @tparam THasher The function object that hashes the elements by their values.
+template<typename T, typename TFingerprint = uint16_t, typename THasher = Hasher<T>>
+class CuckooFilter
+{
+    static_assert(std::is_unsigned_v<TFingerprint> && !std::is_same_v<TFingerprint, bool>,
+        "The fingerprints must be of an unsigned integral type.");
+
+public:
+    /// @brief The amount of fingerprints within each bucket.
+    static constexpr size_t BUCKET_SIZE = 4;
+    /// @brief The maximum amount of fingerprints that get kicked into their alternate buckets to make room for an element.
+    static constexpr size_t MAXIMUM_KICK_COUNT = 500;
+    /// @brief The fraction of the slots the Cuckoo Filter is sized to fill, (the kicking rarely fails below it).
+    static constexpr double MAXIMUM_LOAD_FACTOR = 0.95;
+
+    /// @brief Creates a new empty Cuckoo Filter of a single bucket.
+    CuckooFilter() : CuckooFilter(BUCKET_SIZE) { }
+
+    /// @brief Creates a new empty Cuckoo Filter sized to hold a defined amount of elements.
+    /// @param capacity The amount of elements that'll be added to the Cuckoo Filter, (the buckets count is rounded
+    /// up to the closest power of two).
+    /// @param hasher The function object that'll be used to hash the elements by their values.
+    /// @param hashingSeed An initial value that determines the outcome of the hasher.
+    explicit CuckooFilter(const size_t &capacity, const THasher &hasher = THasher(), const size_t &hashingSeed = 0)
+        : buckets(GrowthPolicy::NextPowerOfTwo((size_t)std::ceil(capacity / (BUCKET_SIZE * MAXIMUM_LOAD_FACTOR))), Bucket()),
+        hasher(hasher), hashingSeed(hashingSeed) { }
+
+    /// @brief Creates a new Cuckoo Filter by copying another Cuckoo Filter as reference.
+    /// @param reference The reference of the Cuckoo Filter that'll be copied.
+    CuckooFilter(const CuckooFilter<T, TFingerprint, THasher> &reference) = default;
+
+    /// @brief Creates a new Cuckoo Filter by taking over the buckets of another Cuckoo Filter.
+    /// @param reference The reference of the Cuckoo Filter that'll be moved.
+    CuckooFilter(CuckooFilter<T, TFingerprint, THasher> &&reference) noexcept = default;
+
+    /// @brief Copies a Cuckoo Filter into another.
+    /// @param reference The reference of the Cuckoo Filter that'll be copied.
+    /// @return The result of the copying.
+    CuckooFilter<T, TFingerprint, THasher> &operator=(const CuckooFilter<T, TFingerprint, THasher> &reference) = default;
+
+    /// @brief Moves a Cuckoo Filter into another, by taking over its buckets.
+    /// @param reference The reference of the Cuckoo Filter that'll be moved.
+    /// @return The result of the moving.
+    CuckooFilter<T, TFingerprint, THasher> &operator=(CuckooFilter<T, TFingerprint, THasher> &&reference) noexcept = default;
+
+private:
+    /// @brief The amount of bits of each fingerprint.
+    static constexpr size_t FINGERPRINT_BIT_COUNT = sizeof(TFingerprint) * 8;
+
+    /// @brief The fingerprints of the elements that are hashed into the same bucket, (where zero marks an empty slot).
+    struct Bucket
+    {
+        /// @brief The slots of the fingerprints.
+        TFingerprint Fingerprints[BUCKET_SIZE] = { };
+    };
+
+    /// @brief The buckets of the fingerprints, (their count is always a power of two).
+    Array<Bucket> buckets;
+    /// @brief The amount of elements currently stored within the Cuckoo Filter.
+    size_t count = 0;
+    /// @brief Indicates whether or not a kicked fingerprint couldn't be placed, which makes the Cuckoo Filter full.
+    bool hasVictim = false;
+    /// @brief The fingerprint that couldn't be placed.
+    TFingerprint victimFingerprint = 0;
+    /// @brief One of the two buckets of the fingerprint that couldn't be placed.
+    size_t victimIndex = 0;
+    /// @brief The state of the generator that picks the kicked fingerprints.
+    uint64_t randomState = 0x9E3779B97F4A7C15ULL;
+    /// @brief The function object that'll be used for hashing the elements.
+    THasher hasher;
+    /// @brief The initial value that determines the outcome of the hasher.
+    size_t hashingSeed = 0;
+
+public:
+    /// @brief The amount of elements the Cuckoo Filter can maximally hold.
+    /// @return The capacity of the Cuckoo Filter.
+    size_t Capacity() const { return buckets.Length() * BUCKET_SIZE; }
+    /// @brief The amount of elements currently stored within the Cuckoo Filter.
+    /// @return The elements count of the Cuckoo Filter.
+    size_t Count() const { return count; }
+    /// @brief The fraction of the slots that are occupied.
+    /// @return The load factor of the Cuckoo Filter.
+    double LoadFactor() const { return count / (double)Capacity(); }
+
+    /// @brief Indicates whether or not the Cuckoo Filter has currently no elements.
+    /// @return A boolean representing whether or not the Cuckoo Filter is empty.
+    bool IsEmpty() const { return !count; }
+
+    /// @brief Indicates whether or not the Cuckoo Filter has run out of room, so no more elements can be added
+    /// until one is removed.
+    /// @return A boolean representing whether or not the Cuckoo Filter is full.
+    bool IsFull() const { return hasVictim; }
+
+    /// @brief Estimates the current chance of an unadded element to be reported as presented, by the chance of its
+    /// fingerprint to match any of the occupied slots of its two buckets.
+    /// @return The estimated false positive rate of the Cuckoo Filter.
+    double EstimatedFalsePositiveRate() const
+    { return 1 - std::pow(1 - std::pow(2.0, -(double)FINGERPRINT_BIT_COUNT), 2 * BUCKET_SIZE * LoadFactor()); }
+
+    /// @brief Adds an element to the Cuckoo Filter, by placing its fingerprint within any of its two buckets, or by
+    /// kicking the fingerprints of other elements into their alternate buckets if both are full.
+    /// @param element The element that'll be added, (adding the same element twice needs removing it twice).
+    /// @return False if the Cuckoo Filter is full, or true if the element has been added.
+    bool Add(const T &element)
+    {
+        if (hasVictim) { return false; }
+
+        size_t index;
+        TFingerprint fingerprint = FingerprintOf(element, index);
+        size_t alternateIndex = AlternateIndexOf(index, fingerprint);
+
+        count++;
+        if (Place(index, fingerprint) || Place(alternateIndex, fingerprint)) { return true; }
+
+        index = NextRandom() & 1 ? index : alternateIndex;
+        for (size_t kick = 0; kick < MAXIMUM_KICK_COUNT; kick++)
+        {
+            std::swap(fingerprint, buckets.begin()[index].Fingerprints[NextRandom() % BUCKET_SIZE]);
+
+            index = AlternateIndexOf(index, fingerprint);
+            if (Place(index, fingerprint)) { return true; }
+        }
+
+        // The last kicked fingerprint is kept aside, so no added element gets lost while the Cuckoo Filter is full.
+        hasVictim = true;
+        victimFingerprint = fingerprint;
+        victimIndex = index;
+        return true;
+    }
+
+    /// @brief Checks whether or not an element might be presented within the Cuckoo Filter.
+    /// @param element The element that'll be checked.
+    /// @return False if the element is definitely not presented, or true if it might be.
+    bool MayContain(const T &element) const
+    {
+        size_t index;
+        TFingerprint fingerprint = FingerprintOf(element, index);
+        size_t alternateIndex = AlternateIndexOf(index, fingerprint);
+
+        return Find(index, fingerprint) || Find(alternateIndex, fingerprint) || IsVictim(index, alternateIndex, fingerprint);
+    }
+
+    /// @brief Removes an element from the Cuckoo Filter, (removing an element that hasn't been added might remove
+    /// another element that shares its fingerprint and buckets).
+    /// @param element The element that'll be removed.
+    /// @return A boolean representing whether or not a fingerprint of the element has been found and removed.
+    bool Remove(const T &element)
+    {
+        size_t index;
+        TFingerprint fingerprint = FingerprintOf(element, index);
+        size_t alternateIndex = AlternateIndexOf(index, fingerprint);
+
+        if (IsVictim(index, alternateIndex, fingerprint)) { hasVictim = false; }
+        else
+        {
+            TFingerprint* slot = Find(index, fingerprint);
+            if (!slot) { slot = Find(alternateIndex, fingerprint); }
+            if (!slot) { return false; }
+
+            *slot = 0;
+            if (hasVictim && (Place(victimIndex, victimFingerprint) || Place(AlternateIndexOf(victimIndex, victimFingerprint), victimFingerprint)))
+            { hasVictim = false; }
+        }
+
+        count--;
+        return true;
+    }
+
+    /// @brief Clears every element from the Cuckoo Filter, (without releasing its memory).
+    void Clear()
+    {
+        for (Bucket &bucket : buckets) { bucket = Bucket(); }
+        count = 0;
+        hasVictim = false;
+    }
+
+private:
+    /// @brief Hashes an element into its fingerprint and its first bucket.
+    /// @param element The element that'll be hashed.
+    /// @param index The variable that'll receive the index of the first bucket of the element.
+    /// @return The fingerprint of the element, (which is never zero).
+    TFingerprint FingerprintOf(const T &element, size_t &index) const
+    {
+        uint64_t hashingValue = hasher(element, hashingSeed);
+        index = hashingValue & (buckets.Length() - 1);
+
+        // The upper bits of the hashing value make the fingerprint, so they're independent of the bucket index.
+        TFingerprint fingerprint = (TFingerprint)(hashingValue >> (64 - FINGERPRINT_BIT_COUNT));
+        return fingerprint ? fingerprint : 1;
+    }
+
+    /// @brief Finds the other bucket of a fingerprint, (applying it to either bucket gives the other one, so a kicked
+    /// fingerprint can be moved without knowing its element).
+    /// @param index The index of one of the buckets of the fingerprint.
+    /// @param fingerprint The fingerprint.
+    /// @return The index of the other bucket of the fingerprint.
+    size_t AlternateIndexOf(const size_t &index, const TFingerprint &fingerprint) const
+    { return (index ^ (size_t)MixBits(fingerprint)) & (buckets.Length() - 1); }
+
+    /// @brief Places a fingerprint within an empty slot of a bucket.
+    /// @param index The index of the bucket.
+    /// @param fingerprint The fingerprint that'll be placed.
+    /// @return A boolean representing whether or not the bucket had an empty slot.
+    bool Place(const size_t &index, const TFingerprint &fingerprint)
+    {
+        TFingerprint* slot = Find(index, 0);
+        if (slot) { *slot = fingerprint; }
+        return slot;
+    }
+
+    /// @brief Finds a fingerprint within a bucket.
+    /// @param index The index of the bucket.
+    /// @param fingerprint The fingerprint that'll be searched for, (or zero for an empty slot).
+    /// @return A pointer to the slot holding the fingerprint, or null pointer if unfound.
+    TFingerprint* Find(const size_t &index, const TFingerprint &fingerprint) const
+    {
+        TFingerprint* fingerprints = buckets.begin()[index].Fingerprints;
+        for (size_t i = 0; i < BUCKET_SIZE; i++)
+        {
+            if (fingerprints[i] == fingerprint) { return fingerprints + i; }
+        }
+
+        return nullptr;
+    }
+
+    /// @brief Checks whether or not a fingerprint, with its buckets, is the one that couldn't be placed.
+    /// @param index The index of the first bucket of the fingerprint.
+    /// @param alternateIndex The index of the other bucket of the fingerprint.
+    /// @param fingerprint The fingerprint.
+    /// @return A boolean representing whether or not the fingerprint is kept aside.
+    bool IsVictim(const size_t &index, const size_t &alternateIndex, const TFingerprint &fingerprint) const
+    { return hasVictim && victimFingerprint == fingerprint && (victimIndex == index || victimIndex == alternateIndex); }
+
+    /// @brief Generates the next pseudo-random value, (by a xorshift generator).
+    /// @return The generated value.
+    uint64_t NextRandom()
+    {
+        randomState ^= randomState << 13;
+        randomState ^= randomState >> 7;
+        randomState ^= randomState << 17;
+        return randomState;
+    }
+};
+
+#endif
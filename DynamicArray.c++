@@ -4,13 +4,36 @@
 #define DYNAMIC_ARRAY
 
 #include "Array.c++"
+#include "GrowthPolicy.c++"
+#include "Instrumentation.c++"
 #include "HashTable.c++"
+#include "SetOperations.c++"
 
 /// @brief Introduces the abstraction of the Hash Table class to the Dynamic Array class.
-/// @tparam T The type of the data stored within the Sparse Array.
-template <typename TKey, typename TValue>
+/// @tparam TKey The type of the keys stored within the Hash Table.
+/// @tparam TValue The type of the values stored within the Hash Table.
+/// @tparam THasher The function object that hashes the keys by their values.
+template <typename TKey, typename TValue, typename THasher>
 class HashTable;
 
+/// @brief A snapshot of the statistics of a Dynamic Array, where the counters stay zero unless the
+/// instrumentation is enabled, (by defining "DATA_STRUCTURES_INSTRUMENTATION").
+struct DynamicArrayStats
+{
+    /// @brief The amount of elements stored within the Dynamic Array.
+    size_t Count = 0;
+    /// @brief The amount of elements the Dynamic Array can hold before reallocating.
+    size_t Capacity = 0;
+    /// @brief The amount of memory blocks allocated for the elements, (including the reallocations).
+    size_t AllocationCount = 0;
+    /// @brief The total size of the memory blocks allocated for the elements.
+    size_t AllocatedByteCount = 0;
+    /// @brief The amount of times the elements have been moved into a new memory block.
+    size_t ReallocationCount = 0;
+    /// @brief The amount of elements moved to open or close a gap, by inserting or removing in the middle.
+    size_t ShiftedElementCount = 0;
+};
+
 /// @brief A data structure which is a basic Array, that can be expanded up or shrunk
 /// down by adding or removing elements from it.
 /// @tparam T The type of the data stored within the Dynamic Array.
@@ -19,73 +42,102 @@ class DynamicArray
 {
 public:
     /// @brief Makes the Hash Table class a friend with the Dynamic Array class.
-    template <typename TKey, typename TValue>
+    template <typename TKey, typename TValue, typename THasher>
     friend class HashTable;
 
-    /// @brief Creates a new empty Dynamic Array.
-    DynamicArray()
-    {
-        capacity = capacityModifier = INITIAL_CAPACITY;
-        array = Array<T>(capacity);
-    }
+    /// @brief Creates a new empty Dynamic Array, (no memory is allocated until the first element is added).
+    DynamicArray() : capacity(0) { }
 
     /// @brief Creates a new Dynamic Array with a defined capacity, to avoid copying the
     /// data if the initial capacity is known.
     /// @param capacity The amount of elements that'll be stored within the Dynamic Array.
-    /// @param capacityModifier The amount of increment the Dynamic Array capacity gets each time it runs
-    /// out of space to store more elements.
-    explicit DynamicArray(const size_t &capacity, const size_t capacityModifier = INITIAL_CAPACITY)
-    {
-        this->capacityModifier = capacityModifier;
-        this->capacity = (capacity / capacityModifier + 1) * capacityModifier;
-        array = Array<T>(this->capacity);
-    }
+    /// @param growthPolicy The way the Dynamic Array capacity grows each time it runs
+    /// out of space to store more elements, (a plain capacity modifier makes it grow linearly).
+    explicit DynamicArray(const size_t &capacity, const GrowthPolicy &growthPolicy = GrowthPolicy())
+        : capacity(growthPolicy.InitialCapacity(capacity)), growthPolicy(growthPolicy), array(this->capacity)
+    { INSTRUMENTED(CountAllocation(this->capacity);) }
 
     /// @brief Creates a new Dynamic Array from a defined Array, and basically takes all of its data.
     /// @param array The Array that'll be used to create the Dynamic Array.
-    /// @param capacityModifier The amount of increment the Dynamic Array capacity gets each time it runs
-    /// out of space to store more elements.
-    DynamicArray(const Array<T> &array, const size_t capacityModifier = INITIAL_CAPACITY)
+    /// @param growthPolicy The way the Dynamic Array capacity grows each time it runs
+    /// out of space to store more elements, (a plain capacity modifier makes it grow linearly).
+    /// @param executionPolicy The way the elements are copied, (in parallel chunks for large Arrays if not sequential).
+    DynamicArray(const Array<T> &array, const GrowthPolicy &growthPolicy = GrowthPolicy(),
+        const ExecutionPolicy &executionPolicy = ExecutionPolicy::Sequential)
+        : DynamicArray(array.Length(), growthPolicy)
     {
         count = array.Length();
-        this->capacityModifier = capacityModifier;
-        capacity = (array.Length() / capacityModifier + 1) * capacityModifier;
-        this->array = array.Resize(capacity);
+        Array<T>::CopyElements(array.data, this->array.data, count, executionPolicy);
     }
 
     /// @brief Creates a new Dynamic Array with a defined elements count and initial values.
     /// @param length The amount of elements that'll be stored within the Dynamic Array initially.
     /// @param data A pointer to an array in memory, that has some values that'll be
     /// stored within the Dynamic Array initially.
-    /// @param capacityModifier The amount of increment the Dynamic Array capacity gets each time it runs
-    /// out of space to store more elements.
-    DynamicArray(const size_t &length, T *data, const size_t capacityModifier = INITIAL_CAPACITY)
-        : DynamicArray(Array<T>(length, data), capacityModifier) {}
+    /// @param growthPolicy The way the Dynamic Array capacity grows each time it runs
+    /// out of space to store more elements, (a plain capacity modifier makes it grow linearly).
+    DynamicArray(const size_t &length, T *data, const GrowthPolicy &growthPolicy = GrowthPolicy())
+        : DynamicArray(Array<T>(length, data), growthPolicy) {}
+
+    /// @brief Creates a new Dynamic Array from a defined Array, by taking over its memory
+    /// instead of copying its elements.
+    /// @param array The Array that'll be moved into the Dynamic Array.
+    /// @param growthPolicy The way the Dynamic Array capacity grows each time it runs
+    /// out of space to store more elements, (a plain capacity modifier makes it grow linearly).
+    DynamicArray(Array<T> &&array, const GrowthPolicy &growthPolicy = GrowthPolicy())
+        : capacity(array.Length()), growthPolicy(growthPolicy), count(array.Length()), array(std::move(array)) { }
+
+    /// @brief Creates a new Dynamic Array by copying another Dynamic Array as reference.
+    /// @param reference The reference of the Dynamic Array that'll be copied.
+    DynamicArray(const DynamicArray<T> &reference) = default;
+
+    /// @brief Creates a new Dynamic Array by taking over the memory of another Dynamic Array,
+    /// which is left empty.
+    /// @param reference The reference of the Dynamic Array that'll be moved.
+    DynamicArray(DynamicArray<T> &&reference) noexcept
+        : capacity(reference.capacity), growthPolicy(reference.growthPolicy),
+        count(reference.count), array(std::move(reference.array)) { reference.capacity = reference.count = 0; }
 
     ~DynamicArray() = default;
 
 protected:
     /// @brief The amount of elements the Dynamic Array can maximally hold currently.
     size_t capacity;
-    /// @brief The amount of increment the Dynamic Array capacity gets each time it runs
+    /// @brief The way the Dynamic Array capacity grows each time it runs
     /// out of space to store more elements.
-    size_t capacityModifier;
+    GrowthPolicy growthPolicy;
     /// @brief The amount of elements currently stored within the Dynamic Array.
     size_t count = 0;
     /// @brief The current Array that holds the current stored element.
     Array<T> array;
+#if defined(DATA_STRUCTURES_INSTRUMENTATION)
+    /// @brief The counters of the allocations and the moved elements of the Dynamic Array.
+    DynamicArrayStats stats;
+#endif
 
 public:
-    /// @brief The initial value of the Dynamic Array capacity modifier if unspecified by the consumer.
-    static const size_t INITIAL_CAPACITY = 200;
-
     /// @brief The amount of elements the Dynamic Array can maximally hold currently.
     /// @return The capacity of the Dynamic Array.
     size_t Capacity() const { return capacity; }
     /// @brief The amount of increment the Dynamic Array capacity gets each time it runs
     /// out of space to store more elements.
-    /// @return The capacity modifier of the Dynamic Array.
-    size_t CapacityModifier() const { return capacityModifier; }
+    /// @return The capacity modifier of the Dynamic Array, or zero if it grows geometrically.
+    size_t CapacityModifier() const { return growthPolicy.CapacityModifier(); }
+    /// @brief The way the Dynamic Array capacity grows each time it runs
+    /// out of space to store more elements.
+    /// @return The Growth Policy of the Dynamic Array.
+    const GrowthPolicy &Growth() const { return growthPolicy; }
+    /// @brief Takes a snapshot of the statistics of the Dynamic Array.
+    /// @return The Dynamic Array Stats, (whose counters are zero unless the instrumentation is enabled).
+    DynamicArrayStats Stats() const
+    {
+        DynamicArrayStats snapshot;
+        INSTRUMENTED(snapshot = stats;)
+        snapshot.Count = count;
+        snapshot.Capacity = capacity;
+        return snapshot;
+    }
+
     /// @brief The amount of elements currently stored within the Dynamic Array.
     /// @return The elements count of the Dynamic Array.
     size_t Count() const { return count; }
@@ -102,23 +154,50 @@ public:
     bool IsEmpty() { return !count; }
 
     /// @brief Adds an element to the end of the Dynamic Array.
-    /// @param element The value of the element that'll be added to the Dynamic Array.
-    void Add(T element)
+    /// @param element The value of the element that'll be copied into the Dynamic Array.
+    void Add(const T &element)
+    {
+        // The element might live within this Dynamic Array, so it's copied before any reallocation.
+        if (count == capacity) { Add(T(element)); return; }
+
+        ExpandArray(1);
+        array.data[count - 1] = element;
+    }
+
+    /// @brief Adds an element to the end of the Dynamic Array.
+    /// @param element The value of the element that'll be moved into the Dynamic Array.
+    void Add(T &&element)
     {
+        if (count == capacity)
+        {
+            T movedElement(std::move(element));
+            ExpandArray(1);
+            array.data[count - 1] = std::move(movedElement);
+            return;
+        }
+
         ExpandArray(1);
-        array[count - 1] = T(element);
+        array.data[count - 1] = std::move(element);
+    }
+
+    /// @brief Constructs an element from a set of arguments, and adds it to the end of the Dynamic Array.
+    /// @tparam ...TArguments The types of the arguments given to the element constructor.
+    /// @param ...arguments The arguments that'll be forwarded to the element constructor.
+    /// @return The reference of the added element.
+    template <typename... TArguments>
+    T &Emplace(TArguments &&...arguments)
+    {
+        Add(T(std::forward<TArguments>(arguments)...));
+        return array.data[count - 1];
     }
 
     /// @brief Adds an Array of elements to the end of the Dynamic Array.
     /// @param array The Array that'll be added to the Dynamic Array.
-    void AddRange(const Array<T> &array)
+    /// @param policy The way the elements are copied, (in parallel chunks for large Arrays if not sequential).
+    void AddRange(const Array<T> &array, const ExecutionPolicy &policy = ExecutionPolicy::Sequential)
     {
         ExpandArray(array.Length());
-
-        for (size_t i = 0; i < array.Length(); i++)
-        {
-            this->array[i + count - array.Length()] = T(array[i]);
-        }
+        Array<T>::CopyElements(array.data, this->array.data + count - array.Length(), array.Length(), policy);
     }
 
     /// @brief Adds a range of elements to the end of the Dynamic Array.
@@ -126,21 +205,47 @@ public:
     /// @param data A pointer to an array in memory, that has some values that'll be added to the Dynamic Array.
     void AddRange(const size_t &length, T *data) { AddRange(Array<T>(length, data)); }
 
+    /// @brief Adds an Array of elements to the end of the Dynamic Array, by moving them out of it.
+    /// @param array The Array that its elements will be moved into the Dynamic Array.
+    void AddRange(Array<T> &&array)
+    {
+        ExpandArray(array.Length());
+        Array<T>::MoveElements(array.data, this->array.data + count - array.Length(), array.Length());
+    }
+
     /// @brief Adds an element into the Dynamic Array at a specified index.
-    /// @param element The value of the element that'll be inserted into the Dynamic Array.
+    /// @param element The value of the element that'll be copied into the Dynamic Array.
     /// @param index The order in which the desired element will be inserted at.
-    void Insert(T element, const size_t &index) noexcept(false)
+    void Insert(const T &element, const size_t &index) noexcept(false) { Insert(T(element), index); }
+
+    /// @brief Adds an element into the Dynamic Array at a specified index.
+    /// @param element The value of the element that'll be moved into the Dynamic Array.
+    /// @param index The order in which the desired element will be inserted at.
+    void Insert(T &&element, const size_t &index) noexcept(false)
     {
         if (index == count || (!index && !count))
         {
-            Add(element);
+            Add(std::move(element));
             return;
         }
 
         ValidateBoundaries(index);
         Shift(index);
 
-        array[index] = T(element);
+        array.data[index] = std::move(element);
+    }
+
+    /// @brief Constructs an element from a set of arguments, and adds it into the Dynamic Array
+    /// at a specified index.
+    /// @tparam ...TArguments The types of the arguments given to the element constructor.
+    /// @param index The order in which the constructed element will be inserted at.
+    /// @param ...arguments The arguments that'll be forwarded to the element constructor.
+    /// @return The reference of the inserted element.
+    template <typename... TArguments>
+    T &EmplaceAt(const size_t &index, TArguments &&...arguments) noexcept(false)
+    {
+        Insert(T(std::forward<TArguments>(arguments)...), index);
+        return array.data[index];
     }
 
     /// @brief Adds an Array of elements into the Dynamic Array at a specified index.
@@ -156,11 +261,7 @@ public:
 
         ValidateBoundaries(index);
         Shift(index, array.Length());
-
-        for (size_t i = 0; i < array.Length(); i++)
-        {
-            this->array[i + index] = T(array[i]);
-        }
+        Array<T>::CopyElements(array.data, this->array.data + index, array.Length(), ExecutionPolicy::Sequential);
     }
 
     /// @brief Adds a range of elements into the Dynamic Array at a specified index.
@@ -184,8 +285,10 @@ public:
 
     /// @brief Searches for an element in the Dynamic Array, and returns all of its occuring indices.
     /// @param element The value of the desired element.
+    /// @param policy The way the elements are searched through, (the indices stay in order either way).
     /// @return An Array filled with all of the element occuring indices, or an empty Array if unfound.
-    Array<size_t> IndicesOf(const T &element) const { return array.IndicesOf(element, count); }
+    Array<size_t> IndicesOf(const T &element, const ExecutionPolicy &policy = ExecutionPolicy::Sequential) const
+    { return array.IndicesOf(element, count, policy); }
 
     /// @brief Checks for the existence of an element in the Dynamic Array.
     /// @param element The value of the desired element.
@@ -227,18 +330,52 @@ public:
     /// @return A boolean representing whether or not the element has been removed.
     bool RemoveAll(const T &element)
     {
-        Array<size_t> indices = IndicesOf(element);
-        if (!indices.Length())
+        // The element might live within this Dynamic Array, so it's copied before the elements get moved over it.
+        T removedElement(element);
+        return RemoveIf([&](const T &element_) { return element_ == removedElement; }) != 0;
+    }
+
+    /// @brief Removes all the elements of the Dynamic Array that match a set of conditions, by moving the
+    /// kept elements over the removed ones in a single walk, (so every element is moved at most once).
+    /// @tparam TPredicate The type of the function that validates the elements.
+    /// @param predicate A function that takes an element and validates it throughout a set of conditions.
+    /// @return The amount of elements that have been removed.
+    template <typename TPredicate>
+    size_t RemoveIf(const TPredicate &predicate)
+    { return Compact(0, [&](const size_t &index) { return predicate(array.data[index]); }); }
+
+    /// @brief Removes the elements of the Dynamic Array at a set of indices, in a single walk.
+    /// @param sortedIndices The indices of the elements that'll be removed, (in a strictly ascending order).
+    void RemoveAtMany(const Array<size_t> &sortedIndices) noexcept(false)
+    {
+        if (!sortedIndices.Length()) { return; }
+        const size_t* indices = sortedIndices.begin();
+
+        for (size_t i = 1; i < sortedIndices.Length(); i++)
         {
-            return false;
+            if (indices[i - 1] < indices[i]) { continue; }
+            throw std::logic_error("The indices of the removed elements must be in a strictly ascending order.");
         }
+        ValidateBoundaries(indices[sortedIndices.Length() - 1]);
 
-        for (auto &&index : indices)
+        size_t nextIndex = 0;
+        Compact(indices[0], [&](const size_t &index)
         {
-            RemoveAt(index);
-        }
+            if (nextIndex == sortedIndices.Length() || indices[nextIndex] != index) { return false; }
 
-        return true;
+            nextIndex++;
+            return true;
+        });
+    }
+
+    /// @brief Removes the repeated elements of the Dynamic Array, keeping the first occurrence of each in its order,
+    /// in an expected linear time, (the elements are hashed if they have a Hasher, or stably sorted otherwise).
+    /// @return The amount of elements that have been removed.
+    size_t Singularize()
+    {
+        Array<bool> isKept(count);
+        MarkFirstOccurrences(begin(), count, isKept.begin());
+        return Compact(0, [&](const size_t &index) { return !isKept.begin()[index]; });
     }
 
     /// @brief Removes an element from the Dynamic Array at a specified index.
@@ -267,18 +404,106 @@ public:
     /// @brief Clears every element from the Dynamic Array.
     void Clear() { RemoveRange(0, count); }
 
+    /// @brief Makes sure the Dynamic Array can hold a defined amount of elements without
+    /// running out of space, (it never shrinks the capacity).
+    /// @param capacity The amount of elements the Dynamic Array will be able to hold.
+    void Reserve(const size_t &capacity)
+    {
+        if (capacity <= this->capacity) { return; }
+        Reallocate(capacity);
+    }
+
+    /// @brief Shrinks the capacity of the Dynamic Array down to its elements count, to release
+    /// the unused memory.
+    void ShrinkToFit()
+    {
+        if (count == capacity) { return; }
+        Reallocate(count);
+    }
+
+    /// @brief Makes a Dynamic Array of the distinct elements of this Dynamic Array, in the order of their
+    /// first occurrences.
+    /// @return A Dynamic Array that has every element of this Dynamic Array once.
+    DynamicArray<T> Distinct() const { return DynamicArray<T>(DistinctElements()); }
+
+    /// @brief Makes a Dynamic Array of the distinct elements of both this and another Dynamic Array, in the order
+    /// of their first occurrences, (the ones of this Dynamic Array come first).
+    /// @param other The Dynamic Array whose elements will be united with the ones of this Dynamic Array.
+    /// @return A Dynamic Array that has every element of both Dynamic Arrays once.
+    DynamicArray<T> Union(const DynamicArray<T> &other) const { return DynamicArray<T>(UnitedElements(other)); }
+
+    /// @brief Makes a Dynamic Array of the distinct elements of this Dynamic Array that are also within another
+    /// Dynamic Array, in the order of their first occurrences.
+    /// @param other The Dynamic Array whose elements will be intersected with the ones of this Dynamic Array.
+    /// @return A Dynamic Array that has every element that's within both Dynamic Arrays once.
+    DynamicArray<T> Intersect(const DynamicArray<T> &other) const { return DynamicArray<T>(FilteredElements(other, true)); }
+
+    /// @brief Makes a Dynamic Array of the distinct elements of this Dynamic Array that aren't within another
+    /// Dynamic Array, in the order of their first occurrences.
+    /// @param other The Dynamic Array whose elements will be excluded from the ones of this Dynamic Array.
+    /// @return A Dynamic Array that has every element that's only within this Dynamic Array once.
+    DynamicArray<T> Except(const DynamicArray<T> &other) const { return DynamicArray<T>(FilteredElements(other, false)); }
+
     /// @brief Makes a copy of the Dynamic Array that'll have the same elements of this Dynamic Array, but
     /// in a reversed order.
+    /// @param policy The way the elements are copied, (in parallel chunks for large Dynamic Arrays if not sequential).
     /// @return A Dynamic Array that has the same elements of this Dynamic Array but in a reversed order.
-    DynamicArray<T> Reverse() const { return DynamicArray<T>(array.Reverse(count)); }
-
-    // TODO: Sort Function Implementation.
-    DynamicArray<T> Sort() const { return this; }
+    DynamicArray<T> Reverse(const ExecutionPolicy &policy = ExecutionPolicy::Sequential) const
+    { return DynamicArray<T>(array.Reverse(count, policy)); }
+
+    /// @brief Makes a copy of the Dynamic Array that'll have the same elements of this Dynamic Array, but sorted
+    /// in an ascending order.
+    /// @param algorithm The algorithm the elements get sorted with.
+    /// @return A Dynamic Array that has the same elements of this Dynamic Array but sorted.
+    DynamicArray<T> Sort(const SortingAlgorithm &algorithm = SortingAlgorithm::Automatic) const noexcept(false)
+    { return DynamicArray<T>(ToArray().Sort(algorithm)); }
+
+    /// @brief Makes a copy of the Dynamic Array that'll have the same elements of this Dynamic Array, but sorted
+    /// by a comparer.
+    /// @tparam TComparer The function object that tells whether or not an element goes before another.
+    /// @param comparer The function object that tells whether or not an element goes before another.
+    /// @param algorithm The algorithm the elements get sorted with.
+    /// @return A Dynamic Array that has the same elements of this Dynamic Array but sorted.
+    template <typename TComparer>
+    DynamicArray<T> Sort(const TComparer &comparer, const SortingAlgorithm &algorithm = SortingAlgorithm::Automatic) const noexcept(false)
+    { return DynamicArray<T>(ToArray().Sort(comparer, algorithm)); }
+
+    /// @brief Sorts the elements of the Dynamic Array in an ascending order, without copying them.
+    /// @param algorithm The algorithm the elements get sorted with.
+    void SortInPlace(const SortingAlgorithm &algorithm = SortingAlgorithm::Automatic) noexcept(false)
+    { SortRange(begin(), end(), algorithm); }
+
+    /// @brief Sorts the elements of the Dynamic Array by a comparer, without copying them.
+    /// @tparam TComparer The function object that tells whether or not an element goes before another.
+    /// @param comparer The function object that tells whether or not an element goes before another.
+    /// @param algorithm The algorithm the elements get sorted with.
+    template <typename TComparer>
+    void SortInPlace(const TComparer &comparer, const SortingAlgorithm &algorithm = SortingAlgorithm::Automatic) noexcept(false)
+    { SortRange(begin(), end(), algorithm, comparer); }
 
     /// @brief Converts the Dynamic Array into an Array.
     /// @return An Array consisting of all of the Dynamic Array elements.
     Array<T> ToArray() const { return array.Resize(count); }
 
+    /// @brief Makes a lazy View of the Dynamic Array elements, that can be reversed, sliced, filtered or mapped
+    /// without copying them, (it's invalidated once the Dynamic Array grows or shrinks).
+    /// @return A Range View of all of the Dynamic Array elements.
+    RangeView<T*> View() const { return RangeView<T*>(begin(), end()); }
+
+    /// @brief Saves the elements of the Dynamic Array into a binary file, (leaving out its unused capacity),
+    /// in the same format as the Array, so either one can load it.
+    /// @param path The path of the file, (which is replaced if it exists).
+    void Save(const std::string &path) const noexcept(false) { SaveElements(path, array.data, count); }
+
+    /// @brief Loads a Dynamic Array from a binary file saved by "Save", and validates its checksum, if the file
+    /// can't be read, or it's corrupted, it'll throw a "runtime error" exception.
+    /// @param path The path of the file.
+    /// @param growthPolicy The way the Dynamic Array capacity grows each time it runs
+    /// out of space to store more elements, (a plain capacity modifier makes it grow linearly).
+    /// @return The Dynamic Array containing the loaded elements.
+    static DynamicArray<T> Load(const std::string &path, const GrowthPolicy &growthPolicy = GrowthPolicy()) noexcept(false)
+    { return DynamicArray<T>(Array<T>::Load(path), growthPolicy); }
+
     /// @brief Gets or Sets an element in the Dynamic Array.
     /// @param index The order of the desired element.
     /// @return The element.
@@ -291,21 +516,51 @@ public:
     /// @brief Only Gets an element in the Dynamic Array, without the ability to Set it.
     /// @param index The order of the desired element.
     /// @return The value of the element.
-    T operator[](const size_t &index) const noexcept(false)
+    const T &operator[](const size_t &index) const noexcept(false)
     {
         ValidateBoundaries(index);
         return array[index];
     }
 
+    /// @brief Copies a Dynamic Array into another.
+    /// @param reference The reference of the Dynamic Array that'll be copied.
+    /// @return The result of the copying.
+    DynamicArray<T> &operator=(const DynamicArray<T> &reference) = default;
+
+    /// @brief Moves a Dynamic Array into another, by taking over its memory.
+    /// @param reference The reference of the Dynamic Array that'll be moved.
+    /// @return The result of the moving.
+    DynamicArray<T> &operator=(DynamicArray<T> &&reference) noexcept
+    {
+        if (this == &reference) { return *this; }
+
+        capacity = reference.capacity;
+        growthPolicy = reference.growthPolicy;
+        count = reference.count;
+        array = std::move(reference.array);
+
+        reference.capacity = reference.count = 0;
+        return *this;
+    }
+
     /// @brief Adds an element to the end of the Dynamic Array.
-    /// @param element The value of the element that'll be added to the Dynamic Array.
+    /// @param element The value of the element that'll be copied into the Dynamic Array.
     /// @return The reference of the Dynamic Array after adding the element value to it.
-    DynamicArray<T> &operator<<(T element)
+    DynamicArray<T> &operator<<(const T &element)
     {
         Add(element);
         return *this;
     }
 
+    /// @brief Adds an element to the end of the Dynamic Array.
+    /// @param element The value of the element that'll be moved into the Dynamic Array.
+    /// @return The reference of the Dynamic Array after adding the element value to it.
+    DynamicArray<T> &operator<<(T &&element)
+    {
+        Add(std::move(element));
+        return *this;
+    }
+
     /// @brief Adds an Array of elements to the end of the Dynamic Array.
     /// @param array The Array that'll be added to the Dynamic Array.
     /// @return The reference of the Dynamic Array after adding the Array of elements value to it.
@@ -329,18 +584,35 @@ protected:
         throw std::out_of_range("The index [" + std::to_string(index) + "] is out of the range of the Dynamic Array.");
     }
 
-    /// @brief Expands the elements count of the Dynamic Array, and also expands the capacity if necessary.
+    /// @brief Expands the elements count of the Dynamic Array, and also expands the capacity if necessary,
+    /// (following the Growth Policy, which keeps adding elements amortized constant time by default).
     /// @param count The amount of elements the Dynamic Array will be expanded to store.
     void ExpandArray(const size_t &count)
     {
         this->count += count;
-        if (this->count > capacity)
-        {
-            capacity = (this->count / capacityModifier + 1) * capacityModifier;
-            array = array.Resize(capacity);
-        }
+        if (this->count > capacity) { Reallocate(growthPolicy.NextCapacity(capacity, this->count)); }
     }
 
+    /// @brief Moves the elements of the Dynamic Array into a new memory block with a defined capacity.
+    /// @param capacity The new amount of elements the Dynamic Array can maximally hold.
+    void Reallocate(const size_t &capacity)
+    {
+        array.Reallocate(capacity);
+        this->capacity = capacity;
+
+        INSTRUMENTED(stats.ReallocationCount++; CountAllocation(capacity);)
+    }
+
+#if defined(DATA_STRUCTURES_INSTRUMENTATION)
+    /// @brief Counts a memory block allocated for the elements of the Dynamic Array.
+    /// @param capacity The amount of elements the memory block holds.
+    void CountAllocation(const size_t &capacity)
+    {
+        stats.AllocationCount++;
+        stats.AllocatedByteCount += capacity * sizeof(T);
+    }
+#endif
+
     /// @brief Shifts all the elements starting at an index towards the right by a specified
     /// amount of steps.
     /// @param start The index of which the shifting will start at.
@@ -348,15 +620,9 @@ protected:
     void Shift(const size_t &start, const size_t &steps = 1)
     {
         ExpandArray(steps);
+        INSTRUMENTED(stats.ShiftedElementCount += count - steps - start;)
 
-        for (size_t i = count - steps - 1; i >= (size_t)start; i--)
-        {
-            array[i + steps] = array[i];
-            if (!i)
-            {
-                break;
-            }
-        }
+        Array<T>::MoveElements(array.data + start, array.data + start + steps, count - steps - start);
     }
 
     /// @brief Shifts all the elements starting at an index towards the left by a specified
@@ -365,12 +631,74 @@ protected:
     /// @param steps The amount of steps the shifting will go towards the left.
     void Unshift(const size_t &start, const size_t &steps = 1)
     {
-        for (size_t i = start + steps; i < count; i++)
+        INSTRUMENTED(stats.ShiftedElementCount += count - start - steps;)
+        Array<T>::MoveElements(array.data + start + steps, array.data + start, count - start - steps);
+
+        count -= steps;
+    }
+
+    /// @brief Copies the distinct elements, in the order of their first occurrences.
+    /// @return An Array of the distinct elements.
+    Array<T> DistinctElements() const
+    { return SelectMarked([&](bool* isKept) { return MarkFirstOccurrences(begin(), count, isKept); }); }
+
+    /// @brief Copies the distinct elements of both this and another Dynamic Array, in the order of their first occurrences.
+    /// @param other The Dynamic Array whose elements will be united with the ones of this Dynamic Array.
+    /// @return An Array of the united elements.
+    Array<T> UnitedElements(const DynamicArray<T> &other) const
+    { return SelectMarked([&](bool* isKept) { return MarkFirstOccurrences(begin(), count, other.begin(), other.count, isKept); }, &other); }
+
+    /// @brief Copies the distinct elements that are, (or aren't), within another Dynamic Array, in the order of their
+    /// first occurrences.
+    /// @param other The Dynamic Array that the elements are searched for within.
+    /// @param isPresented Whether the copied elements are the ones within the other Dynamic Array, or the ones that aren't.
+    /// @return An Array of the filtered elements.
+    Array<T> FilteredElements(const DynamicArray<T> &other, const bool &isPresented) const
+    {
+        return SelectMarked([&](bool* isKept)
+        { return MarkOccurrencesWithin(begin(), count, other.begin(), other.count, isPresented, isKept); });
+    }
+
+    /// @brief Copies the marked elements of the Dynamic Array, followed by the marked elements of another one.
+    /// @tparam TMark The type of the function that marks the elements.
+    /// @param mark A function that takes a pointer to an array in memory, marks whether or not each element is kept,
+    /// (the ones of the other Dynamic Array come after), and returns the amount of the kept elements.
+    /// @param other A pointer to the other Dynamic Array, or null pointer if only this one is marked.
+    /// @return An Array of the kept elements.
+    template <typename TMark>
+    Array<T> SelectMarked(const TMark &mark, const DynamicArray<T>* other = nullptr) const
+    {
+        size_t otherCount = other ? other->count : 0;
+        Array<bool> isKept(count + otherCount);
+        Array<T> selectedElements(mark(isKept.begin()));
+
+        T* destination = selectedElements.begin();
+        for (size_t i = 0; i < count; i++) { if (isKept.begin()[i]) { *destination++ = array.data[i]; } }
+        for (size_t i = 0; i < otherCount; i++) { if (isKept.begin()[count + i]) { *destination++ = other->array.data[i]; } }
+        return selectedElements;
+    }
+
+    /// @brief Removes the elements that are marked for removal, by moving each kept element right after
+    /// the previous kept one, (like the erase-remove idiom).
+    /// @tparam TIsRemoved The type of the function that marks the removed elements.
+    /// @param start The index of the first element that might be removed, (the ones before it are kept).
+    /// @param isRemoved A function that takes the index of an element, (in an ascending order, before the
+    /// element gets moved), and tells whether or not it'll be removed.
+    /// @return The amount of elements that have been removed.
+    template <typename TIsRemoved>
+    size_t Compact(const size_t &start, const TIsRemoved &isRemoved)
+    {
+        size_t keptCount = start;
+        for (size_t i = start; i < count; i++)
         {
-            array[i - steps] = array[i];
+            if (isRemoved(i)) { continue; }
+            if (keptCount != i) { array.data[keptCount] = std::move(array.data[i]); INSTRUMENTED(stats.ShiftedElementCount++;) }
+            keptCount++;
         }
 
-        count -= steps;
+        size_t removedCount = count - keptCount;
+        count = keptCount;
+        return removedCount;
     }
 };
 
@@ -0,0 +1,103 @@
+#include<iostream>
+
+#ifndef EXECUTION_POLICY
+#define EXECUTION_POLICY
+
+#include<algorithm>
+#include<cstdint>
+
+#include "CacheLine.c++"
+#include "ThreadPool.c++"
+
+/// @brief The way a bulk operation goes through the elements of a data structure.
+enum class ExecutionPolicy
+{
+    /// @brief The elements are processed in order by the calling thread.
+    Sequential,
+    /// @brief The elements are split into chunks that are processed across the shared Thread Pool,
+    /// where the elements of each chunk are processed in order.
+    Parallel,
+    /// @brief Like the parallel policy, but the elements of each chunk are processed in blocks without
+    /// branching on every element, so simple predicates can be vectorized, (so an early exit only
+    /// happens at the end of a block).
+    ParallelUnsequenced
+};
+
+/// @brief The smallest amount of elements that a parallel operation is split across threads for,
+/// (shorter ranges are processed sequentially, since waking the threads up would cost more).
+constexpr size_t PARALLEL_EXECUTION_THRESHOLD = 1 << 15;
+
+/// @brief Indicates whether or not an operation over a range of elements runs in parallel.
+/// @param policy The execution policy of the operation.
+/// @param length The amount of elements within the range.
+/// @return A boolean representing whether or not the range gets split across threads.
+inline bool IsParallel(const ExecutionPolicy &policy, const size_t &length)
+{ return policy != ExecutionPolicy::Sequential && length >= PARALLEL_EXECUTION_THRESHOLD; }
+
+/// @brief The split of a range of elements into chunks for the threads, where every chunk but the first
+/// one starts at a cache line, so the threads never write to the same cache line, (if the size of the
+/// elements divides it).
+/// @tparam T The type of the elements.
+template<typename T>
+class ParallelChunks
+{
+public:
+    /// @brief Splits a range of elements into a few chunks for each thread of the shared Thread Pool.
+    /// @param data A pointer to the first element of the range.
+    /// @param length The amount of elements within the range.
+    ParallelChunks(const T* data, const size_t &length) : length(length)
+    {
+        constexpr size_t LINE_LENGTH = CACHE_LINE_SIZE % sizeof(T) ? 1 : CACHE_LINE_SIZE / sizeof(T);
+
+        size_t targetCount = ThreadPool::Shared().ThreadCount() * CHUNKS_PER_THREAD;
+        chunkLength = std::max((length + targetCount - 1) / targetCount, MINIMUM_CHUNK_LENGTH);
+        chunkLength = (chunkLength + LINE_LENGTH - 1) / LINE_LENGTH * LINE_LENGTH;
+
+        size_t misalignment = (uintptr_t)data % CACHE_LINE_SIZE;
+        firstBoundary = chunkLength + (LINE_LENGTH > 1 && misalignment % sizeof(T) == 0
+            ? (CACHE_LINE_SIZE - misalignment) % CACHE_LINE_SIZE / sizeof(T) : 0);
+
+        count = length <= firstBoundary ? 1 : 1 + (length - firstBoundary + chunkLength - 1) / chunkLength;
+    }
+
+private:
+    /// @brief The amount of elements within the range.
+    size_t length;
+    /// @brief The amount of elements within every chunk but the first and the last ones.
+    size_t chunkLength;
+    /// @brief The index that the second chunk starts at.
+    size_t firstBoundary;
+    /// @brief The amount of chunks.
+    size_t count;
+
+public:
+    /// @brief The amount of chunks each thread gets on average, so the threads that finish first
+    /// can take over the rest of the work.
+    static constexpr size_t CHUNKS_PER_THREAD = 4;
+    /// @brief The smallest amount of elements within a chunk.
+    static constexpr size_t MINIMUM_CHUNK_LENGTH = 1 << 12;
+
+    /// @brief The amount of chunks the range is split into.
+    /// @return The chunk count of the range.
+    size_t Count() const { return count; }
+
+    /// @brief The index of the first element of a chunk.
+    /// @param chunkIndex The index of the chunk.
+    /// @return The index within the range that the chunk starts at.
+    size_t Begin(const size_t &chunkIndex) const
+    { return chunkIndex ? std::min(length, firstBoundary + (chunkIndex - 1) * chunkLength) : 0; }
+
+    /// @brief The index past the last element of a chunk.
+    /// @param chunkIndex The index of the chunk.
+    /// @return The index within the range that the chunk ends at.
+    size_t End(const size_t &chunkIndex) const { return Begin(chunkIndex + 1); }
+
+    /// @brief Runs a function over every chunk across the shared Thread Pool, and waits until all of them are done.
+    /// @tparam TBody The type of the function that processes a chunk.
+    /// @param body A function that takes the index of a chunk, and the indices of its first element and past its last one.
+    template<typename TBody>
+    void Run(const TBody &body) const noexcept(false)
+    { ThreadPool::Shared().Run(count, [&](const size_t &chunkIndex) { body(chunkIndex, Begin(chunkIndex), End(chunkIndex)); }); }
+};
+
+#endif
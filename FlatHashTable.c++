@@ -0,0 +1,857 @@
+#include<iostream>
+
+#ifndef FLAT_HASH_TABLE
+#define FLAT_HASH_TABLE
+
+#include<cstdint>
+#include<functional>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define CONTROL_GROUP_SSE2
+#include<emmintrin.h>
+#elif defined(__ARM_NEON) || defined(_M_ARM64)
+#define CONTROL_GROUP_NEON
+#include<arm_neon.h>
+#endif
+
+#include "Array.c++"
+#include "CacheLine.c++"
+#include "GrowthPolicy.c++"
+#include "KeyValuePair.c++"
+#include "Serialization.c++"
+#include "Algorithms/Hasher.c++"
+#include "Algorithms/BitOperations.c++"
+
+/// @brief A group of control bytes of a Flat Hash Table, that are all compared at once using SIMD
+/// instructions (SSE2 or NEON) if available, where each byte describes the state of one slot.
+class ControlGroup
+{
+public:
+    /// @brief Loads a group of control bytes.
+    /// @param controls A pointer to the first control byte of the group.
+    explicit ControlGroup(const int8_t* controls)
+    {
+#if defined(CONTROL_GROUP_SSE2)
+        group = _mm_loadu_si128(reinterpret_cast<const __m128i*>(controls));
+#elif defined(CONTROL_GROUP_NEON)
+        group = vld1q_s8(controls);
+#else
+        for (size_t i = 0; i < WIDTH; i++) { group[i] = controls[i]; }
+#endif
+    }
+
+    ~ControlGroup() = default;
+
+private:
+#if defined(CONTROL_GROUP_SSE2)
+    /// @brief The control bytes of the group.
+    __m128i group;
+#elif defined(CONTROL_GROUP_NEON)
+    /// @brief The control bytes of the group.
+    int8x16_t group;
+#else
+    /// @brief The control bytes of the group.
+    int8_t group[16];
+#endif
+
+public:
+    /// @brief The amount of control bytes within a group.
+    static constexpr size_t WIDTH = 16;
+    /// @brief The control byte of a slot that has never been occupied.
+    static constexpr int8_t EMPTY = -128;
+    /// @brief The control byte of a slot that has been occupied then erased, (also called a tombstone).
+    static constexpr int8_t DELETED = -2;
+
+    /// @brief Finds the slots of the group that have a specified fingerprint.
+    /// @param fingerprint The lowest seven bits of the hashing value of a key.
+    /// @return A bit mask of the matching slots, that can be walked through with LowestIndex and ClearLowest.
+    uint64_t Match(const int8_t &fingerprint) const { return MatchByte(fingerprint); }
+
+    /// @brief Finds the slots of the group that have never been occupied.
+    /// @return A bit mask of the matching slots.
+    uint64_t MatchEmpty() const { return MatchByte(EMPTY); }
+
+    /// @brief Finds the slots of the group that are free to be occupied, (either empty or erased).
+    /// @return A bit mask of the matching slots.
+    uint64_t MatchEmptyOrDeleted() const
+    {
+#if defined(CONTROL_GROUP_SSE2)
+        return (uint64_t)_mm_movemask_epi8(group);
+#elif defined(CONTROL_GROUP_NEON)
+        uint8x16_t matches = vreinterpretq_u8_s8(vshrq_n_s8(group, 7));
+        return Narrow(matches);
+#else
+        uint64_t mask = 0;
+        for (size_t i = 0; i < WIDTH; i++) { mask |= (uint64_t)(group[i] < 0) << i; }
+        return mask;
+#endif
+    }
+
+    /// @brief Gets the position of the first matching slot within a bit mask.
+    /// @param mask A non-zero bit mask returned by the group.
+    /// @return The position of the slot within the group.
+    static size_t LowestIndex(const uint64_t &mask) { return CountTrailingZeros(mask) >> BITS_SHIFT; }
+
+    /// @brief Clears the first matching slot from a bit mask.
+    /// @param mask A non-zero bit mask returned by the group.
+    /// @return The bit mask without its first matching slot.
+    static uint64_t ClearLowest(const uint64_t &mask) { return mask & (mask - 1); }
+
+private:
+#if defined(CONTROL_GROUP_NEON)
+    /// @brief The binary logarithm of the amount of mask bits each slot takes.
+    static constexpr unsigned BITS_SHIFT = 2;
+
+    /// @brief Narrows a vector of byte matches into a mask of one bit for each four bits.
+    /// @param matches A vector where every matching byte is all ones.
+    /// @return The bit mask of the matching slots.
+    static uint64_t Narrow(const uint8x16_t &matches)
+    {
+        uint8x8_t nibbles = vshrn_n_u16(vreinterpretq_u16_u8(matches), 4);
+        return vget_lane_u64(vreinterpret_u64_u8(nibbles), 0) & 0x8888888888888888ULL;
+    }
+#else
+    /// @brief The binary logarithm of the amount of mask bits each slot takes.
+    static constexpr unsigned BITS_SHIFT = 0;
+#endif
+
+    /// @brief Finds the slots of the group that have a specified control byte.
+    /// @param control The desired control byte.
+    /// @return A bit mask of the matching slots.
+    uint64_t MatchByte(const int8_t &control) const
+    {
+#if defined(CONTROL_GROUP_SSE2)
+        return (uint64_t)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(control), group));
+#elif defined(CONTROL_GROUP_NEON)
+        return Narrow(vceqq_s8(vdupq_n_s8(control), group));
+#else
+        uint64_t mask = 0;
+        for (size_t i = 0; i < WIDTH; i++) { mask |= (uint64_t)(group[i] == control) << i; }
+        return mask;
+#endif
+    }
+};
+
+/// @brief A data structure where every entry consists of a key and a value, that stores the pairs
+/// inline within one contiguous array of slots using open addressing, and keeps a separate array of
+/// control bytes that is probed sixteen slots at a time, (a SwissTable-like layout).
+/// @tparam TKey The type of the keys stored within the Flat Hash Table.
+/// @tparam TValue The type of the values stored within the Flat Hash Table.
+/// @tparam THasher The function object that hashes the keys by their values.
+template<typename TKey, typename TValue, typename THasher = Hasher<TKey>>
+class FlatHashTable
+{
+public:
+    /// @brief Walks through the occupied slots of a Flat Hash Table, (the keys must not be changed).
+    class Iterator
+    {
+    public:
+        /// @brief Creates a new Iterator that starts at a defined slot, and skips to the first occupied one.
+        /// @param slot A pointer to the starting slot.
+        /// @param control A pointer to the control byte of the starting slot.
+        /// @param end A pointer past the last control byte.
+        Iterator(KeyValuePair<TKey, TValue>* slot, const int8_t* control, const int8_t* end)
+            : slot(slot), control(control), end(end) { SkipFreeSlots(); }
+
+    private:
+        /// @brief A pointer to the current slot.
+        KeyValuePair<TKey, TValue>* slot;
+        /// @brief A pointer to the control byte of the current slot.
+        const int8_t* control;
+        /// @brief A pointer past the last control byte.
+        const int8_t* end;
+
+        /// @brief Moves forward until an occupied slot or the end is reached.
+        void SkipFreeSlots() { while (control != end && *control < 0) { control++; slot++; } }
+
+    public:
+        /// @brief Accesses the pair of the current slot.
+        /// @return The reference of the pair.
+        KeyValuePair<TKey, TValue> &operator*() const { return *slot; }
+        /// @brief Accesses the pair of the current slot.
+        /// @return A pointer to the pair.
+        KeyValuePair<TKey, TValue>* operator->() const { return slot; }
+
+        /// @brief Moves to the next occupied slot.
+        /// @return The reference of the Iterator after moving.
+        Iterator &operator++() { control++; slot++; SkipFreeSlots(); return *this; }
+
+        /// @brief Compares two Iterators positions.
+        /// @param iterator The Iterator that'll be compared to.
+        /// @return A boolean representing whether or not both Iterators are at the same slot.
+        bool operator==(const Iterator &iterator) const { return control == iterator.control; }
+        /// @brief Compares two Iterators positions.
+        /// @param iterator The Iterator that'll be compared to.
+        /// @return A boolean representing whether or not the Iterators are at different slots.
+        bool operator!=(const Iterator &iterator) const { return control != iterator.control; }
+    };
+
+    /// @brief Creates a new empty Flat Hash Table, (no memory is allocated until the first pair is set).
+    FlatHashTable() = default;
+
+    /// @brief Creates a new Flat Hash Table that can hold a defined amount of pairs without rehashing.
+    /// @param capacity The amount of pairs that'll be stored within the Flat Hash Table.
+    /// @param hasher The function object that'll be used to hash the keys by their values.
+    /// @param hashingSeed An initial value that determines the outcome of the hasher,
+    /// (usually, it's set to zero).
+    explicit FlatHashTable(const size_t &capacity, const THasher &hasher = THasher(), const size_t &hashingSeed = 0)
+        : hasher(hasher), hashingSeed(hashingSeed) { Reserve(capacity); }
+
+    /// @brief Creates a new Flat Hash Table by copying another Flat Hash Table as reference.
+    /// @param reference The reference of the Flat Hash Table that'll be copied.
+    FlatHashTable(const FlatHashTable<TKey, TValue, THasher> &reference) = default;
+
+    /// @brief Creates a new Flat Hash Table by taking over the slots of another Flat Hash Table,
+    /// which is left empty.
+    /// @param reference The reference of the Flat Hash Table that'll be moved.
+    FlatHashTable(FlatHashTable<TKey, TValue, THasher> &&reference) noexcept
+        : controls(std::move(reference.controls)), slots(std::move(reference.slots)),
+        count(reference.count), tombstoneCount(reference.tombstoneCount),
+        hasher(std::move(reference.hasher)), hashingSeed(reference.hashingSeed)
+    { reference.count = reference.tombstoneCount = 0; }
+
+    ~FlatHashTable() = default;
+
+private:
+    /// @brief The control bytes of the slots, (either empty, deleted, or the fingerprint of the stored key).
+    Array<int8_t> controls;
+    /// @brief The slots that store the pairs inline, (its length is always a power of two).
+    Array<KeyValuePair<TKey, TValue>> slots;
+    /// @brief The amount of pairs stored within the Flat Hash Table.
+    size_t count = 0;
+    /// @brief The amount of slots that have been erased and not reused yet.
+    size_t tombstoneCount = 0;
+    /// @brief The function object that'll be used for hashing the keys of the Flat Hash Table.
+    THasher hasher;
+    /// @brief The initial value that determines the outcome of the hasher.
+    size_t hashingSeed = 0;
+
+    template<typename TKey_, typename TValue_, typename THasher_>
+    friend class MappedFlatHashTable;
+    template<typename TKey_, typename TValue_, typename THasher_>
+    friend class ConcurrentHashTable;
+
+public:
+    /// @brief The value returned by the searching functions if the key is unfound.
+    static constexpr size_t NOT_FOUND = (size_t)-1;
+    /// @brief The percentage of the slots that can be occupied, (including the erased ones) before rehashing.
+    static constexpr float MAXIMUM_LOAD_FACTOR = 0.875F;
+    /// @brief The amount of keys the batched operations hash and prefetch ahead of the one being resolved.
+    static constexpr size_t PREFETCH_DISTANCE = 16;
+
+    /// @brief The amount of slots allocated by the Flat Hash Table.
+    /// @return The capacity of the Flat Hash Table.
+    size_t Capacity() const { return slots.Length(); }
+    /// @brief The amount of pairs stored within the Flat Hash Table.
+    /// @return The pairs count of the Flat Hash Table.
+    size_t Count() const { return count; }
+    /// @brief Indicates whether or not the Flat Hash Table has currently no pairs.
+    /// @return A boolean representing whether or not the Flat Hash Table is empty.
+    bool IsEmpty() const { return !count; }
+    /// @brief The percentage of the slots that are currently occupied by pairs.
+    /// @return The load factor of the Flat Hash Table.
+    float LoadFactor() const { return slots.Length() ? count / (float)slots.Length() : 0; }
+
+    /// @brief The beginning of the Flat Hash Table.
+    /// @return An Iterator at the first occupied slot.
+    Iterator begin() const { return Iterator(slots.begin(), controls.begin(), controls.end()); }
+    /// @brief The end of the Flat Hash Table.
+    /// @return An Iterator past the last slot.
+    Iterator end() const { return Iterator(slots.end(), controls.end(), controls.end()); }
+
+    /// @brief Sets a pair within the Flat Hash Table.
+    /// @param key The key of the pair that'll be used to access the value its associated with.
+    /// @param value The value that'll be copied and associated with the key.
+    void Set(const TKey &key, const TValue &value) { SetPair(key, value); }
+
+    /// @brief Sets a pair within the Flat Hash Table.
+    /// @param key The key of the pair that'll be used to access the value its associated with.
+    /// @param value The value that'll be moved and associated with the key.
+    void Set(const TKey &key, TValue &&value) { SetPair(key, std::move(value)); }
+
+    /// @brief Gets a value within the Flat Hash Table using a key, (if the key doesn't exist, it'll throw
+    /// an "out of range" exception).
+    /// @param key The key of the pair that'll be used to access the value its associated with.
+    /// @return The value that's associated with the key.
+    const TValue &Get(const TKey &key) const noexcept(false)
+    {
+        const TValue* value = Find(key);
+        if (value != nullptr) { return *value; }
+
+        throw std::out_of_range("The provided key doesn't exist within the Flat Hash Table.");
+    }
+
+    /// @brief Gets a value within the Flat Hash Table using a key, without throwing if it doesn't exist.
+    /// @param key The key of the pair that'll be used to access the value its associated with.
+    /// @param value The reference that'll be assigned the value associated with the key, if found.
+    /// @return A boolean representing whether or not the key has been found.
+    bool TryGet(const TKey &key, TValue &value) const
+    {
+        const TValue* foundValue = Find(key);
+        if (foundValue == nullptr) { return false; }
+
+        value = *foundValue;
+        return true;
+    }
+
+    /// @brief Searches for the value that's associated with a key.
+    /// @param key The key of the pair that'll be searched for.
+    /// @return A pointer to the value associated with the key, or null pointer if unfound.
+    TValue* Find(const TKey &key)
+    {
+        size_t index = FindIndex(key, Hash(key));
+        return index != NOT_FOUND ? &slots.begin()[index].Value : nullptr;
+    }
+
+    /// @brief Searches for the value that's associated with a key, without the ability to set it.
+    /// @param key The key of the pair that'll be searched for.
+    /// @return A pointer to the value associated with the key, or null pointer if unfound.
+    const TValue* Find(const TKey &key) const
+    {
+        size_t index = FindIndex(key, Hash(key));
+        return index != NOT_FOUND ? &slots.begin()[index].Value : nullptr;
+    }
+
+    /// @brief Checks for a key within the Flat Hash Table.
+    /// @param key The key of the pair that'll be searched for.
+    /// @return A boolean value representing whether or not the key is presented in the Flat Hash Table.
+    bool Has(const TKey &key) const { return FindIndex(key, Hash(key)) != NOT_FOUND; }
+
+    /// @brief Sets a batch of pairs within the Flat Hash Table, where the keys are hashed and their groups are
+    /// prefetched a few pairs ahead, so the cache misses of the pairs overlap instead of stalling one by one.
+    /// @param batchKeys The keys of the pairs.
+    /// @param batchValues The values that'll be copied and associated with the keys at the same indices.
+    void SetMany(const Array<TKey> &batchKeys, const Array<TValue> &batchValues) noexcept(false)
+    {
+        if (batchKeys.Length() != batchValues.Length())
+        {
+            throw std::logic_error("Attempting to set " + std::to_string(batchKeys.Length()) + " keys with "
+                + std::to_string(batchValues.Length()) + " values.");
+        }
+
+        // Reserving first keeps the slots from being rehashed halfway, which would waste the prefetched groups.
+        Reserve(count + batchKeys.Length());
+
+        PipelineLookups(batchKeys, [&](const size_t &index, const size_t &hashingValue)
+        { SetPair(batchKeys.begin()[index], hashingValue, batchValues.begin()[index]); });
+    }
+
+    /// @brief Gets the values of a batch of keys, where the keys are hashed and their groups are prefetched a few
+    /// keys ahead, (if any of the keys doesn't exist, it'll throw an "out of range" exception).
+    /// @param batchKeys The keys of the pairs that'll be used to access the values they're associated with.
+    /// @param batchValues The Array that'll be assigned the value of each key at the same index, (it's
+    /// reallocated if its length doesn't match the keys).
+    void GetMany(const Array<TKey> &batchKeys, Array<TValue> &batchValues) const noexcept(false)
+    {
+        if (batchValues.Length() != batchKeys.Length()) { batchValues = Array<TValue>(batchKeys.Length()); }
+
+        PipelineLookups(batchKeys, [&](const size_t &index, const size_t &hashingValue)
+        {
+            size_t slotIndex = FindIndex(batchKeys.begin()[index], hashingValue);
+            if (slotIndex == NOT_FOUND) { throw std::out_of_range("The provided key doesn't exist within the Flat Hash Table."); }
+
+            batchValues.begin()[index] = slots.begin()[slotIndex].Value;
+        });
+    }
+
+    /// @brief Checks for a batch of keys within the Flat Hash Table, where the keys are hashed and their groups
+    /// are prefetched a few keys ahead.
+    /// @param batchKeys The keys of the pairs that'll be searched for.
+    /// @param isFound The Array that'll be assigned whether or not each key is presented at the same index,
+    /// (it's reallocated if its length doesn't match the keys).
+    void HasMany(const Array<TKey> &batchKeys, Array<bool> &isFound) const
+    {
+        if (isFound.Length() != batchKeys.Length()) { isFound = Array<bool>(batchKeys.Length()); }
+
+        PipelineLookups(batchKeys, [&](const size_t &index, const size_t &hashingValue)
+        { isFound.begin()[index] = FindIndex(batchKeys.begin()[index], hashingValue) != NOT_FOUND; });
+    }
+
+    /// @brief Erases a pair from the Flat Hash Table using its key.
+    /// @param key The key of the pair that'll be erased.
+    /// @return A boolean representing whether or not the pair has been erased.
+    bool Erase(const TKey &key) { return Erase(key, Hash(key)); }
+
+    /// @brief Clears every pair from the Flat Hash Table, (without releasing its slots).
+    void Clear()
+    {
+        for (size_t i = 0; i < slots.Length(); i++)
+        {
+            if (controls.begin()[i] >= 0) { slots.begin()[i] = KeyValuePair<TKey, TValue>(); }
+            controls.begin()[i] = ControlGroup::EMPTY;
+        }
+
+        count = tombstoneCount = 0;
+    }
+
+    /// @brief Makes sure the Flat Hash Table can hold a defined amount of pairs without rehashing.
+    /// @param capacity The amount of pairs the Flat Hash Table will be able to hold.
+    void Reserve(const size_t &capacity)
+    {
+        if (capacity <= MaximumLoad(slots.Length()) - tombstoneCount) { return; }
+        Rehash(capacity);
+    }
+
+    /// @brief Redistributes every pair into a new array of slots, which also clears all the tombstones.
+    /// @param capacity The amount of pairs the new slots should be able to hold, (it never goes below
+    /// the current pairs count).
+    void Rehash(const size_t &capacity)
+    {
+        size_t newCapacity = GrowthPolicy::NextPowerOfTwo(std::max(ControlGroup::WIDTH, std::max(capacity, count)));
+        while (MaximumLoad(newCapacity) < std::max(capacity, count)) { newCapacity <<= 1; }
+
+        Array<int8_t> oldControls = std::move(controls);
+        Array<KeyValuePair<TKey, TValue>> oldSlots = std::move(slots);
+
+        controls = Array<int8_t>(newCapacity, ControlGroup::EMPTY);
+        slots = Array<KeyValuePair<TKey, TValue>>(newCapacity);
+        tombstoneCount = 0;
+
+        for (size_t i = 0; i < oldSlots.Length(); i++)
+        {
+            if (oldControls.begin()[i] < 0) { continue; }
+
+            size_t hashingValue = Hash(oldSlots.begin()[i].Key),
+                index = FindFreeIndex(hashingValue);
+
+            controls.begin()[index] = Fingerprint(hashingValue);
+            slots.begin()[index] = std::move(oldSlots.begin()[i]);
+        }
+    }
+
+    /// @brief Applies a callback Function for each pair in the Flat Hash Table.
+    /// @param callback The function that'll be applied to all pairs, that takes the key and the value of it.
+    void Foreach(std::function<void(const TKey &key, TValue &value)> callback)
+    { for (auto &pair : *this) { callback(pair.Key, pair.Value); } }
+
+    /// @brief Saves the Flat Hash Table into a binary file, as a header followed by the raw control bytes
+    /// and slots, so it can be loaded or mapped without hashing any of the keys again.
+    /// @param path The path of the file, (which is replaced if it exists).
+    void Save(const std::string &path) const noexcept(false)
+    {
+        static_assert(std::is_trivially_copyable_v<KeyValuePair<TKey, TValue>>,
+            "Only the pairs of trivially copyable types can be saved as raw bytes.");
+
+        BinaryHeader header { };
+        header.Format = BinaryFormat::FlatHashTable;
+        header.ElementSize = sizeof(KeyValuePair<TKey, TValue>);
+        header.Count = slots.Length();
+        header.PairCount = count;
+        header.TombstoneCount = tombstoneCount;
+        header.HashingSeed = hashingSeed;
+
+        BinarySection sections[] =
+        {
+            { controls.begin(), controls.Length() },
+            { slots.begin(), slots.Length() * sizeof(KeyValuePair<TKey, TValue>) }
+        };
+        SaveBinaryFile(path, header, sections, 2);
+    }
+
+    /// @brief Loads a Flat Hash Table from a binary file saved by "Save", and validates its checksum, if the file
+    /// can't be read, or it's corrupted, it'll throw a "runtime error" exception.
+    /// @param path The path of the file.
+    /// @param hasher The function object that'll be used to hash the keys, (it must hash them the same way
+    /// as the hasher of the saved Flat Hash Table).
+    /// @return The Flat Hash Table containing the loaded pairs.
+    static FlatHashTable<TKey, TValue, THasher> Load(const std::string &path, const THasher &hasher = THasher()) noexcept(false)
+    {
+        static_assert(std::is_trivially_copyable_v<KeyValuePair<TKey, TValue>>,
+            "Only the pairs of trivially copyable types can be loaded from raw bytes.");
+
+        BinaryFileReader reader(path, BinaryFormat::FlatHashTable, sizeof(KeyValuePair<TKey, TValue>));
+        const BinaryHeader &header = reader.Header();
+        ValidateLayout(header, path);
+        reader.ValidateSectionsLength(header.Count > SIZE_MAX / (sizeof(KeyValuePair<TKey, TValue>) + 1) ? UINT64_MAX
+            : AlignedSectionLength((size_t)header.Count) + header.Count * sizeof(KeyValuePair<TKey, TValue>));
+
+        FlatHashTable<TKey, TValue, THasher> table(0, hasher, (size_t)header.HashingSeed);
+        table.controls = Array<int8_t>((size_t)header.Count);
+        table.slots = Array<KeyValuePair<TKey, TValue>>((size_t)header.Count);
+
+        reader.ReadSection(table.controls.begin(), table.controls.Length());
+        reader.ReadSection(table.slots.begin(), table.slots.Length() * sizeof(KeyValuePair<TKey, TValue>));
+        reader.ValidateChecksum();
+
+        table.count = (size_t)header.PairCount;
+        table.tombstoneCount = (size_t)header.TombstoneCount;
+        return table;
+    }
+
+    /// @brief Only Gets a value within the Flat Hash Table using a key, without the ability
+    /// to set it, (if the key doesn't exist, it'll throw an "out of range" exception).
+    /// @param key The key of the pair that'll be used to access the value its associated with.
+    /// @return The value that's associated with the key.
+    const TValue &operator[](const TKey &key) const noexcept(false) { return Get(key); }
+
+    /// @brief Copies a Flat Hash Table into another.
+    /// @param reference The reference of the Flat Hash Table that'll be copied.
+    /// @return The result of the copying.
+    FlatHashTable<TKey, TValue, THasher> &operator=(const FlatHashTable<TKey, TValue, THasher> &reference) = default;
+
+    /// @brief Moves a Flat Hash Table into another, by taking over its slots.
+    /// @param reference The reference of the Flat Hash Table that'll be moved.
+    /// @return The result of the moving.
+    FlatHashTable<TKey, TValue, THasher> &operator=(FlatHashTable<TKey, TValue, THasher> &&reference) noexcept
+    {
+        if (this == &reference) { return *this; }
+
+        controls = std::move(reference.controls);
+        slots = std::move(reference.slots);
+        count = reference.count;
+        tombstoneCount = reference.tombstoneCount;
+        hasher = std::move(reference.hasher);
+        hashingSeed = reference.hashingSeed;
+
+        reference.count = reference.tombstoneCount = 0;
+        return *this;
+    }
+
+private:
+    /// @brief Hashes a key by its value.
+    /// @param key The key that'll be hashed.
+    /// @return The hashing value of the key.
+    size_t Hash(const TKey &key) const { return hasher(key, hashingSeed); }
+
+    /// @brief Extracts the control byte of a key from its hashing value.
+    /// @param hashingValue The hashing value of the key.
+    /// @return The lowest seven bits of the hashing value.
+    static int8_t Fingerprint(const size_t &hashingValue) { return (int8_t)(hashingValue & 0x7F); }
+
+    /// @brief The amount of slots that can be occupied before rehashing.
+    /// @param capacity The amount of slots.
+    /// @return The maximum load of the slots.
+    static size_t MaximumLoad(const size_t &capacity) { return capacity - capacity / 8; }
+
+    /// @brief Probes the slots for a key, group after group, (jumping by triangular numbers,
+    /// which visits every group as their count is a power of two).
+    /// @param key The key that'll be searched for.
+    /// @param hashingValue The hashing value of the key.
+    /// @return The index of the slot holding the key, or NOT_FOUND if unfound.
+    size_t FindIndex(const TKey &key, const size_t &hashingValue) const
+    { return count ? FindIndex(controls.begin(), slots.begin(), slots.Length(), key, hashingValue) : NOT_FOUND; }
+
+    /// @brief Probes a set of slots for a key, which is shared by the Flat Hash Table and the Mapped Flat Hash Table.
+    /// @param controls A pointer to the first control byte.
+    /// @param slots A pointer to the first slot.
+    /// @param capacity The amount of slots, (a power of two that isn't less than the width of a group).
+    /// @param key The key that'll be searched for.
+    /// @param hashingValue The hashing value of the key.
+    /// @return The index of the slot holding the key, or NOT_FOUND if unfound.
+    static size_t FindIndex(const int8_t* controls, const KeyValuePair<TKey, TValue>* slots, const size_t &capacity,
+        const TKey &key, const size_t &hashingValue)
+    {
+        size_t groupMask = capacity / ControlGroup::WIDTH - 1,
+            group = (hashingValue >> 7) & groupMask;
+        int8_t fingerprint = Fingerprint(hashingValue);
+
+        for (size_t probe = 0; probe <= groupMask; group = (group + ++probe) & groupMask)
+        {
+            ControlGroup controlGroup(controls + group * ControlGroup::WIDTH);
+
+            for (uint64_t mask = controlGroup.Match(fingerprint); mask; mask = ControlGroup::ClearLowest(mask))
+            {
+                size_t index = group * ControlGroup::WIDTH + ControlGroup::LowestIndex(mask);
+                if (slots[index].Key == key) { return index; }
+            }
+
+            if (controlGroup.MatchEmpty()) { return NOT_FOUND; }
+        }
+
+        return NOT_FOUND;
+    }
+
+    /// @brief Checks whether or not the header of a saved Flat Hash Table describes a valid set of slots,
+    /// if not, it'll throw a "runtime error" exception.
+    /// @param header The header of the file.
+    /// @param path The path of the file, (for the message of the exception).
+    static void ValidateLayout(const BinaryHeader &header, const std::string &path) noexcept(false)
+    {
+        bool isPowerOfTwo = header.Count >= ControlGroup::WIDTH && !(header.Count & (header.Count - 1));
+        if ((!header.Count || isPowerOfTwo) && header.PairCount + header.TombstoneCount <= MaximumLoad((size_t)header.Count)
+            && header.Count <= SIZE_MAX / sizeof(KeyValuePair<TKey, TValue>)) { return; }
+
+        throw std::runtime_error("The file \"" + path + "\" doesn't describe a valid set of slots.");
+    }
+
+    /// @brief Walks through a batch of keys in two stages that are a few keys apart: hashing a key and
+    /// prefetching the control bytes and the slots of its first group, then resolving the key.
+    /// @tparam TResolve The type of the function that resolves each key.
+    /// @param batchKeys The keys that'll be walked through.
+    /// @param resolve A function that takes the index of a key and its hashing value, and resolves it.
+    template<typename TResolve>
+    void PipelineLookups(const Array<TKey> &batchKeys, const TResolve &resolve) const
+    {
+        constexpr size_t RING_MASK = 2 * PREFETCH_DISTANCE - 1;
+        size_t hashingValues[RING_MASK + 1];
+        size_t length = batchKeys.Length(), groupMask = slots.Length() / ControlGroup::WIDTH - 1;
+
+        for (size_t i = 0; i < length + PREFETCH_DISTANCE; i++)
+        {
+            if (i < length)
+            {
+                size_t hashingValue = hashingValues[i & RING_MASK] = Hash(batchKeys.begin()[i]);
+                if (slots.Length())
+                {
+                    size_t groupStart = ((hashingValue >> 7) & groupMask) * ControlGroup::WIDTH;
+                    Prefetch(controls.begin() + groupStart);
+                    Prefetch(slots.begin() + groupStart);
+                }
+            }
+
+            if (i >= PREFETCH_DISTANCE) { resolve(i - PREFETCH_DISTANCE, hashingValues[(i - PREFETCH_DISTANCE) & RING_MASK]); }
+        }
+    }
+
+    /// @brief Probes the slots for the first free slot along the probing sequence of a hashing value.
+    /// @param hashingValue The hashing value of the key that'll be stored.
+    /// @return The index of the free slot.
+    size_t FindFreeIndex(const size_t &hashingValue) const
+    {
+        size_t groupMask = slots.Length() / ControlGroup::WIDTH - 1,
+            group = (hashingValue >> 7) & groupMask;
+
+        for (size_t probe = 0; ; group = (group + ++probe) & groupMask)
+        {
+            uint64_t mask = ControlGroup(controls.begin() + group * ControlGroup::WIDTH).MatchEmptyOrDeleted();
+            if (mask) { return group * ControlGroup::WIDTH + ControlGroup::LowestIndex(mask); }
+        }
+    }
+
+    /// @brief Sets a pair within the Flat Hash Table, by either copying or moving the value.
+    /// @tparam TValue_ The type of the given value reference.
+    /// @param key The key of the pair that'll be used to access the value its associated with.
+    /// @param value The value that'll be associated with the key.
+    template<typename TValue_>
+    void SetPair(const TKey &key, TValue_ &&value) { SetPair(key, Hash(key), std::forward<TValue_>(value)); }
+
+    /// @brief Sets a pair within the Flat Hash Table whose key has been already hashed.
+    /// @tparam TValue_ The type of the given value reference.
+    /// @param key The key of the pair that'll be used to access the value its associated with.
+    /// @param hashingValue The hashing value of the key.
+    /// @param value The value that'll be associated with the key.
+    template<typename TValue_>
+    void SetPair(const TKey &key, const size_t &hashingValue, TValue_ &&value)
+    {
+        size_t index = FindIndex(key, hashingValue);
+        if (index != NOT_FOUND) { slots.begin()[index].Value = std::forward<TValue_>(value); return; }
+
+        if (count + tombstoneCount + 1 > MaximumLoad(slots.Length()))
+        {
+            // Doubles the slots if they're mostly occupied by pairs, or only clears the tombstones otherwise.
+            bool isMostlyOccupied = count + 1 > MaximumLoad(slots.Length()) / 2;
+            Rehash(isMostlyOccupied ? std::max(MaximumLoad(slots.Length()) * 2, (size_t)1) : count + 1);
+        }
+
+        index = FindFreeIndex(hashingValue);
+        if (controls.begin()[index] == ControlGroup::DELETED) { tombstoneCount--; }
+
+        controls.begin()[index] = Fingerprint(hashingValue);
+        slots.begin()[index].Key = key;
+        slots.begin()[index].Value = std::forward<TValue_>(value);
+        count++;
+    }
+
+    /// @brief Erases a pair from the Flat Hash Table whose key has been already hashed.
+    /// @param key The key of the pair that'll be erased.
+    /// @param hashingValue The hashing value of the key.
+    /// @return A boolean representing whether or not the pair has been erased.
+    bool Erase(const TKey &key, const size_t &hashingValue)
+    {
+        size_t index = FindIndex(key, hashingValue);
+        if (index == NOT_FOUND) { return false; }
+
+        // A slot can only become empty again if its group was never full, otherwise some probing
+        // sequence might have gone past it, and it has to stay as a tombstone.
+        size_t groupStart = index & ~(ControlGroup::WIDTH - 1);
+        bool canBeEmptied = ControlGroup(controls.begin() + groupStart).MatchEmpty() != 0;
+
+        controls.begin()[index] = canBeEmptied ? ControlGroup::EMPTY : ControlGroup::DELETED;
+        slots.begin()[index] = KeyValuePair<TKey, TValue>();
+
+        if (!canBeEmptied) { tombstoneCount++; }
+        count--;
+        return true;
+    }
+};
+
+/// @brief A read-only Flat Hash Table whose control bytes and slots are mapped straight from a binary file
+/// saved by a Flat Hash Table, without copying them or hashing any of the keys again, (so only the groups
+/// that get probed are read from the disk).
+/// @tparam TKey The type of the keys stored within the Mapped Flat Hash Table.
+/// @tparam TValue The type of the values stored within the Mapped Flat Hash Table.
+/// @tparam THasher The function object that hashes the keys by their values.
+template<typename TKey, typename TValue, typename THasher = Hasher<TKey>>
+class MappedFlatHashTable
+{
+    static_assert(std::is_trivially_copyable_v<KeyValuePair<TKey, TValue>>,
+        "Only the pairs of trivially copyable types can be mapped from raw bytes.");
+
+public:
+    /// @brief Maps the slots of a binary file, if the file can't be mapped, or it isn't of the expected
+    /// kind, it'll throw a "runtime error" exception.
+    /// @param path The path of the file.
+    /// @param verifyChecksum Whether or not the checksum is validated, (which reads the whole file once).
+    /// @param hasher The function object that'll be used to hash the keys, (it must hash them the same way
+    /// as the hasher of the saved Flat Hash Table).
+    explicit MappedFlatHashTable(const std::string &path, const bool &verifyChecksum = false,
+        const THasher &hasher = THasher()) noexcept(false) : file(path), hasher(hasher)
+    {
+        const BinaryHeader &header = ValidateMappedFile(file, BinaryFormat::FlatHashTable, sizeof(Pair),
+            [](const BinaryHeader &header)
+            {
+                return header.Count > SIZE_MAX / (sizeof(Pair) + 1) ? SIZE_MAX
+                    : AlignedSectionLength(header.Count) + header.Count * sizeof(Pair);
+            }, path);
+        FlatHashTable<TKey, TValue, THasher>::ValidateLayout(header, path);
+
+        capacity = (size_t)header.Count;
+        count = (size_t)header.PairCount;
+        hashingSeed = (size_t)header.HashingSeed;
+        controls = reinterpret_cast<const int8_t*>(file.Data() + sizeof(BinaryHeader));
+        slots = reinterpret_cast<const Pair*>(file.Data() + sizeof(BinaryHeader) + AlignedSectionLength(capacity));
+
+        if (verifyChecksum)
+        {
+            BinarySection sections[] = { { controls, capacity }, { slots, capacity * sizeof(Pair) } };
+            ValidateChecksum(header, ChecksumSections(sections, 2), path);
+        }
+    }
+
+    /// @brief Mapped Flat Hash Tables can't be copied, since they own their mapping.
+    MappedFlatHashTable(const MappedFlatHashTable<TKey, TValue, THasher> &reference) = delete;
+
+    /// @brief Creates a new Mapped Flat Hash Table by taking over the mapping of another one.
+    /// @param reference The reference of the Mapped Flat Hash Table that'll be moved.
+    MappedFlatHashTable(MappedFlatHashTable<TKey, TValue, THasher> &&reference) noexcept
+        : file(std::move(reference.file)), controls(reference.controls), slots(reference.slots),
+        capacity(reference.capacity), count(reference.count), hasher(std::move(reference.hasher)),
+        hashingSeed(reference.hashingSeed) { reference.Detach(); }
+
+    ~MappedFlatHashTable() = default;
+
+private:
+    /// @brief The type of the pairs stored within the slots.
+    using Pair = KeyValuePair<TKey, TValue>;
+
+    /// @brief The mapping of the whole file.
+    MappedFile file;
+    /// @brief A pointer to the first control byte within the mapping.
+    const int8_t* controls = nullptr;
+    /// @brief A pointer to the first slot within the mapping.
+    const Pair* slots = nullptr;
+    /// @brief The amount of slots within the mapping.
+    size_t capacity = 0;
+    /// @brief The amount of pairs stored within the slots.
+    size_t count = 0;
+    /// @brief The function object that'll be used for hashing the keys.
+    THasher hasher;
+    /// @brief The initial value the keys have been hashed with.
+    size_t hashingSeed = 0;
+
+public:
+    /// @brief The amount of slots within the mapping.
+    /// @return The capacity of the Mapped Flat Hash Table.
+    size_t Capacity() const { return capacity; }
+    /// @brief The amount of pairs stored within the Mapped Flat Hash Table.
+    /// @return The pairs count of the Mapped Flat Hash Table.
+    size_t Count() const { return count; }
+    /// @brief Indicates whether or not the Mapped Flat Hash Table has no pairs.
+    /// @return A boolean representing whether or not the Mapped Flat Hash Table is empty.
+    bool IsEmpty() const { return !count; }
+
+    /// @brief Gets a value within the Mapped Flat Hash Table using a key, (if the key doesn't exist, it'll throw
+    /// an "out of range" exception).
+    /// @param key The key of the pair that'll be used to access the value its associated with.
+    /// @return The value that's associated with the key.
+    const TValue &Get(const TKey &key) const noexcept(false)
+    {
+        const TValue* value = Find(key);
+        if (value != nullptr) { return *value; }
+
+        throw std::out_of_range("The provided key doesn't exist within the Mapped Flat Hash Table.");
+    }
+
+    /// @brief Gets a value within the Mapped Flat Hash Table using a key, without throwing if it doesn't exist.
+    /// @param key The key of the pair that'll be used to access the value its associated with.
+    /// @param value The reference that'll be assigned the value associated with the key, if found.
+    /// @return A boolean representing whether or not the key has been found.
+    bool TryGet(const TKey &key, TValue &value) const
+    {
+        const TValue* foundValue = Find(key);
+        if (foundValue == nullptr) { return false; }
+
+        value = *foundValue;
+        return true;
+    }
+
+    /// @brief Searches for the value that's associated with a key.
+    /// @param key The key of the pair that'll be searched for.
+    /// @return A pointer to the value associated with the key within the mapping, or null pointer if unfound.
+    const TValue* Find(const TKey &key) const
+    {
+        size_t index = FindIndex(key);
+        return index != FlatHashTable<TKey, TValue, THasher>::NOT_FOUND ? &slots[index].Value : nullptr;
+    }
+
+    /// @brief Checks for a key within the Mapped Flat Hash Table.
+    /// @param key The key of the pair that'll be searched for.
+    /// @return A boolean value representing whether or not the key is presented in the Mapped Flat Hash Table.
+    bool Has(const TKey &key) const { return FindIndex(key) != FlatHashTable<TKey, TValue, THasher>::NOT_FOUND; }
+
+    /// @brief Applies a callback Function for each pair in the Mapped Flat Hash Table.
+    /// @param callback The function that'll be applied to all pairs, that takes the key and the value of it.
+    void Foreach(std::function<void(const TKey &key, const TValue &value)> callback) const
+    {
+        for (size_t i = 0; i < capacity; i++)
+        { if (controls[i] >= 0) { callback(slots[i].Key, slots[i].Value); } }
+    }
+
+    /// @brief Only Gets a value within the Mapped Flat Hash Table using a key, (if the key doesn't exist,
+    /// it'll throw an "out of range" exception).
+    /// @param key The key of the pair that'll be used to access the value its associated with.
+    /// @return The value that's associated with the key.
+    const TValue &operator[](const TKey &key) const noexcept(false) { return Get(key); }
+
+    /// @brief Mapped Flat Hash Tables can't be copied, since they own their mapping.
+    MappedFlatHashTable<TKey, TValue, THasher> &operator=(const MappedFlatHashTable<TKey, TValue, THasher> &reference) = delete;
+
+    /// @brief Moves a Mapped Flat Hash Table into another, by taking over its mapping.
+    /// @param reference The reference of the Mapped Flat Hash Table that'll be moved.
+    /// @return The result of the moving.
+    MappedFlatHashTable<TKey, TValue, THasher> &operator=(MappedFlatHashTable<TKey, TValue, THasher> &&reference) noexcept
+    {
+        if (this == &reference) { return *this; }
+
+        file = std::move(reference.file);
+        controls = reference.controls;
+        slots = reference.slots;
+        capacity = reference.capacity;
+        count = reference.count;
+        hasher = std::move(reference.hasher);
+        hashingSeed = reference.hashingSeed;
+
+        reference.Detach();
+        return *this;
+    }
+
+private:
+    /// @brief Leaves the Mapped Flat Hash Table empty, once its mapping has been taken over.
+    void Detach()
+    {
+        controls = nullptr;
+        slots = nullptr;
+        capacity = count = 0;
+    }
+
+    /// @brief Probes the mapped slots for a key.
+    /// @param key The key that'll be searched for.
+    /// @return The index of the slot holding the key, or NOT_FOUND if unfound.
+    size_t FindIndex(const TKey &key) const
+    {
+        if (!count) { return FlatHashTable<TKey, TValue, THasher>::NOT_FOUND; }
+        return FlatHashTable<TKey, TValue, THasher>::FindIndex(controls, slots, capacity, key, hasher(key, hashingSeed));
+    }
+};
+
+#endif
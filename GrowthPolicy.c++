@@ -0,0 +1,122 @@
+#include<iostream>
+
+#ifndef GROWTH_POLICY
+#define GROWTH_POLICY
+
+#include<algorithm>
+
+/// @brief A strategy that decides the next capacity of a contiguous data structure each time
+/// it runs out of space to store more elements, either by growing it linearly or geometrically.
+class GrowthPolicy
+{
+public:
+    /// @brief The ways in which a Growth Policy can expand a capacity.
+    enum class Kind { Linear, Geometric };
+
+    /// @brief Creates the default Growth Policy, that multiplies the capacity by the default growth factor.
+    GrowthPolicy() = default;
+
+    /// @brief Creates a linear Growth Policy from a capacity modifier, (it's left implicit so any
+    /// capacity modifier can be given wherever a Growth Policy is expected).
+    /// @param capacityModifier The amount of increment the capacity gets each time it runs
+    /// out of space to store more elements.
+    GrowthPolicy(const size_t &capacityModifier)
+        : kind(Kind::Linear), capacityModifier(capacityModifier) { ValidateCapacityModifier(); }
+
+    ~GrowthPolicy() = default;
+
+private:
+    /// @brief The way in which the Growth Policy expands a capacity.
+    Kind kind = Kind::Geometric;
+    /// @brief The amount of increment the capacity gets each time, (only used by linear growth).
+    size_t capacityModifier = 0;
+    /// @brief The factor the capacity gets multiplied by each time, (only used by geometric growth).
+    float growthFactor = DEFAULT_GROWTH_FACTOR;
+
+public:
+    /// @brief The factor the capacity gets multiplied by if unspecified by the consumer.
+    static constexpr float DEFAULT_GROWTH_FACTOR = 2.0F;
+    /// @brief The smallest capacity a geometric growth will ever expand to.
+    static constexpr size_t MINIMUM_CAPACITY = 16;
+
+    /// @brief Creates a Growth Policy that increments the capacity by a fixed amount each time.
+    /// @param capacityModifier The amount of increment the capacity gets each time it runs
+    /// out of space to store more elements.
+    /// @return The linear Growth Policy.
+    static GrowthPolicy Linear(const size_t &capacityModifier) { return GrowthPolicy(capacityModifier); }
+
+    /// @brief Creates a Growth Policy that multiplies the capacity by a fixed factor each time,
+    /// which makes adding elements amortized constant time.
+    /// @param growthFactor The factor the capacity gets multiplied by, (usually 1.5 or 2).
+    /// @return The geometric Growth Policy.
+    static GrowthPolicy Geometric(const float &growthFactor = DEFAULT_GROWTH_FACTOR)
+    {
+        GrowthPolicy growthPolicy;
+        growthPolicy.growthFactor = growthFactor;
+        growthPolicy.ValidateGrowthFactor();
+        return growthPolicy;
+    }
+
+    /// @brief Rounds a capacity up to the closest power of two, (useful for the data structures that
+    /// index their elements with a bit mask instead of a division).
+    /// @param capacity The capacity that'll be rounded up.
+    /// @return The smallest power of two that's greater than or equal to the capacity, (or one if it's zero).
+    static size_t NextPowerOfTwo(const size_t &capacity)
+    {
+        size_t powerOfTwo = 1;
+        while (powerOfTwo < capacity) { powerOfTwo <<= 1; }
+        return powerOfTwo;
+    }
+
+    /// @brief The way in which the Growth Policy expands a capacity.
+    /// @return The kind of the Growth Policy.
+    Kind GrowthKind() const { return kind; }
+    /// @brief The amount of increment the capacity gets each time it runs out of space.
+    /// @return The capacity modifier of the Growth Policy, or zero if it grows geometrically.
+    size_t CapacityModifier() const { return kind == Kind::Linear ? capacityModifier : 0; }
+    /// @brief The factor the capacity gets multiplied by each time it runs out of space.
+    /// @return The growth factor of the Growth Policy, or one if it grows linearly.
+    float GrowthFactor() const { return kind == Kind::Geometric ? growthFactor : 1.0F; }
+
+    /// @brief Computes the capacity that should be allocated up front to hold a defined amount of elements.
+    /// @param required The amount of elements that need to be stored.
+    /// @return The initial capacity.
+    size_t InitialCapacity(const size_t &required) const
+    {
+        if (kind == Kind::Linear) { return (required / capacityModifier + 1) * capacityModifier; }
+        return required;
+    }
+
+    /// @brief Computes the next capacity once the current one can no longer hold the required elements.
+    /// @param capacity The current capacity.
+    /// @param required The amount of elements that need to be stored.
+    /// @return The next capacity, which is guaranteed to be at least the required amount.
+    size_t NextCapacity(const size_t &capacity, const size_t &required) const
+    {
+        if (kind == Kind::Linear) { return (required / capacityModifier + 1) * capacityModifier; }
+
+        size_t grownCapacity = std::max((size_t)(capacity * growthFactor), capacity + 1);
+        return std::max(required, std::max(grownCapacity, MINIMUM_CAPACITY));
+    }
+
+private:
+    /// @brief Checks whether or not the capacity modifier is positive, if not,
+    /// it'll throw an "out of range" exception.
+    void ValidateCapacityModifier() const noexcept(false)
+    {
+        if (capacityModifier) { return; }
+
+        throw std::out_of_range("The capacity modifier of a linear Growth Policy must be greater than zero.");
+    }
+
+    /// @brief Checks whether or not the growth factor is greater than one, if not,
+    /// it'll throw an "out of range" exception.
+    void ValidateGrowthFactor() const noexcept(false)
+    {
+        if (growthFactor > 1) { return; }
+
+        throw std::out_of_range("The growth factor [" + std::to_string(growthFactor) + "] must be greater than one.");
+    }
+};
+
+#endif
@@ -3,52 +3,174 @@
 #ifndef HASH_TABLE
 #define HASH_TABLE
 
+#include<cmath>
+
 #include "LinkedList.c++"
 #include "List.c++"
+#include "CacheLine.c++"
+#include "Instrumentation.c++"
+#include "KeyValuePair.c++"
+#include "BloomFilter.c++"
+
+#include "Algorithms/Hasher.c++"
+
+/// @brief The ways a Hash Table redistributes its pairs once it reaches its threshold.
+enum class RehashingMode
+{
+    /// @brief Redistributes every pair at once, as soon as the threshold is reached.
+    Immediate,
+    /// @brief Keeps the old buckets side by side with the new ones, and migrates a fixed amount
+    /// of them on each access, so no single insertion pays for redistributing every pair.
+    Incremental,
+};
 
-#include "Algorithms/MurmurHashingAlgorithm.c++"
+/// @brief A snapshot of the statistics of a Hash Table, where the counters of its work stay zero unless
+/// the instrumentation is enabled, (by defining "DATA_STRUCTURES_INSTRUMENTATION").
+struct HashTableStats
+{
+    /// @brief The amount of pairs stored within the Hash Table.
+    size_t Count = 0;
+    /// @brief The amount of current buckets.
+    size_t BucketCount = 0;
+    /// @brief The average amount of pairs within each current bucket.
+    float LoadFactor = 0;
+    /// @brief The amount of current buckets for each chain length, (where the chain length is the index),
+    /// which doesn't include the pairs that haven't been migrated yet while rehashing incrementally.
+    Array<size_t> ChainLengthHistogram;
+    /// @brief The amount of times the pairs have been redistributed into a new set of buckets.
+    size_t RehashCount = 0;
+    /// @brief The amount of pairs moved from the old buckets into the current ones.
+    size_t MigratedPairCount = 0;
+    /// @brief The amount of times a key has been searched for, (by every Get, Has and Set).
+    size_t LookupCount = 0;
+    /// @brief The amount of keys compared while searching for the keys.
+    size_t ProbeCount = 0;
+    /// @brief The amount of bucket searches that the Bloom Filter has skipped, since their keys were definitely missing.
+    size_t FilterRejectionCount = 0;
+    /// @brief The amount of bucket searches that the Bloom Filter has let through, but their keys were missing.
+    size_t FilterFalsePositiveCount = 0;
+    /// @brief The false positive rate of the Bloom Filter estimated by the fraction of its set bits, (which is
+    /// known without the instrumentation, and stays zero if the Hash Table isn't filtered).
+    double EstimatedFilterFalsePositiveRate = 0;
+
+    /// @brief The average amount of keys compared for each search.
+    /// @return The probes per lookup, or zero if no key has been searched for.
+    double ProbesPerLookup() const { return LookupCount ? ProbeCount / (double)LookupCount : 0; }
+
+    /// @brief The fraction of the searches for missing keys that the Bloom Filter has failed to skip.
+    /// @return The measured false positive rate of the Bloom Filter, or zero if no missing key has been searched for.
+    double FilterFalsePositiveRate() const
+    {
+        size_t missingCount = FilterRejectionCount + FilterFalsePositiveCount;
+        return missingCount ? FilterFalsePositiveCount / (double)missingCount : 0;
+    }
+};
+
+/// @brief The counters of the work of a Hash Table, which its lookups update too, (so they're atomic, and the
+/// threads that only read a shared Hash Table don't race on them while the instrumentation is enabled).
+struct HashTableCounters
+{
+    /// @brief The amount of times the pairs have been redistributed into a new set of buckets.
+    RelaxedCounter RehashCount;
+    /// @brief The amount of pairs moved from the old buckets into the current ones.
+    RelaxedCounter MigratedPairCount;
+    /// @brief The amount of times a key has been searched for.
+    RelaxedCounter LookupCount;
+    /// @brief The amount of keys compared while searching for the keys.
+    RelaxedCounter ProbeCount;
+    /// @brief The amount of bucket searches that the Bloom Filter has skipped.
+    RelaxedCounter FilterRejectionCount;
+    /// @brief The amount of bucket searches that the Bloom Filter has let through, but their keys were missing.
+    RelaxedCounter FilterFalsePositiveCount;
+};
 
 /// @brief A data structure where every entry consists of a key and a valuel, where the key
 /// can be used to access its associated value.
-/// @tparam TKey 
-/// @tparam TValue 
-template<typename TKey, typename TValue>
+/// @tparam TKey The type of the keys stored within the Hash Table.
+/// @tparam TValue The type of the values stored within the Hash Table.
+/// @tparam THasher The function object that hashes the keys by their values.
+template<typename TKey, typename TValue, typename THasher = Hasher<TKey>>
 class HashTable
 {
 public:
     /// @brief Creates a new empty Hash Table.
-    HashTable()
-    {   
-        this->threshold = INITIAL_THRESHOLD;
-
-        keys = List<LinkedList<TKey>>();
-        values = List<LinkedList<TValue>>();
-    }
+    HashTable() : HashTable(INITIAL_CAPACITY) { }
 
     /// @brief Creates a new Hash Table with a defined capacity, to avoid copying the
     /// data if the initial capacity is known.
     /// @param capacity The amount of elements that'll be stored within the Hash Table.
     /// @param threshold The percentage of the Hash Table that needs to be occupied before resizing.
-    /// @param capacityModifier The amount of increment the Hash Table capacity gets each time it runs
-    /// out of space to store more elements.
-    /// @param hashingAlgorith The algorithm that'll be used to hash the keys of the Hash Table,
-    /// (if none's given, the built-in MurmurHash algorithm will be used instead).
-    /// @param hashingSeed An initial value that determines the outcome of the given hashing algorithm,
+    /// @param growthPolicy The way the Hash Table bucket arrays grow each time they run
+    /// out of space, (a plain capacity modifier makes them grow linearly).
+    /// @param hasher The function object that'll be used to hash the keys of the Hash Table by their values.
+    /// @param hashingSeed An initial value that determines the outcome of the hasher,
     /// (usually, it's set to zero).
-    HashTable(const size_t &capacity, float threshold = HashTable<TKey, TValue>::INITIAL_THRESHOLD,
-        const size_t capacityModifier = HashTable<TKey, TValue>::INITIAL_CAPACITY,
-        std::function<long(const long &rawHashing, const long &seed)> hashingAlgorithm = MurmurHashingAlgorithm,
-        const long &hashingSeed = 0)
+    /// @param rehashingMode Whether the pairs get redistributed all at once, or a few buckets at a time.
+    HashTable(const size_t &capacity, float threshold = INITIAL_THRESHOLD,
+        const GrowthPolicy &growthPolicy = GrowthPolicy(),
+        const THasher &hasher = THasher(), const size_t &hashingSeed = 0,
+        const RehashingMode &rehashingMode = RehashingMode::Immediate) : hasher(hasher), rehashingMode(rehashingMode)
     {
         this->threshold = threshold;
         ValidateThreshold();
 
-        keys = List<LinkedList<TKey>>(capacity, capacityModifier);
-        values = List<LinkedList<TValue>>(capacity, capacityModifier);
+        keys = List<LinkedList<TKey>>(std::max(capacity, (size_t)1), growthPolicy);
+        values = List<LinkedList<TValue>>(std::max(capacity, (size_t)1), growthPolicy);
 
-        this->HashingAlgorithm = hashingAlgorithm;
         this->hashingSeed = hashingSeed;
     }
+
+    /// @brief Creates a new Hash Table by copying another Hash Table as reference.
+    /// @param reference The reference of the Hash Table that'll be copied.
+    HashTable(const HashTable<TKey, TValue, THasher> &reference) = default;
+
+    /// @brief Creates a new Hash Table by taking over the buckets of another Hash Table, which is left empty,
+    /// (with no buckets until a pair is set within it).
+    /// @param reference The reference of the Hash Table that'll be moved.
+    HashTable(HashTable<TKey, TValue, THasher> &&reference) noexcept
+        : keys(std::move(reference.keys)), values(std::move(reference.values)), threshold(reference.threshold),
+        hasher(std::move(reference.hasher)), hashingSeed(reference.hashingSeed), hashedPairCount(reference.hashedPairCount),
+        rehashingMode(reference.rehashingMode), oldKeys(std::move(reference.oldKeys)), oldValues(std::move(reference.oldValues)),
+        migratedBucketCount(reference.migratedBucketCount), isRehashing(reference.isRehashing),
+        filterFalsePositiveRate(reference.filterFalsePositiveRate), filter(std::move(reference.filter)),
+        oldFilter(std::move(reference.oldFilter))
+    {
+        INSTRUMENTED(stats = reference.stats;)
+        reference.LeaveEmpty();
+    }
+
+    /// @brief Copies a Hash Table into another.
+    /// @param reference The reference of the Hash Table that'll be copied.
+    /// @return The result of the copying.
+    HashTable<TKey, TValue, THasher> &operator=(const HashTable<TKey, TValue, THasher> &reference) = default;
+
+    /// @brief Moves a Hash Table into another, by taking over its buckets, (the moved one is left empty,
+    /// with no buckets until a pair is set within it).
+    /// @param reference The reference of the Hash Table that'll be moved.
+    /// @return The result of the moving.
+    HashTable<TKey, TValue, THasher> &operator=(HashTable<TKey, TValue, THasher> &&reference) noexcept
+    {
+        if (this == &reference) { return *this; }
+
+        keys = std::move(reference.keys);
+        values = std::move(reference.values);
+        threshold = reference.threshold;
+        hasher = std::move(reference.hasher);
+        hashingSeed = reference.hashingSeed;
+        hashedPairCount = reference.hashedPairCount;
+        rehashingMode = reference.rehashingMode;
+        oldKeys = std::move(reference.oldKeys);
+        oldValues = std::move(reference.oldValues);
+        migratedBucketCount = reference.migratedBucketCount;
+        isRehashing = reference.isRehashing;
+        filterFalsePositiveRate = reference.filterFalsePositiveRate;
+        filter = std::move(reference.filter);
+        oldFilter = std::move(reference.oldFilter);
+        INSTRUMENTED(stats = reference.stats;)
+
+        reference.LeaveEmpty();
+        return *this;
+    }
     
 private:
     /// @brief The keys stored within the Hash Table.
@@ -57,88 +179,180 @@ private:
     List<LinkedList<TValue>> values;
     /// @brief The percentage of the Hash Table that needs to be occupied before resizing.
     float threshold;
-    /// @brief The algorithm that'll be used for hashing the keys of the Hash Table.
-    std::function<long(const long &rawHashing, const long &seed)> HashingAlgorithm = MurmurHashingAlgorithm;
-    /// @brief The initial value that determines the outcome of the given hashing algorithm.
-    long hashingSeed = 0;
+    /// @brief The function object that'll be used for hashing the keys of the Hash Table.
+    THasher hasher;
+    /// @brief The initial value that determines the outcome of the hasher.
+    size_t hashingSeed = 0;
     /// @brief The amount of pairs that got hashed into the Hashed Table.
     long hashedPairCount = 0;
+    /// @brief Whether the pairs get redistributed all at once, or a few buckets at a time.
+    RehashingMode rehashingMode = RehashingMode::Immediate;
+    /// @brief The keys buckets that are still being migrated into the current ones.
+    List<LinkedList<TKey>> oldKeys = List<LinkedList<TKey>>(0);
+    /// @brief The values buckets that are still being migrated into the current ones.
+    List<LinkedList<TValue>> oldValues = List<LinkedList<TValue>>(0);
+    /// @brief The amount of old buckets that have been already migrated.
+    size_t migratedBucketCount = 0;
+    /// @brief Indicates whether or not the old buckets are still being migrated.
+    bool isRehashing = false;
+    /// @brief The false positive rate the Bloom Filters are sized for, or zero if the Hash Table isn't filtered.
+    double filterFalsePositiveRate = 0;
+    /// @brief The Bloom Filter of the keys within the current buckets.
+    BloomFilter<TKey, THasher> filter;
+    /// @brief The Bloom Filter of the keys within the old buckets that are still being migrated.
+    BloomFilter<TKey, THasher> oldFilter;
+#if defined(DATA_STRUCTURES_INSTRUMENTATION)
+    /// @brief The counters of the work of the Hash Table, (which are updated by the lookups too).
+    mutable HashTableCounters stats;
+#endif
     
 public:
     /// @brief The initial value of the Hash Table capacity modifier if unspecified by the consumer.
     static constexpr float INITIAL_THRESHOLD = 0.75F;
-    /// @brief The initial value of the Hash Table capacity modifier if unspecified by the consumer.
-    static const size_t INITIAL_CAPACITY = 500;
+    /// @brief The initial value of the Hash Table capacity if unspecified by the consumer.
+    static constexpr size_t INITIAL_CAPACITY = 500;
+    /// @brief The amount of old buckets that get migrated on each access while rehashing incrementally.
+    static constexpr size_t MIGRATED_BUCKETS_PER_STEP = 4;
+    /// @brief The amount of keys each stage of the batched operations runs ahead of the next one.
+    static constexpr size_t PREFETCH_DISTANCE = 8;
 
     /// @brief The amount of elements the Dynamic Array can maximally hold currently.
     /// @return The capacity of the Dynamic Array.
     size_t Capacity() const { return keys.capacity; }
     /// @brief The amount of increment the Dynamic Array capacity gets each time it runs
     /// out of space to store more elements.
-    /// @return The capacity modifier of the Dynamic Array.
-    size_t CapacityModifier() const { return keys.capacityModifier; }
+    /// @return The capacity modifier of the Dynamic Array, or zero if it grows geometrically.
+    size_t CapacityModifier() const { return keys.CapacityModifier(); }
+    /// @brief The way the Hash Table bucket arrays grow each time they run out of space.
+    /// @return The Growth Policy of the Hash Table.
+    const GrowthPolicy &Growth() const { return keys.Growth(); }
     /// @brief The percentage of the Hash Table that needs to be occupied before resizing.
     /// @return The threshold of the Hash Table.
     float Threshold() const { return threshold; }
+    /// @brief Whether the pairs get redistributed all at once, or a few buckets at a time.
+    /// @return The Rehashing Mode of the Hash Table.
+    RehashingMode Rehashing() const { return rehashingMode; }
+    /// @brief Indicates whether or not some pairs are still being migrated into the current buckets.
+    /// @return A boolean representing whether or not the Hash Table is rehashing.
+    bool IsRehashing() const { return isRehashing; }
+    /// @brief The amount of pairs stored within the Hash Table.
+    /// @return The pairs count of the Hash Table.
+    size_t Count() const { return hashedPairCount; }
+    /// @brief The average amount of pairs within each bucket of the Hash Table.
+    /// @return The load factor of the Hash Table.
+    float LoadFactor() const { return keys.capacity ? hashedPairCount / (float)keys.capacity : 0; }
+    /// @brief Indicates whether or not a Bloom Filter skips the bucket searches of the missing keys.
+    /// @return A boolean representing whether or not the Hash Table is filtered.
+    bool IsFiltered() const { return filterFalsePositiveRate > 0; }
+
+    /// @brief Takes a snapshot of the statistics of the Hash Table, by walking through its current buckets
+    /// to make the chain length histogram.
+    /// @return The Hash Table Stats, (whose counters are zero unless the instrumentation is enabled).
+    HashTableStats Stats() const
+    {
+        HashTableStats snapshot;
+        INSTRUMENTED
+        (
+            snapshot.RehashCount = stats.RehashCount;
+            snapshot.MigratedPairCount = stats.MigratedPairCount;
+            snapshot.LookupCount = stats.LookupCount;
+            snapshot.ProbeCount = stats.ProbeCount;
+            snapshot.FilterRejectionCount = stats.FilterRejectionCount;
+            snapshot.FilterFalsePositiveCount = stats.FilterFalsePositiveCount;
+        )
+        snapshot.Count = hashedPairCount;
+        snapshot.BucketCount = keys.capacity;
+        snapshot.LoadFactor = LoadFactor();
+        if (IsFiltered()) { snapshot.EstimatedFilterFalsePositiveRate = filter.EstimatedFalsePositiveRate(); }
+
+        size_t longestChainLength = 0;
+        for (size_t i = 0; i < keys.capacity; i++) { longestChainLength = std::max(longestChainLength, keys.array[i].Count()); }
 
-    // TODO: An overloading for the value TKey types, using Sorted Set and Binary Search.
+        snapshot.ChainLengthHistogram = Array<size_t>(longestChainLength + 1, (size_t)0);
+        for (size_t i = 0; i < keys.capacity; i++) { snapshot.ChainLengthHistogram.begin()[keys.array[i].Count()]++; }
+
+        return snapshot;
+    }
 
     /// @brief Sets a pair within the Hash Table.
     /// @param key The key of the pair that'll be used to access the value its associated with.
-    /// @param value The value that'll be associated with the key.
-    void Set(TKey &key, TValue value)
-    {
-        long rawHashing = long(&key) + long(&key) + sizeof(key),
-            hashingValue = HashingAlgorithm(rawHashing, hashingSeed);
-        size_t index = hashingValue % values.capacity;
-        
-        LinkedList<TKey>* keyPocket = &keys.array[index];
-        LinkedList<TValue>* valuePocket = &values.array[index];
-        
-        Node<TKey>* keyNode = keyPocket->FindFirstNode(key);
-        if (keyNode == nullptr)
-        {
-            keyPocket->Add(key);
-            valuePocket->Add(value);
-            
-            hashedPairCount++;
-            return;
-        }
+    /// @param value The value that'll be copied and associated with the key.
+    void Set(const TKey &key, const TValue &value) { SetPair(key, value); }
 
-        size_t keyNodeIndex = keyPocket->IndexOf(keyNode);
-        valuePocket->NodeAt(keyNodeIndex)->Data = value;
-    }
+    /// @brief Sets a pair within the Hash Table.
+    /// @param key The key of the pair that'll be used to access the value its associated with.
+    /// @param value The value that'll be moved and associated with the key.
+    void Set(const TKey &key, TValue &&value) { SetPair(key, std::move(value)); }
 
     /// @brief Gets a value within the Hash Table using a key, (if the key doesn't exist, it'll throw
     /// an "out of range" exception).
     /// @param key The key of the pair that'll be used to access the value its associated with.
     /// @return The value that's associated with the key.
-    TValue Get(TKey &key)
-    {
-        long rawHashing = long(&key) + long(&key) + sizeof(key),
-            hashingValue = HashingAlgorithm(rawHashing, hashingSeed);
-        size_t index = hashingValue % values.capacity;
-        
-        LinkedList<TKey>* keyPocket = &keys.array[index];
-        LinkedList<TValue>* valuePocket = &values.array[index];
-        
-        auto keyNode = keyPocket->FindFirstNode(key);
-        if (keyNode != nullptr)
-        {
-            size_t keyNodeIndex = keyPocket->IndexOf(keyNode);
-            return valuePocket->NodeAt(keyNodeIndex)->Data;
-        }
+    TValue Get(const TKey &key) const noexcept(false)
+    {
+        Node<TValue>* valueNode = FindValueNode(key, Hash(key));
+        if (valueNode != nullptr) { return valueNode->Data; }
 
         throw std::out_of_range("The provided key doesn't exist within the Hash Table.");
     }
 
+    /// @brief Gets a value within the Hash Table using a key, while migrating a few buckets if it's
+    /// rehashing incrementally, (if the key doesn't exist, it'll throw an "out of range" exception).
+    /// @param key The key of the pair that'll be used to access the value its associated with.
+    /// @return The value that's associated with the key.
+    TValue Get(const TKey &key) noexcept(false)
+    {
+        MigrateBuckets(MIGRATED_BUCKETS_PER_STEP);
+        return static_cast<const HashTable<TKey, TValue, THasher>&>(*this).Get(key);
+    }
+
     /// @brief Checks for a key within the Hash Table.
     /// @param key The key of the pair that'll be searched for.
     /// @return A boolean value representing whether or not the key is presented in the Hash Table.
-    bool Has(TKey &key)
+    bool Has(const TKey &key) const { return FindValueNode(key, Hash(key)) != nullptr; }
+
+    /// @brief Sets a batch of pairs within the Hash Table, where the keys are hashed and their buckets are
+    /// prefetched a few pairs ahead, so the cache misses of the pairs overlap instead of stalling one by one.
+    /// @param batchKeys The keys of the pairs.
+    /// @param batchValues The values that'll be copied and associated with the keys at the same indices.
+    void SetMany(const Array<TKey> &batchKeys, const Array<TValue> &batchValues) noexcept(false)
+    {
+        ValidateBatchLength(batchKeys.Length(), batchValues.Length());
+        Reserve(hashedPairCount + batchKeys.Length());
+
+        PipelineLookups(batchKeys, [&](const size_t &index, const size_t &hashingValue)
+        { SetPair(batchKeys.begin()[index], hashingValue, batchValues.begin()[index]); });
+    }
+
+    /// @brief Gets the values of a batch of keys, where the keys are hashed and their buckets are prefetched a few
+    /// keys ahead, (if any of the keys doesn't exist, it'll throw an "out of range" exception).
+    /// @param batchKeys The keys of the pairs that'll be used to access the values they're associated with.
+    /// @param batchValues The Array that'll be assigned the value of each key at the same index, (it's
+    /// reallocated if its length doesn't match the keys).
+    void GetMany(const Array<TKey> &batchKeys, Array<TValue> &batchValues) const noexcept(false)
+    {
+        if (batchValues.Length() != batchKeys.Length()) { batchValues = Array<TValue>(batchKeys.Length()); }
+
+        PipelineLookups(batchKeys, [&](const size_t &index, const size_t &hashingValue)
+        {
+            Node<TValue>* valueNode = FindValueNode(batchKeys.begin()[index], hashingValue);
+            if (valueNode == nullptr) { throw std::out_of_range("The provided key doesn't exist within the Hash Table."); }
+
+            batchValues.begin()[index] = valueNode->Data;
+        });
+    }
+
+    /// @brief Checks for a batch of keys within the Hash Table, where the keys are hashed and their buckets are
+    /// prefetched a few keys ahead.
+    /// @param batchKeys The keys of the pairs that'll be searched for.
+    /// @param isFound The Array that'll be assigned whether or not each key is presented at the same index,
+    /// (it's reallocated if its length doesn't match the keys).
+    void HasMany(const Array<TKey> &batchKeys, Array<bool> &isFound) const
     {
-        try { Get(key); return true; } catch (...) { }
-        return false;
+        if (isFound.Length() != batchKeys.Length()) { isFound = Array<bool>(batchKeys.Length()); }
+
+        PipelineLookups(batchKeys, [&](const size_t &index, const size_t &hashingValue)
+        { isFound.begin()[index] = FindValueNode(batchKeys.begin()[index], hashingValue) != nullptr; });
     }
 
     /// @brief Gets or Sets a value within the Hash Table using a key, without the ability
@@ -147,8 +361,257 @@ public:
     /// @return The value that's associated with the key.
     TValue operator[](const TKey &key) const noexcept(false)
     { return Get(key); }
+
+    /// @brief Redistributes every pair into a new set of buckets at once, (finishing any ongoing
+    /// incremental rehashing first).
+    /// @param bucketCount The amount of buckets, (it never goes below what the pairs count needs
+    /// to stay under the threshold).
+    void Rehash(const size_t &bucketCount)
+    {
+        BeginRehash(std::max(bucketCount, BucketCountFor(hashedPairCount)));
+        MigrateBuckets(oldKeys.capacity);
+    }
+
+    /// @brief Makes sure the Hash Table can hold a defined amount of pairs without exceeding its threshold.
+    /// @param count The amount of pairs the Hash Table will be able to hold.
+    void Reserve(const size_t &count)
+    {
+        if (BucketCountFor(count) <= keys.capacity) { return; }
+        Rehash(BucketCountFor(count));
+    }
+
+    /// @brief Makes a Bloom Filter of the keys skip the bucket searches of the missing keys, which is rebuilt
+    /// along with the buckets on every rehashing, (so lookups that mostly miss cost a single cache line each).
+    /// @param falsePositiveRate The approximate chance of a missing key to still be searched for, (it's between 0 and 1).
+    void EnableFilter(const double &falsePositiveRate = BloomFilter<TKey, THasher>::DEFAULT_FALSE_POSITIVE_RATE) noexcept(false)
+    {
+        MigrateBuckets(oldKeys.capacity);
+
+        filter = MakeFilter(keys.capacity, falsePositiveRate);
+        filterFalsePositiveRate = falsePositiveRate;
+        for (size_t i = 0; i < keys.capacity; i++)
+        {
+            for (Node<TKey>* keyNode = keys.array[i].Head(); keyNode; keyNode = keyNode->Next()) { filter.AddHash(Hash(keyNode->Data)); }
+        }
+    }
+
+    /// @brief Stops filtering the lookups, and releases the Bloom Filters.
+    void DisableFilter()
+    {
+        filterFalsePositiveRate = 0;
+        filter = oldFilter = BloomFilter<TKey, THasher>();
+    }
+
+    /// @brief Saves the pairs of the Hash Table into a binary file, as a header followed by the raw pairs,
+    /// (the buckets aren't saved, since they're rebuilt while loading).
+    /// @param path The path of the file, (which is replaced if it exists).
+    void Save(const std::string &path) const noexcept(false)
+    {
+        Array<KeyValuePair<TKey, TValue>> pairs(hashedPairCount);
+        size_t pairCount = 0;
+
+        auto gather = [&](const List<LinkedList<TKey>> &keysBuckets, const List<LinkedList<TValue>> &valuesBuckets)
+        {
+            for (size_t i = 0; i < keysBuckets.capacity; i++)
+            {
+                Node<TValue>* valueNode = valuesBuckets.array[i].Head();
+                for (Node<TKey>* keyNode = keysBuckets.array[i].Head(); keyNode; keyNode = keyNode->Next(), valueNode = valueNode->Next())
+                { pairs.begin()[pairCount++] = KeyValuePair<TKey, TValue> { keyNode->Data, valueNode->Data }; }
+            }
+        };
+
+        if (isRehashing) { gather(oldKeys, oldValues); }
+        gather(keys, values);
+
+        pairs.Save(path);
+    }
+
+    /// @brief Loads a Hash Table from a binary file saved by "Save", by setting each one of its pairs,
+    /// if the file can't be read, or it's corrupted, it'll throw a "runtime error" exception.
+    /// @param path The path of the file.
+    /// @param hasher The function object that'll be used to hash the keys of the Hash Table by their values.
+    /// @param hashingSeed An initial value that determines the outcome of the hasher.
+    /// @return The Hash Table containing the loaded pairs.
+    static HashTable<TKey, TValue, THasher> Load(const std::string &path, const THasher &hasher = THasher(),
+        const size_t &hashingSeed = 0) noexcept(false)
+    {
+        Array<KeyValuePair<TKey, TValue>> pairs = Array<KeyValuePair<TKey, TValue>>::Load(path);
+
+        HashTable<TKey, TValue, THasher> table(1, INITIAL_THRESHOLD, GrowthPolicy(), hasher, hashingSeed);
+        table.Reserve(pairs.Length());
+
+        for (const KeyValuePair<TKey, TValue> &pair : pairs) { table.Set(pair.Key, pair.Value); }
+        return table;
+    }
     
 private:
+    /// @brief Sets a pair within the Hash Table, by either copying or moving the value.
+    /// @tparam TValue_ The type of the given value reference.
+    /// @param key The key of the pair that'll be used to access the value its associated with.
+    /// @param value The value that'll be associated with the key.
+    template<typename TValue_>
+    void SetPair(const TKey &key, TValue_ &&value) { SetPair(key, Hash(key), std::forward<TValue_>(value)); }
+
+    /// @brief Sets a pair within the Hash Table whose key has been already hashed.
+    /// @tparam TValue_ The type of the given value reference.
+    /// @param key The key of the pair that'll be used to access the value its associated with.
+    /// @param hashingValue The hashing value of the key.
+    /// @param value The value that'll be associated with the key.
+    template<typename TValue_>
+    void SetPair(const TKey &key, const size_t &hashingValue, TValue_ &&value)
+    {
+        if (!keys.capacity) { Rehash(1); }
+        MigrateBuckets(MIGRATED_BUCKETS_PER_STEP);
+
+        Node<TValue>* valueNode = FindValueNode(key, hashingValue);
+        if (valueNode != nullptr) { valueNode->Data = std::forward<TValue_>(value); return; }
+
+        size_t index = hashingValue % keys.capacity;
+        keys.array[index].Add(key);
+        values.array[index].Add(std::forward<TValue_>(value));
+        if (IsFiltered()) { filter.AddHash(hashingValue); }
+        hashedPairCount++;
+
+        AdapteCapacity();
+    }
+
+    /// @brief Hashes a key by its value.
+    /// @param key The key that'll be hashed.
+    /// @return The hashing value of the key.
+    size_t Hash(const TKey &key) const { return hasher(key, hashingSeed); }
+
+    /// @brief Computes the amount of buckets needed to hold a defined amount of pairs under the threshold.
+    /// @param count The amount of pairs.
+    /// @return The amount of buckets.
+    size_t BucketCountFor(const size_t &count) const { return std::max((size_t)std::ceil(count / threshold), (size_t)1); }
+
+    /// @brief Makes an empty Bloom Filter sized for the pairs a set of buckets holds before reaching the threshold.
+    /// @param bucketCount The amount of buckets.
+    /// @param falsePositiveRate The false positive rate of the Bloom Filter.
+    /// @return The Bloom Filter, (that uses the hashing values of the Hash Table).
+    BloomFilter<TKey, THasher> MakeFilter(const size_t &bucketCount, const double &falsePositiveRate) const noexcept(false)
+    { return BloomFilter<TKey, THasher>((size_t)std::ceil(bucketCount * threshold) + 1, falsePositiveRate, hasher, hashingSeed); }
+
+    /// @brief Searches for a key within the bucket it belongs to, (and within its old bucket too
+    /// if it hasn't been migrated yet, since new pairs always go into the current buckets).
+    /// @param key The key of the pair that'll be searched for.
+    /// @param hashingValue The hashing value of the key.
+    /// @return A pointer to the Node holding the value associated with the key, or null pointer if unfound.
+    Node<TValue>* FindValueNode(const TKey &key, const size_t &hashingValue) const
+    {
+        INSTRUMENTED(stats.LookupCount++;)
+        if (!keys.capacity) { return nullptr; }
+
+        if (isRehashing)
+        {
+            size_t oldIndex = hashingValue % oldKeys.capacity;
+            Node<TValue>* valueNode = oldIndex >= migratedBucketCount ?
+                FindValueNode(key, hashingValue, oldFilter, oldKeys.array[oldIndex], oldValues.array[oldIndex]) : nullptr;
+
+            if (valueNode != nullptr) { return valueNode; }
+        }
+
+        size_t index = hashingValue % keys.capacity;
+        return FindValueNode(key, hashingValue, filter, keys.array[index], values.array[index]);
+    }
+
+    /// @brief Searches a bucket for a key, unless the Bloom Filter of the bucket tells it's definitely missing.
+    /// @param key The key of the pair that'll be searched for.
+    /// @param hashingValue The hashing value of the key.
+    /// @param bucketsFilter The Bloom Filter of the keys within the set of buckets the bucket belongs to.
+    /// @param keysBucket The keys chain of the bucket.
+    /// @param valuesBucket The values chain of the bucket.
+    /// @return A pointer to the Node holding the value associated with the key, or null pointer if unfound.
+    Node<TValue>* FindValueNode(const TKey &key, const size_t &hashingValue, const BloomFilter<TKey, THasher> &bucketsFilter,
+        const LinkedList<TKey> &keysBucket, const LinkedList<TValue> &valuesBucket) const
+    {
+        if (!IsFiltered()) { return FindValueNode(key, keysBucket, valuesBucket); }
+
+        if (!bucketsFilter.MayContainHash(hashingValue))
+        {
+            INSTRUMENTED(stats.FilterRejectionCount++;)
+            return nullptr;
+        }
+
+        Node<TValue>* valueNode = FindValueNode(key, keysBucket, valuesBucket);
+        INSTRUMENTED(if (valueNode == nullptr) { stats.FilterFalsePositiveCount++; })
+        return valueNode;
+    }
+
+    /// @brief Searches a bucket for a key, by walking its keys and values chains side by side.
+    /// @param key The key of the pair that'll be searched for.
+    /// @param keysBucket The keys chain of the bucket.
+    /// @param valuesBucket The values chain of the bucket.
+    /// @return A pointer to the Node holding the value associated with the key, or null pointer if unfound.
+    Node<TValue>* FindValueNode(const TKey &key, const LinkedList<TKey> &keysBucket, const LinkedList<TValue> &valuesBucket) const
+    {
+        Node<TKey>* keyNode = keysBucket.Head();
+        Node<TValue>* valueNode = valuesBucket.Head();
+
+        for ( ; keyNode; keyNode = keyNode->Next(), valueNode = valueNode->Next())
+        {
+            INSTRUMENTED(stats.ProbeCount++;)
+            if (keyNode->Data == key) { return valueNode; }
+        }
+
+        return nullptr;
+    }
+
+    /// @brief Walks through a batch of keys in three stages that are a few keys apart: hashing a key and
+    /// prefetching its bucket, then prefetching the first Nodes of the bucket once it has been loaded,
+    /// and finally resolving the key, so the lookups don't wait for each other's cache misses.
+    /// @tparam TResolve The type of the function that resolves each key.
+    /// @param batchKeys The keys that'll be walked through.
+    /// @param resolve A function that takes the index of a key and its hashing value, and resolves it.
+    template<typename TResolve>
+    void PipelineLookups(const Array<TKey> &batchKeys, const TResolve &resolve) const
+    {
+        constexpr size_t RING_MASK = 4 * PREFETCH_DISTANCE - 1;
+        size_t hashingValues[RING_MASK + 1], indices[RING_MASK + 1];
+        size_t length = batchKeys.Length();
+
+        // A moved Hash Table has no buckets to prefetch, so its keys are resolved right away.
+        if (!keys.capacity)
+        {
+            for (size_t i = 0; i < length; i++) { resolve(i, Hash(batchKeys.begin()[i])); }
+            return;
+        }
+
+        for (size_t i = 0; i < length + 2 * PREFETCH_DISTANCE; i++)
+        {
+            if (i < length)
+            {
+                hashingValues[i & RING_MASK] = Hash(batchKeys.begin()[i]);
+                indices[i & RING_MASK] = hashingValues[i & RING_MASK] % keys.capacity;
+
+                Prefetch(keys.array.begin() + indices[i & RING_MASK]);
+                Prefetch(values.array.begin() + indices[i & RING_MASK]);
+                if (IsFiltered()) { Prefetch(filter.BlockOf(hashingValues[i & RING_MASK])); }
+            }
+
+            if (i >= PREFETCH_DISTANCE && i - PREFETCH_DISTANCE < length)
+            {
+                size_t index = indices[(i - PREFETCH_DISTANCE) & RING_MASK];
+                Prefetch(keys.array.begin()[index].Head());
+                Prefetch(values.array.begin()[index].Head());
+            }
+
+            if (i >= 2 * PREFETCH_DISTANCE) { resolve(i - 2 * PREFETCH_DISTANCE, hashingValues[(i - 2 * PREFETCH_DISTANCE) & RING_MASK]); }
+        }
+    }
+
+    /// @brief Checks whether or not a batch of values matches its batch of keys, if not, it'll throw
+    /// a "logic error" exception.
+    /// @param keyCount The amount of keys within the batch.
+    /// @param valueCount The amount of values within the batch.
+    static void ValidateBatchLength(const size_t &keyCount, const size_t &valueCount) noexcept(false)
+    {
+        if (keyCount == valueCount) { return; }
+
+        throw std::logic_error("Attempting to set " + std::to_string(keyCount) + " keys with "
+            + std::to_string(valueCount) + " values.");
+    }
+
     /// @brief Checks whether or not the threshold is between 0 and 1, if not,
     /// it'll throw an "out of range" exception.
     void ValidateThreshold() const
@@ -158,17 +621,83 @@ private:
         throw std::out_of_range("The threshold [" + std::to_string(threshold) + "] is out of the range of [0, 1).");
     }
 
+    /// @brief Leaves a moved Hash Table empty, with no buckets, (which are allocated again once a pair is set).
+    void LeaveEmpty()
+    {
+        hashedPairCount = 0;
+        migratedBucketCount = 0;
+        isRehashing = false;
+        filterFalsePositiveRate = 0;
+        filter = oldFilter = BloomFilter<TKey, THasher>();
+        INSTRUMENTED(stats = HashTableCounters();)
+    }
+
     /// @brief Checks if the Hash Table is up to its threshold percentage, and adapte to
     /// a new capacity if needed.
     void AdapteCapacity()
     {
-        // TODO: Finish implementing this.
-        if (hashedPairCount / (float)keys.capacity < threshold) { return; }
+        if (LoadFactor() <= threshold) { return; }
+
+        BeginRehash(keys.growthPolicy.NextCapacity(keys.capacity, keys.capacity + 1));
+        if (rehashingMode == RehashingMode::Immediate) { MigrateBuckets(oldKeys.capacity); }
+    }
+
+    /// @brief Moves the current buckets aside as the old ones, and replaces them with a new set of
+    /// empty buckets, (finishing any ongoing migration first).
+    /// @param bucketCount The amount of the new buckets.
+    void BeginRehash(const size_t &bucketCount)
+    {
+        MigrateBuckets(oldKeys.capacity);
+
+        oldKeys = std::move(keys);
+        oldValues = std::move(values);
+        keys = List<LinkedList<TKey>>(bucketCount, oldKeys.Growth());
+        values = List<LinkedList<TValue>>(bucketCount, oldValues.Growth());
+        if (IsFiltered())
+        {
+            oldFilter = std::move(filter);
+            filter = MakeFilter(bucketCount, filterFalsePositiveRate);
+        }
+
+        migratedBucketCount = 0;
+        isRehashing = true;
+        INSTRUMENTED(stats.RehashCount++;)
+    }
+
+    /// @brief Migrates the pairs of a defined amount of old buckets into the current ones, then
+    /// releases the old buckets once all of them are migrated.
+    /// @param bucketCount The amount of old buckets that'll be migrated.
+    void MigrateBuckets(const size_t &bucketCount)
+    {
+        if (!isRehashing) { return; }
+
+        size_t lastBucket = std::min(migratedBucketCount + bucketCount, oldKeys.capacity);
+        for ( ; migratedBucketCount < lastBucket; migratedBucketCount++)
+        {
+            LinkedList<TKey> &keysBucket = oldKeys.array[migratedBucketCount];
+            LinkedList<TValue> &valuesBucket = oldValues.array[migratedBucketCount];
+
+            Node<TKey>* keyNode = keysBucket.Head();
+            Node<TValue>* valueNode = valuesBucket.Head();
+            for ( ; keyNode; keyNode = keyNode->Next(), valueNode = valueNode->Next())
+            {
+                size_t hashingValue = Hash(keyNode->Data), index = hashingValue % keys.capacity;
+                if (IsFiltered()) { filter.AddHash(hashingValue); }
+                keys.array[index].Add(std::move(keyNode->Data));
+                values.array[index].Add(std::move(valueNode->Data));
+                INSTRUMENTED(stats.MigratedPairCount++;)
+            }
+
+            keysBucket = LinkedList<TKey>();
+            valuesBucket = LinkedList<TValue>();
+        }
 
-        // std::cout << "UPDATED TO ";
+        if (migratedBucketCount < oldKeys.capacity) { return; }
 
-        keys.ExpandArray(keys.capacityModifier);
-        values.ExpandArray(keys.capacityModifier);
+        oldKeys = List<LinkedList<TKey>>(0);
+        oldValues = List<LinkedList<TValue>>(0);
+        oldFilter = BloomFilter<TKey, THasher>();
+        isRehashing = false;
     }
 };
 
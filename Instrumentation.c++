@@ -0,0 +1,71 @@
+#include<iostream>
+
+#ifndef INSTRUMENTATION
+#define INSTRUMENTATION
+
+#include<atomic>
+#include<cstddef>
+
+#if defined(DATA_STRUCTURES_INSTRUMENTATION)
+/// @brief Indicates whether or not the data structures keep counting their allocations and work for their statistics.
+constexpr bool IS_INSTRUMENTED = true;
+/// @brief Keeps a statement that updates the statistics of a data structure, (only when "DATA_STRUCTURES_INSTRUMENTATION"
+/// is defined, otherwise the statement and the counters it updates are left out, so they cost nothing).
+#define INSTRUMENTED(...) __VA_ARGS__
+#else
+/// @brief Indicates whether or not the data structures keep counting their allocations and work for their statistics.
+constexpr bool IS_INSTRUMENTED = false;
+/// @brief Leaves out a statement that updates the statistics of a data structure, since the instrumentation is disabled.
+#define INSTRUMENTED(...)
+#endif
+
+/// @brief A counter of the work of a data structure that's updated by its read-only operations too, which is atomic,
+/// (and relaxed, since it orders nothing), so the threads that only read a shared data structure don't race on it.
+class RelaxedCounter
+{
+public:
+    /// @brief Creates a new counter.
+    /// @param value The initial value of the counter.
+    RelaxedCounter(const size_t &value = 0) : value(value) { }
+
+    /// @brief Creates a new counter by copying the current value of another counter.
+    /// @param reference The reference of the counter that'll be copied.
+    RelaxedCounter(const RelaxedCounter &reference) : value(reference.Load()) { }
+
+private:
+    /// @brief The value of the counter.
+    std::atomic<size_t> value;
+
+public:
+    /// @brief Reads the current value of the counter.
+    /// @return The value of the counter.
+    size_t Load() const { return value.load(std::memory_order_relaxed); }
+
+    /// @brief Reads the current value of the counter.
+    /// @return The value of the counter.
+    operator size_t() const { return Load(); }
+
+    /// @brief Copies the current value of another counter into the counter.
+    /// @param reference The reference of the counter that'll be copied.
+    /// @return The reference of the counter after copying.
+    RelaxedCounter &operator=(const RelaxedCounter &reference)
+    {
+        value.store(reference.Load(), std::memory_order_relaxed);
+        return *this;
+    }
+
+    /// @brief Increments the counter.
+    /// @return The value of the counter before incrementing.
+    size_t operator++(int) { return value.fetch_add(1, std::memory_order_relaxed); }
+
+    /// @brief Adds an amount to the counter.
+    /// @param amount The amount that'll be added.
+    /// @return The reference of the counter after adding.
+    RelaxedCounter &operator+=(const size_t &amount)
+    {
+        value.fetch_add(amount, std::memory_order_relaxed);
+        return *this;
+    }
+};
+
+#endif
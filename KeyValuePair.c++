@@ -0,0 +1,19 @@
+#include<iostream>
+
+#ifndef KEY_VALUE_PAIR
+#define KEY_VALUE_PAIR
+
+/// @brief A block of data that associates a key with a value, to be stored within the
+/// associative data structures.
+/// @tparam TKey The type of the key.
+/// @tparam TValue The type of the value associated with the key.
+template<typename TKey, typename TValue>
+struct KeyValuePair
+{
+    /// @brief The key that's used to access the value.
+    TKey Key = TKey();
+    /// @brief The value that's associated with the key.
+    TValue Value = TValue();
+};
+
+#endif
@@ -3,25 +3,76 @@
 #ifndef LINKED_LIST
 #define LINKED_LIST
 
+#include<iterator>
+#include<type_traits>
+
 #include "Node.c++"
+#include "NodePool.c++"
 #include "List.c++"
 #include "Array.c++"
+#include "Instrumentation.c++"
+#include "SetOperations.c++"
 
 /// @brief Introduces the abstraction of the Sparse Array class to the Linked List class.
 /// @tparam T The type of the data stored within the Sparse Array.
 template<typename T>
 class SparseArray;
 
+/// @brief A snapshot of the statistics of a Linked List, where the counters stay zero unless the
+/// instrumentation is enabled, (by defining "DATA_STRUCTURES_INSTRUMENTATION").
+struct LinkedListStats
+{
+    /// @brief The amount of Nodes linked within the Linked List.
+    size_t Count = 0;
+    /// @brief The amount of Nodes constructed by the allocator of the Linked List.
+    size_t AllocatedNodeCount = 0;
+    /// @brief The total size of the Nodes constructed by the allocator of the Linked List.
+    size_t AllocatedByteCount = 0;
+};
+
 /// @brief A data structure which is a set of discontiguous Nodes, that can be expanded up or shrunk
 /// down by adding or removing Nodes from it.
 /// @tparam T The type of the data stored within the Linked List.
-template<typename T>
+/// @tparam TAllocator The allocator that constructs the Nodes of the Linked List, which has to provide
+/// "Construct(arguments...)", "Destroy(node)", "Owns(node)" and "Release()", (like the Node Pool).
+template<typename T, typename TAllocator>
 class LinkedList
 {
 public:
     /// @brief Makes the Sparse Array class a friend with the Linked List class.
     friend class SparseArray<T>;
 
+    /// @brief Walks through the values of the Nodes of a Linked List, in both directions.
+    class Iterator
+    {
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = T*;
+        using reference = T&;
+
+        /// @brief Creates a new Iterator at a Node.
+        /// @param node A pointer to the current Node, or null pointer if it's past the tail.
+        /// @param tail A pointer to the tail Node of the Linked List, that's reached by stepping back from the end.
+        Iterator(Node<T>* node, Node<T>* tail) : node(node), tail(tail) { }
+
+        T &operator*() const { return node->Data; }
+        T* operator->() const { return &node->Data; }
+        Iterator &operator++() { node = node->Next(); return *this; }
+        Iterator operator++(int) { Iterator iterator = *this; node = node->Next(); return iterator; }
+        Iterator &operator--() { node = node ? node->Previous() : tail; return *this; }
+        Iterator operator--(int) { Iterator iterator = *this; --*this; return iterator; }
+        bool operator==(const Iterator &iterator) const { return node == iterator.node; }
+        bool operator!=(const Iterator &iterator) const { return node != iterator.node; }
+
+    private:
+        /// @brief A pointer to the current Node.
+        Node<T>* node;
+        /// @brief A pointer to the tail Node of the Linked List.
+        Node<T>* tail;
+    };
+
     /// @brief Creates a new empty Linked List.
     /// @param improvableSearch Determines whether or not the Linked List will improve its
     /// searching each time it searches for a Node or a value within.
@@ -37,25 +88,29 @@ public:
 
     /// @brief Creates a new Linked List by copying another Linked List as reference.
     /// @param reference The reference of the Linked List that'll be copied.
-    LinkedList(const LinkedList<T> &reference)
+    LinkedList(const LinkedList<T, TAllocator> &reference) : ImprovableSearch(reference.ImprovableSearch)
     {
         for (Node<T>* currentNode = reference.head;
             currentNode; currentNode = currentNode->next)
         {
-            if (!currentNode->isConstructed) { Add(currentNode); continue; }
+            if (!reference.allocator.Owns(currentNode)) { Add(currentNode); continue; }
             Add(currentNode->Data);
-        }        
+        }
     }
 
-    ~LinkedList()
+    /// @brief Creates a new Linked List by taking over the Nodes of another Linked List,
+    /// which is left empty.
+    /// @param reference The reference of the Linked List that'll be moved.
+    LinkedList(LinkedList<T, TAllocator> &&reference) noexcept
+        : count(reference.count), head(reference.head), tail(reference.tail),
+        allocator(std::move(reference.allocator)), ImprovableSearch(reference.ImprovableSearch)
     {
-        for (auto &&constructedNode : constructedNodes)
-        {
-            delete constructedNode;
-            constructedNode = nullptr;
-        }
+        reference.count = 0;
+        reference.head = reference.tail = nullptr;
     }
 
+    ~LinkedList() { DestroyNodes(); }
+
 private:
     /// @brief The amount of elements currently stored within the Linked List.
     size_t count = 0;
@@ -63,16 +118,28 @@ private:
     Node<T>* head = nullptr;
     /// @brief The Node that represents the last Node in the Linked List.
     Node<T>* tail = nullptr;
-
-    // TODO: Change into a Set.
-    /// @brief A List that contains all of the constructed Nodes by this Linked List,
-    /// to be released from memory eventually.
-    DynamicArray<Node<T>*> constructedNodes;
+    /// @brief The allocator that constructs the Nodes of this Linked List, and releases them
+    /// from memory eventually.
+    TAllocator allocator;
+#if defined(DATA_STRUCTURES_INSTRUMENTATION)
+    /// @brief The counters of the Nodes constructed by this Linked List.
+    LinkedListStats stats;
+#endif
 
 public:
     /// @brief The amount of elements currently stored within the Linked List.
     /// @return The Nodes count of the Linked List.
     size_t Count() const { return count; }
+
+    /// @brief Takes a snapshot of the statistics of the Linked List.
+    /// @return The Linked List Stats, (whose counters are zero unless the instrumentation is enabled).
+    LinkedListStats Stats() const
+    {
+        LinkedListStats snapshot;
+        INSTRUMENTED(snapshot = stats;)
+        snapshot.Count = count;
+        return snapshot;
+    }
     /// @brief The Node that represents the first Node in the Linked List.
     /// @return The head Node of the Linked List.
     Node<T>* Head() { return head; }
@@ -86,6 +153,13 @@ public:
     /// @brief The Node that represents the last Node in the Linked List.
     /// @return The tail Node of the Linked List.
     Node<T>* Tail() const { return tail; }
+
+    /// @brief The beginning of the Linked List.
+    /// @return An Iterator at the value of the head Node.
+    Iterator begin() const { return Iterator(head, tail); }
+    /// @brief The end of the Linked List.
+    /// @return An Iterator past the value of the tail Node.
+    Iterator end() const { return Iterator(nullptr, tail); }
     
     /// @brief Determines whether or not the Linked List will improve its
     /// searching each time it searches for a Node or a value within.
@@ -118,18 +192,29 @@ public:
 
     /// @brief Constructs a Node from a given value, and adds it to the end of the Linked List.
     /// @param value The value of the Node that'll be constructed and added.
-    void Add(T value)
+    void Add(const T &value) { Add(ConstructNode(value)); }
+
+    /// @brief Constructs a Node from a given value, and adds it to the end of the Linked List.
+    /// @param value The value that'll be moved into the Node that's constructed and added.
+    void Add(T &&value) { Add(ConstructNode(std::move(value))); }
+
+    /// @brief Constructs a Node with its value constructed in place from a set of arguments,
+    /// and adds it to the end of the Linked List.
+    /// @tparam ...TArguments The types of the arguments given to the value constructor.
+    /// @param ...arguments The arguments that'll be forwarded to the value constructor.
+    /// @return A pointer to the constructed Node.
+    template<typename... TArguments>
+    Node<T>* Emplace(TArguments&&... arguments)
     {
-        Node<T>* constructedNode = new Node<T>(value);
-        constructedNode->isConstructed = true;
+        Node<T>* constructedNode = ConstructNode(std::forward<TArguments>(arguments)...);
         Add(constructedNode);
-        constructedNodes.Add(constructedNode);
+        return constructedNode;
     }
 
     /// @brief Constructs Nodes from a given array of values, and adds them to the end of the Linked List.
     /// @param array The array that consists of values that the Nodes will be constructed from and added.
     void AddRange(const Array<T> &array)
-    { for (auto &&value : array) { Add(T(value)); } }
+    { for (auto &&value : array) { Add(value); } }
 
     /// @brief Constructs Nodes from given values, and adds them to the end of the Linked List.
     /// @param length The amount of values that the Nodes will be constructed from and added
@@ -172,15 +257,27 @@ public:
     /// @brief Constructs a Node from a given value, and adds it into the Linked List at a specified index.
     /// @param value The value of the Node that'll be constructed from and inserted into the Linked List.
     /// @param index The order in which the constructed Node will be inserted at.
-    void Insert(T value, const size_t &index) noexcept(false)
+    void Insert(const T &value, const size_t &index) noexcept(false) { EmplaceAt(index, value); }
+
+    /// @brief Constructs a Node from a given value, and adds it into the Linked List at a specified index.
+    /// @param value The value that'll be moved into the Node that's constructed and inserted.
+    /// @param index The order in which the constructed Node will be inserted at.
+    void Insert(T &&value, const size_t &index) noexcept(false) { EmplaceAt(index, std::move(value)); }
+
+    /// @brief Constructs a Node with its value constructed in place from a set of arguments,
+    /// and adds it into the Linked List at a specified index.
+    /// @tparam ...TArguments The types of the arguments given to the value constructor.
+    /// @param index The order in which the constructed Node will be inserted at.
+    /// @param ...arguments The arguments that'll be forwarded to the value constructor.
+    /// @return A pointer to the constructed Node.
+    template<typename... TArguments>
+    Node<T>* EmplaceAt(const size_t &index, TArguments&&... arguments) noexcept(false)
     {
-        if (index == count || !index && !count) { Add(value); return; }
+        if (index != count && (index || count)) { ValidateBoundaries(index); }
 
-        ValidateBoundaries(index);
-        
-        Node<T>* constructedNode = new Node<T>(value);
-        constructedNodes.Add(constructedNode);
+        Node<T>* constructedNode = ConstructNode(std::forward<TArguments>(arguments)...);
         Insert(constructedNode, index);
+        return constructedNode;
     }
 
     /// @brief Constructs Nodes from a given Array of values, and adds them into the Linked List
@@ -195,14 +292,13 @@ public:
         
         if (!array.Length()) { return; }
 
-        Node<T>* firstConstructedNode = new Node<T>(*array.begin());
-        constructedNodes.Add(firstConstructedNode);
+        Node<T>* firstConstructedNode = ConstructNode(*array.begin());
 
         Node<T>* lastConstructedNode = firstConstructedNode;
-        for (int i = 1; i < array.Length(); i++)
+        for (size_t i = 1; i < array.Length(); i++)
         {
-            Node<T>* constructedNode = new Node<T>(array[i], lastConstructedNode);
-            constructedNodes.Add(constructedNode);
+            Node<T>* constructedNode = ConstructNode(array[i]);
+            lastConstructedNode->Link(constructedNode);
             lastConstructedNode = constructedNode;
         }
         Insert(firstConstructedNode, index);
@@ -317,20 +413,26 @@ public:
         return doesNodeExist;
     }
     
-    /// @brief Removes a Node from the Linked List.
+    /// @brief Removes a Node from the Linked List, (if the Node has been constructed by this
+    /// Linked List, it's destroyed and its memory gets reused by the next constructed Node).
     /// @param node A pointer to the Node that'll be removed.
     void Remove(Node<T> *node, const bool &headToTail = true)
     {
         if (!node) { return; }
 
-        if (node != head) { node->previous->next = node->next; }
-        else { head = node->next; }
+        UnlinkNode(node);
+        if (allocator.Owns(node)) { allocator.Destroy(node); }
+    }
 
-        if (node != tail) { node->next->previous = node->previous; }
-        else { tail = node->previous; }
-        
-        node->next = node->previous = nullptr;
-        count--;
+    /// @brief Removes a Node that has been constructed by this Linked List, (by adding or emplacing a value),
+    /// in a constant time, since it's destroyed without searching the slabs of the allocator for it.
+    /// @param node A pointer to the Node that'll be removed.
+    void RemoveConstructed(Node<T> *node)
+    {
+        if (!node) { return; }
+
+        UnlinkNode(node);
+        allocator.Destroy(node);
     }
 
     /// @brief Removes a Node that has a specified value from the Linked List.
@@ -351,12 +453,26 @@ public:
     /// @param headToTail Determines whether or not to search from head to tail.
     /// @return A boolean representing whether or not the Nodes have been removed.
     bool RemoveAll(const T &value, const bool &headToTail = true)
+    { return RemoveIf([&](Node<T>* node) { return node->Data == value; }) != 0; }
+
+    /// @brief Removes all the Nodes that match a set of conditions, in a single walk through the Linked List.
+    /// @tparam TPredicate The type of the function that validates the Nodes.
+    /// @param predicate A function that takes a pointer to a Node and validates it throughout a set of conditions.
+    /// @return The amount of Nodes that have been removed.
+    template<typename TPredicate>
+    size_t RemoveIf(const TPredicate &predicate)
     {
-        auto nodes = FindAllNodes(value, headToTail);
-        if (!nodes.Length()) { return false; }
+        size_t removedCount = 0;
+        for (Node<T>* currentNode = head, *nextNode; currentNode; currentNode = nextNode)
+        {
+            nextNode = currentNode->next;
+            if (!predicate(currentNode)) { continue; }
 
-        for (auto &&node : nodes) { Remove(node); }
-        return true;
+            Remove(currentNode);
+            removedCount++;
+        }
+
+        return removedCount;
     }
     
     /// @brief Removes a Node that at a specified index from the Linked List.
@@ -434,6 +550,30 @@ public:
         
         Node<T>::Swap(node1, node2);
     }
+
+    /// @brief Moves a Node of the Linked List before another one of its Nodes, by only relinking it,
+    /// (so a recently used Node can be moved to the end in a constant time, without searching).
+    /// @param node A pointer to the Node that'll be moved.
+    /// @param position A pointer to the Node that it'll be moved before, or null pointer to move it to the end.
+    void MoveBefore(Node<T>* node, Node<T>* position)
+    {
+        if (node == position || node->next == position) { return; }
+
+        if (node != head) { node->previous->next = node->next; }
+        else { head = node->next; }
+
+        if (node != tail) { node->next->previous = node->previous; }
+        else { tail = node->previous; }
+
+        node->next = position;
+        node->previous = position ? position->previous : tail;
+
+        if (node->previous) { node->previous->next = node; }
+        else { head = node; }
+
+        if (position) { position->previous = node; }
+        else { tail = node; }
+    }
     
     /// @brief Reverses the flow direction of the Nodes within the Linked List.
     void Reverse()
@@ -454,20 +594,37 @@ public:
         tail->previous = secondNode;
     }
     
-    /// @brief Removes all the Nodes that have repeated values from the Linked List.
-    void Singularize()
+    /// @brief Removes all the Nodes that have repeated values from the Linked List, keeping the first Node of each
+    /// value, in an expected linear time, (the values are hashed if they have a Hasher, or stably sorted otherwise).
+    /// @return The amount of Nodes that have been removed.
+    size_t Singularize()
     {
-        for (Node<T>* node1 = head; node1; node1 = node1->next)
-        {
-            for (Node<T>* node2 = node1->next; node2; )
-            {
-                if (node2->Data != node1->Data) { node2 = node2->next; continue; }
+        Array<bool> isKept(count);
+        size_t removedCount = count - MarkFirstOccurrences(begin(), count, isKept.begin());
 
-                Node<T>* nextNode = node2->next;
-                Remove(node2);
-                node2 = nextNode;
-            }
+        size_t index = 0;
+        for (Node<T>* currentNode = head, *nextNode; currentNode; currentNode = nextNode, index++)
+        {
+            nextNode = currentNode->next;
+            if (!isKept.begin()[index]) { Remove(currentNode); }
         }
+
+        return removedCount;
+    }
+
+    /// @brief Makes a Linked List of the distinct values of this Linked List, in the order of their first occurrences.
+    /// @return A Linked List that has a Node for every value of this Linked List once.
+    LinkedList<T, TAllocator> Distinct() const
+    {
+        Array<bool> isKept(count);
+        MarkFirstOccurrences(begin(), count, isKept.begin());
+
+        LinkedList<T, TAllocator> distinctList(ImprovableSearch);
+        size_t index = 0;
+        for (Node<T>* currentNode = head; currentNode; currentNode = currentNode->next, index++)
+        { if (isKept.begin()[index]) { distinctList.Add(currentNode->Data); } }
+
+        return distinctList;
     }
 
     /// @brief Converts the Linked List into an Array made out of the Nodes values.
@@ -486,44 +643,72 @@ public:
     /// @brief Converts the Linked List into a List made out of the Nodes values.
     /// @return A List consisting of all of the Nodes values of the Linked List.
     DynamicArray<T> ToList() const { return DynamicArray<T>(ToArray()); }
+
+    /// @brief Makes a lazy View of the Nodes values, that can be reversed, sliced, filtered or mapped
+    /// without copying them, (it's invalidated once a Node is added or removed).
+    /// @return A Range View of all of the Nodes values.
+    RangeView<Iterator> View() const { return RangeView<Iterator>(begin(), end()); }
     
     /// @brief Copies a Linked List into another.
     /// @param reference The reference of the Linked List that'll be copied.
     /// @return The result of the copying.
-    LinkedList<T> &operator=(const LinkedList<T> &reference)
+    LinkedList<T, TAllocator> &operator=(const LinkedList<T, TAllocator> &reference)
     {
         if (this == &reference) { return *this; }
 
-        for (auto &&constructedNode : constructedNodes)
-        {
-            delete constructedNode;
-            constructedNode = nullptr;
-        }
+        DestroyNodes();
 
         for (Node<T>* currentNode = reference.head;
             currentNode; currentNode = currentNode->next)
         {
-            if (!currentNode->isConstructed) { Add(currentNode); continue; }
+            if (!reference.allocator.Owns(currentNode)) { Add(currentNode); continue; }
             Add(currentNode->Data);
         }
-        
+
+        ImprovableSearch = reference.ImprovableSearch;
+
+        return *this;
+    }
+
+    /// @brief Moves a Linked List into another, by taking over its Nodes.
+    /// @param reference The reference of the Linked List that'll be moved.
+    /// @return The result of the moving.
+    LinkedList<T, TAllocator> &operator=(LinkedList<T, TAllocator> &&reference) noexcept
+    {
+        if (this == &reference) { return *this; }
+
+        DestroyNodes();
+
+        count = reference.count;
+        head = reference.head;
+        tail = reference.tail;
+        allocator = std::move(reference.allocator);
+        ImprovableSearch = reference.ImprovableSearch;
+
+        reference.count = 0;
+        reference.head = reference.tail = nullptr;
         return *this;
     }
 
     /// @brief Adds a Node to the end of the Linked List contiguously.
     /// @param node A pointer to the Node that'll be added to the Linked List.
     /// @return The reference of the Linked List after adding the Node to it.
-    LinkedList<T> &operator<<(Node<T>* node) { Add(node); return *this; }
+    LinkedList<T, TAllocator> &operator<<(Node<T>* node) { Add(node); return *this; }
     
     /// @brief Constructs a Node from a given value, and adds it to the end of the Linked List.
     /// @param value The value of the Node that'll be constructed and added.
     /// @return The reference of the Linked List after adding the constructed Node to it.
-    LinkedList<T> &operator<<(T value) { Add(value); return *this; }
+    LinkedList<T, TAllocator> &operator<<(const T &value) { Add(value); return *this; }
+
+    /// @brief Constructs a Node from a given value, and adds it to the end of the Linked List.
+    /// @param value The value that'll be moved into the Node that's constructed and added.
+    /// @return The reference of the Linked List after adding the constructed Node to it.
+    LinkedList<T, TAllocator> &operator<<(T &&value) { Add(std::move(value)); return *this; }
     
     /// @brief Constructs Nodes from a given array of values, and adds them to the end of the Linked List.
     /// @param array The array that consists of values of the Nodes will be constructed from and added.
     /// @return The reference of the Linked List after adding the constructed Nodes to it.
-    LinkedList<T> &operator<<(const Array<T> &array) { AddRange(array); return *this; }
+    LinkedList<T, TAllocator> &operator<<(const Array<T> &array) { AddRange(array); return *this; }
 
     /// @brief Gets or Sets a Node in the Linked List, (the indexing starts from head to tail).
     /// @param index The order of the desired Node.
@@ -540,6 +725,49 @@ private:
 
         throw std::out_of_range("The index [" + std::to_string(index) + "] is out of the range of the Linked List.");
     }
+
+    /// @brief Unlinks a Node from its neighbours, and from the head and tail of the Linked List.
+    /// @param node A pointer to the Node that'll be unlinked.
+    void UnlinkNode(Node<T> *node)
+    {
+        if (node != head) { node->previous->next = node->next; }
+        else { head = node->next; }
+
+        if (node != tail) { node->next->previous = node->previous; }
+        else { tail = node->previous; }
+
+        node->next = node->previous = nullptr;
+        count--;
+    }
+
+    /// @brief Constructs a Node owned by this Linked List, with its value constructed in place.
+    /// @tparam ...TArguments The types of the arguments given to the value constructor.
+    /// @param ...arguments The arguments that'll be forwarded to the value constructor.
+    /// @return A pointer to the constructed Node, (which isn't linked to the Linked List yet).
+    template<typename... TArguments>
+    Node<T>* ConstructNode(TArguments&&... arguments)
+    {
+        INSTRUMENTED(stats.AllocatedNodeCount++; stats.AllocatedByteCount += sizeof(Node<T>);)
+        return allocator.Construct(std::forward<TArguments>(arguments)...);
+    }
+
+    /// @brief Destroys every Node constructed by this Linked List, and leaves it empty, (if the Nodes
+    /// data are trivially destructible, the allocator releases them all at once without walking them).
+    void DestroyNodes()
+    {
+        if constexpr (std::is_trivially_destructible_v<T>) { allocator.Release(); }
+        else
+        {
+            for (Node<T>* currentNode = head, *nextNode; currentNode; currentNode = nextNode)
+            {
+                nextNode = currentNode->next;
+                if (allocator.Owns(currentNode)) { allocator.Destroy(currentNode); }
+            }
+        }
+
+        head = tail = nullptr;
+        count = 0;
+    }
     
     /// @brief Searches for a specified amount of the Nodes in the Linked List that have a specified value,
     /// and returns every one that matches, (and doesn't shift Nodes if asked for more than one even if allowed to).
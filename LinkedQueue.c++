@@ -5,6 +5,8 @@
 
 #include "LinkedList.c++"
 
+/// @brief A Linked-List-Based Queue.
+/// @tparam T The type of the data stored within the Linked Queue.
 template<typename T>
 class LinkedQueue : protected LinkedList<T>
 {
@@ -14,15 +16,7 @@ public:
     
     /// @brief Creates a new Linked Queue by copying another Linked Queue as reference.
     /// @param reference The reference of the Linked Queue that'll be copied.
-    LinkedStack(const LinkedQueue<T> &reference)
-    {
-        for (Node<T>* currentNode = reference.head;
-            currentNode; currentNode = currentNode->next)
-        {
-            if (!currentNode->isConstructed) { Add(currentNode); continue; }
-            Add(currentNode->Data);
-        }
-    }
+    LinkedQueue(const LinkedQueue<T> &reference) = default;
 
     ~LinkedQueue() = default;
 
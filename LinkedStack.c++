@@ -16,15 +16,7 @@ public:
 
     /// @brief Creates a new Linked Stack by copying another Linked Stack as reference.
     /// @param reference The reference of the Linked Stack that'll be copied.
-    LinkedStack(const LinkedStack<T> &reference)
-    {
-        for (Node<T>* currentNode = reference.head;
-            currentNode; currentNode = currentNode->next)
-        {
-            if (!currentNode->isConstructed) { Add(currentNode); continue; }
-            Add(currentNode->Data);
-        }
-    }
+    LinkedStack(const LinkedStack<T> &reference) = default;
 
     ~LinkedStack() = default;
 
@@ -19,69 +19,160 @@ public:
     /// @brief Creates a new List with a defined capacity, to avoid copying the
     /// data if the initial capacity is known.
     /// @param capacity The amount of elements that'll be stored within the List.
-    /// @param capacityModifier The amount of increment the List capacity gets each time it runs
+    /// @param growthPolicy The way the List capacity grows each time it runs
     /// out of space to store more elements.
-    explicit List(const size_t &capacity, const size_t capacityModifier = DynamicArray<T>::INITIAL_CAPACITY)
-        : DynamicArray<T>(capacity, capacityModifier) { }
+    explicit List(const size_t &capacity, const GrowthPolicy &growthPolicy = GrowthPolicy())
+        : DynamicArray<T>(capacity, growthPolicy) { }
 
     /// @brief Creates a new List from a defined Array, and basically takes all of its data.
     /// @param array The Array that'll be used to create the List.
-    /// @param capacityModifier The amount of increment the List capacity gets each time it runs
+    /// @param growthPolicy The way the List capacity grows each time it runs
     /// out of space to store more elements.
-    List(const Array<T> &array, const size_t capacityModifier = DynamicArray<T>::INITIAL_CAPACITY)
-        : DynamicArray<T>(array, capacityModifier) { }
+    /// @param executionPolicy The way the elements are copied, (in parallel chunks for large Arrays if not sequential).
+    List(const Array<T> &array, const GrowthPolicy &growthPolicy = GrowthPolicy(),
+        const ExecutionPolicy &executionPolicy = ExecutionPolicy::Sequential)
+        : DynamicArray<T>(array, growthPolicy, executionPolicy) { }
 
     /// @brief Creates a new List with a defined elements count and initial values.
     /// @param length The amount of elements that'll be stored within the List initially.
     /// @param data A pointer to an array in memory, that has some values that'll be
     /// stored within the List initially.
-    /// @param capacityModifier The amount of increment the List capacity gets each time it runs
+    /// @param growthPolicy The way the List capacity grows each time it runs
     /// out of space to store more elements.
-    List(const size_t &length, T* data, const size_t capacityModifier = DynamicArray<T>::INITIAL_CAPACITY)
-        : DynamicArray<T>(length, data, capacityModifier) { }
+    List(const size_t &length, T* data, const GrowthPolicy &growthPolicy = GrowthPolicy())
+        : DynamicArray<T>(length, data, growthPolicy) { }
+
+    /// @brief Creates a new List from a defined Array, by taking over its memory
+    /// instead of copying its elements.
+    /// @param array The Array that'll be moved into the List.
+    /// @param growthPolicy The way the List capacity grows each time it runs
+    /// out of space to store more elements.
+    List(Array<T> &&array, const GrowthPolicy &growthPolicy = GrowthPolicy())
+        : DynamicArray<T>(std::move(array), growthPolicy) { }
+
+    /// @brief Creates a new List by copying another List as reference.
+    /// @param reference The reference of the List that'll be copied.
+    List(const List<T> &reference) = default;
+
+    /// @brief Creates a new List by taking over the memory of another List, which is left empty.
+    /// @param reference The reference of the List that'll be moved.
+    List(List<T> &&reference) noexcept = default;
 
     ~List() = default;
 
     /// @brief Searches for the first element in the List that matches a set of conditions.
+    /// @tparam TPredicate The type of the function that validates the elements.
     /// @param predicate A function that takes an element and validates it throughout a set of conditions.
+    /// @param policy The way the elements are searched through, (the chunks after a match stop early).
     /// @return The index of the first element that matches the set of conditions, or -1 if unfound.
-    size_t First(std::function<bool(const T &element)> predicate) const { return this->array.First(predicate, this->count); }
+    template<typename TPredicate>
+    size_t First(const TPredicate &predicate, const ExecutionPolicy &policy = ExecutionPolicy::Sequential) const
+    { return this->array.First(predicate, this->count, policy); }
 
     /// @brief Searches for the last element in the List that matches a set of conditions.
+    /// @tparam TPredicate The type of the function that validates the elements.
     /// @param predicate A function that takes an element and validates it throughout a set of conditions.
     /// @return The index of the last element that matches the set of conditions, or -1 if unfound.
-    size_t Last(std::function<bool(const T &element)> predicate) const { return this->array.Last(predicate, this->count); }
+    template<typename TPredicate>
+    size_t Last(const TPredicate &predicate) const { return this->array.Last(predicate, this->count); }
 
     /// @brief Searches for all the elements in the List that match a set of conditions.
+    /// @tparam TPredicate The type of the function that validates the elements.
     /// @param predicate A function that takes an element and validates it throughout a set of conditions.
+    /// @param policy The way the elements are searched through, (the indices stay in order either way).
     /// @return An Array filled with all of the last elements indices that match the set of conditions,
     /// or an empty Array if unfound.
-    Array<size_t> Every(std::function<bool(const T &element)> predicate) const { return this->array.Every(predicate, this->count); }
+    template<typename TPredicate>
+    Array<size_t> Every(const TPredicate &predicate, const ExecutionPolicy &policy = ExecutionPolicy::Sequential) const
+    { return this->array.Every(predicate, this->count, policy); }
 
     /// @brief Checks if any of the List elements matches a set of conditions.
+    /// @tparam TPredicate The type of the function that validates the elements.
     /// @param predicate A function that takes an element and validates it throughout a set of conditions.
+    /// @param policy The way the elements are checked, (every chunk stops early once a match is found).
     /// @return A boolean representing whether or not any of the Array elements matches the set of conditions.
-    bool Any(std::function<bool(const T &element)> predicate) const { return this->array.Any(predicate, this->count); }
+    template<typename TPredicate>
+    bool Any(const TPredicate &predicate, const ExecutionPolicy &policy = ExecutionPolicy::Sequential) const
+    { return this->array.Any(predicate, this->count, policy); }
 
     /// @brief Checks if all of the List elements match a set of conditions.
+    /// @tparam TPredicate The type of the function that validates the elements.
     /// @param predicate A function that takes an element and validates it throughout a set of conditions.
+    /// @param policy The way the elements are checked, (every chunk stops early once a mismatch is found).
     /// @return A boolean representing whether or not all of the Array elements match the set of conditions.
-    bool All(std::function<bool(const T &element)> predicate) const { return this->array.All(predicate, this->count); }
+    template<typename TPredicate>
+    bool All(const TPredicate &predicate, const ExecutionPolicy &policy = ExecutionPolicy::Sequential) const
+    { return this->array.All(predicate, this->count, policy); }
+
+    /// @brief Makes a List of the distinct elements of this List, in the order of their first occurrences.
+    /// @return A List that has every element of this List once.
+    List<T> Distinct() const { return List<T>(this->DistinctElements()); }
+
+    /// @brief Makes a List of the distinct elements of both this and another List, in the order of their
+    /// first occurrences, (the ones of this List come first).
+    /// @param other The List whose elements will be united with the ones of this List.
+    /// @return A List that has every element of both Lists once.
+    List<T> Union(const DynamicArray<T> &other) const { return List<T>(this->UnitedElements(other)); }
+
+    /// @brief Makes a List of the distinct elements of this List that are also within another List,
+    /// in the order of their first occurrences.
+    /// @param other The List whose elements will be intersected with the ones of this List.
+    /// @return A List that has every element that's within both Lists once.
+    List<T> Intersect(const DynamicArray<T> &other) const { return List<T>(this->FilteredElements(other, true)); }
+
+    /// @brief Makes a List of the distinct elements of this List that aren't within another List,
+    /// in the order of their first occurrences.
+    /// @param other The List whose elements will be excluded from the ones of this List.
+    /// @return A List that has every element that's only within this List once.
+    List<T> Except(const DynamicArray<T> &other) const { return List<T>(this->FilteredElements(other, false)); }
 
     /// @brief Makes a copy of the List that'll have the same elements of this List, but
     /// in a reversed order.
+    /// @param policy The way the elements are copied, (in parallel chunks for large Lists if not sequential).
     /// @return A List that has the same elements of this List but in a reversed order.
-    List<T> Reverse() const { return List<T>(this->array.Reverse(this->count)); }
+    List<T> Reverse(const ExecutionPolicy &policy = ExecutionPolicy::Sequential) const
+    { return List<T>(this->array.Reverse(this->count, policy)); }
+
+    /// @brief Makes a copy of the List that'll have the same elements of this List, but sorted
+    /// in an ascending order.
+    /// @param algorithm The algorithm the elements get sorted with.
+    /// @return A List that has the same elements of this List but sorted.
+    List<T> Sort(const SortingAlgorithm &algorithm = SortingAlgorithm::Automatic) const noexcept(false)
+    { return List<T>(this->ToArray().Sort(algorithm)); }
+
+    /// @brief Makes a copy of the List that'll have the same elements of this List, but sorted by a comparer.
+    /// @tparam TComparer The function object that tells whether or not an element goes before another.
+    /// @param comparer The function object that tells whether or not an element goes before another.
+    /// @param algorithm The algorithm the elements get sorted with.
+    /// @return A List that has the same elements of this List but sorted.
+    template<typename TComparer>
+    List<T> Sort(const TComparer &comparer, const SortingAlgorithm &algorithm = SortingAlgorithm::Automatic) const noexcept(false)
+    { return List<T>(this->ToArray().Sort(comparer, algorithm)); }
+
+    /// @brief Copies a List into another.
+    /// @param reference The reference of the List that'll be copied.
+    /// @return The result of the copying.
+    List<T> &operator=(const List<T> &reference) = default;
+
+    /// @brief Moves a List into another, by taking over its memory.
+    /// @param reference The reference of the List that'll be moved.
+    /// @return The result of the moving.
+    List<T> &operator=(List<T> &&reference) noexcept = default;
+
+    /// @brief Adds an element to the end of the List.
+    /// @param element The value of the element that'll be copied into the List.
+    /// @return The reference of the List after adding the element value to it.
+    List<T> &operator<<(const T &element) { this->Add(element); return *this; }
 
     /// @brief Adds an element to the end of the List.
-    /// @param element The value of the element that'll be added to the List.
+    /// @param element The value of the element that'll be moved into the List.
     /// @return The reference of the List after adding the element value to it.
-    List<T> &operator<<(T element) { return (*this << element); }
+    List<T> &operator<<(T &&element) { this->Add(std::move(element)); return *this; }
     
     /// @brief Adds an Array of elements to the end of the List.
     /// @param array The Array that'll be added to the List.
     /// @return The reference of the List after adding the Array of elements value to it.
-    List<T> &operator<<(const Array<T> &array) { return (*this << array); }
+    List<T> &operator<<(const Array<T> &array) { this->AddRange(array); return *this; }
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,393 @@
+#include<iostream>
+
+#ifndef LRU_CACHE
+#define LRU_CACHE
+
+#include<functional>
+
+#include "FlatHashTable.c++"
+#include "LinkedList.c++"
+#include "Algorithms/Hasher.c++"
+
+/// @brief An entry of a Cache, that's stored within a Node of its recency list.
+/// @tparam TKey The type of the key of the entry.
+/// @tparam TValue The type of the value of the entry.
+template<typename TKey, typename TValue>
+struct CacheEntry
+{
+    /// @brief Creates a new empty entry.
+    CacheEntry() = default;
+
+    /// @brief Creates a new entry from a key and a value.
+    /// @tparam TValue_ The type of the given value reference.
+    /// @param key The key of the entry.
+    /// @param value The value of the entry.
+    /// @param size The part of the Cache capacity taken by the entry.
+    template<typename TValue_>
+    CacheEntry(const TKey &key, TValue_ &&value, const size_t &size)
+        : Key(key), Value(std::forward<TValue_>(value)), Size(size) { }
+
+    /// @brief The key of the entry.
+    TKey Key = TKey();
+    /// @brief The value of the entry.
+    TValue Value = TValue();
+    /// @brief The part of the Cache capacity taken by the entry.
+    size_t Size = 1;
+    /// @brief Whether or not the entry is within the protected segment, (which is always empty for an LRU Cache).
+    bool IsProtected = false;
+};
+
+/// @brief A bounded Cache that evicts its least recently used entries once they don't fit within its capacity,
+/// where a Hash Table indexes the Nodes of a Linked List that's ordered from the least to the most recently
+/// used entry, so getting, putting and evicting an entry take a constant time.
+/// @tparam TKey The type of the keys stored within the LRU Cache.
+/// @tparam TValue The type of the values stored within the LRU Cache.
+/// @tparam THasher The function object that hashes the keys by their values.
+template<typename TKey, typename TValue, typename THasher = Hasher<TKey>>
+class LruCache
+{
+public:
+    /// @brief Creates a new empty LRU Cache with a defined capacity.
+    /// @param capacity The total size of the entries that can be stored at once, (which is their count
+    /// if every entry is put with the default size of one, or their bytes if they're put with their sizes).
+    /// @param evictionCallback A function that's called with the key and the value of every evicted entry,
+    /// (before it's destroyed), if any.
+    explicit LruCache(const size_t &capacity, std::function<void(const TKey &key, const TValue &value)> evictionCallback = nullptr)
+        : LruCache(capacity, 0, std::move(evictionCallback)) { }
+
+    /// @brief LRU Caches can't be copied, since their index points to the Nodes of their own recency list.
+    LruCache(const LruCache<TKey, TValue, THasher> &reference) = delete;
+
+    ~LruCache() = default;
+
+protected:
+    /// @brief Creates a new empty Cache with a protected segment.
+    /// @param capacity The total size of the entries that can be stored at once.
+    /// @param protectedCapacity The total size of the entries that can be stored within the protected segment.
+    /// @param evictionCallback A function that's called with the key and the value of every evicted entry, if any.
+    LruCache(const size_t &capacity, const size_t &protectedCapacity,
+        std::function<void(const TKey &key, const TValue &value)> evictionCallback)
+        : capacity(capacity), protectedCapacity(std::min(protectedCapacity, capacity)),
+        evictionCallback(std::move(evictionCallback)) { }
+
+    /// @brief The entries ordered from the least to the most recently used one, where the entries of the
+    /// probationary segment come before the ones of the protected segment.
+    LinkedList<CacheEntry<TKey, TValue>> entries;
+    /// @brief The Nodes of the entries by their keys.
+    FlatHashTable<TKey, Node<CacheEntry<TKey, TValue>>*, THasher> index;
+    /// @brief The first Node of the protected segment, or null pointer if it's empty.
+    Node<CacheEntry<TKey, TValue>>* protectedHead = nullptr;
+    /// @brief The total size of the entries that can be stored at once.
+    size_t capacity;
+    /// @brief The total size of the entries that can be stored within the protected segment.
+    size_t protectedCapacity;
+    /// @brief The total size of the stored entries.
+    size_t size = 0;
+    /// @brief The total size of the entries stored within the protected segment.
+    size_t protectedSize = 0;
+    /// @brief The function that's called with every evicted entry, if any.
+    std::function<void(const TKey &key, const TValue &value)> evictionCallback;
+    /// @brief The amount of searches that have found their keys.
+    size_t hitCount = 0;
+    /// @brief The amount of searches that haven't found their keys.
+    size_t missCount = 0;
+    /// @brief The amount of entries that have been evicted.
+    size_t evictionCount = 0;
+
+public:
+    /// @brief The total size of the entries that can be stored at once.
+    /// @return The capacity of the LRU Cache.
+    size_t Capacity() const { return capacity; }
+    /// @brief The total size of the stored entries.
+    /// @return The size of the LRU Cache.
+    size_t Size() const { return size; }
+    /// @brief The amount of the stored entries.
+    /// @return The entries count of the LRU Cache.
+    size_t Count() const { return entries.Count(); }
+    /// @brief Indicates whether or not the LRU Cache has no entries.
+    /// @return A boolean representing whether or not the LRU Cache is empty.
+    bool IsEmpty() const { return !entries.Count(); }
+
+    /// @brief The amount of searches that have found their keys, (peeking isn't counted).
+    /// @return The hits count of the LRU Cache.
+    size_t HitCount() const { return hitCount; }
+    /// @brief The amount of searches that haven't found their keys, (peeking isn't counted).
+    /// @return The misses count of the LRU Cache.
+    size_t MissCount() const { return missCount; }
+    /// @brief The amount of entries that have been evicted to make space for others.
+    /// @return The evictions count of the LRU Cache.
+    size_t EvictionCount() const { return evictionCount; }
+    /// @brief The portion of the searches that have found their keys.
+    /// @return The hit ratio of the LRU Cache, (or zero if nothing has been searched for).
+    double HitRatio() const { return hitCount + missCount ? hitCount / (double)(hitCount + missCount) : 0; }
+
+    /// @brief Puts an entry within the LRU Cache as the most recently used one, (replacing the value if the key
+    /// already exists), and evicts the least recently used entries until the rest fit within the capacity.
+    /// @param key The key of the entry.
+    /// @param value The value that'll be copied into the entry.
+    /// @param size The part of the capacity taken by the entry.
+    /// @return A boolean representing whether or not the entry is stored, (it isn't if it's larger than the capacity).
+    bool Put(const TKey &key, const TValue &value, const size_t &size = 1) { return PutEntry(key, value, size); }
+
+    /// @brief Puts an entry within the LRU Cache as the most recently used one, (replacing the value if the key
+    /// already exists), and evicts the least recently used entries until the rest fit within the capacity.
+    /// @param key The key of the entry.
+    /// @param value The value that'll be moved into the entry.
+    /// @param size The part of the capacity taken by the entry.
+    /// @return A boolean representing whether or not the entry is stored, (it isn't if it's larger than the capacity).
+    bool Put(const TKey &key, TValue &&value, const size_t &size = 1) { return PutEntry(key, std::move(value), size); }
+
+    /// @brief Searches for the value of a key, and marks its entry as the most recently used one,
+    /// if the key doesn't exist, it'll throw an "out of range" exception.
+    /// @param key The key of the entry that'll be searched for.
+    /// @return The reference of the value, (which stays valid until its entry is evicted or erased).
+    TValue &Get(const TKey &key) noexcept(false)
+    {
+        TValue* value = Find(key);
+        if (value) { return *value; }
+
+        throw std::out_of_range("The provided key doesn't exist within the Cache.");
+    }
+
+    /// @brief Copies the value of a key if it exists, and marks its entry as the most recently used one.
+    /// @param key The key of the entry that'll be searched for.
+    /// @param value The reference that'll be assigned the value of the entry.
+    /// @return A boolean representing whether or not the key has been found.
+    bool TryGet(const TKey &key, TValue &value)
+    {
+        TValue* foundValue = Find(key);
+        if (foundValue == nullptr) { return false; }
+
+        value = *foundValue;
+        return true;
+    }
+
+    /// @brief Searches for the value of a key, and marks its entry as the most recently used one.
+    /// @param key The key of the entry that'll be searched for.
+    /// @return A pointer to the value, or null pointer if unfound.
+    TValue* Find(const TKey &key)
+    {
+        Node<CacheEntry<TKey, TValue>>** node = index.Find(key);
+        if (node == nullptr) { missCount++; return nullptr; }
+
+        hitCount++;
+        Promote(*node);
+        return &(*node)->Data.Value;
+    }
+
+    /// @brief Searches for the value of a key, without marking its entry as used, or counting the search.
+    /// @param key The key of the entry that'll be searched for.
+    /// @return A pointer to the value, or null pointer if unfound.
+    const TValue* Peek(const TKey &key) const
+    {
+        Node<CacheEntry<TKey, TValue>>* const* node = index.Find(key);
+        return node ? &(*node)->Data.Value : nullptr;
+    }
+
+    /// @brief Checks for a key within the LRU Cache, without marking its entry as used, or counting the search.
+    /// @param key The key of the entry that'll be searched for.
+    /// @return A boolean value representing whether or not the key is presented in the LRU Cache.
+    bool Has(const TKey &key) const { return index.Has(key); }
+
+    /// @brief Erases an entry from the LRU Cache using its key, (without calling the eviction callback).
+    /// @param key The key of the entry that'll be erased.
+    /// @return A boolean representing whether or not the entry has been erased.
+    bool Erase(const TKey &key)
+    {
+        Node<CacheEntry<TKey, TValue>>** node = index.Find(key);
+        if (node == nullptr) { return false; }
+
+        RemoveEntry(*node);
+        return true;
+    }
+
+    /// @brief Clears every entry from the LRU Cache, (without calling the eviction callback, or resetting the counters).
+    void Clear()
+    {
+        entries.Clear();
+        index.Clear();
+        protectedHead = nullptr;
+        size = protectedSize = 0;
+    }
+
+    /// @brief Changes the capacity of the LRU Cache, and evicts the least recently used entries that don't fit within it.
+    /// @param capacity The new total size of the entries that can be stored at once.
+    void Resize(const size_t &capacity)
+    {
+        this->capacity = capacity;
+        protectedCapacity = std::min(protectedCapacity, capacity);
+
+        DemoteOverflow();
+        EvictOverflow(nullptr);
+    }
+
+    /// @brief Applies a callback Function for each entry in the LRU Cache, from the least to the most recently
+    /// used one, (without marking them as used).
+    /// @param callback The function that'll be applied to all entries, that takes the key and the value of it.
+    void Foreach(std::function<void(const TKey &key, TValue &value)> callback)
+    {
+        for (Node<CacheEntry<TKey, TValue>>* node = entries.Head(); node; node = node->Next())
+        { callback(node->Data.Key, node->Data.Value); }
+    }
+
+    /// @brief LRU Caches can't be copied, since their index points to the Nodes of their own recency list.
+    LruCache<TKey, TValue, THasher> &operator=(const LruCache<TKey, TValue, THasher> &reference) = delete;
+
+protected:
+    /// @brief Marks an entry as the most recently used one, by moving it to the end of the recency list,
+    /// (an entry of the probationary segment is promoted into the protected segment, and the least recently
+    /// used entries of the protected segment that don't fit anymore are demoted back).
+    /// @param node A pointer to the Node of the entry.
+    void Promote(Node<CacheEntry<TKey, TValue>>* node)
+    {
+        if (!protectedCapacity) { entries.MoveBefore(node, nullptr); return; }
+
+        if (node->Data.IsProtected)
+        {
+            if (node == protectedHead && node->Next()) { protectedHead = node->Next(); }
+            entries.MoveBefore(node, nullptr);
+            return;
+        }
+
+        entries.MoveBefore(node, nullptr);
+        node->Data.IsProtected = true;
+        protectedSize += node->Data.Size;
+        if (!protectedHead) { protectedHead = node; }
+
+        DemoteOverflow();
+    }
+
+    /// @brief Demotes the least recently used entries of the protected segment until the rest fit within it,
+    /// (they stay in place, since the end of the probationary segment is the beginning of the protected one).
+    void DemoteOverflow()
+    {
+        for ( ; protectedHead && protectedSize > protectedCapacity; protectedHead = protectedHead->Next())
+        {
+            protectedHead->Data.IsProtected = false;
+            protectedSize -= protectedHead->Data.Size;
+        }
+    }
+
+    /// @brief Evicts the least recently used entries until the rest fit within the capacity, (starting with
+    /// the probationary segment, since it comes first).
+    /// @param putNode A pointer to the Node of the entry that's being put, or null pointer if none.
+    /// @return A boolean representing whether or not the entry that's being put has been kept.
+    bool EvictOverflow(Node<CacheEntry<TKey, TValue>>* putNode)
+    {
+        bool isKept = true;
+        while (size > capacity)
+        {
+            Node<CacheEntry<TKey, TValue>>* node = entries.Head();
+            if (node == putNode) { isKept = false; }
+
+            if (evictionCallback) { evictionCallback(node->Data.Key, node->Data.Value); }
+            RemoveEntry(node);
+            evictionCount++;
+        }
+
+        return isKept;
+    }
+
+    /// @brief Removes an entry from the recency list and the index.
+    /// @param node A pointer to the Node of the entry.
+    void RemoveEntry(Node<CacheEntry<TKey, TValue>>* node)
+    {
+        if (node == protectedHead) { protectedHead = node->Next(); }
+        if (node->Data.IsProtected) { protectedSize -= node->Data.Size; }
+
+        size -= node->Data.Size;
+        index.Erase(node->Data.Key);
+        entries.RemoveConstructed(node);
+    }
+
+    /// @brief Puts an entry within the Cache, by either copying or moving the value, where a new entry starts
+    /// as the most recently used one of the probationary segment.
+    /// @tparam TValue_ The type of the given value reference.
+    /// @param key The key of the entry.
+    /// @param value The value of the entry.
+    /// @param size The part of the capacity taken by the entry.
+    /// @return A boolean representing whether or not the entry is stored.
+    template<typename TValue_>
+    bool PutEntry(const TKey &key, TValue_ &&value, const size_t &size)
+    {
+        Node<CacheEntry<TKey, TValue>>** foundNode = index.Find(key);
+        if (size > capacity)
+        {
+            if (foundNode) { RemoveEntry(*foundNode); }
+            return false;
+        }
+
+        if (foundNode)
+        {
+            Node<CacheEntry<TKey, TValue>>* node = *foundNode;
+            node->Data.Value = std::forward<TValue_>(value);
+            this->size += size - node->Data.Size;
+            if (node->Data.IsProtected) { protectedSize += size - node->Data.Size; }
+            node->Data.Size = size;
+
+            // The entry might have been already protected, and grown beyond what fits within the protected segment.
+            Promote(node);
+            DemoteOverflow();
+            return EvictOverflow(node);
+        }
+
+        Node<CacheEntry<TKey, TValue>>* node = entries.Emplace(key, std::forward<TValue_>(value), size);
+        if (protectedHead) { entries.MoveBefore(node, protectedHead); }
+
+        index.Set(key, node);
+        this->size += size;
+        return EvictOverflow(node);
+    }
+};
+
+/// @brief A bounded Cache that's split into a probationary and a protected segment, where new entries start
+/// within the probationary one, and only the entries used again get promoted into the protected one, so a scan
+/// of entries that are used once can't evict the frequently used ones, (a Segmented LRU Cache).
+/// @tparam TKey The type of the keys stored within the SLRU Cache.
+/// @tparam TValue The type of the values stored within the SLRU Cache.
+/// @tparam THasher The function object that hashes the keys by their values.
+template<typename TKey, typename TValue, typename THasher = Hasher<TKey>>
+class SlruCache : public LruCache<TKey, TValue, THasher>
+{
+public:
+    /// @brief Creates a new empty SLRU Cache with a defined capacity, where most of it is protected.
+    /// @param capacity The total size of the entries that can be stored at once.
+    /// @param evictionCallback A function that's called with the key and the value of every evicted entry,
+    /// (before it's destroyed), if any.
+    explicit SlruCache(const size_t &capacity, std::function<void(const TKey &key, const TValue &value)> evictionCallback = nullptr)
+        : SlruCache(capacity, (size_t)(capacity * DEFAULT_PROTECTED_RATIO), std::move(evictionCallback)) { }
+
+    /// @brief Creates a new empty SLRU Cache with a defined capacity, and a defined part of it that's protected.
+    /// @param capacity The total size of the entries that can be stored at once.
+    /// @param protectedCapacity The total size of the entries that can be stored within the protected segment,
+    /// (it never goes beyond the capacity).
+    /// @param evictionCallback A function that's called with the key and the value of every evicted entry,
+    /// (before it's destroyed), if any.
+    SlruCache(const size_t &capacity, const size_t &protectedCapacity,
+        std::function<void(const TKey &key, const TValue &value)> evictionCallback = nullptr)
+        : LruCache<TKey, TValue, THasher>(capacity, protectedCapacity, std::move(evictionCallback)) { }
+
+    /// @brief The portion of the capacity that's protected if unspecified by the consumer.
+    static constexpr double DEFAULT_PROTECTED_RATIO = 0.8;
+
+    /// @brief The total size of the entries that can be stored within the protected segment.
+    /// @return The protected capacity of the SLRU Cache.
+    size_t ProtectedCapacity() const { return this->protectedCapacity; }
+    /// @brief The total size of the entries stored within the protected segment.
+    /// @return The protected size of the SLRU Cache.
+    size_t ProtectedSize() const { return this->protectedSize; }
+
+    /// @brief Changes the capacity of the SLRU Cache and its protected segment, and demotes and evicts the
+    /// least recently used entries that don't fit within them.
+    /// @param capacity The new total size of the entries that can be stored at once.
+    /// @param protectedCapacity The new total size of the entries that can be stored within the protected segment.
+    void Resize(const size_t &capacity, const size_t &protectedCapacity)
+    {
+        this->protectedCapacity = std::min(protectedCapacity, capacity);
+        LruCache<TKey, TValue, THasher>::Resize(capacity);
+    }
+
+    using LruCache<TKey, TValue, THasher>::Resize;
+};
+
+#endif
@@ -0,0 +1,188 @@
+#include<iostream>
+
+#ifndef MAPPED_ARRAY
+#define MAPPED_ARRAY
+
+#include "Array.c++"
+#include "Serialization.c++"
+
+/// @brief A read-only Array whose elements are mapped straight from a binary file saved by an Array,
+/// or a Dynamic Array, without copying them, (so only the pages that are accessed get read from the disk).
+/// @tparam T The type of the data stored within the Mapped Array, (it must be trivially copyable).
+template<typename T>
+class MappedArray
+{
+    static_assert(std::is_trivially_copyable_v<T>, "Only the elements of trivially copyable types can be mapped from raw bytes.");
+
+public:
+    /// @brief Maps the elements of a binary file, if the file can't be mapped, or it isn't of the expected
+    /// kind, it'll throw a "runtime error" exception.
+    /// @param path The path of the file.
+    /// @param verifyChecksum Whether or not the checksum is validated, (which reads the whole file once).
+    explicit MappedArray(const std::string &path, const bool &verifyChecksum = false) noexcept(false) : file(path)
+    {
+        const BinaryHeader &header = ValidateMappedFile(file, BinaryFormat::Elements, sizeof(T),
+            [](const BinaryHeader &header) { return ElementsSectionLength(header.Count, sizeof(T)); }, path);
+
+        data = reinterpret_cast<const T*>(file.Data() + sizeof(BinaryHeader));
+        length = (size_t)header.Count;
+
+        if (verifyChecksum) { ValidateChecksum(header, XXHash64(data, length * sizeof(T)), path); }
+    }
+
+    /// @brief Mapped Arrays can't be copied, since they own their mapping.
+    MappedArray(const MappedArray<T> &reference) = delete;
+
+    /// @brief Creates a new Mapped Array by taking over the mapping of another Mapped Array, which is left empty.
+    /// @param reference The reference of the Mapped Array that'll be moved.
+    MappedArray(MappedArray<T> &&reference) noexcept
+        : file(std::move(reference.file)), data(reference.data), length(reference.length)
+    {
+        reference.data = nullptr;
+        reference.length = 0;
+    }
+
+    ~MappedArray() = default;
+
+private:
+    /// @brief The mapping of the whole file.
+    MappedFile file;
+    /// @brief A pointer to the first element within the mapping.
+    const T* data = nullptr;
+    /// @brief The amount of elements stored within the Mapped Array.
+    size_t length = 0;
+
+public:
+    /// @brief The size of the Mapped Array.
+    /// @return The amount of elements stored within the Mapped Array.
+    size_t Length() const { return length; }
+
+    /// @brief The beginning of the Mapped Array.
+    /// @return A pointer to the first element in the Mapped Array.
+    const T* begin() const { return data; }
+    /// @brief The end of the Mapped Array.
+    /// @return A pointer to the last element in the Mapped Array.
+    const T* end() const { return data + length; }
+
+    /// @brief Searches for an element in the Mapped Array, and returns its first occuring index.
+    /// @param element The value of the desired element.
+    /// @return The first occuring index of the element, or -1 if unfound.
+    size_t FirstIndexOf(const T &element) const { return SearchFirst(data, length, element); }
+
+    /// @brief Searches for an element in the Mapped Array, and returns its last occuring index.
+    /// @param element The value of the desired element.
+    /// @return The last occuring index of the element, or -1 if unfound.
+    size_t LastIndexOf(const T &element) const { return SearchLast(data, length, element); }
+
+    /// @brief Searches for an element in the Mapped Array, and returns all of its occuring indices.
+    /// @param element The value of the desired element.
+    /// @return An Array filled with all of the element occuring indices, or an empty Array if unfound.
+    Array<size_t> IndicesOf(const T &element) const
+    {
+        Array<size_t> indices(SearchCount(data, length, element));
+        SearchAll(data, length, element, indices.begin());
+        return indices;
+    }
+
+    /// @brief Checks for the existence of an element in the Mapped Array.
+    /// @param element The value of the desired element.
+    /// @return A boolean representing whether or not the element exists within the Mapped Array.
+    bool Contains(const T &element) const { return FirstIndexOf(element) != -1; }
+
+    /// @brief Searches for the first element in the Mapped Array that matches a set of conditions.
+    /// @tparam TPredicate The type of the function that validates the elements.
+    /// @param predicate A function that takes an element and validates it throughout a set of conditions.
+    /// @return The index of the first element that matches the set of conditions, or -1 if unfound.
+    template<typename TPredicate>
+    size_t First(const TPredicate &predicate) const
+    {
+        for (size_t i = 0; i < length; i++) { if (predicate(data[i])) { return i; } }
+        return -1;
+    }
+
+    /// @brief Searches for the last element in the Mapped Array that matches a set of conditions.
+    /// @tparam TPredicate The type of the function that validates the elements.
+    /// @param predicate A function that takes an element and validates it throughout a set of conditions.
+    /// @return The index of the last element that matches the set of conditions, or -1 if unfound.
+    template<typename TPredicate>
+    size_t Last(const TPredicate &predicate) const
+    {
+        for (size_t i = length; i > 0; i--) { if (predicate(data[i - 1])) { return i - 1; } }
+        return -1;
+    }
+
+    /// @brief Searches for all the elements in the Mapped Array that match a set of conditions.
+    /// @tparam TPredicate The type of the function that validates the elements.
+    /// @param predicate A function that takes an element and validates it throughout a set of conditions.
+    /// @return An Array filled with all of the elements indices that match the set of conditions,
+    /// or an empty Array if unfound.
+    template<typename TPredicate>
+    Array<size_t> Every(const TPredicate &predicate) const
+    {
+        size_t count = 0;
+        for (size_t i = 0; i < length; i++) { count += predicate(data[i]) ? 1 : 0; }
+
+        Array<size_t> indices(count);
+        for (size_t i = 0, j = 0; j < count; i++) { if (predicate(data[i])) { indices.begin()[j++] = i; } }
+        return indices;
+    }
+
+    /// @brief Checks if any of the Mapped Array elements matches a set of conditions.
+    /// @tparam TPredicate The type of the function that validates the elements.
+    /// @param predicate A function that takes an element and validates it throughout a set of conditions.
+    /// @return A boolean representing whether or not any of the elements matches the set of conditions.
+    template<typename TPredicate>
+    bool Any(const TPredicate &predicate) const { return First(predicate) != -1; }
+
+    /// @brief Checks if all of the Mapped Array elements match a set of conditions.
+    /// @tparam TPredicate The type of the function that validates the elements.
+    /// @param predicate A function that takes an element and validates it throughout a set of conditions.
+    /// @return A boolean representing whether or not all of the elements match the set of conditions.
+    template<typename TPredicate>
+    bool All(const TPredicate &predicate) const { return First([&](const T &element) { return !predicate(element); }) == -1; }
+
+    /// @brief Copies the mapped elements into an Array, which can outlive the mapping.
+    /// @return An Array containing all of the Mapped Array elements.
+    Array<T> ToArray() const { return Array<T>(length, data); }
+
+    /// @brief Mapped Arrays can't be copied, since they own their mapping.
+    MappedArray<T> &operator=(const MappedArray<T> &reference) = delete;
+
+    /// @brief Moves a Mapped Array into another, by taking over its mapping.
+    /// @param reference The reference of the Mapped Array that'll be moved.
+    /// @return The result of the moving.
+    MappedArray<T> &operator=(MappedArray<T> &&reference) noexcept
+    {
+        if (this == &reference) { return *this; }
+
+        file = std::move(reference.file);
+        data = reference.data;
+        length = reference.length;
+
+        reference.data = nullptr;
+        reference.length = 0;
+        return *this;
+    }
+
+    /// @brief Only Gets an element in the Mapped Array, since the mapping is read-only.
+    /// @param index The order of the desired element.
+    /// @return The value of the element.
+    const T &operator[](const size_t &index) const noexcept(false)
+    {
+        ValidateBoundaries(index);
+        return data[index];
+    }
+
+private:
+    /// @brief Checks whether or not an index is within the boundaries of the Mapped Array, if not,
+    /// it'll throw an "out of range" exception.
+    /// @param index The selected index that'll be checked.
+    void ValidateBoundaries(const size_t &index) const noexcept(false)
+    {
+        if (index < length) { return; }
+
+        throw std::out_of_range("The index [" + std::to_string(index) + "] is out of the range of the Mapped Array.");
+    }
+};
+
+#endif
@@ -0,0 +1,658 @@
+#include<iostream>
+
+#ifndef MATRIX
+#define MATRIX
+
+#include<algorithm>
+#include<stdexcept>
+#include<string>
+#include<type_traits>
+
+#if defined(__AVX__)
+#define MATRIX_AVX
+#include<immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define MATRIX_SSE2
+#include<emmintrin.h>
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#define MATRIX_NEON
+#include<arm_neon.h>
+#endif
+
+#include "Array.c++"
+#include "ArrayView.c++"
+#include "ExecutionPolicy.c++"
+
+/// @brief Introduces the abstraction of the Array View class to the Matrix class.
+/// @tparam T The type of the data viewed by the Array View.
+template<typename T>
+class ArrayView;
+
+/// @brief Introduces the abstraction of the Matrix class to the Matrix View class.
+/// @tparam T The type of the data stored within the Matrix.
+template<typename T>
+class Matrix;
+
+/// @brief The length of the square tiles that a Matrix is transposed by, so both the read rows and
+/// the written columns of a tile stay within the cache.
+constexpr size_t TRANSPOSITION_BLOCK_LENGTH = 32;
+/// @brief The length of the square tiles of the right Matrix that a multiplication goes through, so
+/// each tile stays within the cache while every row of the left Matrix is multiplied by it.
+constexpr size_t MULTIPLICATION_BLOCK_LENGTH = 128;
+
+/// @brief Adds a range of elements scaled by a factor to another range, (using SIMD instructions
+/// for floats and doubles, AVX, SSE2 or NEON, if available).
+/// @tparam T The type of the elements.
+/// @param output A pointer to the first element that'll be added to.
+/// @param input A pointer to the first element that'll be scaled and added.
+/// @param factor The factor the input elements are multiplied by.
+/// @param length The amount of elements within both ranges.
+template<typename T>
+inline void MultiplyAdd(T* output, const T* input, const T &factor, const size_t &length)
+{
+    size_t i = 0;
+
+#if defined(MATRIX_AVX)
+    if constexpr (std::is_same_v<T, float>)
+    {
+        __m256 factors = _mm256_set1_ps(factor);
+        for (; i + 8 <= length; i += 8)
+        {
+#if defined(__FMA__)
+            _mm256_storeu_ps(output + i, _mm256_fmadd_ps(factors, _mm256_loadu_ps(input + i), _mm256_loadu_ps(output + i)));
+#else
+            _mm256_storeu_ps(output + i, _mm256_add_ps(_mm256_loadu_ps(output + i), _mm256_mul_ps(factors, _mm256_loadu_ps(input + i))));
+#endif
+        }
+    }
+    else if constexpr (std::is_same_v<T, double>)
+    {
+        __m256d factors = _mm256_set1_pd(factor);
+        for (; i + 4 <= length; i += 4)
+        {
+#if defined(__FMA__)
+            _mm256_storeu_pd(output + i, _mm256_fmadd_pd(factors, _mm256_loadu_pd(input + i), _mm256_loadu_pd(output + i)));
+#else
+            _mm256_storeu_pd(output + i, _mm256_add_pd(_mm256_loadu_pd(output + i), _mm256_mul_pd(factors, _mm256_loadu_pd(input + i))));
+#endif
+        }
+    }
+#elif defined(MATRIX_SSE2)
+    if constexpr (std::is_same_v<T, float>)
+    {
+        __m128 factors = _mm_set1_ps(factor);
+        for (; i + 4 <= length; i += 4)
+        { _mm_storeu_ps(output + i, _mm_add_ps(_mm_loadu_ps(output + i), _mm_mul_ps(factors, _mm_loadu_ps(input + i)))); }
+    }
+    else if constexpr (std::is_same_v<T, double>)
+    {
+        __m128d factors = _mm_set1_pd(factor);
+        for (; i + 2 <= length; i += 2)
+        { _mm_storeu_pd(output + i, _mm_add_pd(_mm_loadu_pd(output + i), _mm_mul_pd(factors, _mm_loadu_pd(input + i)))); }
+    }
+#elif defined(MATRIX_NEON)
+    if constexpr (std::is_same_v<T, float>)
+    {
+        float32x4_t factors = vdupq_n_f32(factor);
+        for (; i + 4 <= length; i += 4) { vst1q_f32(output + i, vfmaq_f32(vld1q_f32(output + i), factors, vld1q_f32(input + i))); }
+    }
+    else if constexpr (std::is_same_v<T, double>)
+    {
+        float64x2_t factors = vdupq_n_f64(factor);
+        for (; i + 2 <= length; i += 2) { vst1q_f64(output + i, vfmaq_f64(vld1q_f64(output + i), factors, vld1q_f64(input + i))); }
+    }
+#endif
+
+    for (; i < length; i++) { output[i] += factor * input[i]; }
+}
+
+/// @brief A non-owning view of a rectangle of elements in row-major order, like a whole Matrix or a part
+/// of it, where changing an element changes the memory it views, (the memory must outlive the view).
+/// @tparam T The type of the data viewed by the Matrix View.
+template<typename T>
+class MatrixView
+{
+public:
+    /// @brief Creates a new empty Matrix View.
+    MatrixView() = default;
+
+    /// @brief Creates a new Matrix View of elements in memory.
+    /// @param data A pointer to the first element of the first row.
+    /// @param rows The amount of viewed rows.
+    /// @param columns The amount of viewed columns.
+    /// @param rowStride The distance between the first elements of two rows, (the columns count if the
+    /// rows are next to each other).
+    MatrixView(T* data, const size_t &rows, const size_t &columns, const size_t &rowStride)
+        : data(data), rows(rows), columns(columns), rowStride(rowStride) { }
+
+private:
+    /// @brief A pointer to the first element of the first row.
+    T* data = nullptr;
+    /// @brief The amount of viewed rows.
+    size_t rows = 0;
+    /// @brief The amount of viewed columns.
+    size_t columns = 0;
+    /// @brief The distance between the first elements of two rows.
+    size_t rowStride = 0;
+
+public:
+    /// @brief The amount of rows viewed by the Matrix View.
+    /// @return The rows count of the Matrix View.
+    size_t Rows() const { return rows; }
+    /// @brief The amount of columns viewed by the Matrix View.
+    /// @return The columns count of the Matrix View.
+    size_t Columns() const { return columns; }
+    /// @brief The distance between the first elements of two rows viewed by the Matrix View.
+    /// @return The row stride of the Matrix View.
+    size_t RowStride() const { return rowStride; }
+    /// @brief Indicates whether or not the rows viewed by the Matrix View are next to each other.
+    /// @return A boolean representing whether or not the Matrix View is contiguous.
+    bool IsContiguous() const { return rowStride == columns || rows <= 1; }
+    /// @brief The memory viewed by the Matrix View.
+    /// @return A pointer to the first element of the first row.
+    T* Data() const { return data; }
+
+    /// @brief Makes a view of a row of the Matrix View.
+    /// @param row The index of the row.
+    /// @return A contiguous Array View of the row.
+    ArrayView<T> Row(const size_t &row) const noexcept(false)
+    {
+        ValidateBoundaries(row, 0, 1, 0);
+        return ArrayView<T>(data + row * rowStride, columns);
+    }
+
+    /// @brief Makes a view of a column of the Matrix View.
+    /// @param column The index of the column.
+    /// @return An Array View of the column, that strides over the rows.
+    ArrayView<T> Column(const size_t &column) const noexcept(false)
+    {
+        ValidateBoundaries(0, column, 0, 1);
+        return ArrayView<T>(data + column, rows, rowStride);
+    }
+
+    /// @brief Makes a view of a rectangle within the Matrix View.
+    /// @param row The index of the first row of the rectangle.
+    /// @param column The index of the first column of the rectangle.
+    /// @param rowCount The amount of rows of the rectangle.
+    /// @param columnCount The amount of columns of the rectangle.
+    /// @return A Matrix View of the rectangle.
+    MatrixView<T> Slice(const size_t &row, const size_t &column, const size_t &rowCount, const size_t &columnCount) const noexcept(false)
+    {
+        ValidateBoundaries(row, column, rowCount, columnCount);
+        return MatrixView<T>(data + row * rowStride + column, rowCount, columnCount, rowStride);
+    }
+
+    /// @brief Sets every viewed element to a value.
+    /// @param value The value that'll be set to each element.
+    void Fill(const T &value)
+    {
+        for (size_t i = 0; i < rows; i++) { std::fill(data + i * rowStride, data + i * rowStride + columns, value); }
+    }
+
+    /// @brief Makes a transposed copy of the viewed elements, by going through square tiles of them,
+    /// so the reads and the writes both stay within the cache.
+    /// @return A Matrix where each row is a column of the Matrix View.
+    Matrix<T> Transpose() const
+    {
+        Matrix<T> transposedMatrix(columns, rows);
+        T* transposedData = transposedMatrix.begin();
+
+        for (size_t rowBlock = 0; rowBlock < rows; rowBlock += TRANSPOSITION_BLOCK_LENGTH)
+        {
+            for (size_t columnBlock = 0; columnBlock < columns; columnBlock += TRANSPOSITION_BLOCK_LENGTH)
+            {
+                size_t rowEnd = std::min(rowBlock + TRANSPOSITION_BLOCK_LENGTH, rows);
+                size_t columnEnd = std::min(columnBlock + TRANSPOSITION_BLOCK_LENGTH, columns);
+
+                for (size_t i = rowBlock; i < rowEnd; i++)
+                {
+                    for (size_t j = columnBlock; j < columnEnd; j++) { transposedData[j * rows + i] = data[i * rowStride + j]; }
+                }
+            }
+        }
+
+        return transposedMatrix;
+    }
+
+    /// @brief Multiplies the viewed elements by another Matrix View, by going through square tiles of the
+    /// right one, and adding each element of a left row times a right row to the result row, (which is
+    /// vectorized for floats and doubles).
+    /// @param right The Matrix View that'll be multiplied from the right.
+    /// @param policy The way the rows of the result are computed, (in parallel chunks of rows if not sequential).
+    /// @return The Matrix resulting from the multiplication.
+    Matrix<T> Multiply(const MatrixView<T> &right, const ExecutionPolicy &policy = ExecutionPolicy::Sequential) const noexcept(false)
+    {
+        if (columns != right.rows)
+        {
+            throw std::logic_error("Attempting to multiply a Matrix of " + std::to_string(columns)
+                + " columns by a Matrix of " + std::to_string(right.rows) + " rows.");
+        }
+
+        Matrix<T> product(rows, right.columns, T());
+        T* productData = product.begin();
+
+        auto multiplyRows = [&](const size_t &rowBegin, const size_t &rowEnd)
+        {
+            for (size_t innerBlock = 0; innerBlock < columns; innerBlock += MULTIPLICATION_BLOCK_LENGTH)
+            {
+                for (size_t columnBlock = 0; columnBlock < right.columns; columnBlock += MULTIPLICATION_BLOCK_LENGTH)
+                {
+                    size_t innerEnd = std::min(innerBlock + MULTIPLICATION_BLOCK_LENGTH, columns);
+                    size_t columnCount = std::min(MULTIPLICATION_BLOCK_LENGTH, right.columns - columnBlock);
+
+                    for (size_t i = rowBegin; i < rowEnd; i++)
+                    {
+                        T* productRow = productData + i * right.columns + columnBlock;
+                        for (size_t k = innerBlock; k < innerEnd; k++)
+                        { MultiplyAdd(productRow, right.data + k * right.rowStride + columnBlock, data[i * rowStride + k], columnCount); }
+                    }
+                }
+            }
+        };
+
+        // The work is proportional to every element of the product, not just to the rows count.
+        if (!IsParallel(policy, rows * right.columns * columns / MULTIPLICATION_BLOCK_LENGTH)) { multiplyRows(0, rows); }
+        else
+        {
+            size_t threadCount = ThreadPool::Shared().ThreadCount(), rowCount = (rows + threadCount - 1) / threadCount;
+            ThreadPool::Shared().Run(threadCount, [&](const size_t &chunkIndex)
+            { multiplyRows(std::min(chunkIndex * rowCount, rows), std::min((chunkIndex + 1) * rowCount, rows)); });
+        }
+
+        return product;
+    }
+
+    /// @brief Copies the viewed elements into a Matrix.
+    /// @return A Matrix consisting of all of the viewed elements.
+    Matrix<T> ToMatrix() const
+    {
+        Matrix<T> matrix(rows, columns);
+        for (size_t i = 0; i < rows; i++) { std::copy(data + i * rowStride, data + i * rowStride + columns, matrix.begin() + i * columns); }
+        return matrix;
+    }
+
+    /// @brief Makes a view of a row of the Matrix View, so an element can be reached by "view[row][column]".
+    /// @param row The index of the row.
+    /// @return A contiguous Array View of the row.
+    ArrayView<T> operator[](const size_t &row) const noexcept(false) { return Row(row); }
+
+    /// @brief Gets or Sets a viewed element.
+    /// @param row The index of the row of the element.
+    /// @param column The index of the column of the element.
+    /// @return The element.
+    T &operator()(const size_t &row, const size_t &column) const noexcept(false)
+    {
+        ValidateBoundaries(row, column, 1, 1);
+        return data[row * rowStride + column];
+    }
+
+private:
+    /// @brief Checks whether or not a rectangle is within the boundaries of the Matrix View, if not,
+    /// it'll throw an "out of range" exception.
+    /// @param row The index of the first row of the rectangle.
+    /// @param column The index of the first column of the rectangle.
+    /// @param rowCount The amount of rows of the rectangle.
+    /// @param columnCount The amount of columns of the rectangle.
+    void ValidateBoundaries(const size_t &row, const size_t &column, const size_t &rowCount, const size_t &columnCount) const noexcept(false)
+    {
+        if (row <= rows && rowCount <= rows - row && column <= columns && columnCount <= columns - column) { return; }
+
+        throw std::out_of_range("The position (" + std::to_string(row) + ", " + std::to_string(column)
+            + ") is out of the range of the Matrix.");
+    }
+};
+
+/// @brief A two-dimensional data structure that stores all of its elements within a single contiguous
+/// block of memory, row after row.
+/// @tparam T The type of the data stored within the Matrix.
+template<typename T>
+class Matrix
+{
+public:
+    /// @brief Creates a new empty Matrix.
+    Matrix() = default;
+
+    /// @brief Creates a new Matrix with a defined shape, and all elements are set to their default value.
+    /// @param rows The amount of rows of the Matrix.
+    /// @param columns The amount of columns of the Matrix.
+    Matrix(const size_t &rows, const size_t &columns) : rows(rows), columns(columns), elements(rows * columns) { }
+
+    /// @brief Creates a new Matrix with a defined shape, and all elements are set to an initial value.
+    /// @param rows The amount of rows of the Matrix.
+    /// @param columns The amount of columns of the Matrix.
+    /// @param initialValue The value that'll be set to each element as a default one.
+    Matrix(const size_t &rows, const size_t &columns, const T &initialValue)
+        : rows(rows), columns(columns), elements(rows * columns, initialValue) { }
+
+    /// @brief Creates a new Matrix by copying a Jagged Matrix, whose rows must all have the same length,
+    /// otherwise it'll throw a "logic error" exception.
+    /// @param jaggedMatrix The Jagged Matrix that'll be copied.
+    explicit Matrix(const JaggedMatrix<T> &jaggedMatrix) noexcept(false)
+        : Matrix(jaggedMatrix.Length(), jaggedMatrix.Length() ? jaggedMatrix.begin()->Length() : 0)
+    {
+        for (size_t i = 0; i < rows; i++)
+        {
+            const Array<T> &row = jaggedMatrix.begin()[i];
+            if (row.Length() != columns) { throw std::logic_error("The rows of a Jagged Matrix must all have the same length to make a Matrix."); }
+
+            std::copy(row.begin(), row.end(), elements.begin() + i * columns);
+        }
+    }
+
+    /// @brief Creates a new Matrix by copying another Matrix as reference, (a single copy of its memory block).
+    /// @param reference The reference of the Matrix that'll be copied.
+    Matrix(const Matrix<T> &reference) = default;
+
+    /// @brief Creates a new Matrix by taking over the memory of another Matrix, which is left empty.
+    /// @param reference The reference of the Matrix that'll be moved.
+    Matrix(Matrix<T> &&reference) noexcept
+        : rows(reference.rows), columns(reference.columns), elements(std::move(reference.elements)) { reference.rows = reference.columns = 0; }
+
+    ~Matrix() = default;
+
+private:
+    /// @brief The amount of rows of the Matrix.
+    size_t rows = 0;
+    /// @brief The amount of columns of the Matrix.
+    size_t columns = 0;
+    /// @brief The elements of the Matrix, row after row.
+    Array<T> elements;
+
+public:
+    /// @brief The amount of rows of the Matrix.
+    /// @return The rows count of the Matrix.
+    size_t Rows() const { return rows; }
+    /// @brief The amount of columns of the Matrix.
+    /// @return The columns count of the Matrix.
+    size_t Columns() const { return columns; }
+    /// @brief The amount of elements stored within the Matrix.
+    /// @return The elements count of the Matrix.
+    size_t Count() const { return elements.Length(); }
+
+    /// @brief The beginning of the Matrix.
+    /// @return A pointer to the first element of the first row.
+    T* begin() const { return elements.begin(); }
+    /// @brief The end of the Matrix.
+    /// @return A pointer past the last element of the last row.
+    T* end() const { return elements.end(); }
+
+    /// @brief Makes a view of the whole Matrix.
+    /// @return A Matrix View of all of the Matrix elements.
+    MatrixView<T> View() const { return MatrixView<T>(elements.begin(), rows, columns, columns); }
+
+    /// @brief Makes a view of a row of the Matrix.
+    /// @param row The index of the row.
+    /// @return A contiguous Array View of the row.
+    ArrayView<T> Row(const size_t &row) const noexcept(false) { return View().Row(row); }
+
+    /// @brief Makes a view of a column of the Matrix.
+    /// @param column The index of the column.
+    /// @return An Array View of the column, that strides over the rows.
+    ArrayView<T> Column(const size_t &column) const noexcept(false) { return View().Column(column); }
+
+    /// @brief Makes a view of a rectangle within the Matrix.
+    /// @param row The index of the first row of the rectangle.
+    /// @param column The index of the first column of the rectangle.
+    /// @param rowCount The amount of rows of the rectangle.
+    /// @param columnCount The amount of columns of the rectangle.
+    /// @return A Matrix View of the rectangle.
+    MatrixView<T> Slice(const size_t &row, const size_t &column, const size_t &rowCount, const size_t &columnCount) const noexcept(false)
+    { return View().Slice(row, column, rowCount, columnCount); }
+
+    /// @brief Sets every element of the Matrix to a value.
+    /// @param value The value that'll be set to each element.
+    void Fill(const T &value) { std::fill(begin(), end(), value); }
+
+    /// @brief Makes a transposed copy of the Matrix, by going through square tiles of it.
+    /// @return A Matrix where each row is a column of this Matrix.
+    Matrix<T> Transpose() const { return View().Transpose(); }
+
+    /// @brief Multiplies the Matrix by another Matrix, (vectorized for floats and doubles).
+    /// @param right The Matrix View that'll be multiplied from the right.
+    /// @param policy The way the rows of the result are computed, (in parallel chunks of rows if not sequential).
+    /// @return The Matrix resulting from the multiplication.
+    Matrix<T> Multiply(const MatrixView<T> &right, const ExecutionPolicy &policy = ExecutionPolicy::Sequential) const noexcept(false)
+    { return View().Multiply(right, policy); }
+
+    /// @brief Converts the Matrix into a Jagged Matrix, where each row is a separate Array.
+    /// @return A Jagged Matrix consisting of all of the Matrix elements.
+    JaggedMatrix<T> ToJaggedMatrix() const
+    {
+        JaggedMatrix<T> jaggedMatrix(rows);
+        for (size_t i = 0; i < rows; i++) { jaggedMatrix.begin()[i] = Array<T>(columns, elements.begin() + i * columns); }
+        return jaggedMatrix;
+    }
+
+    /// @brief Makes a view of the whole Matrix.
+    /// @return A Matrix View of all of the Matrix elements.
+    operator MatrixView<T>() const { return View(); }
+
+    /// @brief Copies a Matrix into another.
+    /// @param reference The reference of the Matrix that'll be copied.
+    /// @return The result of the copying.
+    Matrix<T> &operator=(const Matrix<T> &reference) = default;
+
+    /// @brief Moves a Matrix into another, by taking over its memory.
+    /// @param reference The reference of the Matrix that'll be moved.
+    /// @return The result of the moving.
+    Matrix<T> &operator=(Matrix<T> &&reference) noexcept
+    {
+        if (this == &reference) { return *this; }
+
+        rows = reference.rows;
+        columns = reference.columns;
+        elements = std::move(reference.elements);
+
+        reference.rows = reference.columns = 0;
+        return *this;
+    }
+
+    /// @brief Multiplies the Matrix by another Matrix.
+    /// @param right The Matrix that'll be multiplied from the right.
+    /// @return The Matrix resulting from the multiplication.
+    Matrix<T> operator*(const Matrix<T> &right) const noexcept(false) { return Multiply(right); }
+
+    /// @brief Makes a view of a row of the Matrix, so an element can be reached by "matrix[row][column]".
+    /// @param row The index of the row.
+    /// @return A contiguous Array View of the row.
+    ArrayView<T> operator[](const size_t &row) const noexcept(false) { return Row(row); }
+
+    /// @brief Gets or Sets an element in the Matrix.
+    /// @param row The index of the row of the element.
+    /// @param column The index of the column of the element.
+    /// @return The element.
+    T &operator()(const size_t &row, const size_t &column) noexcept(false) { return View()(row, column); }
+
+    /// @brief Only Gets an element in the Matrix, without the ability to Set it.
+    /// @param row The index of the row of the element.
+    /// @param column The index of the column of the element.
+    /// @return The value of the element.
+    const T &operator()(const size_t &row, const size_t &column) const noexcept(false) { return View()(row, column); }
+};
+
+/// @brief A three-dimensional data structure that stores all of its elements within a single contiguous
+/// block of memory, Matrix after Matrix, (each one row-major).
+/// @tparam T The type of the data stored within the Tensor.
+template<typename T>
+class Tensor
+{
+public:
+    /// @brief Creates a new empty Tensor.
+    Tensor() = default;
+
+    /// @brief Creates a new Tensor with a defined shape, and all elements are set to their default value.
+    /// @param depth The amount of matrices of the Tensor.
+    /// @param rows The amount of rows of each Matrix.
+    /// @param columns The amount of columns of each Matrix.
+    Tensor(const size_t &depth, const size_t &rows, const size_t &columns)
+        : depth(depth), rows(rows), columns(columns), elements(depth * rows * columns) { }
+
+    /// @brief Creates a new Tensor with a defined shape, and all elements are set to an initial value.
+    /// @param depth The amount of matrices of the Tensor.
+    /// @param rows The amount of rows of each Matrix.
+    /// @param columns The amount of columns of each Matrix.
+    /// @param initialValue The value that'll be set to each element as a default one.
+    Tensor(const size_t &depth, const size_t &rows, const size_t &columns, const T &initialValue)
+        : depth(depth), rows(rows), columns(columns), elements(depth * rows * columns, initialValue) { }
+
+    /// @brief Creates a new Tensor by copying a Jagged Tensor, whose matrices must all have the same shape,
+    /// otherwise it'll throw a "logic error" exception.
+    /// @param jaggedTensor The Jagged Tensor that'll be copied.
+    explicit Tensor(const JaggedTensor<T> &jaggedTensor) noexcept(false)
+    {
+        if (!jaggedTensor.Length()) { return; }
+
+        Matrix<T> firstMatrix(*jaggedTensor.begin());
+        *this = Tensor<T>(jaggedTensor.Length(), firstMatrix.Rows(), firstMatrix.Columns());
+
+        for (size_t i = 0; i < depth; i++)
+        {
+            Matrix<T> matrix(jaggedTensor.begin()[i]);
+            if (matrix.Rows() != rows || matrix.Columns() != columns)
+            { throw std::logic_error("The matrices of a Jagged Tensor must all have the same shape to make a Tensor."); }
+
+            std::copy(matrix.begin(), matrix.end(), elements.begin() + i * rows * columns);
+        }
+    }
+
+    /// @brief Creates a new Tensor by copying another Tensor as reference, (a single copy of its memory block).
+    /// @param reference The reference of the Tensor that'll be copied.
+    Tensor(const Tensor<T> &reference) = default;
+
+    /// @brief Creates a new Tensor by taking over the memory of another Tensor, which is left empty.
+    /// @param reference The reference of the Tensor that'll be moved.
+    Tensor(Tensor<T> &&reference) noexcept
+        : depth(reference.depth), rows(reference.rows), columns(reference.columns), elements(std::move(reference.elements))
+    { reference.depth = reference.rows = reference.columns = 0; }
+
+    ~Tensor() = default;
+
+private:
+    /// @brief The amount of matrices of the Tensor.
+    size_t depth = 0;
+    /// @brief The amount of rows of each Matrix.
+    size_t rows = 0;
+    /// @brief The amount of columns of each Matrix.
+    size_t columns = 0;
+    /// @brief The elements of the Tensor, Matrix after Matrix.
+    Array<T> elements;
+
+public:
+    /// @brief The amount of matrices of the Tensor.
+    /// @return The depth of the Tensor.
+    size_t Depth() const { return depth; }
+    /// @brief The amount of rows of each Matrix of the Tensor.
+    /// @return The rows count of the Tensor.
+    size_t Rows() const { return rows; }
+    /// @brief The amount of columns of each Matrix of the Tensor.
+    /// @return The columns count of the Tensor.
+    size_t Columns() const { return columns; }
+    /// @brief The distance between the first elements of two matrices of the Tensor.
+    /// @return The Matrix stride of the Tensor.
+    size_t MatrixStride() const { return rows * columns; }
+    /// @brief The amount of elements stored within the Tensor.
+    /// @return The elements count of the Tensor.
+    size_t Count() const { return elements.Length(); }
+
+    /// @brief The beginning of the Tensor.
+    /// @return A pointer to the first element of the first Matrix.
+    T* begin() const { return elements.begin(); }
+    /// @brief The end of the Tensor.
+    /// @return A pointer past the last element of the last Matrix.
+    T* end() const { return elements.end(); }
+
+    /// @brief Makes a view of a Matrix of the Tensor.
+    /// @param index The index of the Matrix.
+    /// @return A Matrix View of the Matrix.
+    MatrixView<T> Slice(const size_t &index) const noexcept(false)
+    {
+        ValidateIndex(index);
+        return MatrixView<T>(elements.begin() + index * rows * columns, rows, columns, columns);
+    }
+
+    /// @brief Sets every element of the Tensor to a value.
+    /// @param value The value that'll be set to each element.
+    void Fill(const T &value) { std::fill(begin(), end(), value); }
+
+    /// @brief Converts the Tensor into a Jagged Tensor, where each row of each Matrix is a separate Array.
+    /// @return A Jagged Tensor consisting of all of the Tensor elements.
+    JaggedTensor<T> ToJaggedTensor() const
+    {
+        JaggedTensor<T> jaggedTensor(depth);
+        for (size_t i = 0; i < depth; i++) { jaggedTensor.begin()[i] = Slice(i).ToMatrix().ToJaggedMatrix(); }
+        return jaggedTensor;
+    }
+
+    /// @brief Copies a Tensor into another.
+    /// @param reference The reference of the Tensor that'll be copied.
+    /// @return The result of the copying.
+    Tensor<T> &operator=(const Tensor<T> &reference) = default;
+
+    /// @brief Moves a Tensor into another, by taking over its memory.
+    /// @param reference The reference of the Tensor that'll be moved.
+    /// @return The result of the moving.
+    Tensor<T> &operator=(Tensor<T> &&reference) noexcept
+    {
+        if (this == &reference) { return *this; }
+
+        depth = reference.depth;
+        rows = reference.rows;
+        columns = reference.columns;
+        elements = std::move(reference.elements);
+
+        reference.depth = reference.rows = reference.columns = 0;
+        return *this;
+    }
+
+    /// @brief Makes a view of a Matrix of the Tensor, so an element can be reached by "tensor[index][row][column]".
+    /// @param index The index of the Matrix.
+    /// @return A Matrix View of the Matrix.
+    MatrixView<T> operator[](const size_t &index) const noexcept(false) { return Slice(index); }
+
+    /// @brief Gets or Sets an element in the Tensor.
+    /// @param index The index of the Matrix of the element.
+    /// @param row The index of the row of the element.
+    /// @param column The index of the column of the element.
+    /// @return The element.
+    T &operator()(const size_t &index, const size_t &row, const size_t &column) noexcept(false)
+    {
+        ValidateBoundaries(index, row, column);
+        return elements.begin()[(index * rows + row) * columns + column];
+    }
+
+    /// @brief Only Gets an element in the Tensor, without the ability to Set it.
+    /// @param index The index of the Matrix of the element.
+    /// @param row The index of the row of the element.
+    /// @param column The index of the column of the element.
+    /// @return The value of the element.
+    const T &operator()(const size_t &index, const size_t &row, const size_t &column) const noexcept(false)
+    {
+        ValidateBoundaries(index, row, column);
+        return elements.begin()[(index * rows + row) * columns + column];
+    }
+
+private:
+    /// @brief Checks whether or not an index of a Matrix is within the boundaries of the Tensor, if not,
+    /// it'll throw an "out of range" exception, (the Matrix may be empty, as its rows or columns may be none).
+    /// @param index The index of the Matrix.
+    void ValidateIndex(const size_t &index) const noexcept(false)
+    {
+        if (index < depth) { return; }
+        throw std::out_of_range("The index [" + std::to_string(index) + "] is out of the range of the Tensor.");
+    }
+
+    /// @brief Checks whether or not a position is within the boundaries of the Tensor, if not,
+    /// it'll throw an "out of range" exception.
+    /// @param index The index of the Matrix of the position.
+    /// @param row The index of the row of the position.
+    /// @param column The index of the column of the position.
+    void ValidateBoundaries(const size_t &index, const size_t &row, const size_t &column) const noexcept(false)
+    {
+        if (index < depth && row < rows && column < columns) { return; }
+
+        throw std::out_of_range("The position (" + std::to_string(index) + ", " + std::to_string(row) + ", "
+            + std::to_string(column) + ") is out of the range of the Tensor.");
+    }
+};
+
+#endif
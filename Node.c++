@@ -3,9 +3,18 @@
 #ifndef NODE
 #define NODE
 
-/// @brief Introduces the abstraction of the Linked List class to the Node class.
-/// @tparam T The type of the data stored within the Linked List.
+#include<utility>
+
+/// @brief Introduces the abstraction of the Node Pool class to the Node class.
+/// @tparam T The type of the data stored within the Nodes.
 template<typename T>
+class NodePool;
+
+/// @brief Introduces the abstraction of the Linked List class to the Node class, (along with its
+/// default allocator, since the Linked List might be used before it's defined through the includes cycle).
+/// @tparam T The type of the data stored within the Linked List.
+/// @tparam TAllocator The allocator that constructs the Nodes of the Linked List.
+template<typename T, typename TAllocator = NodePool<T>>
 class LinkedList;
 
 /// @brief A block of code that contains a certain amount of data, and points to another block.
@@ -15,15 +24,26 @@ class Node
 {
 public:
     /// @brief Makes the Linked List class a friend with the Node class.
-    friend class LinkedList<T>;
+    template<typename T_, typename TAllocator>
+    friend class LinkedList;
 
     /// @brief Creates a new empty Node.
     Node() = default;
 
     /// @brief Creates a new Node with a defined data.
-    /// @param data The data that'll be stored within the Node.
+    /// @param data The data that'll be copied into the Node.
     Node(const T &data) : Data(data) { }
 
+    /// @brief Creates a new Node with a defined data.
+    /// @param data The data that'll be moved into the Node.
+    Node(T &&data) : Data(std::move(data)) { }
+
+    /// @brief Creates a new Node with its data constructed in place from a set of arguments.
+    /// @tparam ...TArguments The types of the arguments given to the data constructor.
+    /// @param ...arguments The arguments that'll be forwarded to the data constructor.
+    template<typename... TArguments>
+    explicit Node(std::in_place_t, TArguments&&... arguments) : Data(std::forward<TArguments>(arguments)...) { }
+
     /// @brief Creates a new Node with a defined data, and the Node that should point to this Node.
     /// @param data The data that'll be stored within the Node.
     /// @param next A pointer to Node that'll point to this Node as a next Node.
@@ -36,8 +56,6 @@ private:
     Node* previous = nullptr;
     /// @brief The Node that this Node points to as a next Node.
     Node* next = nullptr;
-    /// @brief Indicates whether or not the Node has been constructed by some Linked List.
-    bool isConstructed = false;
 
 public:
     /// @brief The data stored within the Node.
@@ -0,0 +1,183 @@
+#include<iostream>
+
+#ifndef NODE_POOL
+#define NODE_POOL
+
+#include<functional>
+#include<new>
+
+#include "Node.c++"
+
+/// @brief An allocator that carves Nodes out of large slabs of memory, that grow geometrically,
+/// and keeps the released Nodes within a free list to be reused, so constructing a Node rarely
+/// touches the heap, and every slab is released at once when the Node Pool is destroyed.
+/// @tparam T The type of the data stored within the Nodes.
+template<typename T>
+class NodePool
+{
+public:
+    /// @brief Creates a new empty Node Pool, (no memory is allocated until the first Node is constructed).
+    NodePool() = default;
+
+    /// @brief Node Pools can't be copied, since their Nodes belong to whoever constructed them.
+    NodePool(const NodePool<T> &reference) = delete;
+
+    /// @brief Creates a new Node Pool by taking over the slabs of another Node Pool, which is left empty.
+    /// @param reference The reference of the Node Pool that'll be moved.
+    NodePool(NodePool<T> &&reference) noexcept
+        : lastSlab(reference.lastSlab), usedSlotCount(reference.usedSlotCount), freeSlots(reference.freeSlots)
+    {
+        reference.lastSlab = nullptr;
+        reference.freeSlots = nullptr;
+        reference.usedSlotCount = 0;
+    }
+
+    ~NodePool() { Release(); }
+
+private:
+    /// @brief A piece of memory that can either hold a Node, or point to the next free slot.
+    union Slot
+    {
+        /// @brief The next free slot within the free list.
+        Slot* NextFree;
+        /// @brief The memory that the Node is constructed in.
+        alignas(Node<T>) unsigned char Storage[sizeof(Node<T>)];
+    };
+
+    /// @brief A contiguous block of slots, that points to the slab allocated before it.
+    struct Slab
+    {
+        /// @brief The slots of the slab.
+        Slot* Slots;
+        /// @brief The amount of slots within the slab.
+        size_t Length;
+        /// @brief The slab allocated before this one.
+        Slab* Previous;
+    };
+
+    /// @brief The most recently allocated slab, that new slots are carved out of.
+    Slab* lastSlab = nullptr;
+    /// @brief The amount of slots that have been carved out of the last slab.
+    size_t usedSlotCount = 0;
+    /// @brief The first slot within the list of released slots.
+    Slot* freeSlots = nullptr;
+
+public:
+    /// @brief The amount of slots within the first allocated slab.
+    static constexpr size_t INITIAL_SLAB_LENGTH = 4;
+
+    /// @brief The amount of Nodes the Node Pool can hold without allocating another slab.
+    /// @return The capacity of the Node Pool.
+    size_t Capacity() const
+    {
+        size_t capacity = 0;
+        for (Slab* slab = lastSlab; slab; slab = slab->Previous) { capacity += slab->Length; }
+        return capacity;
+    }
+
+    /// @brief Constructs a Node within a free slot, with its data constructed in place.
+    /// @tparam ...TArguments The types of the arguments given to the data constructor.
+    /// @param ...arguments The arguments that'll be forwarded to the data constructor.
+    /// @return A pointer to the constructed Node.
+    template<typename... TArguments>
+    Node<T>* Construct(TArguments&&... arguments)
+    {
+        Slot* slot = AllocateSlot();
+        try { return new (slot->Storage) Node<T>(std::in_place, std::forward<TArguments>(arguments)...); }
+        catch (...) { FreeSlot(slot); throw; }
+    }
+
+    /// @brief Destroys a Node constructed by this Node Pool, and puts its slot within the free list.
+    /// @param node A pointer to the Node that'll be destroyed.
+    void Destroy(Node<T>* node)
+    {
+        node->~Node();
+        FreeSlot(reinterpret_cast<Slot*>(node));
+    }
+
+    /// @brief Checks whether or not a Node lives within the slabs of this Node Pool, by its address.
+    /// @param node A pointer to the Node that'll be checked.
+    /// @return A boolean representing whether or not the Node has been constructed by this Node Pool.
+    bool Owns(const Node<T>* node) const
+    {
+        const Slot* slot = reinterpret_cast<const Slot*>(node);
+        for (Slab* slab = lastSlab; slab; slab = slab->Previous)
+        {
+            if (std::less_equal<const Slot*>()(slab->Slots, slot) && std::less<const Slot*>()(slot, slab->Slots + slab->Length))
+            { return true; }
+        }
+
+        return false;
+    }
+
+    /// @brief Releases every slab from memory at once, (the Nodes within them must have been destroyed
+    /// already, or have trivially destructible data).
+    void Release()
+    {
+        while (lastSlab)
+        {
+            Slab* previousSlab = lastSlab->Previous;
+            delete[] lastSlab->Slots;
+            delete lastSlab;
+            lastSlab = previousSlab;
+        }
+
+        freeSlots = nullptr;
+        usedSlotCount = 0;
+    }
+
+    /// @brief Node Pools can't be copied, since their Nodes belong to whoever constructed them.
+    NodePool<T> &operator=(const NodePool<T> &reference) = delete;
+
+    /// @brief Moves a Node Pool into another, by taking over its slabs.
+    /// @param reference The reference of the Node Pool that'll be moved.
+    /// @return The result of the moving.
+    NodePool<T> &operator=(NodePool<T> &&reference) noexcept
+    {
+        if (this == &reference) { return *this; }
+
+        Release();
+
+        lastSlab = reference.lastSlab;
+        usedSlotCount = reference.usedSlotCount;
+        freeSlots = reference.freeSlots;
+
+        reference.lastSlab = nullptr;
+        reference.freeSlots = nullptr;
+        reference.usedSlotCount = 0;
+        return *this;
+    }
+
+private:
+    /// @brief Takes a slot from the free list, or carves a new one out of the last slab, (allocating
+    /// a slab twice as large as the last one if it's full).
+    /// @return A pointer to the slot.
+    Slot* AllocateSlot()
+    {
+        if (freeSlots)
+        {
+            Slot* slot = freeSlots;
+            freeSlots = slot->NextFree;
+            return slot;
+        }
+
+        if (!lastSlab || usedSlotCount == lastSlab->Length)
+        {
+            size_t length = lastSlab ? lastSlab->Length * 2 : INITIAL_SLAB_LENGTH;
+            lastSlab = new Slab { new Slot[length], length, lastSlab };
+            usedSlotCount = 0;
+        }
+
+        return lastSlab->Slots + usedSlotCount++;
+    }
+
+    /// @brief Puts a slot within the free list, to be reused by the next constructed Node.
+    /// @param slot A pointer to the slot.
+    void FreeSlot(Slot* slot)
+    {
+        slot->NextFree = freeSlots;
+        freeSlots = slot;
+    }
+};
+
+#endif
@@ -0,0 +1,598 @@
+#include<iostream>
+
+#ifndef PRIORITY_QUEUE
+#define PRIORITY_QUEUE
+
+#include<algorithm>
+#include<cstdint>
+#include<functional>
+#include<stdexcept>
+#include<string>
+
+#include "Array.c++"
+#include "DynamicArray.c++"
+#include "Algorithms/Sorting.c++"
+
+/// @brief The amount of children of each element within the heaps of the Priority Queues, (four children
+/// fit within a cache line for small elements, and halve the height of a binary heap).
+constexpr size_t PRIORITY_QUEUE_ARITY = 4;
+
+/// @brief A data structure that keeps its elements as a four-ary heap within a Dynamic Array, where the element
+/// that goes before all of the others leaves first, (the smallest one by default).
+/// @tparam T The type of the data stored within the Priority Queue.
+/// @tparam TComparer The function object that tells whether or not an element goes before another.
+template<typename T, typename TComparer = std::less<T>>
+class PriorityQueue
+{
+public:
+    /// @brief Creates a new empty Priority Queue.
+    /// @param comparer The function object that tells whether or not an element goes before another.
+    explicit PriorityQueue(const TComparer &comparer = TComparer()) : comparer(comparer) { }
+
+    /// @brief Creates a new empty Priority Queue with a defined capacity, to avoid copying the
+    /// data if the initial capacity is known.
+    /// @param capacity The amount of elements that'll be stored within the Priority Queue.
+    /// @param comparer The function object that tells whether or not an element goes before another.
+    explicit PriorityQueue(const size_t &capacity, const TComparer &comparer = TComparer())
+        : heap(capacity), comparer(comparer) { }
+
+    /// @brief Creates a new Priority Queue from a defined Array, by heapifying its elements in a linear time.
+    /// @param array The Array that'll be used to create the Priority Queue.
+    /// @param comparer The function object that tells whether or not an element goes before another.
+    PriorityQueue(const Array<T> &array, const TComparer &comparer = TComparer())
+        : heap(array), comparer(comparer) { Heapify(); }
+
+    /// @brief Creates a new Priority Queue from a defined Array, by taking over its memory and heapifying its
+    /// elements in a linear time.
+    /// @param array The Array that'll be moved into the Priority Queue.
+    /// @param comparer The function object that tells whether or not an element goes before another.
+    PriorityQueue(Array<T> &&array, const TComparer &comparer = TComparer())
+        : heap(std::move(array)), comparer(comparer) { Heapify(); }
+
+    /// @brief Creates a new Priority Queue with a defined elements count and initial values.
+    /// @param length The amount of elements that'll be stored within the Priority Queue initially.
+    /// @param data A pointer to an array in memory, that has some values that'll be
+    /// stored within the Priority Queue initially.
+    /// @param comparer The function object that tells whether or not an element goes before another.
+    PriorityQueue(const size_t &length, T* data, const TComparer &comparer = TComparer())
+        : PriorityQueue(Array<T>(length, data), comparer) { }
+
+    /// @brief Creates a new Priority Queue by copying another Priority Queue as reference.
+    /// @param reference The reference of the Priority Queue that'll be copied.
+    PriorityQueue(const PriorityQueue<T, TComparer> &reference) = default;
+
+    /// @brief Creates a new Priority Queue by taking over the memory of another Priority Queue, which is left empty.
+    /// @param reference The reference of the Priority Queue that'll be moved.
+    PriorityQueue(PriorityQueue<T, TComparer> &&reference) noexcept = default;
+
+    ~PriorityQueue() = default;
+
+private:
+    /// @brief The elements of the Priority Queue, ordered as a four-ary heap.
+    DynamicArray<T> heap;
+    /// @brief The function object that tells whether or not an element goes before another.
+    TComparer comparer;
+
+public:
+    /// @brief The amount of elements the Priority Queue can maximally hold currently.
+    /// @return The capacity of the Priority Queue.
+    size_t Capacity() const { return heap.Capacity(); }
+    /// @brief The amount of elements currently stored within the Priority Queue.
+    /// @return The elements count of the Priority Queue.
+    size_t Count() const { return heap.Count(); }
+
+    /// @brief Indicates whether or not the Priority Queue has currently no elements.
+    /// @return A boolean representing whether or not the Priority Queue is empty.
+    bool IsEmpty() const { return !heap.Count(); }
+
+    /// @brief Makes sure the Priority Queue can hold a defined amount of elements without
+    /// running out of space, (it never shrinks the capacity).
+    /// @param capacity The amount of elements the Priority Queue will be able to hold.
+    void Reserve(const size_t &capacity) { heap.Reserve(capacity); }
+
+    /// @brief Shrinks the capacity of the Priority Queue down to its elements count, to release the unused memory.
+    void ShrinkToFit() { heap.ShrinkToFit(); }
+
+    /// @brief Retrieves the element that'll be the first to leave the Priority Queue, without removing it.
+    /// @return The value of the element that goes before all of the others.
+    T Top() const noexcept(false)
+    {
+        ValidateNonEmptiness();
+        return *heap.begin();
+    }
+
+    /// @brief Adds an element to the Priority Queue, in a logarithmic time.
+    /// @param element The value of the element that'll be copied into the Priority Queue.
+    void Push(const T &element)
+    {
+        heap.Add(element);
+        SiftUp(heap.Count() - 1);
+    }
+
+    /// @brief Adds an element to the Priority Queue, in a logarithmic time.
+    /// @param element The value of the element that'll be moved into the Priority Queue.
+    void Push(T &&element)
+    {
+        heap.Add(std::move(element));
+        SiftUp(heap.Count() - 1);
+    }
+
+    /// @brief Constructs an element from a set of arguments, and adds it to the Priority Queue.
+    /// @tparam ...TArguments The types of the arguments given to the element constructor.
+    /// @param ...arguments The arguments that'll be forwarded to the element constructor.
+    template<typename... TArguments>
+    void Emplace(TArguments&&... arguments) { Push(T(std::forward<TArguments>(arguments)...)); }
+
+    /// @brief Adds an Array of elements to the Priority Queue.
+    /// @param array The Array that'll be added to the Priority Queue.
+    void PushRange(const Array<T> &array)
+    {
+        size_t previousCount = heap.Count();
+        heap.AddRange(array);
+        RestoreAfterPushing(previousCount);
+    }
+
+    /// @brief Adds an Array of elements to the Priority Queue, by moving them out of it.
+    /// @param array The Array that its elements will be moved into the Priority Queue.
+    void PushRange(Array<T> &&array)
+    {
+        size_t previousCount = heap.Count();
+        heap.AddRange(std::move(array));
+        RestoreAfterPushing(previousCount);
+    }
+
+    /// @brief Adds a range of elements to the Priority Queue.
+    /// @param length The amount of elements that'll be added to the Priority Queue.
+    /// @param data A pointer to an array in memory, that has some values that'll be added to the Priority Queue.
+    void PushRange(const size_t &length, T* data) { PushRange(Array<T>(length, data)); }
+
+    /// @brief Retrieves the element that goes before all of the others, by removing it, in a logarithmic time.
+    /// @return The value of the element that was the first to leave the Priority Queue.
+    T Pop() noexcept(false)
+    {
+        ValidateNonEmptiness();
+
+        T* elements = heap.begin();
+        size_t lastIndex = heap.Count() - 1;
+
+        T topElement = std::move(elements[0]);
+        if (lastIndex) { elements[0] = std::move(elements[lastIndex]); }
+
+        heap.RemoveAt(lastIndex);
+        if (heap.Count() > 1) { SiftDown(0); }
+        return topElement;
+    }
+
+    /// @brief Retrieves a range of elements that go before all of the others, by removing them.
+    /// @param length The amount of elements that'll be removed from the Priority Queue.
+    /// @return An Array of the removed elements, in the same order they've left the Priority Queue.
+    Array<T> PopRange(const size_t &length) noexcept(false)
+    {
+        if (length > heap.Count())
+        { throw std::out_of_range("Attempting to pop [" + std::to_string(length) + "] elements out of a Priority Queue of [" + std::to_string(heap.Count()) + "]."); }
+
+        Array<T> elements(length);
+        for (size_t i = 0; i < length; i++) { elements.begin()[i] = Pop(); }
+        return elements;
+    }
+
+    /// @brief Clears every element from the Priority Queue, (without releasing its memory).
+    void Clear() { heap.Clear(); }
+
+    /// @brief Converts the Priority Queue into an Array, in the order its elements would leave the Priority Queue.
+    /// @return An Array consisting of all of the Priority Queue elements, sorted by the comparer.
+    Array<T> ToArray() const
+    {
+        Array<T> elements = heap.ToArray();
+        IntroSort(elements.begin(), elements.end(), comparer);
+        return elements;
+    }
+
+    /// @brief Copies a Priority Queue into another.
+    /// @param reference The reference of the Priority Queue that'll be copied.
+    /// @return The result of the copying.
+    PriorityQueue<T, TComparer> &operator=(const PriorityQueue<T, TComparer> &reference) = default;
+
+    /// @brief Moves a Priority Queue into another, by taking over its memory.
+    /// @param reference The reference of the Priority Queue that'll be moved.
+    /// @return The result of the moving.
+    PriorityQueue<T, TComparer> &operator=(PriorityQueue<T, TComparer> &&reference) noexcept = default;
+
+    /// @brief Adds an element to the Priority Queue.
+    /// @param element The value of the element that'll be copied into the Priority Queue.
+    /// @return The reference of the Priority Queue after adding the element value to it.
+    PriorityQueue<T, TComparer> &operator<<(const T &element) { Push(element); return *this; }
+
+    /// @brief Adds an element to the Priority Queue.
+    /// @param element The value of the element that'll be moved into the Priority Queue.
+    /// @return The reference of the Priority Queue after adding the element value to it.
+    PriorityQueue<T, TComparer> &operator<<(T &&element) { Push(std::move(element)); return *this; }
+
+    /// @brief Adds an Array to the Priority Queue.
+    /// @param array The Array that'll be added to the Priority Queue.
+    /// @return The reference of the Priority Queue after adding the Array of elements to it.
+    PriorityQueue<T, TComparer> &operator<<(const Array<T> &array) { PushRange(array); return *this; }
+
+private:
+    /// @brief Checks whether or not the Priority Queue has any elements, if not,
+    /// it'll throw an "out of range" exception.
+    void ValidateNonEmptiness() const noexcept(false)
+    {
+        if (heap.Count()) { return; }
+
+        throw std::out_of_range("Attempting to access an element of an empty Priority Queue.");
+    }
+
+    /// @brief Moves an element up the heap until its parent goes before it.
+    /// @param index The position of the element within the heap.
+    void SiftUp(size_t index)
+    {
+        T* elements = heap.begin();
+        T element = std::move(elements[index]);
+
+        while (index)
+        {
+            size_t parent = (index - 1) / PRIORITY_QUEUE_ARITY;
+            if (!comparer(element, elements[parent])) { break; }
+
+            elements[index] = std::move(elements[parent]);
+            index = parent;
+        }
+
+        elements[index] = std::move(element);
+    }
+
+    /// @brief Moves an element down the heap until it goes before all of its children.
+    /// @param index The position of the element within the heap.
+    void SiftDown(size_t index)
+    {
+        T* elements = heap.begin();
+        size_t count = heap.Count();
+        T element = std::move(elements[index]);
+
+        for (size_t firstChild = index * PRIORITY_QUEUE_ARITY + 1; firstChild < count; firstChild = index * PRIORITY_QUEUE_ARITY + 1)
+        {
+            size_t bestChild = firstChild, lastChild = std::min(firstChild + PRIORITY_QUEUE_ARITY, count);
+            for (size_t child = firstChild + 1; child < lastChild; child++)
+            {
+                if (comparer(elements[child], elements[bestChild])) { bestChild = child; }
+            }
+
+            if (!comparer(elements[bestChild], element)) { break; }
+
+            elements[index] = std::move(elements[bestChild]);
+            index = bestChild;
+        }
+
+        elements[index] = std::move(element);
+    }
+
+    /// @brief Orders all of the elements as a heap from the bottom up, in a linear time.
+    void Heapify()
+    {
+        size_t count = heap.Count();
+        if (count < 2) { return; }
+
+        for (size_t i = (count - 2) / PRIORITY_QUEUE_ARITY + 1; i-- > 0;) { SiftDown(i); }
+    }
+
+    /// @brief Restores the heap after a range of elements has been added to its end, by sifting each one up,
+    /// or by heapifying all of them once the range is at least as long as the elements that were there.
+    /// @param previousCount The amount of elements that were within the heap before the range was added.
+    void RestoreAfterPushing(const size_t &previousCount)
+    {
+        if (heap.Count() - previousCount >= previousCount) { Heapify(); return; }
+
+        for (size_t i = previousCount; i < heap.Count(); i++) { SiftUp(i); }
+    }
+};
+
+/// @brief A Priority Queue that gives every pushed element a handle, so its priority can be changed, or it can be
+/// removed, in a logarithmic time, (a handle gets reused once its element leaves the Indexed Priority Queue).
+/// @tparam T The type of the data stored within the Indexed Priority Queue.
+/// @tparam TComparer The function object that tells whether or not an element goes before another.
+template<typename T, typename TComparer = std::less<T>>
+class IndexedPriorityQueue
+{
+public:
+    /// @brief Creates a new empty Indexed Priority Queue.
+    /// @param comparer The function object that tells whether or not an element goes before another.
+    explicit IndexedPriorityQueue(const TComparer &comparer = TComparer()) : comparer(comparer) { }
+
+    /// @brief Creates a new empty Indexed Priority Queue with a defined capacity, to avoid copying the
+    /// data if the initial capacity is known.
+    /// @param capacity The amount of elements that'll be stored within the Indexed Priority Queue.
+    /// @param comparer The function object that tells whether or not an element goes before another.
+    explicit IndexedPriorityQueue(const size_t &capacity, const TComparer &comparer = TComparer())
+        : heap(capacity), positions(capacity), comparer(comparer) { }
+
+    /// @brief Creates a new Indexed Priority Queue by copying another Indexed Priority Queue as reference,
+    /// (the handles keep referring to the same elements).
+    /// @param reference The reference of the Indexed Priority Queue that'll be copied.
+    IndexedPriorityQueue(const IndexedPriorityQueue<T, TComparer> &reference) = default;
+
+    /// @brief Creates a new Indexed Priority Queue by taking over the memory of another Indexed Priority Queue,
+    /// which is left empty.
+    /// @param reference The reference of the Indexed Priority Queue that'll be moved.
+    IndexedPriorityQueue(IndexedPriorityQueue<T, TComparer> &&reference) noexcept = default;
+
+    ~IndexedPriorityQueue() = default;
+
+private:
+    /// @brief The position a handle has in the positions when its element isn't within the heap.
+    static constexpr size_t NO_POSITION = SIZE_MAX;
+
+    /// @brief An element of the heap, along with the handle that refers to it.
+    struct Entry
+    {
+        /// @brief The value of the element.
+        T Value;
+        /// @brief The handle that refers to the element.
+        size_t Handle;
+    };
+
+    /// @brief The elements of the Indexed Priority Queue, ordered as a four-ary heap.
+    DynamicArray<Entry> heap;
+    /// @brief The position of the element of every handle within the heap.
+    DynamicArray<size_t> positions;
+    /// @brief The handles whose elements have left, that'll be given to the next pushed elements.
+    DynamicArray<size_t> freeHandles;
+    /// @brief The function object that tells whether or not an element goes before another.
+    TComparer comparer;
+
+public:
+    /// @brief The amount of elements the Indexed Priority Queue can maximally hold currently.
+    /// @return The capacity of the Indexed Priority Queue.
+    size_t Capacity() const { return heap.Capacity(); }
+    /// @brief The amount of elements currently stored within the Indexed Priority Queue.
+    /// @return The elements count of the Indexed Priority Queue.
+    size_t Count() const { return heap.Count(); }
+
+    /// @brief Indicates whether or not the Indexed Priority Queue has currently no elements.
+    /// @return A boolean representing whether or not the Indexed Priority Queue is empty.
+    bool IsEmpty() const { return !heap.Count(); }
+
+    /// @brief Makes sure the Indexed Priority Queue can hold a defined amount of elements without
+    /// running out of space, (it never shrinks the capacity).
+    /// @param capacity The amount of elements the Indexed Priority Queue will be able to hold.
+    void Reserve(const size_t &capacity)
+    {
+        heap.Reserve(capacity);
+        positions.Reserve(capacity);
+    }
+
+    /// @brief Checks whether or not a handle refers to an element within the Indexed Priority Queue.
+    /// @param handle The handle that'll be checked.
+    /// @return A boolean representing whether or not the element of the handle is presented.
+    bool Contains(const size_t &handle) const { return handle < positions.Count() && positions.begin()[handle] != NO_POSITION; }
+
+    /// @brief Retrieves the element that'll be the first to leave the Indexed Priority Queue, without removing it.
+    /// @return The value of the element that goes before all of the others.
+    T Top() const noexcept(false)
+    {
+        ValidateNonEmptiness();
+        return heap.begin()->Value;
+    }
+
+    /// @brief Retrieves the handle of the element that'll be the first to leave the Indexed Priority Queue.
+    /// @return The handle of the element that goes before all of the others.
+    size_t TopHandle() const noexcept(false)
+    {
+        ValidateNonEmptiness();
+        return heap.begin()->Handle;
+    }
+
+    /// @brief Retrieves the element that a handle refers to.
+    /// @param handle The handle of the element.
+    /// @return The value of the element.
+    T Get(const size_t &handle) const noexcept(false) { return heap.begin()[PositionOf(handle)].Value; }
+
+    /// @brief Adds an element to the Indexed Priority Queue, in a logarithmic time.
+    /// @param element The value of the element that'll be copied into the Indexed Priority Queue.
+    /// @return The handle that refers to the element until it leaves the Indexed Priority Queue.
+    size_t Push(const T &element) { return Push(T(element)); }
+
+    /// @brief Adds an element to the Indexed Priority Queue, in a logarithmic time.
+    /// @param element The value of the element that'll be moved into the Indexed Priority Queue.
+    /// @return The handle that refers to the element until it leaves the Indexed Priority Queue.
+    size_t Push(T &&element)
+    {
+        size_t handle, position = heap.Count();
+        if (freeHandles.Count())
+        {
+            handle = freeHandles.begin()[freeHandles.Count() - 1];
+            freeHandles.RemoveAt(freeHandles.Count() - 1);
+            positions.begin()[handle] = position;
+        }
+        else
+        {
+            handle = positions.Count();
+            positions.Add(position);
+        }
+
+        heap.Add(Entry { std::move(element), handle });
+        SiftUp(position);
+        return handle;
+    }
+
+    /// @brief Constructs an element from a set of arguments, and adds it to the Indexed Priority Queue.
+    /// @tparam ...TArguments The types of the arguments given to the element constructor.
+    /// @param ...arguments The arguments that'll be forwarded to the element constructor.
+    /// @return The handle that refers to the element until it leaves the Indexed Priority Queue.
+    template<typename... TArguments>
+    size_t Emplace(TArguments&&... arguments) { return Push(T(std::forward<TArguments>(arguments)...)); }
+
+    /// @brief Retrieves the element that goes before all of the others, by removing it, in a logarithmic time.
+    /// @return The value of the element that was the first to leave the Indexed Priority Queue.
+    T Pop() noexcept(false)
+    {
+        ValidateNonEmptiness();
+        return RemoveFrom(0);
+    }
+
+    /// @brief Removes the element that a handle refers to, in a logarithmic time.
+    /// @param handle The handle of the element that'll be removed, (it's released for the next pushed elements).
+    /// @return The value of the removed element.
+    T Remove(const size_t &handle) noexcept(false) { return RemoveFrom(PositionOf(handle)); }
+
+    /// @brief Moves an element towards the front of the Indexed Priority Queue by giving it a value that doesn't
+    /// go after its current value, in a logarithmic time.
+    /// @param handle The handle of the element.
+    /// @param element The new value of the element.
+    void DecreaseKey(const size_t &handle, const T &element) noexcept(false) { DecreaseKey(handle, T(element)); }
+
+    /// @brief Moves an element towards the front of the Indexed Priority Queue by giving it a value that doesn't
+    /// go after its current value, in a logarithmic time.
+    /// @param handle The handle of the element.
+    /// @param element The new value of the element, that'll be moved into the Indexed Priority Queue.
+    void DecreaseKey(const size_t &handle, T &&element) noexcept(false)
+    {
+        size_t position = PositionOf(handle);
+        T &value = heap.begin()[position].Value;
+        if (comparer(value, element))
+        { throw std::logic_error("The new value of the element of the handle [" + std::to_string(handle) + "] goes after its current value."); }
+
+        value = std::move(element);
+        SiftUp(position);
+    }
+
+    /// @brief Changes the value of an element, which moves it either way within the Indexed Priority Queue,
+    /// in a logarithmic time.
+    /// @param handle The handle of the element.
+    /// @param element The new value of the element.
+    void Update(const size_t &handle, const T &element) noexcept(false) { Update(handle, T(element)); }
+
+    /// @brief Changes the value of an element, which moves it either way within the Indexed Priority Queue,
+    /// in a logarithmic time.
+    /// @param handle The handle of the element.
+    /// @param element The new value of the element, that'll be moved into the Indexed Priority Queue.
+    void Update(const size_t &handle, T &&element) noexcept(false)
+    {
+        size_t position = PositionOf(handle);
+        heap.begin()[position].Value = std::move(element);
+        Restore(position);
+    }
+
+    /// @brief Clears every element from the Indexed Priority Queue, and releases all of the handles,
+    /// (without releasing its memory).
+    void Clear()
+    {
+        heap.Clear();
+        positions.Clear();
+        freeHandles.Clear();
+    }
+
+    /// @brief Copies an Indexed Priority Queue into another.
+    /// @param reference The reference of the Indexed Priority Queue that'll be copied.
+    /// @return The result of the copying.
+    IndexedPriorityQueue<T, TComparer> &operator=(const IndexedPriorityQueue<T, TComparer> &reference) = default;
+
+    /// @brief Moves an Indexed Priority Queue into another, by taking over its memory.
+    /// @param reference The reference of the Indexed Priority Queue that'll be moved.
+    /// @return The result of the moving.
+    IndexedPriorityQueue<T, TComparer> &operator=(IndexedPriorityQueue<T, TComparer> &&reference) noexcept = default;
+
+private:
+    /// @brief Checks whether or not the Indexed Priority Queue has any elements, if not,
+    /// it'll throw an "out of range" exception.
+    void ValidateNonEmptiness() const noexcept(false)
+    {
+        if (heap.Count()) { return; }
+
+        throw std::out_of_range("Attempting to access an element of an empty Indexed Priority Queue.");
+    }
+
+    /// @brief Finds the position of the element of a handle within the heap, and if the handle doesn't refer
+    /// to any element, it'll throw an "out of range" exception.
+    /// @param handle The handle of the element.
+    /// @return The position of the element within the heap.
+    size_t PositionOf(const size_t &handle) const noexcept(false)
+    {
+        if (Contains(handle)) { return positions.begin()[handle]; }
+
+        throw std::out_of_range("The handle [" + std::to_string(handle) + "] doesn't refer to an element within the Indexed Priority Queue.");
+    }
+
+    /// @brief Places an entry at a position within the heap, and records the position for its handle.
+    /// @param entry The entry that'll be moved into the position.
+    /// @param position The position within the heap.
+    void Place(Entry &&entry, const size_t &position)
+    {
+        positions.begin()[entry.Handle] = position;
+        heap.begin()[position] = std::move(entry);
+    }
+
+    /// @brief Removes the element at a position within the heap, by filling it with the last element.
+    /// @param position The position of the element within the heap.
+    /// @return The value of the removed element.
+    T RemoveFrom(const size_t &position)
+    {
+        Entry* entries = heap.begin();
+        size_t lastPosition = heap.Count() - 1;
+
+        Entry removedEntry = std::move(entries[position]);
+        positions.begin()[removedEntry.Handle] = NO_POSITION;
+        freeHandles.Add(removedEntry.Handle);
+
+        if (position != lastPosition) { Place(std::move(entries[lastPosition]), position); }
+        heap.RemoveAt(lastPosition);
+
+        if (position < heap.Count()) { Restore(position); }
+        return std::move(removedEntry.Value);
+    }
+
+    /// @brief Moves an element, whose value has been changed, either up or down the heap.
+    /// @param position The position of the element within the heap.
+    void Restore(const size_t &position)
+    {
+        if (position && comparer(heap.begin()[position].Value, heap.begin()[(position - 1) / PRIORITY_QUEUE_ARITY].Value))
+        { SiftUp(position); }
+        else { SiftDown(position); }
+    }
+
+    /// @brief Moves an element up the heap until its parent goes before it.
+    /// @param position The position of the element within the heap.
+    void SiftUp(size_t position)
+    {
+        Entry* entries = heap.begin();
+        Entry entry = std::move(entries[position]);
+
+        while (position)
+        {
+            size_t parent = (position - 1) / PRIORITY_QUEUE_ARITY;
+            if (!comparer(entry.Value, entries[parent].Value)) { break; }
+
+            Place(std::move(entries[parent]), position);
+            position = parent;
+        }
+
+        Place(std::move(entry), position);
+    }
+
+    /// @brief Moves an element down the heap until it goes before all of its children.
+    /// @param position The position of the element within the heap.
+    void SiftDown(size_t position)
+    {
+        Entry* entries = heap.begin();
+        size_t count = heap.Count();
+        Entry entry = std::move(entries[position]);
+
+        for (size_t firstChild = position * PRIORITY_QUEUE_ARITY + 1; firstChild < count; firstChild = position * PRIORITY_QUEUE_ARITY + 1)
+        {
+            size_t bestChild = firstChild, lastChild = std::min(firstChild + PRIORITY_QUEUE_ARITY, count);
+            for (size_t child = firstChild + 1; child < lastChild; child++)
+            {
+                if (comparer(entries[child].Value, entries[bestChild].Value)) { bestChild = child; }
+            }
+
+            if (!comparer(entries[bestChild].Value, entry.Value)) { break; }
+
+            Place(std::move(entries[bestChild]), position);
+            position = bestChild;
+        }
+
+        Place(std::move(entry), position);
+    }
+};
+
+#endif
@@ -3,96 +3,275 @@
 #ifndef QUEUE
 #define QUEUE
 
-#include "DynamicArray.c++"
+#include<algorithm>
 
+#include "Array.c++"
+#include "GrowthPolicy.c++"
+
+/// @brief A linear data structure to save data close together in memory as a line, where
+/// each element waits behind the previous one, providing the First In First Out functionality,
+/// (the elements are stored within a circular buffer, so pushing and popping never moves the others).
+/// @tparam T The type of the data stored within the Queue.
 template<typename T>
-class Queue : protected DynamicArray<T>
+class Queue
 {
 public:
     /// @brief Creates a new empty Queue.
-    Queue() : DynamicArray<T>() {}
+    Queue() = default;
 
     /// @brief Creates a new Queue with a defined capacity, to avoid copying the
     /// data if the initial capacity is known.
-    /// @param capacity The amount of elements that'll be stored within the Queue.
-    /// @param capacityModifier The amount of increment the Queue capacity gets each time it runs
-    /// out of space to store more elements.
-    explicit Queue(const size_t &capacity, const size_t capacityModifier = DynamicArray<T>::INITIAL_CAPACITY)
-        : DynamicArray<T>(capacity, capacityModifier) { }
+    /// @param capacity The amount of elements that'll be stored within the Queue, (it's rounded
+    /// up to the closest power of two).
+    explicit Queue(const size_t &capacity) { Reallocate(capacity); }
 
-    /// @brief Creates a new Queue from a defined Array, and basically takes all of its data.
+    /// @brief Creates a new Queue from a defined Array, where its first element will be the first to leave.
     /// @param array The Array that'll be used to create the Queue.
-    /// @param capacityModifier The amount of increment the Queue capacity gets each time it runs
-    /// out of space to store more elements.
-    Queue(const Array<T> &array, const size_t capacityModifier = DynamicArray<T>::INITIAL_CAPACITY)
-        : DynamicArray<T>(array, capacityModifier) { }
+    Queue(const Array<T> &array) { PushRange(array); }
+
+    /// @brief Creates a new Queue from a defined Array, by moving its elements out of it.
+    /// @param array The Array that its elements will be moved into the Queue.
+    Queue(Array<T> &&array) { PushRange(std::move(array)); }
 
     /// @brief Creates a new Queue with a defined elements count and initial values.
     /// @param length The amount of elements that'll be stored within the Queue initially.
     /// @param data A pointer to an array in memory, that has some values that'll be
     /// stored within the Queue initially.
-    /// @param capacityModifier The amount of increment the Queue capacity gets each time it runs
-    /// out of space to store more elements.
-    Queue(const size_t &length, T* data, const size_t capacityModifier = DynamicArray<T>::INITIAL_CAPACITY)
-        : DynamicArray<T>(length, data, capacityModifier) { }
+    Queue(const size_t &length, T* data) { PushRange(length, data); }
+
+    /// @brief Creates a new Queue by copying another Queue as reference.
+    /// @param reference The reference of the Queue that'll be copied.
+    Queue(const Queue<T> &reference) = default;
+
+    /// @brief Creates a new Queue by taking over the memory of another Queue, which is left empty.
+    /// @param reference The reference of the Queue that'll be moved.
+    Queue(Queue<T> &&reference) noexcept
+        : buffer(std::move(reference.buffer)), head(reference.head), count(reference.count)
+    { reference.head = reference.count = 0; }
 
     ~Queue() = default;
 
+private:
+    /// @brief The circular buffer that holds the elements, (its length is always a power of two).
+    Array<T> buffer;
+    /// @brief The position of the element that'll be the first to leave the Queue within the buffer.
+    size_t head = 0;
+    /// @brief The amount of elements currently stored within the Queue.
+    size_t count = 0;
+
 public:
     /// @brief The amount of elements the Queue can maximally hold currently.
     /// @return The capacity of the Queue.
-    size_t Capacity() const { return ((DynamicArray<T>*)this)->Capacity(); };
-    /// @brief The amount of increment the Queue capacity gets each time it runs
-    /// out of space to store more elements.
-    /// @return The capacity modifier of the Queue.
-    size_t CapacityModifier() const { return ((DynamicArray<T>*)this)->CapacityModifier(); }
+    size_t Capacity() const { return buffer.Length(); }
     /// @brief The amount of elements currently stored within the Queue.
     /// @return The elements count of the Queue.
-    size_t Count() const { return ((DynamicArray<T>*)this)->Count(); }
-    
+    size_t Count() const { return count; }
+
     /// @brief Indicates whether or not the Queue has currently no elements.
     /// @return A boolean representing whether or not the Queue is empty.
-    bool IsEmpty() { return ((DynamicArray<T>*)this)->IsEmpty(); }
+    bool IsEmpty() const { return !count; }
+
+    /// @brief Makes sure the Queue can hold a defined amount of elements without
+    /// running out of space, (it never shrinks the capacity).
+    /// @param capacity The amount of elements the Queue will be able to hold.
+    void Reserve(const size_t &capacity)
+    {
+        if (capacity <= buffer.Length()) { return; }
+        Reallocate(capacity);
+    }
+
+    /// @brief Shrinks the capacity of the Queue down to the closest power of two of its elements count,
+    /// to release the unused memory.
+    void ShrinkToFit()
+    {
+        if (GrowthPolicy::NextPowerOfTwo(count) == buffer.Length()) { return; }
+        Reallocate(count);
+    }
 
     /// @brief Retrieves the element that is at the front of the Queue, without removing it.
     /// @return The value of the element that is at the front of the Queue.
-    T Front() { return *(this->end() - 1); }
+    T Front() const noexcept(false)
+    {
+        ValidateNonEmptiness();
+        return buffer.begin()[Wrap(head + count - 1)];
+    }
 
     /// @brief Retrieves the element that is at the back of the Queue, without removing it.
     /// @return The value of the element that is at the back of the Queue.
-    T Back() { return *(this->begin()); }
+    T Back() const noexcept(false)
+    {
+        ValidateNonEmptiness();
+        return buffer.begin()[head];
+    }
 
     /// @brief Adds an element to the front of the Queue.
-    /// @param element The value of the element that'll be added to the front of the Queue.
-    void Push(T element) { this->Add(element); }
-    
-    /// @brief Adds an Array to the front of the Queue.
+    /// @param element The value of the element that'll be copied to the front of the Queue.
+    void Push(const T &element)
+    {
+        if (count == buffer.Length()) { Push(T(element)); return; }
+        buffer.begin()[Wrap(head + count++)] = element;
+    }
+
+    /// @brief Adds an element to the front of the Queue.
+    /// @param element The value of the element that'll be moved to the front of the Queue.
+    void Push(T &&element)
+    {
+        if (count == buffer.Length()) { Reallocate(count + 1); }
+        buffer.begin()[Wrap(head + count++)] = std::move(element);
+    }
+
+    /// @brief Constructs an element from a set of arguments, and adds it to the front of the Queue.
+    /// @tparam ...TArguments The types of the arguments given to the element constructor.
+    /// @param ...arguments The arguments that'll be forwarded to the element constructor.
+    template<typename... TArguments>
+    void Emplace(TArguments&&... arguments) { Push(T(std::forward<TArguments>(arguments)...)); }
+
+    /// @brief Adds an Array to the front of the Queue, by copying it in at most two contiguous segments.
     /// @param array The Array that'll be added to the front of the Queue.
-    void PushRange(const Array<T> &array) { this->AddRange(array); }
-    
-    /// @brief Adds a range of elements to the front of the Queue.
+    void PushRange(const Array<T> &array) { PushRange(array.Length(), array.begin()); }
+
+    /// @brief Adds an Array to the front of the Queue, by moving it in at most two contiguous segments.
+    /// @param array The Array that its elements will be moved to the front of the Queue.
+    void PushRange(Array<T> &&array)
+    {
+        size_t length = array.Length();
+        if (count + length > buffer.Length()) { Reallocate(count + length); }
+
+        size_t tail = Wrap(head + count),
+            firstSegmentLength = std::min(length, buffer.Length() - tail);
+
+        std::move(array.begin(), array.begin() + firstSegmentLength, buffer.begin() + tail);
+        std::move(array.begin() + firstSegmentLength, array.end(), buffer.begin());
+        count += length;
+    }
+
+    /// @brief Adds a range of elements to the front of the Queue, by copying them in at most
+    /// two contiguous segments.
     /// @param length The amount of elements that'll be added to the front of the Queue.
     /// @param data A pointer to an array in memory, that has some values that'll be added to the front of the Queue.
-    void PushRange(const size_t &length, T* data) { this->AddRange(length, data); }
+    void PushRange(const size_t &length, const T* data)
+    {
+        if (count + length > buffer.Length()) { Reallocate(count + length); }
+
+        size_t tail = Wrap(head + count),
+            firstSegmentLength = std::min(length, buffer.Length() - tail);
 
-    /// @brief Retrieves the element that is on the front of the Queue, by removing it.
-    /// @return The value of the element that is on the top of the Queue.
-    T Pop()
+        std::copy(data, data + firstSegmentLength, buffer.begin() + tail);
+        std::copy(data + firstSegmentLength, data + length, buffer.begin());
+        count += length;
+    }
+
+    /// @brief Retrieves the element that is at the back of the Queue, by removing it.
+    /// @return The value of the element that was at the back of the Queue.
+    T Pop() noexcept(false)
     {
-        T lastElement = Back();
-        this->RemoveAt(0);
+        ValidateNonEmptiness();
+
+        T lastElement = std::move(buffer.begin()[head]);
+        head = Wrap(head + 1);
+        count--;
         return lastElement;
     }
-    
+
+    /// @brief Retrieves a range of elements from the back of the Queue, by removing them and
+    /// moving them out in at most two contiguous segments.
+    /// @param length The amount of elements that'll be removed from the Queue.
+    /// @return An Array of the removed elements, in the same order they've left the Queue.
+    Array<T> PopRange(const size_t &length) noexcept(false)
+    {
+        if (length > count)
+        { throw std::out_of_range("Attempting to pop [" + std::to_string(length) + "] elements out of a Queue of [" + std::to_string(count) + "]."); }
+
+        Array<T> elements(length);
+        size_t firstSegmentLength = std::min(length, buffer.Length() - head);
+
+        std::move(buffer.begin() + head, buffer.begin() + head + firstSegmentLength, elements.begin());
+        std::move(buffer.begin(), buffer.begin() + length - firstSegmentLength, elements.begin() + firstSegmentLength);
+
+        head = count == length ? 0 : Wrap(head + length);
+        count -= length;
+        return elements;
+    }
+
+    /// @brief Clears every element from the Queue, (without releasing its memory).
+    void Clear() { head = count = 0; }
+
+    /// @brief Converts the Queue into an Array, where its first element is the first to leave the Queue.
+    /// @return An Array consisting of all of the Queue elements.
+    Array<T> ToArray() const
+    {
+        Array<T> elements(count);
+        size_t firstSegmentLength = std::min(count, buffer.Length() - head);
+
+        std::copy(buffer.begin() + head, buffer.begin() + head + firstSegmentLength, elements.begin());
+        std::copy(buffer.begin(), buffer.begin() + count - firstSegmentLength, elements.begin() + firstSegmentLength);
+        return elements;
+    }
+
+    /// @brief Copies a Queue into another.
+    /// @param reference The reference of the Queue that'll be copied.
+    /// @return The result of the copying.
+    Queue<T> &operator=(const Queue<T> &reference) = default;
+
+    /// @brief Moves a Queue into another, by taking over its memory.
+    /// @param reference The reference of the Queue that'll be moved.
+    /// @return The result of the moving.
+    Queue<T> &operator=(Queue<T> &&reference) noexcept
+    {
+        if (this == &reference) { return *this; }
+
+        buffer = std::move(reference.buffer);
+        head = reference.head;
+        count = reference.count;
+
+        reference.head = reference.count = 0;
+        return *this;
+    }
+
     /// @brief Adds an element to the front of the Queue.
-    /// @param element The value of the element that'll be added to the front of the Queue.
+    /// @param element The value of the element that'll be copied to the front of the Queue.
     /// @return The reference of the Queue after adding the element value to it.
-    Queue<T> &operator<<(T element) { Push(element); return *this; }
+    Queue<T> &operator<<(const T &element) { Push(element); return *this; }
+
+    /// @brief Adds an element to the front of the Queue.
+    /// @param element The value of the element that'll be moved to the front of the Queue.
+    /// @return The reference of the Queue after adding the element value to it.
+    Queue<T> &operator<<(T &&element) { Push(std::move(element)); return *this; }
 
     /// @brief Adds an Array to the front of the Queue.
     /// @param array The Array that'll be added to the front of the Queue.
     /// @return The reference of the Queue after adding the element value to it.
     Queue<T> &operator<<(const Array<T> &array) { PushRange(array); return *this; }
+
+private:
+    /// @brief Checks whether or not the Queue has any elements, if not,
+    /// it'll throw an "out of range" exception.
+    void ValidateNonEmptiness() const noexcept(false)
+    {
+        if (count) { return; }
+
+        throw std::out_of_range("Attempting to access an element of an empty Queue.");
+    }
+
+    /// @brief Wraps a position around the circular buffer.
+    /// @param position The position that might've gone past the end of the buffer.
+    /// @return The position within the boundaries of the buffer.
+    size_t Wrap(const size_t &position) const { return position & (buffer.Length() - 1); }
+
+    /// @brief Moves the elements into a new circular buffer, so the first to leave the Queue is at
+    /// its beginning, while growing geometrically as powers of two.
+    /// @param capacity The amount of elements the new buffer should at least hold.
+    void Reallocate(const size_t &capacity)
+    {
+        Array<T> newBuffer(GrowthPolicy::NextPowerOfTwo(std::max(capacity, GrowthPolicy::MINIMUM_CAPACITY)));
+        size_t firstSegmentLength = std::min(count, buffer.Length() - head);
+
+        std::move(buffer.begin() + head, buffer.begin() + head + firstSegmentLength, newBuffer.begin());
+        std::move(buffer.begin(), buffer.begin() + count - firstSegmentLength, newBuffer.begin() + firstSegmentLength);
+
+        buffer = std::move(newBuffer);
+        head = 0;
+    }
 };
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,417 @@
+#include<iostream>
+
+#ifndef SERIALIZATION
+#define SERIALIZATION
+
+#include<cstdint>
+#include<cstring>
+#include<fstream>
+#include<stdexcept>
+#include<string>
+#include<type_traits>
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include<windows.h>
+#else
+#include<fcntl.h>
+#include<sys/mman.h>
+#include<sys/stat.h>
+#include<unistd.h>
+#endif
+
+#include "Algorithms/XXHash.c++"
+
+/// @brief The kinds of data structures a binary file can hold, which are laid out differently after the header.
+enum class BinaryFormat : uint32_t
+{
+    /// @brief A single section of contiguous elements, (saved by the Array, the Dynamic Array, and the Hash Table).
+    Elements = 1,
+    /// @brief A section of control bytes followed by a section of slots, (saved by the Flat Hash Table).
+    FlatHashTable = 2
+};
+
+/// @brief The header at the beginning of every binary file, which describes the raw sections after it, (the files
+/// are saved in the byte order of the machine, and are only meant to be loaded by the same kind of machine).
+struct BinaryHeader
+{
+    /// @brief The bytes that mark a binary file of the data structures.
+    char Magic[8];
+    /// @brief The version of the layout of the file.
+    uint32_t Version;
+    /// @brief The kind of data structure held by the file.
+    BinaryFormat Format;
+    /// @brief The size of each element, (or each slot), in bytes.
+    uint64_t ElementSize;
+    /// @brief The amount of elements, (or slots).
+    uint64_t Count;
+    /// @brief The amount of occupied slots, (only used by the Flat Hash Table).
+    uint64_t PairCount;
+    /// @brief The amount of erased slots, (only used by the Flat Hash Table).
+    uint64_t TombstoneCount;
+    /// @brief The seed the keys have been hashed with, (only used by the Flat Hash Table).
+    uint64_t HashingSeed;
+    /// @brief The xxHash64 of the sections, each one hashed with the hashing value of the previous one as its seed.
+    uint64_t Checksum;
+
+    /// @brief The bytes that mark a binary file of the data structures.
+    static constexpr char MAGIC[8] = { 'D', 'S', 'B', 'I', 'N', 'A', 'R', 'Y' };
+    /// @brief The current version of the layout of the files.
+    static constexpr uint32_t VERSION = 1;
+    /// @brief The alignment of each section within the file, so the mapped sections can be used in place.
+    static constexpr size_t SECTION_ALIGNMENT = 64;
+};
+
+static_assert(sizeof(BinaryHeader) == BinaryHeader::SECTION_ALIGNMENT, "The header must keep the first section aligned.");
+
+/// @brief A block of bytes that's saved after the header of a binary file.
+struct BinarySection
+{
+    /// @brief A pointer to the first byte of the section.
+    const void* Data;
+    /// @brief The amount of bytes within the section.
+    size_t Length;
+};
+
+/// @brief Rounds the length of a section up to the section alignment, (which is where the next section starts).
+/// @param length The amount of bytes within the section.
+/// @return The amount of bytes the section takes within the file.
+constexpr size_t AlignedSectionLength(const size_t &length)
+{ return (length + BinaryHeader::SECTION_ALIGNMENT - 1) / BinaryHeader::SECTION_ALIGNMENT * BinaryHeader::SECTION_ALIGNMENT; }
+
+/// @brief Computes the amount of bytes of a section of elements, which saturates instead of wrapping around,
+/// so a corrupt count of elements is caught by the length of the file, (and never allocated).
+/// @param count The amount of elements, (as described by a header).
+/// @param elementSize The size of each element in bytes.
+/// @return The amount of bytes within the section, or the maximum one if it can't be held in memory.
+constexpr uint64_t ElementsSectionLength(const uint64_t &count, const size_t &elementSize)
+{ return count > SIZE_MAX / elementSize ? UINT64_MAX : count * elementSize; }
+
+/// @brief Checks whether or not a binary file is long enough for the sections its header describes, before any of
+/// them is allocated or read, if not, it'll throw a "runtime error" exception.
+/// @param fileLength The amount of bytes within the whole file.
+/// @param sectionsLength The amount of bytes the sections need after the header.
+/// @param path The path of the file, (for the message of the exception).
+inline void ValidateFileLength(const uint64_t &fileLength, const uint64_t &sectionsLength, const std::string &path) noexcept(false)
+{
+    if (fileLength >= sizeof(BinaryHeader) && fileLength - sizeof(BinaryHeader) >= sectionsLength) { return; }
+    throw std::runtime_error("The file \"" + path + "\" is shorter than its header describes.");
+}
+
+/// @brief Computes the checksum of the sections of a binary file.
+/// @param sections A pointer to the first section.
+/// @param sectionCount The amount of sections.
+/// @return The checksum of the sections.
+inline uint64_t ChecksumSections(const BinarySection* sections, const size_t &sectionCount)
+{
+    uint64_t checksum = 0;
+    for (size_t i = 0; i < sectionCount; i++) { checksum = XXHash64(sections[i].Data, sections[i].Length, checksum); }
+    return checksum;
+}
+
+/// @brief Checks whether or not a header describes a binary file of the expected kind, if not, it'll throw
+/// a "runtime error" exception.
+/// @param header The header that'll be checked.
+/// @param format The kind of data structure that's expected.
+/// @param elementSize The size of each element that's expected.
+/// @param path The path of the file, (for the message of the exception).
+inline void ValidateBinaryHeader(const BinaryHeader &header, const BinaryFormat &format, const size_t &elementSize,
+    const std::string &path) noexcept(false)
+{
+    if (std::memcmp(header.Magic, BinaryHeader::MAGIC, sizeof(header.Magic)))
+    { throw std::runtime_error("The file \"" + path + "\" isn't a binary file of the data structures."); }
+
+    if (header.Version != BinaryHeader::VERSION)
+    { throw std::runtime_error("The file \"" + path + "\" has the unsupported version " + std::to_string(header.Version) + "."); }
+
+    if (header.Format != format)
+    { throw std::runtime_error("The file \"" + path + "\" holds another kind of data structure."); }
+
+    if (header.ElementSize != elementSize)
+    {
+        throw std::runtime_error("The file \"" + path + "\" holds elements of " + std::to_string(header.ElementSize)
+            + " bytes, instead of " + std::to_string(elementSize) + " bytes.");
+    }
+}
+
+/// @brief Checks whether or not the checksum of the loaded sections matches the header, if not, it'll throw
+/// a "runtime error" exception.
+/// @param header The header of the file.
+/// @param checksum The checksum of the loaded sections.
+/// @param path The path of the file, (for the message of the exception).
+inline void ValidateChecksum(const BinaryHeader &header, const uint64_t &checksum, const std::string &path) noexcept(false)
+{
+    if (header.Checksum == checksum) { return; }
+    throw std::runtime_error("The checksum of the file \"" + path + "\" doesn't match its content.");
+}
+
+/// @brief Saves a header followed by its sections into a binary file, (which fills the marking bytes, the version
+/// and the checksum of the header), if the file can't be written, it'll throw a "runtime error" exception.
+/// @param path The path of the file, (which is replaced if it exists).
+/// @param header The header of the file, (describing the kind of data structure and its counts).
+/// @param sections A pointer to the first section.
+/// @param sectionCount The amount of sections.
+inline void SaveBinaryFile(const std::string &path, BinaryHeader header, const BinarySection* sections,
+    const size_t &sectionCount) noexcept(false)
+{
+    std::memcpy(header.Magic, BinaryHeader::MAGIC, sizeof(header.Magic));
+    header.Version = BinaryHeader::VERSION;
+    header.Checksum = ChecksumSections(sections, sectionCount);
+
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+    const char padding[BinaryHeader::SECTION_ALIGNMENT] = { };
+    for (size_t i = 0; i < sectionCount; i++)
+    {
+        file.write(static_cast<const char*>(sections[i].Data), (std::streamsize)sections[i].Length);
+        file.write(padding, (std::streamsize)(AlignedSectionLength(sections[i].Length) - sections[i].Length));
+    }
+
+    if (!file.flush()) { throw std::runtime_error("The file \"" + path + "\" couldn't be written."); }
+}
+
+/// @brief Reads a binary file section after section into memory, while computing their checksum.
+class BinaryFileReader
+{
+public:
+    /// @brief Opens a binary file and reads its header, if the file can't be read, or it isn't of the expected
+    /// kind, it'll throw a "runtime error" exception.
+    /// @param path The path of the file.
+    /// @param format The kind of data structure that's expected.
+    /// @param elementSize The size of each element that's expected.
+    BinaryFileReader(const std::string &path, const BinaryFormat &format, const size_t &elementSize) noexcept(false)
+        : path(path), file(path, std::ios::binary)
+    {
+        if (!file.read(reinterpret_cast<char*>(&header), sizeof(header)))
+        { throw std::runtime_error("The file \"" + path + "\" couldn't be read."); }
+
+        ValidateBinaryHeader(header, format, elementSize, path);
+
+        file.seekg(0, std::ios::end);
+        fileLength = (uint64_t)file.tellg();
+        file.seekg((std::streamoff)sizeof(header), std::ios::beg);
+    }
+
+    /// @brief Binary File Readers can't be copied, since they own their file.
+    BinaryFileReader(const BinaryFileReader &reference) = delete;
+
+    ~BinaryFileReader() = default;
+
+private:
+    /// @brief The path of the file.
+    std::string path;
+    /// @brief The file that's being read.
+    std::ifstream file;
+    /// @brief The header of the file.
+    BinaryHeader header;
+    /// @brief The checksum of the sections that have been read so far.
+    uint64_t checksum = 0;
+    /// @brief The amount of bytes within the whole file.
+    uint64_t fileLength = 0;
+
+public:
+    /// @brief The header of the binary file.
+    /// @return The reference of the header.
+    const BinaryHeader &Header() const { return header; }
+
+    /// @brief Checks whether or not the file is long enough for the sections its header describes, which must be done
+    /// before allocating the memory to read them into, if not, it'll throw a "runtime error" exception.
+    /// @param sectionsLength The amount of bytes the sections need after the header.
+    void ValidateSectionsLength(const uint64_t &sectionsLength) const noexcept(false) { ValidateFileLength(fileLength, sectionsLength, path); }
+
+    /// @brief Reads the next section of the file, if the file is shorter, it'll throw a "runtime error" exception.
+    /// @param data A pointer to the memory the section will be read into.
+    /// @param length The amount of bytes within the section.
+    void ReadSection(void* data, const size_t &length) noexcept(false)
+    {
+        if (!file.read(static_cast<char*>(data), (std::streamsize)length))
+        { throw std::runtime_error("The file \"" + path + "\" is shorter than its header describes."); }
+
+        file.ignore((std::streamsize)(AlignedSectionLength(length) - length));
+        checksum = XXHash64(data, length, checksum);
+    }
+
+    /// @brief Checks whether or not the checksum of the read sections matches the header, if not, it'll throw
+    /// a "runtime error" exception.
+    void ValidateChecksum() const noexcept(false) { ::ValidateChecksum(header, checksum, path); }
+
+    /// @brief Binary File Readers can't be copied, since they own their file.
+    BinaryFileReader &operator=(const BinaryFileReader &reference) = delete;
+};
+
+/// @brief A read-only mapping of a whole file into memory, (using "mmap" on POSIX systems, and file mappings
+/// on Windows), so its pages are only read from the disk once they're accessed.
+class MappedFile
+{
+public:
+    /// @brief Creates a new empty Mapped File.
+    MappedFile() = default;
+
+    /// @brief Maps a file into memory, if the file can't be mapped, it'll throw a "runtime error" exception.
+    /// @param path The path of the file.
+    explicit MappedFile(const std::string &path) noexcept(false)
+    {
+#if defined(_WIN32)
+        HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        LARGE_INTEGER fileSize;
+        if (file == INVALID_HANDLE_VALUE || !GetFileSizeEx(file, &fileSize) || !fileSize.QuadPart)
+        {
+            if (file != INVALID_HANDLE_VALUE) { CloseHandle(file); }
+            throw std::runtime_error("The file \"" + path + "\" couldn't be mapped.");
+        }
+
+        HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        void* mappedData = mapping ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+        if (mapping) { CloseHandle(mapping); }
+        CloseHandle(file);
+
+        if (!mappedData) { throw std::runtime_error("The file \"" + path + "\" couldn't be mapped."); }
+        data = static_cast<const char*>(mappedData);
+        length = (size_t)fileSize.QuadPart;
+#else
+        int file = open(path.c_str(), O_RDONLY);
+        struct stat fileStatus;
+        if (file < 0 || fstat(file, &fileStatus) || !fileStatus.st_size)
+        {
+            if (file >= 0) { close(file); }
+            throw std::runtime_error("The file \"" + path + "\" couldn't be mapped.");
+        }
+
+        void* mappedData = mmap(nullptr, (size_t)fileStatus.st_size, PROT_READ, MAP_PRIVATE, file, 0);
+        close(file);
+
+        if (mappedData == MAP_FAILED) { throw std::runtime_error("The file \"" + path + "\" couldn't be mapped."); }
+        data = static_cast<const char*>(mappedData);
+        length = (size_t)fileStatus.st_size;
+#endif
+    }
+
+    /// @brief Mapped Files can't be copied, since they own their mapping.
+    MappedFile(const MappedFile &reference) = delete;
+
+    /// @brief Creates a new Mapped File by taking over the mapping of another Mapped File, which is left empty.
+    /// @param reference The reference of the Mapped File that'll be moved.
+    MappedFile(MappedFile &&reference) noexcept : data(reference.data), length(reference.length)
+    {
+        reference.data = nullptr;
+        reference.length = 0;
+    }
+
+    ~MappedFile() { Unmap(); }
+
+private:
+    /// @brief A pointer to the first mapped byte.
+    const char* data = nullptr;
+    /// @brief The amount of mapped bytes.
+    size_t length = 0;
+
+public:
+    /// @brief The memory the file is mapped at.
+    /// @return A pointer to the first mapped byte.
+    const char* Data() const { return data; }
+    /// @brief The size of the mapped file.
+    /// @return The amount of mapped bytes.
+    size_t Length() const { return length; }
+
+    /// @brief Mapped Files can't be copied, since they own their mapping.
+    MappedFile &operator=(const MappedFile &reference) = delete;
+
+    /// @brief Moves a Mapped File into another, by taking over its mapping.
+    /// @param reference The reference of the Mapped File that'll be moved.
+    /// @return The result of the moving.
+    MappedFile &operator=(MappedFile &&reference) noexcept
+    {
+        if (this == &reference) { return *this; }
+
+        Unmap();
+        data = reference.data;
+        length = reference.length;
+
+        reference.data = nullptr;
+        reference.length = 0;
+        return *this;
+    }
+
+private:
+    /// @brief Releases the mapping, and leaves the Mapped File empty.
+    void Unmap()
+    {
+        if (data == nullptr) { return; }
+
+#if defined(_WIN32)
+        UnmapViewOfFile(data);
+#else
+        munmap(const_cast<char*>(data), length);
+#endif
+        data = nullptr;
+        length = 0;
+    }
+};
+
+/// @brief Checks the header of a mapped binary file, and that it's long enough for its sections, if not,
+/// it'll throw a "runtime error" exception.
+/// @param file The Mapped File.
+/// @param format The kind of data structure that's expected.
+/// @param elementSize The size of each element that's expected.
+/// @tparam TSectionsLength The type of the function that computes the length of the sections.
+/// @param sectionsLength A function that takes the header, and returns the amount of bytes its sections need after it.
+/// @param path The path of the file, (for the messages of the exceptions).
+/// @return The reference of the header within the mapping.
+template<typename TSectionsLength>
+const BinaryHeader &ValidateMappedFile(const MappedFile &file, const BinaryFormat &format, const size_t &elementSize,
+    const TSectionsLength &sectionsLength, const std::string &path) noexcept(false)
+{
+    if (file.Length() < sizeof(BinaryHeader)) { throw std::runtime_error("The file \"" + path + "\" is too short to have a header."); }
+
+    const BinaryHeader &header = *reinterpret_cast<const BinaryHeader*>(file.Data());
+    ValidateBinaryHeader(header, format, elementSize, path);
+    ValidateFileLength(file.Length(), sectionsLength(header), path);
+
+    return header;
+}
+
+/// @brief Saves contiguous elements into a binary file, as a header followed by the raw elements.
+/// @tparam T The type of the elements, (it must be trivially copyable).
+/// @param path The path of the file, (which is replaced if it exists).
+/// @param data A pointer to the first element.
+/// @param count The amount of elements.
+template<typename T>
+void SaveElements(const std::string &path, const T* data, const size_t &count) noexcept(false)
+{
+    static_assert(std::is_trivially_copyable_v<T>, "Only the elements of trivially copyable types can be saved as raw bytes.");
+
+    BinaryHeader header { };
+    header.Format = BinaryFormat::Elements;
+    header.ElementSize = sizeof(T);
+    header.Count = count;
+
+    BinarySection section { data, count * sizeof(T) };
+    SaveBinaryFile(path, header, &section, 1);
+}
+
+/// @brief Loads the elements saved by "SaveElements" from a binary file, and validates their checksum.
+/// @tparam T The type of the elements, (it must be trivially copyable).
+/// @tparam TAllocate The type of the function that allocates the memory of the elements.
+/// @param path The path of the file.
+/// @param allocate A function that takes the amount of elements, and returns a pointer to the memory they'll be read into.
+template<typename T, typename TAllocate>
+void LoadElements(const std::string &path, const TAllocate &allocate) noexcept(false)
+{
+    static_assert(std::is_trivially_copyable_v<T>, "Only the elements of trivially copyable types can be loaded from raw bytes.");
+
+    BinaryFileReader reader(path, BinaryFormat::Elements, sizeof(T));
+    reader.ValidateSectionsLength(ElementsSectionLength(reader.Header().Count, sizeof(T)));
+    size_t count = (size_t)reader.Header().Count;
+
+    T* data = allocate(count);
+    reader.ReadSection(data, count * sizeof(T));
+    reader.ValidateChecksum();
+}
+
+#endif
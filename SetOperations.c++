@@ -0,0 +1,227 @@
+#include<iostream>
+
+#ifndef SET_OPERATIONS
+#define SET_OPERATIONS
+
+#include<iterator>
+#include<type_traits>
+
+#include "Array.c++"
+#include "FlatHashTable.c++"
+#include "Algorithms/Hasher.c++"
+#include "Algorithms/Sorting.c++"
+
+/// @brief Indicates whether or not the values of a type can be ordered by the less-than operator.
+/// @tparam T The type of the values.
+template<typename T, typename = void>
+constexpr bool IS_LESS_COMPARABLE = false;
+
+/// @brief Indicates that the values of a type can be ordered by the less-than operator.
+/// @tparam T The type of the values.
+template<typename T>
+constexpr bool IS_LESS_COMPARABLE<T, std::void_t<decltype((bool)(std::declval<const T &>() < std::declval<const T &>()))>> = true;
+
+/// @brief A key of a Flat Hash Table that refers to a value stored somewhere else, and is hashed and compared
+/// by that value, so a set of the values of a container can be made without copying any of them.
+/// @tparam T The type of the referred value.
+template<typename T>
+struct ValueReference
+{
+    /// @brief A pointer to the referred value.
+    const T* Value = nullptr;
+
+    /// @brief Hashes the referred value.
+    /// @return The hashing value of the referred value.
+    size_t Hash() const { return Hasher<T>()(*Value); }
+
+    /// @brief Compares the referred values of two Value References.
+    /// @param reference The Value Reference that'll be compared to.
+    /// @return A boolean representing whether or not both referred values are equal.
+    bool operator==(const ValueReference<T> &reference) const { return *Value == *reference.Value; }
+};
+
+/// @brief A set of values that are stored within a container, which hashes them if they have a Hasher, (in an
+/// expected constant time for each), or sorts them otherwise, (the values must outlive the Value Set).
+/// @tparam T The type of the values.
+/// @tparam IsHashed Whether or not the values are hashed.
+template<typename T, bool IsHashed = IS_HASHABLE<T>>
+class ValueSet;
+
+/// @brief A set of values that are stored within a container, and indexed by a Flat Hash Table of references.
+/// @tparam T The type of the values.
+template<typename T>
+class ValueSet<T, true>
+{
+public:
+    /// @brief Creates a new empty Value Set that can hold a defined amount of values without rehashing.
+    /// @param capacity The amount of values that'll be added to the Value Set.
+    explicit ValueSet(const size_t &capacity) : references(capacity) { }
+
+    /// @brief Creates a new Value Set of a range of values.
+    /// @tparam TIterator The type of the iterators of the range.
+    /// @param first The iterator at the first value.
+    /// @param length The amount of values within the range.
+    template<typename TIterator>
+    ValueSet(TIterator first, const size_t &length) : ValueSet(length)
+    { for (size_t i = 0; i < length; i++, ++first) { Add(*first); } }
+
+private:
+    /// @brief The references to the values of the Value Set.
+    FlatHashTable<ValueReference<T>, bool> references;
+
+public:
+    /// @brief Adds a value to the Value Set if an equal one isn't there yet.
+    /// @param value The value that'll be referred to, (it mustn't be moved while the Value Set is used).
+    /// @return A boolean representing whether or not the value has been added.
+    bool Add(const T &value)
+    {
+        ValueReference<T> reference { &value };
+        if (references.Has(reference)) { return false; }
+
+        references.Set(reference, true);
+        return true;
+    }
+
+    /// @brief Checks for a value within the Value Set.
+    /// @param value The value that'll be searched for.
+    /// @return A boolean representing whether or not an equal value is presented in the Value Set.
+    bool Contains(const T &value) const { return references.Has(ValueReference<T> { &value }); }
+};
+
+/// @brief A set of values that are stored within a container, and indexed by an Array of pointers sorted
+/// by the values, that's binary searched, (for the values that can only be compared).
+/// @tparam T The type of the values.
+template<typename T>
+class ValueSet<T, false>
+{
+    static_assert(IS_LESS_COMPARABLE<T>, "The values must either have a Hasher, or be comparable by the less-than operator.");
+
+public:
+    /// @brief Creates a new Value Set of a range of values.
+    /// @tparam TIterator The type of the iterators of the range.
+    /// @param first The iterator at the first value.
+    /// @param length The amount of values within the range.
+    template<typename TIterator>
+    ValueSet(TIterator first, const size_t &length) : values(length)
+    {
+        for (size_t i = 0; i < length; i++, ++first) { values.begin()[i] = &*first; }
+        IntroSort(values.begin(), values.end(), [](const T* value1, const T* value2) { return *value1 < *value2; });
+    }
+
+private:
+    /// @brief The pointers to the values, sorted by the values.
+    Array<const T*> values;
+
+public:
+    /// @brief Checks for a value within the Value Set.
+    /// @param value The value that'll be searched for.
+    /// @return A boolean representing whether or not an equivalent value is presented in the Value Set.
+    bool Contains(const T &value) const
+    {
+        size_t low = 0, high = values.Length();
+        while (low < high)
+        {
+            size_t middle = low + (high - low) / 2;
+            if (*values.begin()[middle] < value) { low = middle + 1; }
+            else { high = middle; }
+        }
+
+        return low < values.Length() && !(value < *values.begin()[low]);
+    }
+};
+
+/// @brief Marks the first occurrence of every distinct value within two consecutive ranges, (the second one
+/// is empty unless a union is made), by hashing the values if they have a Hasher, or by stably sorting their
+/// indices otherwise.
+/// @tparam TIterator The type of the iterators of the first range.
+/// @tparam TOtherIterator The type of the iterators of the second range.
+/// @param first The iterator at the first value of the first range.
+/// @param length The amount of values within the first range.
+/// @param otherFirst The iterator at the first value of the second range.
+/// @param otherLength The amount of values within the second range.
+/// @param isKept A pointer to an array in memory that'll receive whether or not each value is a first occurrence,
+/// (the values of the second range come after the ones of the first).
+/// @return The amount of the first occurrences.
+template<typename TIterator, typename TOtherIterator>
+size_t MarkFirstOccurrences(TIterator first, const size_t &length, TOtherIterator otherFirst, const size_t &otherLength, bool* isKept)
+{
+    using T = std::decay_t<decltype(*first)>;
+    size_t keptCount = 0;
+
+    if constexpr (IS_HASHABLE<T>)
+    {
+        // The set grows by the distinct values only, since reserving for every value wastes the cache on duplicates.
+        ValueSet<T> seenValues(0);
+        for (size_t i = 0; i < length; i++, ++first) { keptCount += isKept[i] = seenValues.Add(*first); }
+        for (size_t i = 0; i < otherLength; i++, ++otherFirst) { keptCount += isKept[length + i] = seenValues.Add(*otherFirst); }
+    }
+    else
+    {
+        static_assert(IS_LESS_COMPARABLE<T>, "The values must either have a Hasher, or be comparable by the less-than operator.");
+
+        Array<const T*> values(length + otherLength);
+        Array<size_t> order(values.Length());
+        for (size_t i = 0; i < length; i++, ++first) { values.begin()[i] = &*first; }
+        for (size_t i = 0; i < otherLength; i++, ++otherFirst) { values.begin()[length + i] = &*otherFirst; }
+        for (size_t i = 0; i < order.Length(); i++) { order.begin()[i] = i; }
+
+        // The sorting is stable, so the first index within each run of equivalent values is their first occurrence.
+        MergeSort(order.begin(), order.end(), [&](const size_t &index1, const size_t &index2)
+        { return *values.begin()[index1] < *values.begin()[index2]; });
+
+        for (size_t i = 0; i < order.Length(); i++)
+        {
+            const size_t* indices = order.begin();
+            bool isFirst = !i || *values.begin()[indices[i - 1]] < *values.begin()[indices[i]];
+
+            isKept[indices[i]] = isFirst;
+            keptCount += isFirst;
+        }
+    }
+
+    return keptCount;
+}
+
+/// @brief Marks the first occurrence of every distinct value within a range.
+/// @tparam TIterator The type of the iterators of the range.
+/// @param first The iterator at the first value.
+/// @param length The amount of values within the range.
+/// @param isKept A pointer to an array in memory that'll receive whether or not each value is a first occurrence.
+/// @return The amount of the first occurrences.
+template<typename TIterator>
+size_t MarkFirstOccurrences(TIterator first, const size_t &length, bool* isKept)
+{ return MarkFirstOccurrences(first, length, first, 0, isKept); }
+
+/// @brief Marks the first occurrence of every distinct value within a range that is, (or isn't), presented
+/// within another range.
+/// @tparam TIterator The type of the iterators of the marked range.
+/// @tparam TOtherIterator The type of the iterators of the other range.
+/// @param first The iterator at the first value of the marked range.
+/// @param length The amount of values within the marked range.
+/// @param otherFirst The iterator at the first value of the other range.
+/// @param otherLength The amount of values within the other range.
+/// @param isPresented Whether the marked values are the ones presented within the other range, (an intersection),
+/// or the ones that aren't, (a difference).
+/// @param isKept A pointer to an array in memory that'll receive whether or not each value is marked.
+/// @return The amount of the marked values.
+template<typename TIterator, typename TOtherIterator>
+size_t MarkOccurrencesWithin(TIterator first, const size_t &length, TOtherIterator otherFirst, const size_t &otherLength,
+    const bool &isPresented, bool* isKept)
+{
+    using T = std::decay_t<decltype(*first)>;
+
+    size_t keptCount = MarkFirstOccurrences(first, length, isKept);
+    ValueSet<T> otherValues(otherFirst, otherLength);
+
+    for (size_t i = 0; i < length; i++, ++first)
+    {
+        if (!isKept[i] || otherValues.Contains(*first) == isPresented) { continue; }
+
+        isKept[i] = false;
+        keptCount--;
+    }
+
+    return keptCount;
+}
+
+#endif
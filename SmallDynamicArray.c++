@@ -0,0 +1,350 @@
+#include<iostream>
+
+#ifndef SMALL_DYNAMIC_ARRAY
+#define SMALL_DYNAMIC_ARRAY
+
+#include "Array.c++"
+#include "DynamicArray.c++"
+#include "GrowthPolicy.c++"
+
+/// @brief A data structure which is a basic Array, that can be expanded up or shrunk down by adding
+/// or removing elements from it, where the first elements are kept inline within the Small Dynamic Array
+/// itself, and only spill into a memory block on the heap once they don't fit anymore.
+/// @tparam T The type of the data stored within the Small Dynamic Array.
+/// @tparam N The amount of elements that are stored inline, without allocating any memory.
+template<typename T, size_t N>
+class SmallDynamicArray
+{
+    static_assert(N > 0, "A Small Dynamic Array must hold at least one element inline.");
+
+public:
+    /// @brief Creates a new empty Small Dynamic Array, which uses its inline elements.
+    SmallDynamicArray() = default;
+
+    /// @brief Creates a new empty Small Dynamic Array with a defined Growth Policy, which uses its inline elements.
+    /// @param growthPolicy The way the Small Dynamic Array capacity grows each time it runs
+    /// out of space to store more elements, (a plain capacity modifier makes it grow linearly).
+    explicit SmallDynamicArray(const GrowthPolicy &growthPolicy) : growthPolicy(growthPolicy) { }
+
+    /// @brief Creates a new Small Dynamic Array from a defined Array, by copying all of its elements.
+    /// @param array The Array that'll be used to create the Small Dynamic Array.
+    /// @param growthPolicy The way the Small Dynamic Array capacity grows each time it runs
+    /// out of space to store more elements, (a plain capacity modifier makes it grow linearly).
+    SmallDynamicArray(const Array<T> &array, const GrowthPolicy &growthPolicy = GrowthPolicy())
+        : SmallDynamicArray(growthPolicy) { AddRange(array); }
+
+    /// @brief Creates a new Small Dynamic Array with a defined elements count and initial values.
+    /// @param length The amount of elements that'll be stored within the Small Dynamic Array initially.
+    /// @param data A pointer to an array in memory, that has some values that'll be
+    /// stored within the Small Dynamic Array initially.
+    /// @param growthPolicy The way the Small Dynamic Array capacity grows each time it runs
+    /// out of space to store more elements, (a plain capacity modifier makes it grow linearly).
+    SmallDynamicArray(const size_t &length, const T* data, const GrowthPolicy &growthPolicy = GrowthPolicy())
+        : SmallDynamicArray(growthPolicy) { AddRange(length, data); }
+
+    /// @brief Creates a new Small Dynamic Array by copying another Small Dynamic Array as reference.
+    /// @param reference The reference of the Small Dynamic Array that'll be copied.
+    SmallDynamicArray(const SmallDynamicArray<T, N> &reference) = default;
+
+    /// @brief Creates a new Small Dynamic Array by taking over the heap memory of another Small Dynamic Array,
+    /// (or by moving its inline elements), which is left empty.
+    /// @param reference The reference of the Small Dynamic Array that'll be moved.
+    SmallDynamicArray(SmallDynamicArray<T, N> &&reference) noexcept
+        : growthPolicy(reference.growthPolicy), count(reference.count), heapElements(std::move(reference.heapElements))
+    {
+        if (heapElements.Length() == 0) { MoveElements(reference.inlineElements, inlineElements, count); }
+        reference.count = 0;
+    }
+
+    ~SmallDynamicArray() = default;
+
+protected:
+    /// @brief The elements that are stored within the Small Dynamic Array itself, until they spill.
+    T inlineElements[N];
+    /// @brief The way the Small Dynamic Array capacity grows each time it runs
+    /// out of space to store more elements.
+    GrowthPolicy growthPolicy;
+    /// @brief The amount of elements currently stored within the Small Dynamic Array.
+    size_t count = 0;
+    /// @brief The memory block the elements have spilled into, (which is empty while they're inline).
+    Array<T> heapElements;
+
+public:
+    /// @brief The amount of elements that are stored inline, without allocating any memory.
+    static constexpr size_t INLINE_CAPACITY = N;
+
+    /// @brief The amount of elements the Small Dynamic Array can maximally hold currently.
+    /// @return The capacity of the Small Dynamic Array.
+    size_t Capacity() const { return IsInline() ? N : heapElements.Length(); }
+    /// @brief The way the Small Dynamic Array capacity grows each time it runs
+    /// out of space to store more elements.
+    /// @return The Growth Policy of the Small Dynamic Array.
+    const GrowthPolicy &Growth() const { return growthPolicy; }
+    /// @brief The amount of elements currently stored within the Small Dynamic Array.
+    /// @return The elements count of the Small Dynamic Array.
+    size_t Count() const { return count; }
+    /// @brief Indicates whether or not the elements are still stored inline, without any heap memory.
+    /// @return A boolean representing whether or not the Small Dynamic Array is inline.
+    bool IsInline() const { return heapElements.Length() == 0; }
+
+    /// @brief The beginning of the Small Dynamic Array.
+    /// @return A pointer to the first element in the Small Dynamic Array.
+    T* begin() { return Data(); }
+    /// @brief The end of the Small Dynamic Array.
+    /// @return A pointer to the last element in the Small Dynamic Array.
+    T* end() { return Data() + count; }
+    /// @brief The beginning of the Small Dynamic Array.
+    /// @return A pointer to the first element in the Small Dynamic Array.
+    const T* begin() const { return Data(); }
+    /// @brief The end of the Small Dynamic Array.
+    /// @return A pointer to the last element in the Small Dynamic Array.
+    const T* end() const { return Data() + count; }
+
+    /// @brief Indicates whether or not the Small Dynamic Array has currently no elements.
+    /// @return A boolean representing whether or not the Small Dynamic Array is empty.
+    bool IsEmpty() const { return !count; }
+
+    /// @brief Adds an element to the end of the Small Dynamic Array.
+    /// @param element The value of the element that'll be copied into the Small Dynamic Array.
+    void Add(const T &element)
+    {
+        // The element might live within this Small Dynamic Array, so it's copied before it spills.
+        if (count == Capacity()) { Add(T(element)); return; }
+
+        Data()[count++] = element;
+    }
+
+    /// @brief Adds an element to the end of the Small Dynamic Array.
+    /// @param element The value of the element that'll be moved into the Small Dynamic Array.
+    void Add(T &&element)
+    {
+        if (count == Capacity())
+        {
+            T movedElement(std::move(element));
+            Grow(count + 1);
+            Data()[count++] = std::move(movedElement);
+            return;
+        }
+
+        Data()[count++] = std::move(element);
+    }
+
+    /// @brief Constructs an element from a set of arguments, and adds it to the end of the Small Dynamic Array.
+    /// @tparam ...TArguments The types of the arguments given to the element constructor.
+    /// @param ...arguments The arguments that'll be forwarded to the element constructor.
+    /// @return The reference of the added element.
+    template<typename... TArguments>
+    T &Emplace(TArguments&&... arguments)
+    {
+        Add(T(std::forward<TArguments>(arguments)...));
+        return Data()[count - 1];
+    }
+
+    /// @brief Adds an Array of elements to the end of the Small Dynamic Array.
+    /// @param array The Array that'll be added to the Small Dynamic Array.
+    void AddRange(const Array<T> &array) { AddRange(array.Length(), array.begin()); }
+
+    /// @brief Adds a range of elements to the end of the Small Dynamic Array.
+    /// @param length The amount of elements that'll be added to the Small Dynamic Array.
+    /// @param data A pointer to an array in memory, that has some values that'll be added
+    /// to the Small Dynamic Array, (it mustn't point within this Small Dynamic Array).
+    void AddRange(const size_t &length, const T* data)
+    {
+        Reserve(count + length);
+        for (size_t i = 0; i < length; i++) { Data()[count + i] = T(data[i]); }
+        count += length;
+    }
+
+    /// @brief Adds an element into the Small Dynamic Array at a specified index.
+    /// @param element The value of the element that'll be copied into the Small Dynamic Array.
+    /// @param index The order in which the desired element will be inserted at.
+    void Insert(const T &element, const size_t &index) noexcept(false) { Insert(T(element), index); }
+
+    /// @brief Adds an element into the Small Dynamic Array at a specified index.
+    /// @param element The value of the element that'll be moved into the Small Dynamic Array.
+    /// @param index The order in which the desired element will be inserted at.
+    void Insert(T &&element, const size_t &index) noexcept(false)
+    {
+        if (index == count) { Add(std::move(element)); return; }
+
+        ValidateBoundaries(index);
+        if (count == Capacity()) { Grow(count + 1); }
+
+        T* data = Data();
+        for (size_t i = count; i > index; i--) { data[i] = std::move(data[i - 1]); }
+
+        data[index] = std::move(element);
+        count++;
+    }
+
+    /// @brief Searches for an element in the Small Dynamic Array, and returns its first occuring index.
+    /// @param element The value of the desired element.
+    /// @return The first occuring index of the element, or -1 if unfound.
+    size_t FirstIndexOf(const T &element) const { return SearchFirst(Data(), count, element); }
+
+    /// @brief Searches for an element in the Small Dynamic Array, and returns its last occuring index.
+    /// @param element The value of the desired element.
+    /// @return The last occuring index of the element, or -1 if unfound.
+    size_t LastIndexOf(const T &element) const { return SearchLast(Data(), count, element); }
+
+    /// @brief Checks for the existence of an element in the Small Dynamic Array.
+    /// @param element The value of the desired element.
+    /// @return A boolean representing whether or not the element exists within the Small Dynamic Array.
+    bool Contains(const T &element) const { return FirstIndexOf(element) != -1; }
+
+    /// @brief Removes the first occurance of an element from the Small Dynamic Array.
+    /// @param element The value of the desired element.
+    /// @return A boolean representing whether or not the element has been removed.
+    bool RemoveFirst(const T &element)
+    {
+        size_t index = FirstIndexOf(element);
+        if (index == -1) { return false; }
+
+        RemoveAt(index);
+        return true;
+    }
+
+    /// @brief Removes an element from the Small Dynamic Array at a specified index.
+    /// @param index The order in which the element will be removed from.
+    void RemoveAt(const size_t &index) noexcept(false) { RemoveRange(index, 1); }
+
+    /// @brief Removes a range of elements from the Small Dynamic Array starting from a specified index.
+    /// @param index The order in which the removal will start from.
+    /// @param count The amount of elements will be removed.
+    void RemoveRange(const size_t &index, const size_t &count) noexcept(false)
+    {
+        if (!count) { return; }
+
+        ValidateBoundaries(index);
+        ValidateBoundaries(index + count - 1);
+
+        T* data = Data();
+        for (size_t i = index + count; i < this->count; i++) { data[i - count] = std::move(data[i]); }
+        this->count -= count;
+    }
+
+    /// @brief Clears every element from the Small Dynamic Array, (keeping its capacity).
+    void Clear() { count = 0; }
+
+    /// @brief Makes sure the Small Dynamic Array can hold a defined amount of elements without
+    /// running out of space, (it never shrinks the capacity).
+    /// @param capacity The amount of elements the Small Dynamic Array will be able to hold.
+    void Reserve(const size_t &capacity)
+    {
+        if (capacity <= Capacity()) { return; }
+        Reallocate(capacity);
+    }
+
+    /// @brief Shrinks the capacity of the Small Dynamic Array down to its elements count, to release
+    /// the unused memory, (which moves the elements back inline if they fit).
+    void ShrinkToFit()
+    {
+        if (IsInline() || count == Capacity()) { return; }
+        Reallocate(count);
+    }
+
+    /// @brief Converts the Small Dynamic Array into an Array.
+    /// @return An Array consisting of all of the Small Dynamic Array elements.
+    Array<T> ToArray() const { return Array<T>(count, Data()); }
+
+    /// @brief Converts the Small Dynamic Array into a Dynamic Array.
+    /// @return A Dynamic Array consisting of all of the Small Dynamic Array elements.
+    DynamicArray<T> ToDynamicArray() const { return DynamicArray<T>(ToArray(), growthPolicy); }
+
+    /// @brief Gets or Sets an element in the Small Dynamic Array.
+    /// @param index The order of the desired element.
+    /// @return The element.
+    T &operator[](const size_t &index) noexcept(false)
+    {
+        ValidateBoundaries(index);
+        return Data()[index];
+    }
+
+    /// @brief Only Gets an element in the Small Dynamic Array, without the ability to Set it.
+    /// @param index The order of the desired element.
+    /// @return The value of the element.
+    const T &operator[](const size_t &index) const noexcept(false)
+    {
+        ValidateBoundaries(index);
+        return Data()[index];
+    }
+
+    /// @brief Copies a Small Dynamic Array into another.
+    /// @param reference The reference of the Small Dynamic Array that'll be copied.
+    /// @return The result of the copying.
+    SmallDynamicArray<T, N> &operator=(const SmallDynamicArray<T, N> &reference) = default;
+
+    /// @brief Moves a Small Dynamic Array into another, by taking over its heap memory,
+    /// (or by moving its inline elements).
+    /// @param reference The reference of the Small Dynamic Array that'll be moved.
+    /// @return The result of the moving.
+    SmallDynamicArray<T, N> &operator=(SmallDynamicArray<T, N> &&reference) noexcept
+    {
+        if (this == &reference) { return *this; }
+
+        growthPolicy = reference.growthPolicy;
+        count = reference.count;
+        heapElements = std::move(reference.heapElements);
+        if (heapElements.Length() == 0) { MoveElements(reference.inlineElements, inlineElements, count); }
+
+        reference.count = 0;
+        return *this;
+    }
+
+    /// @brief Adds an element to the end of the Small Dynamic Array.
+    /// @param element The value of the element that'll be copied into the Small Dynamic Array.
+    /// @return The reference of the Small Dynamic Array after adding the element value to it.
+    SmallDynamicArray<T, N> &operator<<(const T &element) { Add(element); return *this; }
+
+    /// @brief Adds an element to the end of the Small Dynamic Array.
+    /// @param element The value of the element that'll be moved into the Small Dynamic Array.
+    /// @return The reference of the Small Dynamic Array after adding the element value to it.
+    SmallDynamicArray<T, N> &operator<<(T &&element) { Add(std::move(element)); return *this; }
+
+protected:
+    /// @brief The memory the elements are currently stored within, (either inline or on the heap).
+    /// @return A pointer to the first element.
+    T* Data() { return IsInline() ? inlineElements : heapElements.begin(); }
+    /// @brief The memory the elements are currently stored within, (either inline or on the heap).
+    /// @return A pointer to the first element.
+    const T* Data() const { return IsInline() ? inlineElements : heapElements.begin(); }
+
+    /// @brief Checks whether or not an index is within the boundaries of the Small Dynamic Array, if not,
+    /// it'll throw an "out of range" exception.
+    /// @param index The selected index that'll be checked.
+    void ValidateBoundaries(const size_t &index) const noexcept(false)
+    {
+        if (index < count) { return; }
+
+        throw std::out_of_range("The index [" + std::to_string(index) + "] is out of the range of the Small Dynamic Array.");
+    }
+
+    /// @brief Expands the capacity following the Growth Policy, once the elements don't fit anymore.
+    /// @param required The amount of elements that need to be stored.
+    void Grow(const size_t &required) { Reallocate(growthPolicy.NextCapacity(Capacity(), required)); }
+
+    /// @brief Moves the elements into a memory block with a defined capacity, or back inline if they fit.
+    /// @param capacity The new amount of elements the Small Dynamic Array can maximally hold.
+    void Reallocate(const size_t &capacity)
+    {
+        if (capacity <= N)
+        {
+            MoveElements(heapElements.begin(), inlineElements, count);
+            heapElements = Array<T>();
+            return;
+        }
+
+        Array<T> reallocatedElements(capacity);
+        MoveElements(Data(), reallocatedElements.begin(), count);
+        heapElements = std::move(reallocatedElements);
+    }
+
+    /// @brief Moves a range of elements into another memory block.
+    /// @param source A pointer to the first element that'll be moved.
+    /// @param destination A pointer to the first element that'll be overwritten.
+    /// @param count The amount of elements that'll be moved.
+    static void MoveElements(T* source, T* destination, const size_t &count)
+    { for (size_t i = 0; i < count; i++) { destination[i] = std::move(source[i]); } }
+};
+
+#endif
@@ -0,0 +1,174 @@
+#include<iostream>
+
+#ifndef SMALL_LIST
+#define SMALL_LIST
+
+#include "SmallDynamicArray.c++"
+#include "List.c++"
+
+/// @brief A data structure which is a dynamic array, that can be expanded up or shrunk down by adding
+/// or removing elements from it, and offers more functionalities overall, (the first elements are kept
+/// inline within the Small List itself, so short-lived Lists don't allocate any memory).
+/// @tparam T The type of the data stored within the Small List.
+/// @tparam N The amount of elements that are stored inline, without allocating any memory.
+template<typename T, size_t N>
+class SmallList : public SmallDynamicArray<T, N>
+{
+public:
+    /// @brief Creates a new empty Small List.
+    SmallList() = default;
+
+    /// @brief Creates a new empty Small List with a defined Growth Policy.
+    /// @param growthPolicy The way the Small List capacity grows each time it runs
+    /// out of space to store more elements.
+    explicit SmallList(const GrowthPolicy &growthPolicy) : SmallDynamicArray<T, N>(growthPolicy) { }
+
+    /// @brief Creates a new Small List from a defined Array, by copying all of its elements.
+    /// @param array The Array that'll be used to create the Small List.
+    /// @param growthPolicy The way the Small List capacity grows each time it runs
+    /// out of space to store more elements.
+    SmallList(const Array<T> &array, const GrowthPolicy &growthPolicy = GrowthPolicy())
+        : SmallDynamicArray<T, N>(array, growthPolicy) { }
+
+    /// @brief Creates a new Small List with a defined elements count and initial values.
+    /// @param length The amount of elements that'll be stored within the Small List initially.
+    /// @param data A pointer to an array in memory, that has some values that'll be
+    /// stored within the Small List initially.
+    /// @param growthPolicy The way the Small List capacity grows each time it runs
+    /// out of space to store more elements.
+    SmallList(const size_t &length, const T* data, const GrowthPolicy &growthPolicy = GrowthPolicy())
+        : SmallDynamicArray<T, N>(length, data, growthPolicy) { }
+
+    /// @brief Creates a new Small List by copying another Small List as reference.
+    /// @param reference The reference of the Small List that'll be copied.
+    SmallList(const SmallList<T, N> &reference) = default;
+
+    /// @brief Creates a new Small List by taking over the memory of another Small List, which is left empty.
+    /// @param reference The reference of the Small List that'll be moved.
+    SmallList(SmallList<T, N> &&reference) noexcept = default;
+
+    ~SmallList() = default;
+
+    /// @brief Searches for the first element in the Small List that matches a set of conditions.
+    /// @tparam TPredicate The type of the function that validates the elements.
+    /// @param predicate A function that takes an element and validates it throughout a set of conditions.
+    /// @return The index of the first element that matches the set of conditions, or -1 if unfound.
+    template<typename TPredicate>
+    size_t First(const TPredicate &predicate) const
+    {
+        for (size_t i = 0; i < this->count; i++) { if (predicate(this->Data()[i])) { return i; } }
+        return -1;
+    }
+
+    /// @brief Searches for the last element in the Small List that matches a set of conditions.
+    /// @tparam TPredicate The type of the function that validates the elements.
+    /// @param predicate A function that takes an element and validates it throughout a set of conditions.
+    /// @return The index of the last element that matches the set of conditions, or -1 if unfound.
+    template<typename TPredicate>
+    size_t Last(const TPredicate &predicate) const
+    {
+        for (size_t i = this->count; i > 0; i--) { if (predicate(this->Data()[i - 1])) { return i - 1; } }
+        return -1;
+    }
+
+    /// @brief Searches for all the elements in the Small List that match a set of conditions.
+    /// @tparam TPredicate The type of the function that validates the elements.
+    /// @param predicate A function that takes an element and validates it throughout a set of conditions.
+    /// @return An Array filled with all of the elements indices that match the set of conditions,
+    /// or an empty Array if unfound.
+    template<typename TPredicate>
+    Array<size_t> Every(const TPredicate &predicate) const
+    {
+        SmallDynamicArray<size_t, N> indices;
+        for (size_t i = 0; i < this->count; i++) { if (predicate(this->Data()[i])) { indices.Add(i); } }
+        return indices.ToArray();
+    }
+
+    /// @brief Checks if any of the Small List elements matches a set of conditions.
+    /// @tparam TPredicate The type of the function that validates the elements.
+    /// @param predicate A function that takes an element and validates it throughout a set of conditions.
+    /// @return A boolean representing whether or not any of the Small List elements matches the set of conditions.
+    template<typename TPredicate>
+    bool Any(const TPredicate &predicate) const { return First(predicate) != -1; }
+
+    /// @brief Checks if all of the Small List elements match a set of conditions.
+    /// @tparam TPredicate The type of the function that validates the elements.
+    /// @param predicate A function that takes an element and validates it throughout a set of conditions.
+    /// @return A boolean representing whether or not all of the Small List elements match the set of conditions.
+    template<typename TPredicate>
+    bool All(const TPredicate &predicate) const { return First([&](const T &element) { return !predicate(element); }) == -1; }
+
+    /// @brief Makes a copy of the Small List that'll have the same elements of this Small List, but
+    /// in a reversed order.
+    /// @return A Small List that has the same elements of this Small List but in a reversed order.
+    SmallList<T, N> Reverse() const
+    {
+        SmallList<T, N> reversedList(this->growthPolicy);
+        reversedList.Reserve(this->count);
+        for (size_t i = this->count; i > 0; i--) { reversedList.Add(this->Data()[i - 1]); }
+        return reversedList;
+    }
+
+    /// @brief Makes a copy of the Small List that'll have the same elements of this Small List, but sorted
+    /// in an ascending order.
+    /// @param algorithm The algorithm the elements get sorted with.
+    /// @return A Small List that has the same elements of this Small List but sorted.
+    SmallList<T, N> Sort(const SortingAlgorithm &algorithm = SortingAlgorithm::Automatic) const noexcept(false)
+    {
+        SmallList<T, N> sortedList(*this);
+        sortedList.SortInPlace(algorithm);
+        return sortedList;
+    }
+
+    /// @brief Makes a copy of the Small List that'll have the same elements of this Small List, but sorted by a comparer.
+    /// @tparam TComparer The function object that tells whether or not an element goes before another.
+    /// @param comparer The function object that tells whether or not an element goes before another.
+    /// @param algorithm The algorithm the elements get sorted with.
+    /// @return A Small List that has the same elements of this Small List but sorted.
+    template<typename TComparer>
+    SmallList<T, N> Sort(const TComparer &comparer, const SortingAlgorithm &algorithm = SortingAlgorithm::Automatic) const noexcept(false)
+    {
+        SmallList<T, N> sortedList(*this);
+        sortedList.SortInPlace(comparer, algorithm);
+        return sortedList;
+    }
+
+    /// @brief Sorts the elements of the Small List in an ascending order, without copying them.
+    /// @param algorithm The algorithm the elements get sorted with.
+    void SortInPlace(const SortingAlgorithm &algorithm = SortingAlgorithm::Automatic) noexcept(false)
+    { SortRange(this->begin(), this->end(), algorithm); }
+
+    /// @brief Sorts the elements of the Small List by a comparer, without copying them.
+    /// @tparam TComparer The function object that tells whether or not an element goes before another.
+    /// @param comparer The function object that tells whether or not an element goes before another.
+    /// @param algorithm The algorithm the elements get sorted with.
+    template<typename TComparer>
+    void SortInPlace(const TComparer &comparer, const SortingAlgorithm &algorithm = SortingAlgorithm::Automatic) noexcept(false)
+    { SortRange(this->begin(), this->end(), algorithm, comparer); }
+
+    /// @brief Converts the Small List into a List.
+    /// @return A List containing all of the Small List elements.
+    List<T> ToList() const { return List<T>(this->ToArray(), this->growthPolicy); }
+
+    /// @brief Copies a Small List into another.
+    /// @param reference The reference of the Small List that'll be copied.
+    /// @return The result of the copying.
+    SmallList<T, N> &operator=(const SmallList<T, N> &reference) = default;
+
+    /// @brief Moves a Small List into another, by taking over its memory.
+    /// @param reference The reference of the Small List that'll be moved.
+    /// @return The result of the moving.
+    SmallList<T, N> &operator=(SmallList<T, N> &&reference) noexcept = default;
+
+    /// @brief Adds an element to the end of the Small List.
+    /// @param element The value of the element that'll be copied into the Small List.
+    /// @return The reference of the Small List after adding the element value to it.
+    SmallList<T, N> &operator<<(const T &element) { this->Add(element); return *this; }
+
+    /// @brief Adds an element to the end of the Small List.
+    /// @param element The value of the element that'll be moved into the Small List.
+    /// @return The reference of the Small List after adding the element value to it.
+    SmallList<T, N> &operator<<(T &&element) { this->Add(std::move(element)); return *this; }
+};
+
+#endif
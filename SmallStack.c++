@@ -0,0 +1,112 @@
+#include<iostream>
+
+#ifndef SMALL_STACK
+#define SMALL_STACK
+
+#include "SmallDynamicArray.c++"
+
+/// @brief A linear data structure to save data close together in memory as a pile, where each element
+/// is put on top of the previous one, providing the First In Last Out functionality, (the first elements
+/// are kept inline within the Small Stack itself, so short-lived Stacks don't allocate any memory).
+/// @tparam T The type of the data stored within the Small Stack.
+/// @tparam N The amount of elements that are stored inline, without allocating any memory.
+template<typename T, size_t N>
+class SmallStack : protected SmallDynamicArray<T, N>
+{
+public:
+    /// @brief Creates a new empty Small Stack.
+    SmallStack() = default;
+
+    /// @brief Creates a new empty Small Stack with a defined Growth Policy.
+    /// @param growthPolicy The way the Small Stack capacity grows each time it runs
+    /// out of space to store more elements.
+    explicit SmallStack(const GrowthPolicy &growthPolicy) : SmallDynamicArray<T, N>(growthPolicy) { }
+
+    /// @brief Creates a new Small Stack from a defined Array, where its last element will be on the top.
+    /// @param array The Array that'll be used to create the Small Stack.
+    /// @param growthPolicy The way the Small Stack capacity grows each time it runs
+    /// out of space to store more elements.
+    SmallStack(const Array<T> &array, const GrowthPolicy &growthPolicy = GrowthPolicy())
+        : SmallDynamicArray<T, N>(array, growthPolicy) { }
+
+    /// @brief Creates a new Small Stack by copying another Small Stack as reference.
+    /// @param reference The reference of the Small Stack that'll be copied.
+    SmallStack(const SmallStack<T, N> &reference) = default;
+
+    /// @brief Creates a new Small Stack by taking over the memory of another Small Stack, which is left empty.
+    /// @param reference The reference of the Small Stack that'll be moved.
+    SmallStack(SmallStack<T, N> &&reference) noexcept = default;
+
+    ~SmallStack() = default;
+
+    using SmallDynamicArray<T, N>::INLINE_CAPACITY;
+    using SmallDynamicArray<T, N>::Capacity;
+    using SmallDynamicArray<T, N>::Growth;
+    using SmallDynamicArray<T, N>::Count;
+    using SmallDynamicArray<T, N>::IsInline;
+    using SmallDynamicArray<T, N>::IsEmpty;
+    using SmallDynamicArray<T, N>::Reserve;
+    using SmallDynamicArray<T, N>::ShrinkToFit;
+    using SmallDynamicArray<T, N>::Clear;
+
+    /// @brief Converts the Small Stack into an Array, where its first element is the one at the bottom of the Stack.
+    /// @return An Array consisting of all of the Small Stack elements.
+    Array<T> ToArray() const { return SmallDynamicArray<T, N>::ToArray(); }
+
+    /// @brief Retrieves the element that is on the top of the Small Stack, without removing it.
+    /// @return The value of the element that is on the top of the Small Stack.
+    T Top() const { return *(this->end() - 1); }
+
+    /// @brief Retrieves the element that is at the bottom of the Small Stack, without removing it.
+    /// @return The value of the element that is at the bottom of the Small Stack.
+    T Bottom() const { return *(this->begin()); }
+
+    /// @brief Adds an element on the top of the Small Stack.
+    /// @param element The value of the element that'll be copied on the top of the Small Stack.
+    void Push(const T &element) { this->Add(element); }
+
+    /// @brief Adds an element on the top of the Small Stack.
+    /// @param element The value of the element that'll be moved on the top of the Small Stack.
+    void Push(T &&element) { this->Add(std::move(element)); }
+
+    /// @brief Constructs an element from a set of arguments, and adds it on the top of the Small Stack.
+    /// @tparam ...TArguments The types of the arguments given to the element constructor.
+    /// @param ...arguments The arguments that'll be forwarded to the element constructor.
+    template<typename... TArguments>
+    void Emplace(TArguments&&... arguments) { SmallDynamicArray<T, N>::Emplace(std::forward<TArguments>(arguments)...); }
+
+    /// @brief Adds an Array on the top of the Small Stack.
+    /// @param array The Array that'll be added on the top of the Small Stack.
+    void PushRange(const Array<T> &array) { this->AddRange(array); }
+
+    /// @brief Retrieves the element that is on the top of the Small Stack, by removing it.
+    /// @return The value of the element that is on the top of the Small Stack.
+    T Pop()
+    {
+        T lastElement = std::move(*(this->end() - 1));
+        this->RemoveAt(this->count - 1);
+        return lastElement;
+    }
+
+    /// @brief Copies a Small Stack into another.
+    /// @param reference The reference of the Small Stack that'll be copied.
+    /// @return The result of the copying.
+    SmallStack<T, N> &operator=(const SmallStack<T, N> &reference) = default;
+
+    /// @brief Moves a Small Stack into another, by taking over its memory.
+    /// @param reference The reference of the Small Stack that'll be moved.
+    /// @return The result of the moving.
+    SmallStack<T, N> &operator=(SmallStack<T, N> &&reference) noexcept = default;
+
+    /// @brief Adds an element on the top of the Small Stack.
+    /// @param element The value of the element that'll be copied on the top of the Small Stack.
+    /// @return The reference of the Small Stack after adding the element value to it.
+    SmallStack<T, N> &operator<<(const T &element) { Push(element); return *this; }
+
+    /// @brief Adds an element on the top of the Small Stack.
+    /// @param element The value of the element that'll be moved on the top of the Small Stack.
+    /// @return The reference of the Small Stack after adding the element value to it.
+    SmallStack<T, N> &operator<<(T &&element) { Push(std::move(element)); return *this; }
+};
+
+#endif
@@ -0,0 +1,161 @@
+#include<iostream>
+
+#ifndef SORTED_MAP
+#define SORTED_MAP
+
+#include<functional>
+#include<stdexcept>
+#include<utility>
+
+#include "Array.c++"
+#include "BPlusTree.c++"
+#include "KeyValuePair.c++"
+
+/// @brief An associative data structure that keeps its keys in an ascending order within a B+ Tree, which finds,
+/// sets and erases a key in a logarithmic time, (touching a wide Node per level), and walks through the pairs
+/// of any range of keys sequentially, (the keys are stored apart from the values, so searching a Node only
+/// loads keys).
+/// @tparam TKey The type of the keys, (which must be default constructible).
+/// @tparam TValue The type of the values associated with the keys, (which must be default constructible).
+/// @tparam TComparer The type of the comparer that orders the keys, (a strict weak ordering).
+template<typename TKey, typename TValue, typename TComparer = std::less<TKey>>
+class SortedMap : public BPlusTree<TKey, TValue, TComparer>
+{
+public:
+    /// @brief Creates a new empty Sorted Map.
+    /// @param comparer The comparer that'll order the keys.
+    explicit SortedMap(const TComparer &comparer = TComparer()) : BPlusTree<TKey, TValue, TComparer>(comparer) { }
+
+    /// @brief Creates a new Sorted Map by bulk loading an Array of pairs sorted by their keys, which fills its Nodes
+    /// in a linear time, and keeps the first pair of every repeated key, (if the Array isn't sorted, it'll throw
+    /// a "logic error" exception).
+    /// @param pairs The sorted Array of pairs that'll be copied into the Sorted Map.
+    /// @param comparer The comparer that orders the keys.
+    explicit SortedMap(const Array<KeyValuePair<TKey, TValue>> &pairs, const TComparer &comparer = TComparer()) noexcept(false)
+        : SortedMap(Array<KeyValuePair<TKey, TValue>>(pairs), comparer) { }
+
+    /// @brief Creates a new Sorted Map by bulk loading an Array of pairs sorted by their keys, which fills its Nodes
+    /// in a linear time, and keeps the first pair of every repeated key, (if the Array isn't sorted, it'll throw
+    /// a "logic error" exception).
+    /// @param pairs The sorted Array of pairs whose keys and values will be moved into the Sorted Map.
+    /// @param comparer The comparer that orders the keys.
+    explicit SortedMap(Array<KeyValuePair<TKey, TValue>> &&pairs, const TComparer &comparer = TComparer()) noexcept(false)
+        : BPlusTree<TKey, TValue, TComparer>(comparer)
+    {
+        Array<TKey> keys(pairs.Length());
+        Array<TValue> values(pairs.Length());
+        for (size_t i = 0; i < pairs.Length(); i++)
+        {
+            keys.begin()[i] = std::move(pairs.begin()[i].Key);
+            values.begin()[i] = std::move(pairs.begin()[i].Value);
+        }
+
+        this->Load(keys.begin(), values.begin(), keys.Length());
+    }
+
+    /// @brief Sets a value within the Sorted Map using a key, (if the key isn't there, it'll be added).
+    /// @param key The key of the pair that'll be used to access the value its associated with.
+    /// @param value The new value that'll be associated with the key.
+    void Set(const TKey &key, const TValue &value) { *Place(key) = value; }
+
+    /// @brief Sets a value within the Sorted Map using a key, (if the key isn't there, it'll be added).
+    /// @param key The key of the pair that'll be used to access the value its associated with.
+    /// @param value The new value that'll be moved and associated with the key.
+    void Set(const TKey &key, TValue &&value) { *Place(key) = std::move(value); }
+
+    /// @brief Only Gets a value within the Sorted Map using a key, (if the key doesn't exist,
+    /// it'll throw an "out of range" exception).
+    /// @param key The key of the pair that'll be used to access the value its associated with.
+    /// @return The value that's associated with the key.
+    const TValue &Get(const TKey &key) const noexcept(false)
+    {
+        const TValue* value = FindValue(key);
+        if (!value) { throw std::out_of_range("The provided key doesn't exist within the Sorted Map."); }
+
+        return *value;
+    }
+
+    /// @brief Tries to get a value within the Sorted Map using a key.
+    /// @param key The key of the pair that'll be used to access the value its associated with.
+    /// @param value A reference to a variable that'll receive the value if the key is found.
+    /// @return A boolean representing whether or not the key is found.
+    bool TryGet(const TKey &key, TValue &value) const
+    {
+        const TValue* found = FindValue(key);
+        if (!found) { return false; }
+
+        value = *found;
+        return true;
+    }
+
+    /// @brief Searches for a value within the Sorted Map using a key, (unlike Find, which gives the Iterator
+    /// at the key).
+    /// @param key The key of the pair that'll be searched for.
+    /// @return A pointer to the value that's associated with the key, or null pointer if the key isn't there.
+    TValue* FindValue(const TKey &key)
+    {
+        size_t index = 0;
+        auto leaf = this->Search(key, index);
+        return leaf ? &leaf->Values[index] : nullptr;
+    }
+
+    /// @brief Searches for a value within the Sorted Map using a key, (unlike Find, which gives the Iterator
+    /// at the key).
+    /// @param key The key of the pair that'll be searched for.
+    /// @return A pointer to the value that's associated with the key, or null pointer if the key isn't there.
+    const TValue* FindValue(const TKey &key) const
+    {
+        size_t index = 0;
+        auto leaf = this->Search(key, index);
+        return leaf ? &leaf->Values[index] : nullptr;
+    }
+
+    /// @brief Checks for a key within the Sorted Map.
+    /// @param key The key of the pair that'll be checked for.
+    /// @return A boolean representing whether or not the key is presented in the Sorted Map.
+    bool Has(const TKey &key) const
+    {
+        size_t index = 0;
+        return this->Search(key, index);
+    }
+
+    /// @brief Erases a key and its associated value from the Sorted Map.
+    /// @param key The key of the pair that'll be erased.
+    /// @return A boolean representing whether or not the key has been erased.
+    bool Erase(const TKey &key) { return this->Remove(key); }
+
+    /// @brief Walks through every pair of the Sorted Map in an ascending order of the keys.
+    /// @param callback The function that'll be called with each key and its value.
+    void Foreach(std::function<void(const TKey &key, TValue &value)> callback)
+    { for (auto pair : *this) { callback(pair.Key, pair.Value); } }
+
+    /// @brief Copies the pairs of the Sorted Map into an Array, in an ascending order of the keys.
+    /// @return The Array of the pairs.
+    Array<KeyValuePair<TKey, TValue>> ToArray() const
+    {
+        Array<KeyValuePair<TKey, TValue>> array(this->Count());
+        size_t i = 0;
+        for (auto pair : *this) { array.begin()[i++] = pair; }
+        return array;
+    }
+
+    /// @brief Only Gets a value within the Sorted Map using a key, (if the key doesn't exist,
+    /// it'll throw an "out of range" exception).
+    /// @param key The key of the pair that'll be used to access the value its associated with.
+    /// @return The value that's associated with the key.
+    const TValue &operator[](const TKey &key) const noexcept(false) { return Get(key); }
+
+private:
+    /// @brief Finds the value of a key, adding the key with a default value if it isn't there.
+    /// @param key The key of the pair.
+    /// @return A pointer to the value that's associated with the key.
+    TValue* Place(const TKey &key)
+    {
+        size_t index = 0;
+        bool isInserted = false;
+        auto leaf = this->Insert(key, index, isInserted);
+        return &leaf->Values[index];
+    }
+};
+
+#endif
@@ -0,0 +1,96 @@
+#include<iostream>
+
+#ifndef SORTED_SET
+#define SORTED_SET
+
+#include<functional>
+#include<utility>
+
+#include "Array.c++"
+#include "BPlusTree.c++"
+
+/// @brief A set of distinct elements kept in an ascending order within a B+ Tree, which finds, adds and removes
+/// an element in a logarithmic time, (touching a wide Node per level), and walks through the elements of any
+/// range of values sequentially.
+/// @tparam T The type of the elements, (which must be default constructible).
+/// @tparam TComparer The type of the comparer that orders the elements, (a strict weak ordering).
+template<typename T, typename TComparer = std::less<T>>
+class SortedSet : public BPlusTree<T, void, TComparer>
+{
+public:
+    /// @brief Creates a new empty Sorted Set.
+    /// @param comparer The comparer that'll order the elements.
+    explicit SortedSet(const TComparer &comparer = TComparer()) : BPlusTree<T, void, TComparer>(comparer) { }
+
+    /// @brief Creates a new Sorted Set by bulk loading a sorted Array, which fills its Nodes in a linear time,
+    /// and skips the repetitions of an element, (if the Array isn't sorted, it'll throw a "logic error" exception).
+    /// @param array The sorted Array that'll be copied into the Sorted Set.
+    /// @param comparer The comparer that orders the elements.
+    explicit SortedSet(const Array<T> &array, const TComparer &comparer = TComparer()) noexcept(false)
+        : SortedSet(Array<T>(array), comparer) { }
+
+    /// @brief Creates a new Sorted Set by bulk loading a sorted Array, which fills its Nodes in a linear time,
+    /// and skips the repetitions of an element, (if the Array isn't sorted, it'll throw a "logic error" exception).
+    /// @param array The sorted Array whose elements will be moved into the Sorted Set.
+    /// @param comparer The comparer that orders the elements.
+    explicit SortedSet(Array<T> &&array, const TComparer &comparer = TComparer()) noexcept(false)
+        : BPlusTree<T, void, TComparer>(comparer) { this->Load(array.begin(), nullptr, array.Length()); }
+
+    /// @brief Adds an element to the Sorted Set if an equivalent one isn't there yet.
+    /// @param element The value of the element that'll be added.
+    /// @return A boolean representing whether or not the element has been added.
+    bool Add(const T &element)
+    {
+        size_t index = 0;
+        bool isInserted = false;
+        this->Insert(element, index, isInserted);
+        return isInserted;
+    }
+
+    /// @brief Adds an element to the Sorted Set if an equivalent one isn't there yet.
+    /// @param element The value of the element that'll be moved into the Sorted Set.
+    /// @return A boolean representing whether or not the element has been added.
+    bool Add(T &&element)
+    {
+        size_t index = 0;
+        bool isInserted = false;
+        this->Insert(std::move(element), index, isInserted);
+        return isInserted;
+    }
+
+    /// @brief Removes an element from the Sorted Set.
+    /// @param element The value of the element that'll be removed.
+    /// @return A boolean representing whether or not the element has been removed.
+    bool Remove(const T &element) { return BPlusTree<T, void, TComparer>::Remove(element); }
+
+    /// @brief Checks for an element within the Sorted Set.
+    /// @param element The value of the element that'll be searched for.
+    /// @return A boolean representing whether or not an equivalent element is presented in the Sorted Set.
+    bool Contains(const T &element) const
+    {
+        size_t index = 0;
+        return this->Search(element, index);
+    }
+
+    /// @brief Copies the elements of the Sorted Set into an Array, in an ascending order.
+    /// @return The Array of the elements.
+    Array<T> ToArray() const
+    {
+        Array<T> array(this->Count());
+        size_t i = 0;
+        for (const T &element : *this) { array.begin()[i++] = element; }
+        return array;
+    }
+
+    /// @brief Adds an element to the Sorted Set.
+    /// @param element The value of the element that'll be added.
+    /// @return The reference of the Sorted Set after adding the element to it.
+    SortedSet<T, TComparer> &operator<<(const T &element) { Add(element); return *this; }
+
+    /// @brief Adds an element to the Sorted Set.
+    /// @param element The value of the element that'll be moved into the Sorted Set.
+    /// @return The reference of the Sorted Set after adding the element to it.
+    SortedSet<T, TComparer> &operator<<(T &&element) { Add(std::move(element)); return *this; }
+};
+
+#endif
@@ -3,15 +3,54 @@
 #ifndef SPARSE_ARRAY
 #define SPARSE_ARRAY
 
+#include<iterator>
+#include<stdexcept>
+#include<string>
+
 #include "SparseNode.c++"
-#include "LinkedList.c++"
+#include "KeyValuePair.c++"
+#include "DynamicArray.c++"
+#include "Algorithms/Sorting.c++"
 
-/// @brief A data structure to save discontiguous sparse data in memory.
+/// @brief A data structure to save discontiguous sparse data in memory, by storing only the non-default
+/// elements within two parallel arrays, (their indices in an ascending order, and their values).
 /// @tparam T The type of the data stored within the Sparse Array.
 template<typename T>
 class SparseArray
 {
 public:
+    /// @brief Walks through the non-default elements of a Sparse Array in an ascending order of indices.
+    class Iterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = SparseNode<T>;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = SparseNode<T>;
+
+        /// @brief Creates a new Iterator at a non-default element.
+        /// @param sparseArray The Sparse Array that'll be walked through.
+        /// @param position The position of the current element within the stored elements.
+        Iterator(const SparseArray<T>* sparseArray, const size_t &position) : sparseArray(sparseArray), position(position) { }
+
+        /// @brief The current element.
+        /// @return A Sparse Node of the value and the index of the current element.
+        SparseNode<T> operator*() const
+        { return SparseNode<T>(sparseArray->values.begin()[position], sparseArray->indices.begin()[position]); }
+
+        Iterator &operator++() { position++; return *this; }
+        Iterator operator++(int) { Iterator iterator = *this; position++; return iterator; }
+        bool operator==(const Iterator &iterator) const { return position == iterator.position; }
+        bool operator!=(const Iterator &iterator) const { return position != iterator.position; }
+
+    private:
+        /// @brief The Sparse Array that's walked through.
+        const SparseArray<T>* sparseArray;
+        /// @brief The position of the current element within the stored elements.
+        size_t position;
+    };
+
     /// @brief Creates a new empty Sparse Array.
     SparseArray() = default;
 
@@ -24,33 +63,26 @@ public:
     /// an initial value.
     /// @param length The amount of elements that'll be stored within the Sparse Array.
     /// @param defaultValue The value that'll be set to each element as a default one.
-    SparseArray(const size_t &length, const T &defaultValue) : SparseArray(length) { std::cout<< (DefaultValue = defaultValue) << "\n"; }
+    SparseArray(const size_t &length, const T &defaultValue) : length(length), DefaultValue(defaultValue) { }
 
     /// @brief Creates a new Sparse Array by copying another Sparse Array as reference.
     /// @param reference The reference of the Sparse Array that'll be copied.
-    SparseArray(const SparseArray<T> &reference)
-    {
-        length = reference.length;
-        actualLength = reference.actualLength;
+    SparseArray(const SparseArray<T> &reference) = default;
 
-        sparseNodes = LinkedList<SparseNode<T>>();
-        for (Node<SparseNode<T>>* currentNode = reference.sparseNodes.Head();
-            currentNode; currentNode = currentNode->Next())
-        { sparseNodes.Add(currentNode->Data); }
-    }
+    /// @brief Creates a new Sparse Array by taking over the elements of another Sparse Array.
+    /// @param reference The reference of the Sparse Array that'll be moved.
+    SparseArray(SparseArray<T> &&reference) = default;
 
     ~SparseArray() = default;
 
 private:
     /// @brief The amount of elements stored within the Sparse Array.
     size_t length = 0;
-    /// @brief The amount of non-default elements stored within the Sparse Array.
-    size_t actualLength = 0;
+    /// @brief The indices of the non-default elements, in an ascending order.
+    DynamicArray<size_t> indices;
+    /// @brief The values of the non-default elements, each one at the same position as its index.
+    DynamicArray<T> values;
 
-    // TODO: Implement Binary Search.
-    /// @brief A Linked List that contains all of the Sparse Nodes created within the Sparse Array.
-    LinkedList<SparseNode<T>> sparseNodes;
-    
 public:
     /// @brief The value that'll be set to each element with an unspecified value.
     T DefaultValue = T();
@@ -60,90 +92,157 @@ public:
     size_t Length() const { return length; }
     /// @brief The amount of non-default elements stored within the Sparse Array.
     /// @return The actual length of the Sparse Array.
-    size_t ActualLength() const { return actualLength; }
+    size_t ActualLength() const { return indices.Count(); }
+
+    /// @brief The indices of the non-default elements, in an ascending order.
+    /// @return A pointer to the first index, (there are "ActualLength()" of them).
+    const size_t* Indices() const { return indices.begin(); }
+    /// @brief The values of the non-default elements, in the same order as their indices.
+    /// @return A pointer to the first value, (there are "ActualLength()" of them).
+    T* Values() const { return values.begin(); }
+
+    /// @brief The beginning of the non-default elements of the Sparse Array.
+    /// @return An Iterator at the non-default element with the smallest index.
+    Iterator begin() const { return Iterator(this, 0); }
+    /// @brief The end of the non-default elements of the Sparse Array.
+    /// @return An Iterator past the non-default element with the greatest index.
+    Iterator end() const { return Iterator(this, indices.Count()); }
+
+    /// @brief Gets an element value within the Sparse Array at a specified index, by a binary search.
+    /// @param index The order in which the desired element will be chosen.
+    /// @return The value of the element, or the default value if it was never set.
+    const T &Get(const size_t &index) const noexcept(false)
+    {
+        ValidateBoundaries(index);
+
+        size_t position = Locate(index);
+        return position < indices.Count() && indices.begin()[position] == index ? values.begin()[position] : DefaultValue;
+    }
+
+    /// @brief Checks whether or not an element within the Sparse Array has been set.
+    /// @param index The order in which the desired element will be chosen.
+    /// @return A boolean representing whether or not the element is stored within the Sparse Array.
+    bool Has(const size_t &index) const noexcept(false)
+    {
+        ValidateBoundaries(index);
+
+        size_t position = Locate(index);
+        return position < indices.Count() && indices.begin()[position] == index;
+    }
 
-    /// @brief Sets an element value within the Sparse Array at a specified index.
+    /// @brief Sets an element value within the Sparse Array at a specified index, by a binary search,
+    /// (setting the elements in an ascending order of indices only appends them).
     /// @param element The new value of the element that'll be set.
     /// @param index The order in which the desired element will be chosen to set its value.
     SparseArray<T> &Set(const T &element, const size_t &index) noexcept(false)
     {
         ValidateBoundaries(index);
-        
-        SparseNode<T> sparseNode(element, index);
-        if (!actualLength) { sparseNodes.Add(sparseNode); actualLength++; return *this; }
 
-        if (!index)
-        {
-            if (!sparseNodes.Head()->Data.Index) { sparseNodes.Head()->Data = sparseNode; return *this; }
-            sparseNodes.Insert(sparseNode, 0);
-            return *this;
-        }
+        size_t position = Locate(index);
+        if (position < indices.Count() && indices.begin()[position] == index) { values.begin()[position] = element; return *this; }
 
-        bool inserted = false;
-        size_t currentIndex = 0;
-        for (Node<SparseNode<T>>* currentNode = sparseNodes.Head();
-            currentNode; currentNode = currentNode->Next(), currentIndex++)
-        {
-            if (currentNode->Data == sparseNode)
-            { currentNode->Data = sparseNode; inserted |= true; break; }
+        indices.Insert(index, position);
+        values.Insert(element, position);
+        return *this;
+    }
 
-            if (currentNode->Data < sparseNode) { continue; }
+    /// @brief Resets an element within the Sparse Array back to the default value.
+    /// @param index The order in which the desired element will be chosen.
+    /// @return A boolean representing whether or not the element had been set.
+    bool Unset(const size_t &index) noexcept(false)
+    {
+        ValidateBoundaries(index);
 
-            sparseNodes.Insert(sparseNode, currentIndex);
-            inserted |= true;
-        }
+        size_t position = Locate(index);
+        if (position == indices.Count() || indices.begin()[position] != index) { return false; }
 
-        if (!inserted) { sparseNodes.Add(sparseNode); }
+        indices.RemoveAt(position);
+        values.RemoveAt(position);
+        return true;
+    }
 
-        actualLength++;
-        return *this;
+    /// @brief Replaces the elements of the Sparse Array with unsorted pairs of indices and values, which are
+    /// sorted once, (when an index occurs more than once, its last value is the one that's kept).
+    /// @param entries The pairs of indices as keys and values that'll be set.
+    void Build(const Array<KeyValuePair<size_t, T>> &entries) noexcept(false)
+    {
+        for (const KeyValuePair<size_t, T> &entry : entries) { ValidateBoundaries(entry.Key); }
+
+        // A stable sort keeps the repeated indices in their original order, so the last one can win.
+        Array<KeyValuePair<size_t, T>> sortedEntries(entries);
+        SortRange(sortedEntries.begin(), sortedEntries.end(), SortingAlgorithm::MergeSort,
+            [](const KeyValuePair<size_t, T> &entry1, const KeyValuePair<size_t, T> &entry2) { return entry1.Key < entry2.Key; });
+
+        Clear();
+        indices.Reserve(sortedEntries.Length());
+        values.Reserve(sortedEntries.Length());
+
+        for (size_t i = 0; i < sortedEntries.Length(); i++)
+        {
+            KeyValuePair<size_t, T> &entry = sortedEntries.begin()[i];
+            if (i + 1 < sortedEntries.Length() && sortedEntries.begin()[i + 1].Key == entry.Key) { continue; }
+
+            indices.Add(entry.Key);
+            values.Add(std::move(entry.Value));
+        }
+    }
+
+    /// @brief Resets every element of the Sparse Array back to the default value.
+    void Clear()
+    {
+        indices.Clear();
+        values.Clear();
     }
 
     void Print() const
     {
         std::cout << " ";
-        size_t index = 0;
-        for (Node<SparseNode<T>>* currentNode = sparseNodes.Head();
-            index < length; currentNode = currentNode ? currentNode->Next() : nullptr, index++)
+        for (size_t index = 0, position = 0; index < length; index++)
         {
-            bool isCurrentNodeFar = currentNode && index < currentNode->Data.Index,
-                isOuttaNodes = !currentNode && index < length;
-                
-            while (isCurrentNodeFar || isOuttaNodes)
-            {
-                std::cout << DefaultValue << " ";
-
-                if (isCurrentNodeFar) { isCurrentNodeFar &= ++index < currentNode->Data.Index; }
-                if (isOuttaNodes) { isOuttaNodes &= ++index < length; }
-            }
-
-            if (currentNode) { std::cout << currentNode->Data << " "; }
+            if (position < indices.Count() && indices.begin()[position] == index) { std::cout << values.begin()[position++] << " "; }
+            else { std::cout << DefaultValue << " "; }
         }
         std::cout << "\n";
     }
 
+    /// @brief Only Gets an element in the Sparse Array, without the ability to Set it.
+    /// @param index The order in which the desired element will be chosen.
+    /// @return The value of the element, or the default value if it was never set.
+    const T &operator[](const size_t &index) const noexcept(false) { return Get(index); }
+
     /// @brief Copies a Sparse Array into another.
     /// @param reference The reference of the Sparse Array that'll be copied.
     /// @return The result of the copying.
-    SparseArray<T> &operator=(const SparseArray<T> &reference)
-    {
-        if (this == &reference) { return *this; }
-
-        length = reference.length;
-        actualLength = reference.actualLength;
-        
-        sparseNodes = LinkedList<SparseNode<T>>();
-        for (Node<SparseNode<T>>* currentNode = reference.sparseNodes.Head();
-            currentNode; currentNode = currentNode->Next())
-        { sparseNodes.Add(currentNode->Data); }
-        
-        return *this;
-    }
-    
+    SparseArray<T> &operator=(const SparseArray<T> &reference) = default;
+
+    /// @brief Moves a Sparse Array into another, by taking over its elements.
+    /// @param reference The reference of the Sparse Array that'll be moved.
+    /// @return The result of the moving.
+    SparseArray<T> &operator=(SparseArray<T> &&reference) = default;
+
     template<typename T_>
     friend std::ostream &operator<<(std::ostream &cout, const SparseArray<T_> &sparseArray);
 
 private:
+    /// @brief Searches for the position of an index within the stored indices by a binary search,
+    /// (an index past the greatest stored one is found right away).
+    /// @param index The index of the desired element.
+    /// @return The position of the first stored index that isn't smaller than the desired one.
+    size_t Locate(const size_t &index) const
+    {
+        size_t low = 0, high = indices.Count();
+        if (!high || indices.begin()[high - 1] < index) { return high; }
+
+        while (low < high)
+        {
+            size_t middle = low + (high - low) / 2;
+            if (indices.begin()[middle] < index) { low = middle + 1; }
+            else { high = middle; }
+        }
+
+        return low;
+    }
+
     /// @brief Checks whether or not an index is within the boundaries of the Sparse Array, if not,
     /// it'll throw an "out of range" exception.
     /// @param index The selected index that'll be checked.
@@ -159,15 +258,16 @@ template<typename T>
 static std::ostream &operator<<(std::ostream &cout, const SparseArray<T> &sparseArray) noexcept(false)
 { sparseArray.Print(); return cout; }
 
-/// @brief Simple shortcut of writing Two-Dimensional Sparse Array types.
-/// @tparam T The type of the data stored within the Matrix.
+/// @brief Simple shortcut of writing Two-Dimensional Sparse Array types, where each row is a separate
+/// Sparse Array, (the Sparse Matrix class compresses all of the rows together instead).
+/// @tparam T The type of the data stored within the Jagged Sparse Matrix.
 template<typename T>
-using SparseMatrix = SparseArray<SparseArray<T>>;
+using JaggedSparseMatrix = SparseArray<SparseArray<T>>;
 
 /// @brief Simple shortcut of writing Three-Dimensional Sparse Array types.
-/// @tparam T The type of the data stored within the Tensor.
+/// @tparam T The type of the data stored within the Jagged Sparse Tensor.
 template<typename T>
-using SparseTensor = SparseArray<SparseArray<SparseArray<T>>>;
+using JaggedSparseTensor = SparseArray<SparseArray<SparseArray<T>>>;
 
 
 #endif
\ No newline at end of file
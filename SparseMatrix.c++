@@ -0,0 +1,568 @@
+#include<iostream>
+
+#ifndef SPARSE_MATRIX
+#define SPARSE_MATRIX
+
+#include<stdexcept>
+#include<string>
+
+#include "SparseArray.c++"
+#include "Matrix.c++"
+#include "ExecutionPolicy.c++"
+
+/// @brief The layout a Sparse Matrix compresses its non-default elements by.
+enum class SparseMatrixFormat
+{
+    /// @brief The elements are grouped by rows, (CSR), so multiplying by vectors runs across rows in parallel.
+    CompressedRows,
+    /// @brief The elements are grouped by columns, (CSC), so reading a column is as fast as reading a row in CSR.
+    CompressedColumns
+};
+
+/// @brief A block of data that associates a value with its position within a Matrix, to be stored within
+/// a Sparse Matrix Builder.
+/// @tparam T The type of the value.
+template<typename T>
+struct SparseMatrixEntry
+{
+    /// @brief The index of the row of the value.
+    size_t Row = 0;
+    /// @brief The index of the column of the value.
+    size_t Column = 0;
+    /// @brief The value at the position.
+    T Value = T();
+};
+
+/// @brief Introduces the abstraction of the Sparse Matrix Builder class to the Sparse Matrix class.
+/// @tparam T The type of the data stored within the Sparse Matrix.
+template<typename T>
+class SparseMatrixBuilder;
+
+/// @brief A two-dimensional data structure that stores only its non-default elements, grouped by rows (CSR)
+/// or by columns (CSC), where an offsets Array tells where each group starts within the indices and the
+/// values Arrays, and the indices of each group are in an ascending order.
+/// @tparam T The type of the data stored within the Sparse Matrix.
+template<typename T>
+class SparseMatrix
+{
+public:
+    /// @brief Creates a new empty Sparse Matrix.
+    SparseMatrix() : offsets(1, (size_t)0) { }
+
+    /// @brief Creates a new Sparse Matrix with a defined shape, where all elements are the default value.
+    /// @param rows The amount of rows of the Sparse Matrix.
+    /// @param columns The amount of columns of the Sparse Matrix.
+    /// @param format The layout the elements are compressed by.
+    SparseMatrix(const size_t &rows, const size_t &columns, const SparseMatrixFormat &format = SparseMatrixFormat::CompressedRows)
+        : rows(rows), columns(columns), format(format),
+        offsets((format == SparseMatrixFormat::CompressedRows ? rows : columns) + 1, (size_t)0) { }
+
+    /// @brief Creates a new Sparse Matrix out of the non-default elements of a Matrix.
+    /// @param matrix The Matrix View of the elements that'll be compressed.
+    /// @param format The layout the elements are compressed by.
+    explicit SparseMatrix(const MatrixView<T> &matrix, const SparseMatrixFormat &format = SparseMatrixFormat::CompressedRows)
+        : SparseMatrix(matrix.Rows(), matrix.Columns(), SparseMatrixFormat::CompressedRows)
+    {
+        size_t count = 0;
+        for (size_t i = 0; i < rows; i++)
+        {
+            for (size_t j = 0; j < columns; j++) { count += !(matrix(i, j) == T()); }
+        }
+
+        indices = Array<size_t>(count);
+        values = Array<T>(count);
+
+        for (size_t i = 0, k = 0; i < rows; i++)
+        {
+            for (size_t j = 0; j < columns; j++)
+            {
+                if (matrix(i, j) == T()) { continue; }
+
+                indices.begin()[k] = j;
+                values.begin()[k++] = matrix(i, j);
+            }
+
+            offsets.begin()[i + 1] = k;
+        }
+
+        if (format == SparseMatrixFormat::CompressedColumns) { *this = ToFormat(format); }
+    }
+
+    /// @brief Creates a new Sparse Matrix out of the Sparse Arrays of its rows.
+    /// @param sparseRows The rows of the Sparse Matrix, which must all have the same length, otherwise
+    /// it'll throw a "logic error" exception.
+    /// @param format The layout the elements are compressed by.
+    explicit SparseMatrix(const Array<SparseArray<T>> &sparseRows, const SparseMatrixFormat &format = SparseMatrixFormat::CompressedRows)
+        noexcept(false) : SparseMatrix(sparseRows.Length(), sparseRows.Length() ? sparseRows.begin()->Length() : 0)
+    {
+        size_t count = 0;
+        for (const SparseArray<T> &sparseRow : sparseRows)
+        {
+            if (sparseRow.Length() != columns) { throw std::logic_error("The rows of a Sparse Matrix must all have the same length."); }
+            count += sparseRow.ActualLength();
+        }
+
+        indices = Array<size_t>(count);
+        values = Array<T>(count);
+
+        for (size_t i = 0, k = 0; i < rows; i++)
+        {
+            const SparseArray<T> &sparseRow = sparseRows.begin()[i];
+            std::copy(sparseRow.Indices(), sparseRow.Indices() + sparseRow.ActualLength(), indices.begin() + k);
+            std::copy(sparseRow.Values(), sparseRow.Values() + sparseRow.ActualLength(), values.begin() + k);
+            offsets.begin()[i + 1] = k += sparseRow.ActualLength();
+        }
+
+        if (format == SparseMatrixFormat::CompressedColumns) { *this = ToFormat(format); }
+    }
+
+    /// @brief Creates a new Sparse Matrix by copying another Sparse Matrix as reference.
+    /// @param reference The reference of the Sparse Matrix that'll be copied.
+    SparseMatrix(const SparseMatrix<T> &reference) = default;
+
+    /// @brief Creates a new Sparse Matrix by taking over the elements of another Sparse Matrix.
+    /// @param reference The reference of the Sparse Matrix that'll be moved.
+    SparseMatrix(SparseMatrix<T> &&reference) = default;
+
+    ~SparseMatrix() = default;
+
+private:
+    /// @brief The amount of rows of the Sparse Matrix.
+    size_t rows = 0;
+    /// @brief The amount of columns of the Sparse Matrix.
+    size_t columns = 0;
+    /// @brief The layout the elements are compressed by.
+    SparseMatrixFormat format = SparseMatrixFormat::CompressedRows;
+    /// @brief The position of the first element of each row, (or column), within the indices and the values,
+    /// followed by the amount of non-default elements.
+    Array<size_t> offsets;
+    /// @brief The column, (or row), of each non-default element.
+    Array<size_t> indices;
+    /// @brief The value of each non-default element.
+    Array<T> values;
+
+    friend class SparseMatrixBuilder<T>;
+
+public:
+    /// @brief The amount of rows of the Sparse Matrix.
+    /// @return The rows count of the Sparse Matrix.
+    size_t Rows() const { return rows; }
+    /// @brief The amount of columns of the Sparse Matrix.
+    /// @return The columns count of the Sparse Matrix.
+    size_t Columns() const { return columns; }
+    /// @brief The layout the elements of the Sparse Matrix are compressed by.
+    /// @return The format of the Sparse Matrix.
+    SparseMatrixFormat Format() const { return format; }
+    /// @brief The amount of non-default elements stored within the Sparse Matrix.
+    /// @return The actual count of the Sparse Matrix.
+    size_t ActualCount() const { return values.Length(); }
+
+    /// @brief The position of the first element of each row, (or column), followed by the actual count.
+    /// @return A pointer to the first offset.
+    const size_t* Offsets() const { return offsets.begin(); }
+    /// @brief The column, (or row), of each non-default element.
+    /// @return A pointer to the first index.
+    const size_t* Indices() const { return indices.begin(); }
+    /// @brief The value of each non-default element.
+    /// @return A pointer to the first value.
+    T* Values() const { return values.begin(); }
+
+    /// @brief Gets an element value within the Sparse Matrix, by a binary search within its row, (or column).
+    /// @param row The index of the row of the element.
+    /// @param column The index of the column of the element.
+    /// @return The value of the element, or the default one if it isn't stored.
+    T Get(const size_t &row, const size_t &column) const noexcept(false)
+    {
+        ValidateBoundaries(row, column);
+
+        bool isRowMajor = format == SparseMatrixFormat::CompressedRows;
+        size_t position = Locate(isRowMajor ? row : column, isRowMajor ? column : row);
+        return position == -1 ? T() : values.begin()[position];
+    }
+
+    /// @brief Copies a row of the Sparse Matrix into a Sparse Array, (which takes a binary search for
+    /// each column if the elements are compressed by columns).
+    /// @param row The index of the row.
+    /// @return A Sparse Array of the non-default elements of the row.
+    SparseArray<T> Row(const size_t &row) const noexcept(false)
+    {
+        ValidateBoundaries(row, 0);
+        return format == SparseMatrixFormat::CompressedRows ? Group(row, columns) : Cross(row, columns);
+    }
+
+    /// @brief Copies a column of the Sparse Matrix into a Sparse Array, (which takes a binary search for
+    /// each row if the elements are compressed by rows).
+    /// @param column The index of the column.
+    /// @return A Sparse Array of the non-default elements of the column.
+    SparseArray<T> Column(const size_t &column) const noexcept(false)
+    {
+        ValidateBoundaries(0, column);
+        return format == SparseMatrixFormat::CompressedColumns ? Group(column, rows) : Cross(column, rows);
+    }
+
+    /// @brief Makes a copy of the Sparse Matrix in another layout, by a counting sort of its elements.
+    /// @param format The layout the copy is compressed by.
+    /// @return A Sparse Matrix with the same elements, compressed by the desired format.
+    SparseMatrix<T> ToFormat(const SparseMatrixFormat &format) const
+    {
+        if (format == this->format) { return *this; }
+
+        SparseMatrix<T> sparseMatrix(rows, columns, format);
+        Regroup(offsets.Length() - 1, offsets.begin(), indices.begin(), values.begin(),
+            sparseMatrix.offsets, sparseMatrix.indices, sparseMatrix.values);
+
+        return sparseMatrix;
+    }
+
+    /// @brief Multiplies the Sparse Matrix by a vector, (in parallel chunks of rows with about the same amount
+    /// of elements if they're compressed by rows, or sequentially otherwise, since the columns would write to the
+    /// same elements of the result).
+    /// @param vector The Array View of the vector, which must have an element for each column, otherwise it'll
+    /// throw a "logic error" exception.
+    /// @param policy The way the rows of the result are computed.
+    /// @return An Array of an element for each row.
+    Array<T> Multiply(const ArrayView<T> &vector, const ExecutionPolicy &policy = ExecutionPolicy::Sequential) const noexcept(false)
+    {
+        if (vector.Length() != columns)
+        {
+            throw std::logic_error("Attempting to multiply a Sparse Matrix of " + std::to_string(columns)
+                + " columns by a vector of " + std::to_string(vector.Length()) + " elements.");
+        }
+
+        Array<T> product(rows, T());
+        T* productData = product.begin();
+
+        if (format == SparseMatrixFormat::CompressedColumns)
+        {
+            for (size_t j = 0; j < columns; j++)
+            {
+                const T &factor = vector.Data()[j * vector.Stride()];
+                for (size_t k = offsets.begin()[j]; k < offsets.begin()[j + 1]; k++)
+                { productData[indices.begin()[k]] += values.begin()[k] * factor; }
+            }
+
+            return product;
+        }
+
+        RunRowChunks(policy, [&](const size_t &rowBegin, const size_t &rowEnd)
+        {
+            for (size_t i = rowBegin; i < rowEnd; i++)
+            {
+                T sum = T();
+                for (size_t k = offsets.begin()[i]; k < offsets.begin()[i + 1]; k++)
+                { sum += values.begin()[k] * vector.Data()[indices.begin()[k] * vector.Stride()]; }
+
+                productData[i] = sum;
+            }
+        });
+
+        return product;
+    }
+
+    /// @brief Multiplies the Sparse Matrix by a dense Matrix, by adding each element times the matching row of the
+    /// dense one to a row of the result, (which is vectorized for floats and doubles, and runs in parallel chunks of
+    /// rows if the elements are compressed by rows).
+    /// @param right The Matrix View that'll be multiplied from the right, which must have a row for each column,
+    /// otherwise it'll throw a "logic error" exception.
+    /// @param policy The way the rows of the result are computed.
+    /// @return The Matrix resulting from the multiplication.
+    Matrix<T> Multiply(const MatrixView<T> &right, const ExecutionPolicy &policy = ExecutionPolicy::Sequential) const noexcept(false)
+    {
+        if (right.Rows() != columns)
+        {
+            throw std::logic_error("Attempting to multiply a Sparse Matrix of " + std::to_string(columns)
+                + " columns by a Matrix of " + std::to_string(right.Rows()) + " rows.");
+        }
+
+        Matrix<T> product(rows, right.Columns(), T());
+        T* productData = product.begin();
+        auto addRow = [&](const size_t &row, const size_t &rightRow, const T &factor)
+        { MultiplyAdd(productData + row * right.Columns(), right.Data() + rightRow * right.RowStride(), factor, right.Columns()); };
+
+        if (format == SparseMatrixFormat::CompressedColumns)
+        {
+            for (size_t j = 0; j < columns; j++)
+            {
+                for (size_t k = offsets.begin()[j]; k < offsets.begin()[j + 1]; k++) { addRow(indices.begin()[k], j, values.begin()[k]); }
+            }
+
+            return product;
+        }
+
+        RunRowChunks(policy, [&](const size_t &rowBegin, const size_t &rowEnd)
+        {
+            for (size_t i = rowBegin; i < rowEnd; i++)
+            {
+                for (size_t k = offsets.begin()[i]; k < offsets.begin()[i + 1]; k++) { addRow(i, indices.begin()[k], values.begin()[k]); }
+            }
+        }, right.Columns());
+
+        return product;
+    }
+
+    /// @brief Expands the Sparse Matrix into a Matrix, where every unstored element is the default value.
+    /// @return A Matrix consisting of all of the Sparse Matrix elements.
+    Matrix<T> ToMatrix() const
+    {
+        Matrix<T> matrix(rows, columns, T());
+        bool isRowMajor = format == SparseMatrixFormat::CompressedRows;
+
+        for (size_t major = 0; major + 1 < offsets.Length(); major++)
+        {
+            for (size_t k = offsets.begin()[major]; k < offsets.begin()[major + 1]; k++)
+            {
+                size_t row = isRowMajor ? major : indices.begin()[k], column = isRowMajor ? indices.begin()[k] : major;
+                matrix.begin()[row * columns + column] = values.begin()[k];
+            }
+        }
+
+        return matrix;
+    }
+
+    /// @brief Multiplies the Sparse Matrix by a vector.
+    /// @param vector The Array of the vector.
+    /// @return An Array of an element for each row.
+    Array<T> operator*(const Array<T> &vector) const noexcept(false) { return Multiply(ArrayView<T>(vector)); }
+
+    /// @brief Multiplies the Sparse Matrix by a dense Matrix.
+    /// @param right The Matrix that'll be multiplied from the right.
+    /// @return The Matrix resulting from the multiplication.
+    Matrix<T> operator*(const Matrix<T> &right) const noexcept(false) { return Multiply(right.View()); }
+
+    /// @brief Copies a Sparse Matrix into another.
+    /// @param reference The reference of the Sparse Matrix that'll be copied.
+    /// @return The result of the copying.
+    SparseMatrix<T> &operator=(const SparseMatrix<T> &reference) = default;
+
+    /// @brief Moves a Sparse Matrix into another, by taking over its elements.
+    /// @param reference The reference of the Sparse Matrix that'll be moved.
+    /// @return The result of the moving.
+    SparseMatrix<T> &operator=(SparseMatrix<T> &&reference) = default;
+
+private:
+    /// @brief Searches for an element within a row, (or column), by a binary search.
+    /// @param major The index of the row, (or column), that's searched.
+    /// @param minor The index of the element within the row, (or column).
+    /// @return The position of the element within the values, or -1 if it isn't stored.
+    size_t Locate(const size_t &major, const size_t &minor) const
+    {
+        size_t low = offsets.begin()[major], high = offsets.begin()[major + 1];
+        while (low < high)
+        {
+            size_t middle = low + (high - low) / 2;
+            if (indices.begin()[middle] < minor) { low = middle + 1; }
+            else { high = middle; }
+        }
+
+        return low < offsets.begin()[major + 1] && indices.begin()[low] == minor ? low : -1;
+    }
+
+    /// @brief Copies a row, (or column), that the elements are grouped by into a Sparse Array.
+    /// @param major The index of the row, (or column).
+    /// @param length The length of the Sparse Array.
+    /// @return A Sparse Array of the non-default elements.
+    SparseArray<T> Group(const size_t &major, const size_t &length) const
+    {
+        size_t begin = offsets.begin()[major], count = offsets.begin()[major + 1] - begin;
+
+        Array<KeyValuePair<size_t, T>> entries(count);
+        for (size_t k = 0; k < count; k++) { entries.begin()[k] = { indices.begin()[begin + k], values.begin()[begin + k] }; }
+
+        SparseArray<T> sparseArray(length);
+        sparseArray.Build(entries);
+        return sparseArray;
+    }
+
+    /// @brief Copies a row, (or column), across the groups of the elements into a Sparse Array.
+    /// @param minor The index of the row, (or column), within every group.
+    /// @param length The length of the Sparse Array.
+    /// @return A Sparse Array of the non-default elements.
+    SparseArray<T> Cross(const size_t &minor, const size_t &length) const
+    {
+        SparseArray<T> sparseArray(length);
+        for (size_t major = 0; major < length; major++)
+        {
+            size_t position = Locate(major, minor);
+            if (position != -1) { sparseArray.Set(values.begin()[position], major); }
+        }
+
+        return sparseArray;
+    }
+
+    /// @brief Regroups compressed elements by their indices, by counting the elements of each new group, and then
+    /// scattering the elements in the order of their old groups, so the new groups end up sorted.
+    /// @param groupCount The amount of old groups.
+    /// @param offsets A pointer to the old offsets.
+    /// @param indices A pointer to the old indices.
+    /// @param values A pointer to the old values.
+    /// @param regroupedOffsets The new offsets, which must already have an element for each new group and one more.
+    /// @param regroupedIndices The new indices, which hold the old groups of the elements.
+    /// @param regroupedValues The new values.
+    static void Regroup(const size_t &groupCount, const size_t* offsets, const size_t* indices, T* values,
+        Array<size_t> &regroupedOffsets, Array<size_t> &regroupedIndices, Array<T> &regroupedValues)
+    {
+        size_t count = offsets[groupCount];
+        std::fill(regroupedOffsets.begin(), regroupedOffsets.end(), 0);
+        for (size_t k = 0; k < count; k++) { regroupedOffsets.begin()[indices[k] + 1]++; }
+        for (size_t i = 1; i < regroupedOffsets.Length(); i++) { regroupedOffsets.begin()[i] += regroupedOffsets.begin()[i - 1]; }
+
+        regroupedIndices = Array<size_t>(count);
+        regroupedValues = Array<T>(count);
+        Array<size_t> cursors(regroupedOffsets);
+
+        for (size_t group = 0; group < groupCount; group++)
+        {
+            for (size_t k = offsets[group]; k < offsets[group + 1]; k++)
+            {
+                size_t position = cursors.begin()[indices[k]]++;
+                regroupedIndices.begin()[position] = group;
+                regroupedValues.begin()[position] = values[k];
+            }
+        }
+    }
+
+    /// @brief Runs a function over chunks of rows, that are split across the shared Thread Pool so each one has
+    /// about the same amount of elements, (if the policy isn't sequential, and there's enough work).
+    /// @tparam TBody The type of the function that runs a chunk.
+    /// @param policy The way the rows are processed.
+    /// @param body A function that takes the first row of a chunk and the row past its last one.
+    /// @param elementWork The amount of work each element takes.
+    template<typename TBody>
+    void RunRowChunks(const ExecutionPolicy &policy, const TBody &body, const size_t &elementWork = 1) const
+    {
+        size_t count = values.Length();
+        if (!IsParallel(policy, count * elementWork + rows)) { body(0, rows); return; }
+
+        size_t chunkCount = ThreadPool::Shared().ThreadCount() * ParallelChunks<T>::CHUNKS_PER_THREAD;
+        auto chunkBoundary = [&](const size_t &chunkIndex)
+        {
+            if (chunkIndex >= chunkCount) { return rows; }
+            // The first row whose elements start past the elements of the previous chunks.
+            return (size_t)(std::lower_bound(offsets.begin(), offsets.begin() + rows, count / chunkCount * chunkIndex) - offsets.begin());
+        };
+
+        ThreadPool::Shared().Run(chunkCount, [&](const size_t &chunkIndex)
+        {
+            size_t rowBegin = chunkBoundary(chunkIndex), rowEnd = chunkBoundary(chunkIndex + 1);
+            if (rowBegin < rowEnd) { body(rowBegin, rowEnd); }
+        });
+    }
+
+    /// @brief Checks whether or not a position is within the boundaries of the Sparse Matrix, if not,
+    /// it'll throw an "out of range" exception.
+    /// @param row The index of the row of the position.
+    /// @param column The index of the column of the position.
+    void ValidateBoundaries(const size_t &row, const size_t &column) const noexcept(false)
+    {
+        if (row < rows && column < columns) { return; }
+
+        throw std::out_of_range("The position (" + std::to_string(row) + ", " + std::to_string(column)
+            + ") is out of the range of the Sparse Matrix.");
+    }
+};
+
+/// @brief Collects the elements of a Sparse Matrix as unsorted coordinates, (COO), and compresses all of them
+/// at once by two counting sorts, which makes it much faster than setting them one by one.
+/// @tparam T The type of the data stored within the Sparse Matrix.
+template<typename T>
+class SparseMatrixBuilder
+{
+public:
+    /// @brief Creates a new Sparse Matrix Builder for a defined shape.
+    /// @param rows The amount of rows of the built Sparse Matrix.
+    /// @param columns The amount of columns of the built Sparse Matrix.
+    SparseMatrixBuilder(const size_t &rows, const size_t &columns) : rows(rows), columns(columns) { }
+
+    ~SparseMatrixBuilder() = default;
+
+private:
+    /// @brief The amount of rows of the built Sparse Matrix.
+    size_t rows;
+    /// @brief The amount of columns of the built Sparse Matrix.
+    size_t columns;
+    /// @brief The collected elements, in the order they've been added.
+    DynamicArray<SparseMatrixEntry<T>> entries;
+
+public:
+    /// @brief The amount of elements collected by the Sparse Matrix Builder, (including repeated positions).
+    /// @return The count of the Sparse Matrix Builder.
+    size_t Count() const { return entries.Count(); }
+
+    /// @brief Makes sure the Sparse Matrix Builder can collect a defined amount of elements without reallocating.
+    /// @param capacity The amount of elements the Sparse Matrix Builder will be able to collect.
+    void Reserve(const size_t &capacity) { entries.Reserve(capacity); }
+
+    /// @brief Adds an element to be built into the Sparse Matrix, (the values at a repeated position are summed up).
+    /// @param row The index of the row of the element.
+    /// @param column The index of the column of the element.
+    /// @param value The value of the element.
+    SparseMatrixBuilder<T> &Add(const size_t &row, const size_t &column, const T &value) noexcept(false)
+    {
+        if (row >= rows || column >= columns)
+        {
+            throw std::out_of_range("The position (" + std::to_string(row) + ", " + std::to_string(column)
+                + ") is out of the range of the Sparse Matrix.");
+        }
+
+        entries.Add({ row, column, value });
+        return *this;
+    }
+
+    /// @brief Compresses the collected elements into a Sparse Matrix, by grouping them by their minor indices
+    /// first, and then regrouping them by their major ones, so each group ends up sorted.
+    /// @param format The layout the elements are compressed by.
+    /// @return The built Sparse Matrix.
+    SparseMatrix<T> Build(const SparseMatrixFormat &format = SparseMatrixFormat::CompressedRows) const
+    {
+        bool isRowMajor = format == SparseMatrixFormat::CompressedRows;
+        size_t majorCount = isRowMajor ? rows : columns, minorCount = isRowMajor ? columns : rows, count = entries.Count();
+
+        Array<size_t> minorOffsets(minorCount + 1, (size_t)0), majorIndices(count);
+        Array<T> minorValues(count);
+        for (const SparseMatrixEntry<T> &entry : entries) { minorOffsets.begin()[(isRowMajor ? entry.Column : entry.Row) + 1]++; }
+        for (size_t i = 1; i <= minorCount; i++) { minorOffsets.begin()[i] += minorOffsets.begin()[i - 1]; }
+
+        Array<size_t> cursors(minorOffsets);
+        for (const SparseMatrixEntry<T> &entry : entries)
+        {
+            size_t position = cursors.begin()[isRowMajor ? entry.Column : entry.Row]++;
+            majorIndices.begin()[position] = isRowMajor ? entry.Row : entry.Column;
+            minorValues.begin()[position] = entry.Value;
+        }
+
+        SparseMatrix<T> sparseMatrix(rows, columns, format);
+        SparseMatrix<T>::Regroup(minorCount, minorOffsets.begin(), majorIndices.begin(), minorValues.begin(),
+            sparseMatrix.offsets, sparseMatrix.indices, sparseMatrix.values);
+
+        // The repeated positions are next to each other now, so they're summed up in one pass.
+        size_t* offsets = sparseMatrix.offsets.begin();
+        size_t* indices = sparseMatrix.indices.begin();
+        T* values = sparseMatrix.values.begin();
+        size_t actualCount = 0;
+
+        for (size_t major = 0, k = 0; major < majorCount; major++)
+        {
+            size_t groupEnd = offsets[major + 1];
+            offsets[major] = actualCount;
+
+            for (; k < groupEnd; k++)
+            {
+                if (actualCount > offsets[major] && indices[actualCount - 1] == indices[k]) { values[actualCount - 1] += values[k]; continue; }
+
+                indices[actualCount] = indices[k];
+                values[actualCount++] = values[k];
+            }
+        }
+
+        offsets[majorCount] = actualCount;
+        if (actualCount < count)
+        {
+            sparseMatrix.indices = sparseMatrix.indices.Resize(actualCount);
+            sparseMatrix.values = sparseMatrix.values.Resize(actualCount);
+        }
+
+        return sparseMatrix;
+    }
+};
+
+#endif
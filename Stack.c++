@@ -18,26 +18,34 @@ public:
     /// @brief Creates a new Stack with a defined capacity, to avoid copying the
     /// data if the initial capacity is known.
     /// @param capacity The amount of elements that'll be stored within the Stack.
-    /// @param capacityModifier The amount of increment the Stack capacity gets each time it runs
+    /// @param growthPolicy The way the Stack capacity grows each time it runs
     /// out of space to store more elements.
-    explicit Stack(const size_t &capacity, const size_t capacityModifier = DynamicArray<T>::INITIAL_CAPACITY)
-        : DynamicArray<T>(capacity, capacityModifier) { }
+    explicit Stack(const size_t &capacity, const GrowthPolicy &growthPolicy = GrowthPolicy())
+        : DynamicArray<T>(capacity, growthPolicy) { }
 
     /// @brief Creates a new Stack from a defined Array, and basically takes all of its data.
     /// @param array The Array that'll be used to create the Stack.
-    /// @param capacityModifier The amount of increment the Stack capacity gets each time it runs
+    /// @param growthPolicy The way the Stack capacity grows each time it runs
     /// out of space to store more elements.
-    Stack(const Array<T> &array, const size_t capacityModifier = DynamicArray<T>::INITIAL_CAPACITY)
-        : DynamicArray<T>(array, capacityModifier) { }
+    Stack(const Array<T> &array, const GrowthPolicy &growthPolicy = GrowthPolicy())
+        : DynamicArray<T>(array, growthPolicy) { }
 
     /// @brief Creates a new Stack with a defined elements count and initial values.
     /// @param length The amount of elements that'll be stored within the Stack initially.
     /// @param data A pointer to an array in memory, that has some values that'll be
     /// stored within the Stack initially.
-    /// @param capacityModifier The amount of increment the Stack capacity gets each time it runs
+    /// @param growthPolicy The way the Stack capacity grows each time it runs
     /// out of space to store more elements.
-    Stack(const size_t &length, T* data, const size_t capacityModifier = DynamicArray<T>::INITIAL_CAPACITY)
-        : DynamicArray<T>(length, data, capacityModifier) { }
+    Stack(const size_t &length, T* data, const GrowthPolicy &growthPolicy = GrowthPolicy())
+        : DynamicArray<T>(length, data, growthPolicy) { }
+
+    /// @brief Creates a new Stack by copying another Stack as reference.
+    /// @param reference The reference of the Stack that'll be copied.
+    Stack(const Stack<T> &reference) = default;
+
+    /// @brief Creates a new Stack by taking over the memory of another Stack, which is left empty.
+    /// @param reference The reference of the Stack that'll be moved.
+    Stack(Stack<T> &&reference) noexcept = default;
 
     ~Stack() = default;
 
@@ -47,16 +55,36 @@ public:
     size_t Capacity() const { return ((DynamicArray<T>*)this)->Capacity(); };
     /// @brief The amount of increment the Stack capacity gets each time it runs
     /// out of space to store more elements.
-    /// @return The capacity modifier of the Stack.
+    /// @return The capacity modifier of the Stack, or zero if it grows geometrically.
     size_t CapacityModifier() const { return ((DynamicArray<T>*)this)->CapacityModifier(); }
+    /// @brief The way the Stack capacity grows each time it runs
+    /// out of space to store more elements.
+    /// @return The Growth Policy of the Stack.
+    const GrowthPolicy &Growth() const { return ((DynamicArray<T>*)this)->Growth(); }
     /// @brief The amount of elements currently stored within the Stack.
     /// @return The elements count of the Stack.
     size_t Count() const { return ((DynamicArray<T>*)this)->Count(); }
+    /// @brief Takes a snapshot of the statistics of the Stack.
+    /// @return The Dynamic Array Stats of the Stack, (whose counters are zero unless the instrumentation is enabled).
+    DynamicArrayStats Stats() const { return ((DynamicArray<T>*)this)->Stats(); }
 
     /// @brief Indicates whether or not the Stack has currently no elements.
     /// @return A boolean representing whether or not the Stack is empty.
     bool IsEmpty() { return ((DynamicArray<T>*)this)->IsEmpty(); }
 
+    /// @brief Makes sure the Stack can hold a defined amount of elements without
+    /// running out of space, (it never shrinks the capacity).
+    /// @param capacity The amount of elements the Stack will be able to hold.
+    void Reserve(const size_t &capacity) { ((DynamicArray<T>*)this)->Reserve(capacity); }
+
+    /// @brief Shrinks the capacity of the Stack down to its elements count, to release
+    /// the unused memory.
+    void ShrinkToFit() { ((DynamicArray<T>*)this)->ShrinkToFit(); }
+
+    /// @brief Converts the Stack into an Array, where its first element is the one at the bottom of the Stack.
+    /// @return An Array consisting of all of the Stack elements.
+    Array<T> ToArray() const { return ((DynamicArray<T>*)this)->ToArray(); }
+
     /// @brief Retrieves the element that is on the top of the Stack, without removing it.
     /// @return The value of the element that is on the top of the Stack.
     T Top() { return *(this->end() - 1); }
@@ -66,8 +94,18 @@ public:
     T Bottom() { return *(this->begin()); }
     
     /// @brief Adds an element on the top of the Stack.
-    /// @param element The value of the element that'll be added on the top of the Stack.
-    void Push(T element) { this->Add(element); }
+    /// @param element The value of the element that'll be copied on the top of the Stack.
+    void Push(const T &element) { this->Add(element); }
+
+    /// @brief Adds an element on the top of the Stack.
+    /// @param element The value of the element that'll be moved on the top of the Stack.
+    void Push(T &&element) { this->Add(std::move(element)); }
+
+    /// @brief Constructs an element from a set of arguments, and adds it on the top of the Stack.
+    /// @tparam ...TArguments The types of the arguments given to the element constructor.
+    /// @param ...arguments The arguments that'll be forwarded to the element constructor.
+    template<typename... TArguments>
+    void Emplace(TArguments&&... arguments) { ((DynamicArray<T>*)this)->Emplace(std::forward<TArguments>(arguments)...); }
     
     /// @brief Adds an Array on the top of the Stack.
     /// @param array The Array that'll be added on the top of the Stack.
@@ -82,15 +120,20 @@ public:
     /// @return The value of the element that is on the top of the Stack.
     T Pop()
     {
-        T lastElement = Top();
+        T lastElement = std::move(*(this->end() - 1));
         this->RemoveAt(this->count - 1);
         return lastElement;
     }
     
     /// @brief Adds an element on the top of the Stack.
-    /// @param element The value of the element that'll be added on the top of the Stack.
+    /// @param element The value of the element that'll be copied on the top of the Stack.
+    /// @return The reference of the Stack after adding the element value to it.
+    Stack<T> &operator<<(const T &element) { Push(element); return *this; }
+
+    /// @brief Adds an element on the top of the Stack.
+    /// @param element The value of the element that'll be moved on the top of the Stack.
     /// @return The reference of the Stack after adding the element value to it.
-    Stack<T> &operator<<(T element) { Push(element); return *this; }
+    Stack<T> &operator<<(T &&element) { Push(std::move(element)); return *this; }
     
     /// @brief Adds an Array on the top of the Stack.
     /// @param array The Array that'll be added on the top of the Stack.
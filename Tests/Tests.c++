@@ -0,0 +1,1040 @@
+#include<iostream>
+
+#include<algorithm>
+#include<atomic>
+#include<cmath>
+#include<cstddef>
+#include<cstdint>
+#include<cstdio>
+#include<fstream>
+#include<functional>
+#include<iterator>
+#include<list>
+#include<limits>
+#include<map>
+#include<queue>
+#include<random>
+#include<set>
+#include<stdexcept>
+#include<string>
+#include<thread>
+#include<unordered_map>
+#include<utility>
+#include<vector>
+
+#include "../Algorithms/Sorting.c++"
+#include "../Array.c++"
+#include "../BloomFilter.c++"
+#include "../ConcurrentHashTable.c++"
+#include "../ConcurrentQueue.c++"
+#include "../FlatHashTable.c++"
+#include "../HashTable.c++"
+#include "../LruCache.c++"
+#include "../MappedArray.c++"
+#include "../Matrix.c++"
+#include "../PriorityQueue.c++"
+#include "../SortedMap.c++"
+#include "../SortedSet.c++"
+#include "../WorkStealingDeque.c++"
+
+/// @brief A test of a behaviour of a container, that throws if the behaviour doesn't hold.
+struct Test
+{
+    /// @brief The name of the tested behaviour.
+    std::string Name;
+    /// @brief A function that runs the test.
+    std::function<void()> Run;
+};
+
+/// @brief Checks a condition of a test, if it doesn't hold, it'll throw a "logic error" exception.
+/// @param condition The checked condition.
+/// @param description The description of the condition.
+void Check(const bool &condition, const std::string &description) noexcept(false)
+{ if (!condition) { throw std::logic_error("The check \"" + description + "\" has failed."); } }
+
+/// @brief Checks that running a function throws an exception of a type, if it doesn't, it'll throw
+/// a "logic error" exception.
+/// @tparam TException The type of the expected exception.
+/// @tparam TBody The type of the function.
+/// @param body The function that's expected to throw.
+/// @param description The description of the expected exception.
+template<typename TException, typename TBody>
+void CheckThrows(const TBody &body, const std::string &description) noexcept(false)
+{
+    try { body(); }
+    catch (const TException &) { return; }
+
+    throw std::logic_error("The check \"" + description + "\" hasn't thrown.");
+}
+
+/// @brief A hasher that sends the keys into only a few probing groups, while keeping their fingerprints apart,
+/// so the groups fill up and the probing sequences get long.
+struct CollidingHasher
+{
+    /// @brief Hashes a key into one of eight groups.
+    /// @param key The key that'll be hashed.
+    /// @param seed The seed of the hashing, (which is ignored).
+    /// @return The hashing value of the key.
+    size_t operator()(const long &key, const size_t &seed = 0) const { (void)seed; return (size_t)(key % 8) << 7 | (size_t)(key & 0x7F); }
+};
+
+/// @brief Pushes and pops elements from several threads through a concurrent Queue, and checks that every pushed element
+/// is popped exactly once, and that each consumer pops the elements of each producer in the order they were pushed.
+/// @tparam TQueue The type of the Queue.
+/// @param queue The reference of the Queue, (which must be empty).
+/// @param producerCount The amount of the threads that push the elements.
+/// @param consumerCount The amount of the threads that pop the elements.
+template<typename TQueue>
+void CheckConcurrentQueue(TQueue &queue, const size_t &producerCount, const size_t &consumerCount) noexcept(false)
+{
+    const size_t elementCount = 100000, totalCount = producerCount * elementCount;
+    std::atomic<size_t> poppedCount(0);
+    std::vector<std::vector<long>> popped(consumerCount);
+    std::vector<std::thread> threads;
+
+    for (size_t producer = 0; producer < producerCount; producer++)
+    {
+        threads.emplace_back([&, producer]()
+        {
+            // The values of each producer are its own range, so their order can be checked once popped.
+            long firstValue = (long)(producer * elementCount) + 1;
+            Array<long> range(elementCount / 2);
+            for (size_t i = 0; i < range.Length(); i++) { range.begin()[i] = firstValue + (long)i; }
+
+            queue.PushRange(range);
+            for (size_t i = range.Length(); i < elementCount; i++) { queue.Push(firstValue + (long)i); }
+        });
+    }
+    for (size_t consumer = 0; consumer < consumerCount; consumer++)
+    {
+        threads.emplace_back([&, consumer]()
+        {
+            long element = 0;
+            while (poppedCount.load(std::memory_order_relaxed) < totalCount)
+            {
+                if (!queue.TryPop(element)) { std::this_thread::yield(); continue; }
+
+                popped[consumer].push_back(element);
+                poppedCount.fetch_add(1, std::memory_order_relaxed);
+            }
+        });
+    }
+    for (std::thread &thread : threads) { thread.join(); }
+
+    std::vector<long> allPopped;
+    for (const std::vector<long> &consumerPopped : popped)
+    {
+        std::vector<long> lastValues(producerCount, 0);
+        for (const long &element : consumerPopped)
+        {
+            size_t producer = (size_t)(element - 1) / elementCount;
+            Check(lastValues[producer] < element, "the elements of a producer are popped in order");
+            lastValues[producer] = element;
+        }
+        allPopped.insert(allPopped.end(), consumerPopped.begin(), consumerPopped.end());
+    }
+
+    long sum = 0;
+    for (const long &element : allPopped) { sum += element; }
+    Check(sum == (long)totalCount * ((long)totalCount + 1) / 2, "the popped elements sum up to the pushed ones");
+
+    std::sort(allPopped.begin(), allPopped.end());
+    bool isEachPoppedOnce = allPopped.size() == totalCount;
+    for (size_t i = 0; isEachPoppedOnce && i < totalCount; i++) { isEachPoppedOnce = allPopped[i] == (long)i + 1; }
+    Check(isEachPoppedOnce, "every element is popped exactly once");
+
+    long element = 0;
+    Check(!queue.TryPop(element), "the drained queue is empty");
+}
+
+/// @brief Sorts copies of a range by every Sorting Algorithm, and checks them against an "std::sort" of the range.
+/// @tparam T The type of the elements.
+/// @param elements The elements that'll be sorted.
+/// @param description The description of the elements.
+template<typename T>
+void CheckSortingAlgorithms(const std::vector<T> &elements, const std::string &description) noexcept(false)
+{
+    std::vector<T> expected(elements), sorted;
+    std::sort(expected.begin(), expected.end());
+
+    for (const SortingAlgorithm &algorithm : { SortingAlgorithm::Automatic, SortingAlgorithm::IntroSort,
+        SortingAlgorithm::MergeSort, SortingAlgorithm::RadixSort, SortingAlgorithm::ParallelMergeSort })
+    {
+        sorted = elements;
+        SortRange(sorted.data(), sorted.data() + sorted.size(), algorithm);
+        Check(sorted == expected, "sorting " + description + " by the algorithm " + std::to_string((int)algorithm));
+    }
+
+    // An odd amount of threads leaves a chunk without a pair to merge with.
+    sorted = elements;
+    ParallelMergeSort(sorted.data(), sorted.data() + sorted.size(), std::less<T>(), 3);
+    Check(sorted == expected, "sorting " + description + " across three threads");
+
+    std::reverse(expected.begin(), expected.end());
+    sorted = elements;
+    IntroSort(sorted.data(), sorted.data() + sorted.size(), std::greater<T>());
+    Check(sorted == expected, "sorting " + description + " in a descending order");
+}
+
+/// @brief Makes several kinds of ranges of a type, and checks every Sorting Algorithm against them.
+/// @tparam T The type of the elements.
+/// @tparam TRandom The function object that makes a random element.
+/// @param random The function object that makes a random element, (which is negative about half of the times
+/// for the signed and floating point types).
+template<typename T, typename TRandom>
+void CheckSortingAlgorithms(const TRandom &random) noexcept(false)
+{
+    for (const size_t &length : { (size_t)0, (size_t)1, INSERTION_SORTING_THRESHOLD + 1, RADIX_SORTING_THRESHOLD + 44,
+        (size_t)5000, PARALLEL_SORTING_THRESHOLD * 2 + 7 })
+    {
+        std::vector<T> elements(length);
+        for (T &element : elements) { element = random(); }
+        CheckSortingAlgorithms(elements, std::to_string(length) + " random elements");
+
+        // The values share their high digits, so the Radix Sort skips the passes over them.
+        for (T &element : elements) { element = (T)(100 + std::fmod(std::abs((double)random()), 20.0)); }
+        CheckSortingAlgorithms(elements, std::to_string(length) + " narrow elements");
+
+        if constexpr (std::is_signed_v<T>)
+        {
+            for (T &element : elements) { element = (T)-std::abs((double)random()); }
+            CheckSortingAlgorithms(elements, std::to_string(length) + " negative elements");
+        }
+
+        std::fill(elements.begin(), elements.end(), random());
+        CheckSortingAlgorithms(elements, std::to_string(length) + " equal elements");
+
+        for (T &element : elements) { element = random(); }
+        std::sort(elements.begin(), elements.end());
+        CheckSortingAlgorithms(elements, std::to_string(length) + " sorted elements");
+
+        std::reverse(elements.begin(), elements.end());
+        CheckSortingAlgorithms(elements, std::to_string(length) + " reversed elements");
+    }
+}
+
+/// @brief Checks that an ordered data structure walks through the same elements as its reference, both forwards
+/// and backwards.
+/// @tparam TSorted The type of the ordered data structure.
+/// @tparam TReference The type of the reference, (an "std::set" or an "std::map").
+/// @tparam TEqual The function object that compares an element of each one.
+/// @param sorted The reference of the ordered data structure.
+/// @param reference The reference of the reference.
+/// @param isEqual The function object that compares an element of each one.
+/// @param description The description of the ordered data structure.
+template<typename TSorted, typename TReference, typename TEqual>
+void CheckSortedElements(const TSorted &sorted, const TReference &reference, const TEqual &isEqual,
+    const std::string &description) noexcept(false)
+{
+    Check(sorted.Count() == reference.size() && sorted.IsEmpty() == reference.empty(), "the count of " + description);
+    Check(std::equal(sorted.begin(), sorted.end(), reference.begin(), reference.end(), isEqual),
+        "walking through " + description);
+    Check(std::equal(std::make_reverse_iterator(sorted.end()), std::make_reverse_iterator(sorted.begin()),
+        reference.rbegin(), reference.rend(), isEqual), "walking backwards through " + description);
+}
+
+/// @brief Checks the bounds, the searches and the ranges of an ordered data structure against its reference,
+/// at random elements.
+/// @tparam TSorted The type of the ordered data structure.
+/// @tparam TReference The type of the reference, (an "std::set" or an "std::map").
+/// @tparam TEqual The function object that compares an element of each one.
+/// @tparam TMakeKey The function object that makes a key out of an index.
+/// @param sorted The reference of the ordered data structure.
+/// @param reference The reference of the reference.
+/// @param isEqual The function object that compares an element of each one.
+/// @param random The random generator of the searched indices.
+/// @param indexCount The amount of the indices the keys are made out of.
+/// @param makeKey The function object that makes a key out of an index.
+template<typename TSorted, typename TReference, typename TEqual, typename TMakeKey>
+void CheckSortedSearches(const TSorted &sorted, const TReference &reference, const TEqual &isEqual,
+    std::mt19937_64 &random, const size_t &indexCount, const TMakeKey &makeKey) noexcept(false)
+{
+    auto isSame = [&](const auto &iterator, const auto &referenceIterator)
+    {
+        if (referenceIterator == reference.end()) { return iterator == sorted.end(); }
+        return iterator != sorted.end() && isEqual(*iterator, *referenceIterator);
+    };
+
+    for (size_t i = 0; i < 64; i++)
+    {
+        // The indices go a bit past the stored ones, so the searches also fall before and after every key.
+        auto key = makeKey(random() % (indexCount + 2));
+        Check(isSame(sorted.LowerBound(key), reference.lower_bound(key)), "the lower bound of a key");
+        Check(isSame(sorted.UpperBound(key), reference.upper_bound(key)), "the upper bound of a key");
+        Check(isSame(sorted.Find(key), reference.find(key)), "finding a key");
+
+        auto high = makeKey(random() % (indexCount + 2));
+        auto range = sorted.Range(key, high);
+        if (!reference.key_comp()(key, high)) { Check(range.begin() == range.end(), "an empty range"); }
+        else
+        {
+            Check(std::equal(range.begin(), range.end(), reference.lower_bound(key), reference.lower_bound(high), isEqual),
+                "the keys within a range");
+        }
+    }
+}
+
+/// @brief Bulk loads a Sorted Set, adds and removes random elements, copies it, and then removes all of its
+/// elements, while checking it against an "std::set", (the removals empty its Nodes, so they borrow from and
+/// merge with their siblings).
+/// @tparam T The type of the elements.
+/// @tparam TComparer The type of the comparer that orders the elements.
+/// @tparam TMakeElement The function object that makes an element out of an index.
+/// @param random The random generator of the elements.
+/// @param size The amount of the bulk loaded elements, (some of them are repeated).
+/// @param makeElement The function object that makes an element out of an index, (distinct indices must make
+/// distinct elements).
+template<typename T, typename TComparer, typename TMakeElement>
+void CheckSortedSet(std::mt19937_64 &random, const size_t &size, const TMakeElement &makeElement) noexcept(false)
+{
+    const size_t indexCount = 2 * size;
+    auto isEqual = [](const T &element, const T &referenceElement) { return element == referenceElement; };
+
+    std::vector<T> loaded;
+    for (size_t i = 0; i < size; i++) { loaded.push_back(makeElement(random() % indexCount)); }
+    std::sort(loaded.begin(), loaded.end(), TComparer());
+
+    std::set<T, TComparer> reference(loaded.begin(), loaded.end());
+    SortedSet<T, TComparer> set(Array<T>(loaded.size(), loaded.data()));
+    CheckSortedElements(set, reference, isEqual, "a bulk loaded set");
+    CheckSortedSearches(set, reference, isEqual, random, indexCount, makeElement);
+
+    std::reverse(loaded.begin(), loaded.end());
+    CheckThrows<std::logic_error>([&]() { SortedSet<T, TComparer> unsorted(Array<T>(loaded.size(), loaded.data())); },
+        "bulk loading unsorted elements");
+
+    for (size_t i = 0; i < 4 * size; i++)
+    {
+        T element = makeElement(random() % indexCount);
+        switch (random() % 3)
+        {
+            case 0: Check(set.Add(element) == reference.insert(element).second, "adding an element"); break;
+            case 1: Check(set.Remove(element) == (reference.erase(element) > 0), "removing an element"); break;
+            default: Check(set.Contains(element) == (reference.count(element) > 0), "checking for an element"); break;
+        }
+
+        if (i % size == 0)
+        {
+            CheckSortedElements(set, reference, isEqual, "a changed set");
+            CheckSortedSearches(set, reference, isEqual, random, indexCount, makeElement);
+        }
+    }
+
+    SortedSet<T, TComparer> copy(set), assigned;
+    assigned = copy;
+    std::set<T, TComparer> copiedReference(reference);
+
+    std::vector<T> elements(reference.begin(), reference.end());
+    std::shuffle(elements.begin(), elements.end(), random);
+    for (size_t i = 0; i < elements.size(); i++)
+    {
+        Check(set.Remove(elements[i]) && reference.erase(elements[i]), "removing every element");
+        if (i % (size / 4) == 0) { CheckSortedElements(set, reference, isEqual, "a shrinking set"); }
+    }
+    Check(set.IsEmpty() && set.Height() == 0 && set.begin() == set.end(), "the emptied set");
+
+    CheckSortedElements(copy, copiedReference, isEqual, "a copied set");
+    CheckSortedSearches(copy, copiedReference, isEqual, random, indexCount, makeElement);
+    CheckSortedElements(assigned, copiedReference, isEqual, "an assigned set");
+
+    for (const T &element : elements) { set << element; }
+    CheckSortedElements(set, copiedReference, isEqual, "a refilled set");
+}
+
+/// @brief Bulk loads a Sorted Map, sets and erases random keys, copies it, and then erases all of its keys,
+/// while checking it against an "std::map", (the erasures empty its Nodes, so they borrow from and merge with
+/// their siblings).
+/// @tparam TKey The type of the keys.
+/// @tparam TComparer The type of the comparer that orders the keys.
+/// @tparam TMakeKey The function object that makes a key out of an index.
+/// @param random The random generator of the keys and the values.
+/// @param size The amount of the bulk loaded pairs, (some of their keys are repeated).
+/// @param makeKey The function object that makes a key out of an index, (distinct indices must make
+/// distinct keys).
+template<typename TKey, typename TComparer, typename TMakeKey>
+void CheckSortedMap(std::mt19937_64 &random, const size_t &size, const TMakeKey &makeKey) noexcept(false)
+{
+    const size_t indexCount = 2 * size;
+    auto isEqual = [](const KeyValueReference<TKey, long> &pair, const std::pair<const TKey, long> &referencePair)
+    { return pair.Key == referencePair.first && pair.Value == referencePair.second; };
+
+    std::vector<KeyValuePair<TKey, long>> loaded;
+    for (size_t i = 0; i < size; i++) { loaded.push_back({ makeKey(random() % indexCount), (long)random() }); }
+    std::stable_sort(loaded.begin(), loaded.end(), [](const KeyValuePair<TKey, long> &pair, const KeyValuePair<TKey, long> &other)
+    { return TComparer()(pair.Key, other.Key); });
+
+    // Both keep the first pair of every repeated key.
+    std::map<TKey, long, TComparer> reference;
+    for (const KeyValuePair<TKey, long> &pair : loaded) { reference.insert({ pair.Key, pair.Value }); }
+    SortedMap<TKey, long, TComparer> map(Array<KeyValuePair<TKey, long>>(loaded.size(), loaded.data()));
+    CheckSortedElements(map, reference, isEqual, "a bulk loaded map");
+    CheckSortedSearches(map, reference, isEqual, random, indexCount, makeKey);
+
+    std::reverse(loaded.begin(), loaded.end());
+    CheckThrows<std::logic_error>([&]()
+    { SortedMap<TKey, long, TComparer> unsorted(Array<KeyValuePair<TKey, long>>(loaded.size(), loaded.data())); },
+        "bulk loading unsorted pairs");
+
+    for (size_t i = 0; i < 4 * size; i++)
+    {
+        TKey key = makeKey(random() % indexCount);
+        long value = (long)random(), foundValue = 0;
+        switch (random() % 4)
+        {
+            case 0: map.Set(key, value); reference[key] = value; break;
+            case 1: Check(map.Erase(key) == (reference.erase(key) > 0), "erasing a key"); break;
+            case 2:
+            {
+                auto iterator = map.Find(key);
+                Check((iterator != map.end()) == (reference.count(key) > 0), "finding the Iterator at a key");
+                if (iterator != map.end()) { iterator.Value() = value; reference[key] = value; }
+                break;
+            }
+            default:
+            {
+                auto found = reference.find(key);
+                bool isFound = found != reference.end();
+                Check(map.Has(key) == isFound && map.TryGet(key, foundValue) == isFound, "checking for a key");
+                Check(!isFound || (map.Get(key) == found->second && map[key] == found->second && *map.FindValue(key) == found->second &&
+                    foundValue == found->second), "getting the value of a key");
+                if (!isFound)
+                {
+                    Check(!map.FindValue(key), "finding the value of a missing key");
+                    CheckThrows<std::out_of_range>([&]() { map.Get(key); }, "getting a missing key");
+                }
+                break;
+            }
+        }
+
+        if (i % size == 0)
+        {
+            CheckSortedElements(map, reference, isEqual, "a changed map");
+            CheckSortedSearches(map, reference, isEqual, random, indexCount, makeKey);
+        }
+    }
+
+    SortedMap<TKey, long, TComparer> copy(map);
+    std::map<TKey, long, TComparer> copiedReference(reference);
+
+    std::vector<TKey> keys;
+    for (const auto &pair : reference) { keys.push_back(pair.first); }
+    std::shuffle(keys.begin(), keys.end(), random);
+    for (size_t i = 0; i < keys.size(); i++)
+    {
+        Check(map.Erase(keys[i]) && reference.erase(keys[i]), "erasing every key");
+        if (i % (size / 4) == 0) { CheckSortedElements(map, reference, isEqual, "a shrinking map"); }
+    }
+    Check(map.IsEmpty() && map.Height() == 0 && map.begin() == map.end(), "the emptied map");
+
+    CheckSortedElements(copy, copiedReference, isEqual, "a copied map");
+    CheckSortedSearches(copy, copiedReference, isEqual, random, indexCount, makeKey);
+}
+
+/// @brief Makes all of the tests, one for each tested behaviour.
+/// @return A vector of the tests.
+std::vector<Test> MakeTests()
+{
+    std::vector<Test> tests;
+
+    tests.push_back({ "BloomFilter::EstimatedFalsePositiveRate", []()
+    {
+        const size_t count = 20000;
+        std::mt19937_64 random(29);
+
+        // The probes are enough to expect a couple hundred false positives, which keeps the measured rate within
+        // a few percent, while the fraction of the set bits over the whole filter is several times too low at the lower rates.
+        for (const double &falsePositiveRate : { 1e-2, 1e-3, 1e-4 })
+        {
+            BloomFilter<uint64_t> filter(count, falsePositiveRate);
+            for (size_t i = 0; i < count; i++) { filter.Add(random()); }
+
+            const size_t probeCount = (size_t)(200 / falsePositiveRate);
+            size_t falsePositiveCount = 0;
+            for (size_t i = 0; i < probeCount; i++) { falsePositiveCount += filter.MayContain(random()); }
+
+            double measuredRate = falsePositiveCount / (double)probeCount;
+            double estimatedRate = filter.EstimatedFalsePositiveRate();
+            Check(std::abs(estimatedRate - measuredRate) <= 0.25 * measuredRate, "the estimated rate is near the measured rate");
+        }
+
+        HashTable<long, long> table;
+        table.EnableFilter(1e-3);
+        for (long i = 0; i < (long)count; i++) { table.Set(i, i); }
+        for (long i = count; i < 201 * (long)count; i++) { Check(!table.Has(i), "a missing key isn't found"); }
+
+        HashTableStats stats = table.Stats();
+        if (IS_INSTRUMENTED)
+        {
+            Check(std::abs(stats.EstimatedFilterFalsePositiveRate - stats.FilterFalsePositiveRate()) <=
+                0.25 * stats.FilterFalsePositiveRate(), "the table's estimated rate is near its measured rate");
+        }
+        else
+        {
+            Check(stats.EstimatedFilterFalsePositiveRate > 0 && stats.EstimatedFilterFalsePositiveRate < 1e-2,
+                "the table's estimated rate is sized");
+        }
+    } });
+
+    tests.push_back({ "ConcurrentHashTable::ConcurrentUpdates", []()
+    {
+        const size_t threadCount = 8, roundCount = 200;
+        const long keyCount = 512;
+        ConcurrentHashTable<long, long> table;
+        std::vector<std::atomic<size_t>> setCounts(keyCount);
+        std::atomic<size_t> mismatchCount(0), erasedCount(0);
+
+        auto runThreads = [&](const auto &body)
+        {
+            std::vector<std::thread> threads;
+            for (size_t thread = 0; thread < threadCount; thread++) { threads.emplace_back([&, thread]() { body(thread); }); }
+            for (std::thread &thread : threads) { thread.join(); }
+        };
+
+        // Every thread races to set the keys with a value of its own, and all of them get the value that won.
+        std::vector<long> gotValues(threadCount * keyCount);
+        runThreads([&](const size_t &thread)
+        { for (long key = 0; key < keyCount; key++) { gotValues[thread * keyCount + key] = table.GetOrSet(key, key * 100 + (long)thread); } });
+
+        Check(table.Count() == (size_t)keyCount, "the raced keys are set once");
+        std::vector<long> initialValues(keyCount);
+        for (long key = 0; key < keyCount; key++)
+        {
+            initialValues[key] = table.Get(key);
+            Check(initialValues[key] / 100 == key, "one of the racing values is set");
+            for (size_t thread = 0; thread < threadCount; thread++)
+            { Check(gotValues[thread * keyCount + key] == initialValues[key], "every racing thread gets the set value"); }
+        }
+
+        runThreads([&](const size_t &)
+        {
+            for (size_t round = 0; round < roundCount; round++)
+            {
+                for (long key = 0; key < keyCount; key++)
+                {
+                    if (!table.Update(key, [](long &value) { value += 100; })) { mismatchCount++; }
+                    if (table.SetOrUpdate(keyCount + key, 1, [](long &value) { value++; })) { setCounts[key]++; }
+
+                    long value = 0;
+                    if (!table.TryGet(key, value) || value % 100 != initialValues[key] % 100) { mismatchCount++; }
+                }
+            }
+        });
+        Check(!mismatchCount, "every updated key is found");
+
+        for (long key = 0; key < keyCount; key++)
+        {
+            Check(table.Get(key) == initialValues[key] + (long)(threadCount * roundCount * 100), "every update is applied");
+            Check(setCounts[key] == 1 && table.Get(keyCount + key) == (long)(threadCount * roundCount), "every key is set once, then updated");
+        }
+
+        runThreads([&](const size_t &) { for (long key = 0; key < 2 * keyCount; key++) { if (table.Erase(key)) { erasedCount++; } } });
+        Check(erasedCount == 2 * (size_t)keyCount && table.Count() == 0, "every key is erased once");
+    } });
+
+    tests.push_back({ "ConcurrentQueue::ProducersAndConsumers", []()
+    {
+        // The small capacities make the rings wrap around, and the producers wait for free space.
+        SpscQueue<long> spscQueue(64);
+        CheckConcurrentQueue(spscQueue, 1, 1);
+
+        MpmcQueue<long> mpmcQueue(64);
+        CheckConcurrentQueue(mpmcQueue, 4, 4);
+
+        ConcurrentLinkedQueue<long> linkedQueue;
+        CheckConcurrentQueue(linkedQueue, 4, 4);
+    } });
+
+    tests.push_back({ "FlatHashTable::RandomOperations", []()
+    {
+        std::mt19937_64 random(5);
+
+        auto run = [&](auto table)
+        {
+            std::unordered_map<long, long> expected;
+            for (size_t i = 0; i < 200000; i++)
+            {
+                long key = (long)(random() % 3000), value = (long)random();
+                switch (random() % 8)
+                {
+                case 0: case 1: case 2: table.Set(key, value); expected[key] = value; break;
+                case 3: case 4: Check(table.Erase(key) == (expected.erase(key) == 1), "erasing a key"); break;
+                case 5:
+                {
+                    long foundValue = 0;
+                    bool isFound = table.TryGet(key, foundValue);
+                    Check(isFound == expected.count(key) && (!isFound || foundValue == expected[key]), "getting a key");
+                    break;
+                }
+                case 6: Check(table.Has(key) == (expected.count(key) == 1), "checking a key"); break;
+                default:
+                    if (random() % 1000 == 0) { table.Clear(); expected.clear(); }
+                    else if (random() % 100 == 0) { table.Rehash(random() % 4000); }
+                    break;
+                }
+
+                Check(table.Count() == expected.size(), "counting the pairs");
+            }
+
+            size_t iteratedCount = 0;
+            for (const auto &pair : table) { Check(expected.at(pair.Key) == pair.Value, "iterating the pairs"); iteratedCount++; }
+            Check(iteratedCount == expected.size(), "iterating every pair");
+
+            // The erased slots are reused, so the table doesn't outgrow the keys it has ever held at once.
+            Check(table.Capacity() <= 8192, "reusing the erased slots");
+        };
+
+        run(FlatHashTable<long, long>());
+        run(FlatHashTable<long, long, CollidingHasher>());
+    } });
+
+    tests.push_back({ "HashTable::ConcurrentReaders", []()
+    {
+        HashTable<long, long> table;
+        table.EnableFilter();
+        for (long i = 0; i < 1000; i++) { table.Set(i, i); }
+
+        // The lookups are read-only, so they may share the table, even while the instrumentation counts them.
+        const HashTable<long, long> &sharedTable = table;
+        std::vector<std::thread> readers;
+        std::vector<char> isCorrect(4, 0);
+        for (size_t reader = 0; reader < isCorrect.size(); reader++)
+        {
+            readers.emplace_back([&, reader]()
+            {
+                bool isReaderCorrect = true;
+                for (long i = 0; i < 2000; i++)
+                {
+                    isReaderCorrect &= (i < 1000) == sharedTable.Has(i);
+                    if (i < 1000) { isReaderCorrect &= sharedTable.Get(i) == i && sharedTable[i] == i; }
+                }
+
+                Array<bool> isFound;
+                sharedTable.HasMany(Array<long>(10, 999L), isFound);
+                isCorrect[reader] = isReaderCorrect && isFound.begin()[9];
+            });
+        }
+        for (std::thread &reader : readers) { reader.join(); }
+
+        for (const char &isReaderCorrect : isCorrect) { Check(isReaderCorrect, "the concurrent lookups are found"); }
+        if (IS_INSTRUMENTED) { Check(table.Stats().LookupCount >= isCorrect.size() * 4000, "every concurrent lookup is counted"); }
+    } });
+
+    tests.push_back({ "HashTable::UseAfterMove", []()
+    {
+        for (const RehashingMode &mode : { RehashingMode::Immediate, RehashingMode::Incremental })
+        {
+            HashTable<long, long> table(1, HashTable<long, long>::INITIAL_THRESHOLD, GrowthPolicy(), Hasher<long>(), 0, mode);
+            table.EnableFilter();
+            for (long i = 0; i < 100; i++) { table.Set(i, i); }
+
+            // The moved table may be in the middle of an incremental rehashing, which mustn't be carried along.
+            HashTable<long, long> movedTable(std::move(table)), assignedTable;
+            Check(movedTable.Count() == 100 && movedTable.Get(99) == 99, "the moved pairs are kept");
+
+            for (HashTable<long, long>* emptyTable : { &table, &movedTable })
+            {
+                if (emptyTable == &movedTable) { assignedTable = std::move(movedTable); }
+
+                Check(emptyTable->Count() == 0 && !emptyTable->Has(1) && emptyTable->LoadFactor() == 0, "a moved table is empty");
+                CheckThrows<std::out_of_range>([&]() { emptyTable->Get(1); }, "getting from a moved table");
+
+                Array<bool> isFound;
+                emptyTable->HasMany(Array<long>(3, 1L), isFound);
+                Check(!isFound.begin()[0] && !isFound.begin()[2], "checking a batch within a moved table");
+
+                emptyTable->Set(5, 50);
+                emptyTable->SetMany(Array<long>(1, 6L), Array<long>(1, 60L));
+                Check(emptyTable->Count() == 2 && emptyTable->Get(5) == 50 && emptyTable->Get(6) == 60, "setting within a moved table");
+            }
+
+            Check(assignedTable.Count() == 100 && assignedTable.Get(42) == 42, "the assigned pairs are kept");
+        }
+    } });
+
+    tests.push_back({ "LruCache::AgainstReferenceModel", []()
+    {
+        std::mt19937_64 random(25);
+        std::vector<long> evictedKeys;
+        LruCache<long, std::string> cache(64, [&](const long &key, const std::string &) { evictedKeys.push_back(key); });
+
+        // The most recently used keys are at the front of the model list.
+        std::list<long> recency;
+        std::unordered_map<long, std::string> values;
+        std::vector<long> expectedEvictedKeys;
+
+        for (size_t i = 0; i < 100000; i++)
+        {
+            long key = (long)(random() % 200);
+            std::string value;
+            switch (random() % 4)
+            {
+            case 0: case 1:
+                value = std::to_string(random());
+                cache.Put(key, value);
+
+                if (values.count(key)) { recency.remove(key); }
+                recency.push_front(key);
+                values[key] = value;
+                if (recency.size() > 64)
+                {
+                    expectedEvictedKeys.push_back(recency.back());
+                    values.erase(recency.back());
+                    recency.pop_back();
+                }
+                break;
+            case 2:
+                Check(cache.TryGet(key, value) == (values.count(key) == 1) && (!values.count(key) || value == values[key]), "getting a key");
+                if (values.count(key)) { recency.remove(key); recency.push_front(key); }
+                break;
+            default:
+                Check(cache.Erase(key) == (values.erase(key) == 1), "erasing a key");
+                recency.remove(key);
+                break;
+            }
+
+            Check(cache.Count() == values.size(), "counting the entries");
+        }
+
+        Check(evictedKeys == expectedEvictedKeys, "evicting the least recently used entries");
+    } });
+
+    tests.push_back({ "PriorityQueue::AgainstStdPriorityQueue", []()
+    {
+        std::mt19937_64 random(28);
+        Array<long> initialElements(1000);
+        for (long &element : initialElements) { element = (long)(random() % 5000); }
+
+        // The queue starts heapified from an Array, and then the ranges either sift up or heapify again.
+        PriorityQueue<long> queue(initialElements);
+        std::priority_queue<long, std::vector<long>, std::greater<long>> expected(initialElements.begin(), initialElements.end());
+
+        for (size_t i = 0; i < 20000; i++)
+        {
+            switch (random() % 5)
+            {
+            case 0: case 1:
+            {
+                long element = (long)(random() % 5000);
+                queue.Push(element);
+                expected.push(element);
+                break;
+            }
+            case 2:
+            {
+                // The ranges are either short, or at least as long as the queue.
+                Array<long> range(random() % 2 ? random() % 8 : expected.size() + random() % 8);
+                for (long &element : range) { element = (long)(random() % 5000); expected.push(element); }
+                queue.PushRange(range);
+                break;
+            }
+            case 3:
+                if (expected.empty()) { CheckThrows<std::out_of_range>([&]() { queue.Pop(); }, "popping an empty queue"); break; }
+                Check(queue.Pop() == expected.top(), "popping the first element");
+                expected.pop();
+                break;
+            default:
+            {
+                Array<long> popped = queue.PopRange(std::min((size_t)(random() % 16), expected.size()));
+                for (const long &element : popped) { Check(element == expected.top(), "popping a range in order"); expected.pop(); }
+                break;
+            }
+            }
+
+            Check(queue.Count() == expected.size() && (expected.empty() || queue.Top() == expected.top()), "the top element");
+            if (queue.Count() > 4000) { while (queue.Count() > 100) { Check(queue.Pop() == expected.top(), "draining"); expected.pop(); } }
+        }
+
+        Array<long> sorted = queue.ToArray();
+        for (const long &element : sorted) { Check(element == expected.top(), "converting into a sorted Array"); expected.pop(); }
+        CheckThrows<std::out_of_range>([&]() { queue.PopRange(queue.Count() + 1); }, "popping more than the queue holds");
+
+        PriorityQueue<long, std::greater<long>> maximumQueue(initialElements);
+        std::vector<long> descending(initialElements.begin(), initialElements.end());
+        std::sort(descending.begin(), descending.end(), std::greater<long>());
+        for (const long &element : descending) { Check(maximumQueue.Pop() == element, "popping by another comparer"); }
+    } });
+
+    tests.push_back({ "IndexedPriorityQueue::AgainstReferenceModel", []()
+    {
+        std::mt19937_64 random(29);
+        IndexedPriorityQueue<long> queue;
+        std::map<size_t, long> values;
+        std::set<std::pair<long, size_t>> ordered;
+        size_t peakCount = 0;
+
+        auto erase = [&](const size_t &handle)
+        {
+            ordered.erase({ values[handle], handle });
+            values.erase(handle);
+        };
+
+        for (size_t i = 0; i < 50000; i++)
+        {
+            auto randomHandle = [&]() { return std::next(values.begin(), (long)(random() % values.size()))->first; };
+            long element = (long)(random() % 10000);
+
+            switch (values.empty() ? 0 : random() % 6)
+            {
+            case 0: case 1:
+            {
+                size_t handle = queue.Push(element);
+                Check(!values.count(handle), "a pushed handle isn't in use");
+                values[handle] = element;
+                ordered.insert({ element, handle });
+                peakCount = std::max(peakCount, values.size());
+
+                // The released handles are reused, so there are never more handles than the most elements held at once.
+                Check(handle < peakCount, "reusing the released handles");
+                break;
+            }
+            case 2:
+            {
+                size_t handle = queue.TopHandle();
+                Check(queue.Pop() == ordered.begin()->first && values[handle] == ordered.begin()->first, "popping the first element");
+                erase(handle);
+                Check(!queue.Contains(handle), "a popped handle is released");
+                break;
+            }
+            case 3:
+            {
+                size_t handle = randomHandle();
+                Check(queue.Remove(handle) == values[handle], "removing an element by its handle");
+                erase(handle);
+                CheckThrows<std::out_of_range>([&]() { queue.Get(handle); }, "getting a removed handle");
+                break;
+            }
+            case 4:
+            {
+                size_t handle = randomHandle();
+                long decreased = values[handle] - (long)(random() % 100);
+                CheckThrows<std::logic_error>([&]() { queue.DecreaseKey(handle, values[handle] + 1); }, "increasing a key");
+
+                queue.DecreaseKey(handle, decreased);
+                erase(handle);
+                values[handle] = decreased;
+                ordered.insert({ decreased, handle });
+                break;
+            }
+            default:
+            {
+                size_t handle = randomHandle();
+                queue.Update(handle, element);
+                erase(handle);
+                values[handle] = element;
+                ordered.insert({ element, handle });
+                break;
+            }
+            }
+
+            Check(queue.Count() == values.size(), "counting the elements");
+            if (!values.empty())
+            {
+                Check(queue.Top() == ordered.begin()->first && queue.Get(queue.TopHandle()) == queue.Top(), "the top element");
+                size_t handle = randomHandle();
+                Check(queue.Contains(handle) && queue.Get(handle) == values[handle], "getting an element by its handle");
+            }
+        }
+    } });
+
+    tests.push_back({ "Serialization::CorruptCount", []()
+    {
+        const std::string path = "corrupt_count.bin";
+        Array<long>(1000, 7L).Save(path);
+
+        // The count claims more elements than the file holds, up to one that'd overflow their size in bytes.
+        for (uint64_t count : { (uint64_t)1001, (uint64_t)1 << 40, UINT64_MAX / sizeof(long) + 1, UINT64_MAX })
+        {
+            std::fstream file(path, std::ios::binary | std::ios::in | std::ios::out);
+            file.seekp(offsetof(BinaryHeader, Count));
+            file.write(reinterpret_cast<const char*>(&count), sizeof(count));
+            file.close();
+
+            CheckThrows<std::runtime_error>([&]() { Array<long>::Load(path); }, "loading a corrupt count");
+            CheckThrows<std::runtime_error>([&]() { MappedArray<long> mappedArray(path); }, "mapping a corrupt count");
+        }
+
+        std::remove(path.c_str());
+    } });
+
+    tests.push_back({ "Serialization::TruncatedFile", []()
+    {
+        const std::string path = "truncated_file.bin";
+        FlatHashTable<long, long> table(0);
+        for (long i = 0; i < 1000; i++) { table.Set(i, i); }
+
+        for (const std::string &name : { std::string("Array"), std::string("FlatHashTable") })
+        {
+            if (name == "Array") { Array<long>(1000, 7L).Save(path); }
+            else { table.Save(path); }
+
+            std::ifstream input(path, std::ios::binary);
+            std::string content((std::istreambuf_iterator<char>(input)), std::istreambuf_iterator<char>());
+            input.close();
+
+            std::ofstream output(path, std::ios::binary | std::ios::trunc);
+            output.write(content.data(), (std::streamsize)(content.size() / 2));
+            output.close();
+
+            if (name == "Array")
+            {
+                CheckThrows<std::runtime_error>([&]() { Array<long>::Load(path); }, "loading a truncated Array");
+                CheckThrows<std::runtime_error>([&]() { MappedArray<long> mappedArray(path); }, "mapping a truncated Array");
+            }
+            else { CheckThrows<std::runtime_error>([&]() { FlatHashTable<long, long>::Load(path); }, "loading a truncated Flat Hash Table"); }
+        }
+
+        std::remove(path.c_str());
+    } });
+
+    tests.push_back({ "SortedMap::AgainstStdMap", []()
+    {
+        std::mt19937_64 random(30);
+        CheckSortedMap<long, std::less<long>>(random, 20000, [](const size_t &index) { return (long)index - 20000; });
+        CheckSortedMap<std::string, std::less<std::string>>(random, 2000,
+            [](const size_t &index) { return "key" + std::to_string(index); });
+    } });
+
+    tests.push_back({ "SortedSet::AgainstStdSet", []()
+    {
+        std::mt19937_64 random(30);
+        CheckSortedSet<int, std::less<int>>(random, 20000, [](const size_t &index) { return (int)index - 20000; });
+        CheckSortedSet<int64_t, std::less<int64_t>>(random, 20000,
+            [](const size_t &index) { return (int64_t)index * 0x100000001 - ((int64_t)1 << 40); });
+        CheckSortedSet<double, std::less<double>>(random, 20000, [](const size_t &index) { return index * 0.5 - 1000; });
+        CheckSortedSet<double, std::greater<double>>(random, 20000, [](const size_t &index) { return index * 0.5 - 1000; });
+        CheckSortedSet<std::string, std::less<std::string>>(random, 2000,
+            [](const size_t &index) { return "element" + std::to_string(index); });
+    } });
+
+    tests.push_back({ "Sorting::AgainstStdSort", []()
+    {
+        std::mt19937_64 random(12);
+        auto randomInteger = [&]() { return random(); };
+        std::uniform_real_distribution<double> realDistribution(-1e6, 1e6);
+        auto randomReal = [&]() { return realDistribution(random); };
+
+        CheckSortingAlgorithms<int8_t>([&]() { return (int8_t)randomInteger(); });
+        CheckSortingAlgorithms<uint16_t>([&]() { return (uint16_t)randomInteger(); });
+        CheckSortingAlgorithms<int32_t>([&]() { return (int32_t)randomInteger(); });
+        CheckSortingAlgorithms<uint32_t>([&]() { return (uint32_t)randomInteger(); });
+        CheckSortingAlgorithms<int64_t>([&]() { return (int64_t)randomInteger(); });
+        CheckSortingAlgorithms<float>([&]() { return (float)randomReal(); });
+        CheckSortingAlgorithms<double>(randomReal);
+
+        // The signed zeros and the infinities are ordered by the bits of the floating points too.
+        std::vector<double> extremes { 0.0, -0.0, 1e-300, -1e-300, std::numeric_limits<double>::infinity(),
+            -std::numeric_limits<double>::infinity(), std::numeric_limits<double>::denorm_min(), -1.5, 1.5 };
+        for (size_t i = 0; i < 300; i++) { extremes.push_back(extremes[i % 9]); }
+        CheckSortingAlgorithms(extremes, "extreme floating points");
+    } });
+
+    tests.push_back({ "Sorting::Stability", []()
+    {
+        std::mt19937_64 random(13);
+        auto isKeyBefore = [](const std::pair<int, size_t> &first, const std::pair<int, size_t> &second) { return first.first < second.first; };
+
+        for (const size_t &length : { (size_t)17, (size_t)5000, PARALLEL_SORTING_THRESHOLD * 2 + 7 })
+        {
+            // The keys repeat a lot, and the indices tell apart the elements of the same key.
+            std::vector<std::pair<int, size_t>> elements(length), expected, sorted;
+            for (size_t i = 0; i < length; i++) { elements[i] = { (int)(random() % 64) - 32, i }; }
+            expected = elements;
+            std::stable_sort(expected.begin(), expected.end(), isKeyBefore);
+
+            sorted = elements;
+            MergeSort(sorted.data(), sorted.data() + length, isKeyBefore);
+            Check(sorted == expected, "a merge sort keeps the order of the equal elements");
+
+            for (const size_t &threadCount : { (size_t)2, (size_t)3, (size_t)0 })
+            {
+                sorted = elements;
+                ParallelMergeSort(sorted.data(), sorted.data() + length, isKeyBefore, threadCount);
+                Check(sorted == expected, "a parallel merge sort keeps the order of the equal elements");
+            }
+        }
+    } });
+
+    tests.push_back({ "Tensor::ZeroExtentAccess", []()
+    {
+        Tensor<int> noRows(2, 0, 3), noColumns(2, 3, 0);
+
+        Check(noRows.Slice(1).Rows() == 0 && noColumns.Slice(1).Columns() == 0, "empty matrices can be sliced");
+        CheckThrows<std::out_of_range>([&]() { noRows.Slice(2); }, "slicing past the depth");
+        CheckThrows<std::out_of_range>([&]() { noRows(0, 0, 0); }, "accessing a tensor of no rows");
+        CheckThrows<std::out_of_range>([&]() { noColumns(1, 0, 0); }, "accessing a tensor of no columns");
+        CheckThrows<std::out_of_range>([&]() { std::as_const(noColumns)(0, 2, 0); }, "only getting from a tensor of no columns");
+    } });
+
+    tests.push_back({ "WorkStealingDeque::OwnerAndThieves", []()
+    {
+        const long elementCount = 200000;
+        WorkStealingDeque<long> deque(2);
+        std::atomic<bool> isDone(false);
+        std::vector<std::vector<long>> taken(4);
+        std::vector<std::thread> thieves;
+
+        for (size_t thief = 1; thief < taken.size(); thief++)
+        {
+            thieves.emplace_back([&, thief]()
+            {
+                long element = 0;
+                while (!isDone.load(std::memory_order_acquire) || !deque.IsEmpty())
+                {
+                    if (deque.Steal(element)) { taken[thief].push_back(element); }
+                }
+            });
+        }
+
+        // The owner keeps more than it pops, so the deque grows while the thieves steal from it.
+        std::mt19937_64 random(11);
+        long element = 0;
+        for (long nextElement = 1; nextElement <= elementCount; )
+        {
+            size_t burstLength = std::min((size_t)(random() % 300 + 1), (size_t)(elementCount - nextElement + 1));
+            if (random() % 2)
+            {
+                Array<long> burst(burstLength);
+                for (size_t i = 0; i < burstLength; i++) { burst.begin()[i] = nextElement++; }
+                deque.PushRange(burst);
+            }
+            else { for (size_t i = 0; i < burstLength; i++) { deque.Push(nextElement++); } }
+
+            for (size_t i = 0; i < burstLength / 3; i++) { if (deque.TryPop(element)) { taken[0].push_back(element); } }
+        }
+        while (!deque.IsEmpty()) { if (deque.TryPop(element)) { taken[0].push_back(element); } }
+
+        isDone.store(true, std::memory_order_release);
+        for (std::thread &thief : thieves) { thief.join(); }
+
+        std::vector<long> allTaken;
+        for (const std::vector<long> &threadTaken : taken) { allTaken.insert(allTaken.end(), threadTaken.begin(), threadTaken.end()); }
+        std::sort(allTaken.begin(), allTaken.end());
+
+        bool isEachTakenOnce = allTaken.size() == (size_t)elementCount;
+        for (size_t i = 0; isEachTakenOnce && i < allTaken.size(); i++) { isEachTakenOnce = allTaken[i] == (long)i + 1; }
+        Check(isEachTakenOnce, "every element is taken exactly once");
+        Check(deque.Capacity() > 2, "the deque has grown");
+    } });
+
+    return tests;
+}
+
+int main(int argumentCount, char** arguments)
+{
+    std::string filter = argumentCount > 1 ? arguments[1] : "";
+    size_t failureCount = 0;
+
+    for (const Test &test : MakeTests())
+    {
+        if (test.Name.find(filter) == std::string::npos) { continue; }
+
+        try { test.Run(); std::cerr << "Passed " << test.Name << '\n'; }
+        catch (const std::exception &exception)
+        {
+            std::cerr << "Failed " << test.Name << ": " << exception.what() << '\n';
+            failureCount++;
+        }
+    }
+
+    return failureCount ? 1 : 0;
+}
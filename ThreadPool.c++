@@ -0,0 +1,179 @@
+#include<iostream>
+
+#ifndef THREAD_POOL
+#define THREAD_POOL
+
+#include<algorithm>
+#include<atomic>
+#include<condition_variable>
+#include<exception>
+#include<functional>
+#include<mutex>
+#include<thread>
+#include<vector>
+
+/// @brief A fixed set of threads that run the chunks of a task together with the thread that runs it,
+/// so the bulk operations can be split across the cores without creating threads each time.
+class ThreadPool
+{
+public:
+    /// @brief Creates a new Thread Pool, and starts its threads.
+    /// @param threadCount The amount of threads that run each task, (including the one that runs it,
+    /// and it's the amount of cores if zero).
+    explicit ThreadPool(size_t threadCount = 0)
+    {
+        if (!threadCount) { threadCount = std::max(std::thread::hardware_concurrency(), 1U); }
+        for (size_t i = 1; i < threadCount; i++) { workers.emplace_back([this] { Work(); }); }
+    }
+
+    /// @brief Thread Pools can't be copied, since they own their threads.
+    ThreadPool(const ThreadPool &reference) = delete;
+
+    ~ThreadPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            isStopping = true;
+        }
+
+        wakeCondition.notify_all();
+        for (std::thread &worker : workers) { worker.join(); }
+    }
+
+private:
+    /// @brief The threads of the Thread Pool.
+    std::vector<std::thread> workers;
+    /// @brief Makes the tasks run one at a time, when they're run from different threads.
+    std::mutex taskMutex;
+    /// @brief Guards the state shared with the threads.
+    std::mutex mutex;
+    /// @brief Wakes the threads up when a task starts, or when the Thread Pool stops.
+    std::condition_variable wakeCondition;
+    /// @brief Wakes the thread that runs the task up when the threads have left it.
+    std::condition_variable finishCondition;
+    /// @brief The task that's currently running, or null if there's none.
+    const std::function<void(const size_t &chunkIndex)>* task = nullptr;
+    /// @brief The amount of chunks of the current task.
+    size_t chunkCount = 0;
+    /// @brief The index of the next chunk that hasn't been taken by a thread.
+    std::atomic<size_t> nextChunkIndex { 0 };
+    /// @brief The amount of threads that are currently running chunks of the task.
+    size_t busyWorkerCount = 0;
+    /// @brief The number of the current task, which tells the threads that a new one has started.
+    size_t taskNumber = 0;
+    /// @brief The first exception thrown by a chunk of the current task.
+    std::exception_ptr exception;
+    /// @brief Whether or not the Thread Pool is being destroyed.
+    bool isStopping = false;
+    /// @brief Whether or not the current thread belongs to a Thread Pool, (so nested tasks run sequentially).
+    inline static thread_local bool isWorker = false;
+
+public:
+    /// @brief The amount of threads that run each task, (including the one that runs it).
+    /// @return The thread count of the Thread Pool.
+    size_t ThreadCount() const { return workers.size() + 1; }
+
+    /// @brief The Thread Pool shared by the parallel operations of the data structures, which
+    /// has a thread for each core.
+    /// @return The reference of the shared Thread Pool.
+    static ThreadPool &Shared()
+    {
+        static ThreadPool sharedThreadPool;
+        return sharedThreadPool;
+    }
+
+    /// @brief Runs every chunk of a task across the threads, and waits until all of them are done, (the
+    /// chunks run sequentially when there are no other threads, or when it's called from within a task).
+    /// @tparam TTask The type of the function that runs a chunk.
+    /// @param chunkCount The amount of chunks of the task.
+    /// @param task A function that takes the index of a chunk and runs it, (the first exception it throws
+    /// cancels the chunks that haven't started yet, and it's rethrown once the running ones finish).
+    template<typename TTask>
+    void Run(const size_t &chunkCount, const TTask &task) noexcept(false)
+    {
+        if (chunkCount <= 1 || workers.empty() || isWorker)
+        {
+            for (size_t i = 0; i < chunkCount; i++) { task(i); }
+            return;
+        }
+
+        std::function<void(const size_t &chunkIndex)> taskFunction(std::cref(task));
+        std::lock_guard<std::mutex> taskLock(taskMutex);
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            this->task = &taskFunction;
+            this->chunkCount = chunkCount;
+            nextChunkIndex.store(0, std::memory_order_relaxed);
+            exception = nullptr;
+            taskNumber++;
+        }
+
+        wakeCondition.notify_all();
+
+        isWorker = true;
+        RunChunks();
+        isWorker = false;
+
+        std::exception_ptr thrownException;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            finishCondition.wait(lock, [this] { return !busyWorkerCount; });
+            this->task = nullptr;
+            thrownException = exception;
+        }
+
+        if (thrownException) { std::rethrow_exception(thrownException); }
+    }
+
+    /// @brief Thread Pools can't be copied, since they own their threads.
+    ThreadPool &operator=(const ThreadPool &reference) = delete;
+
+private:
+    /// @brief Takes the chunks of the current task one by one and runs them, until none is left.
+    void RunChunks()
+    {
+        for (size_t i; (i = nextChunkIndex.fetch_add(1, std::memory_order_relaxed)) < chunkCount;)
+        {
+            try { (*task)(i); }
+            catch (...)
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                if (!exception) { exception = std::current_exception(); }
+                nextChunkIndex.store(chunkCount, std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /// @brief Waits for the tasks and runs their chunks, until the Thread Pool stops.
+    void Work()
+    {
+        isWorker = true;
+        size_t lastTaskNumber = 0;
+
+        while (true)
+        {
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                wakeCondition.wait(lock, [&] { return isStopping || taskNumber != lastTaskNumber; });
+                if (isStopping) { return; }
+
+                lastTaskNumber = taskNumber;
+                // The task might have finished before this thread woke up.
+                if (!task) { continue; }
+                busyWorkerCount++;
+            }
+
+            RunChunks();
+
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                busyWorkerCount--;
+            }
+
+            finishCondition.notify_one();
+        }
+    }
+};
+
+#endif
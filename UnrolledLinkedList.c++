@@ -0,0 +1,492 @@
+#include<iostream>
+
+#ifndef UNROLLED_LINKED_LIST
+#define UNROLLED_LINKED_LIST
+
+#include<algorithm>
+#include<functional>
+
+#include "Array.c++"
+
+/// @brief A data structure which is a set of discontiguous blocks, where each block stores a fixed
+/// amount of contiguous elements along with how many of them are used, so traversing it touches
+/// one block per many elements, and indexing skips whole blocks at a time.
+/// @tparam T The type of the data stored within the Unrolled Linked List.
+/// @tparam BLOCK_CAPACITY The maximum amount of elements stored within each block.
+template<typename T, size_t BLOCK_CAPACITY = 64>
+class UnrolledLinkedList
+{
+    static_assert(BLOCK_CAPACITY >= 2, "The blocks of an Unrolled Linked List must hold at least two elements.");
+
+private:
+    /// @brief A block of contiguous elements, that points to the blocks before and after it.
+    struct Block
+    {
+        /// @brief The block that points to this block as a next block.
+        Block* Previous = nullptr;
+        /// @brief The block that this block points to as a next block.
+        Block* Next = nullptr;
+        /// @brief The amount of elements currently stored within the block.
+        size_t Count = 0;
+        /// @brief The elements stored within the block, (only the first ones up to the count are used).
+        T Elements[BLOCK_CAPACITY];
+    };
+
+public:
+    /// @brief Walks through the elements of an Unrolled Linked List, block by block.
+    class Iterator
+    {
+    public:
+        /// @brief Creates a new Iterator at a defined element of a block.
+        /// @param block A pointer to the block of the element, (or null pointer for the end).
+        /// @param index The position of the element within its block.
+        Iterator(Block* block, const size_t &index) : block(block), index(index) { }
+
+    private:
+        /// @brief The block of the current element.
+        Block* block;
+        /// @brief The position of the current element within its block.
+        size_t index;
+
+    public:
+        /// @brief Accesses the current element.
+        /// @return The reference of the element.
+        T &operator*() const { return block->Elements[index]; }
+        /// @brief Accesses the current element.
+        /// @return A pointer to the element.
+        T* operator->() const { return block->Elements + index; }
+
+        /// @brief Moves to the next element, (jumping to the next block once the current one is done).
+        /// @return The reference of the Iterator after moving.
+        Iterator &operator++()
+        {
+            if (++index < block->Count) { return *this; }
+
+            block = block->Next;
+            index = 0;
+            return *this;
+        }
+
+        /// @brief Compares two Iterators positions.
+        /// @param iterator The Iterator that'll be compared to.
+        /// @return A boolean representing whether or not both Iterators are at the same element.
+        bool operator==(const Iterator &iterator) const { return block == iterator.block && index == iterator.index; }
+        /// @brief Compares two Iterators positions.
+        /// @param iterator The Iterator that'll be compared to.
+        /// @return A boolean representing whether or not the Iterators are at different elements.
+        bool operator!=(const Iterator &iterator) const { return !(*this == iterator); }
+    };
+
+    /// @brief Creates a new empty Unrolled Linked List.
+    UnrolledLinkedList() = default;
+
+    /// @brief Creates a new Unrolled Linked List from a defined Array.
+    /// @param array The Array that'll be used to create the Unrolled Linked List.
+    UnrolledLinkedList(const Array<T> &array) { AddRange(array); }
+
+    /// @brief Creates a new Unrolled Linked List with a defined elements count and initial values.
+    /// @param length The amount of elements that'll be stored within the Unrolled Linked List initially.
+    /// @param data A pointer to an array in memory, that has some values that'll be
+    /// stored within the Unrolled Linked List initially.
+    UnrolledLinkedList(const size_t &length, T* data) { AddRange(length, data); }
+
+    /// @brief Creates a new Unrolled Linked List by copying another Unrolled Linked List as reference.
+    /// @param reference The reference of the Unrolled Linked List that'll be copied.
+    UnrolledLinkedList(const UnrolledLinkedList<T, BLOCK_CAPACITY> &reference) { CopyBlocks(reference); }
+
+    /// @brief Creates a new Unrolled Linked List by taking over the blocks of another Unrolled
+    /// Linked List, which is left empty.
+    /// @param reference The reference of the Unrolled Linked List that'll be moved.
+    UnrolledLinkedList(UnrolledLinkedList<T, BLOCK_CAPACITY> &&reference) noexcept
+        : count(reference.count), blockCount(reference.blockCount), head(reference.head), tail(reference.tail)
+    {
+        reference.count = reference.blockCount = 0;
+        reference.head = reference.tail = nullptr;
+    }
+
+    ~UnrolledLinkedList() { Clear(); }
+
+private:
+    /// @brief The amount of elements currently stored within the Unrolled Linked List.
+    size_t count = 0;
+    /// @brief The amount of blocks currently allocated by the Unrolled Linked List.
+    size_t blockCount = 0;
+    /// @brief The first block in the Unrolled Linked List.
+    Block* head = nullptr;
+    /// @brief The last block in the Unrolled Linked List.
+    Block* tail = nullptr;
+
+public:
+    /// @brief The amount of elements currently stored within the Unrolled Linked List.
+    /// @return The elements count of the Unrolled Linked List.
+    size_t Count() const { return count; }
+    /// @brief The amount of blocks currently allocated by the Unrolled Linked List.
+    /// @return The blocks count of the Unrolled Linked List.
+    size_t BlockCount() const { return blockCount; }
+    /// @brief Indicates whether or not the Unrolled Linked List has currently no elements.
+    /// @return A boolean representing whether or not the Unrolled Linked List is empty.
+    bool IsEmpty() const { return !count; }
+
+    /// @brief The beginning of the Unrolled Linked List.
+    /// @return An Iterator at the first element.
+    Iterator begin() const { return Iterator(head, 0); }
+    /// @brief The end of the Unrolled Linked List.
+    /// @return An Iterator past the last element.
+    Iterator end() const { return Iterator(nullptr, 0); }
+
+    /// @brief Adds an element to the end of the Unrolled Linked List.
+    /// @param element The value of the element that'll be copied into the Unrolled Linked List.
+    void Add(const T &element) { Emplace(element); }
+
+    /// @brief Adds an element to the end of the Unrolled Linked List.
+    /// @param element The value of the element that'll be moved into the Unrolled Linked List.
+    void Add(T &&element) { Emplace(std::move(element)); }
+
+    /// @brief Constructs an element from a set of arguments, and adds it to the end of the Unrolled Linked List.
+    /// @tparam ...TArguments The types of the arguments given to the element constructor.
+    /// @param ...arguments The arguments that'll be forwarded to the element constructor.
+    /// @return The reference of the added element.
+    template<typename... TArguments>
+    T &Emplace(TArguments&&... arguments)
+    {
+        T element(std::forward<TArguments>(arguments)...);
+        if (!tail || tail->Count == BLOCK_CAPACITY) { LinkBlock(tail); }
+
+        T &addedElement = tail->Elements[tail->Count++] = std::move(element);
+        count++;
+        return addedElement;
+    }
+
+    /// @brief Adds an Array of elements to the end of the Unrolled Linked List, by filling the
+    /// blocks contiguously.
+    /// @param array The Array that'll be added to the Unrolled Linked List.
+    void AddRange(const Array<T> &array) { AddRange(array.Length(), array.begin()); }
+
+    /// @brief Adds a range of elements to the end of the Unrolled Linked List, by filling the
+    /// blocks contiguously.
+    /// @param length The amount of elements that'll be added to the Unrolled Linked List.
+    /// @param data A pointer to an array in memory, that has some values that'll be added.
+    void AddRange(const size_t &length, const T* data)
+    {
+        for (size_t i = 0; i < length; )
+        {
+            if (!tail || tail->Count == BLOCK_CAPACITY) { LinkBlock(tail); }
+
+            size_t copiedCount = std::min(length - i, BLOCK_CAPACITY - tail->Count);
+            std::copy(data + i, data + i + copiedCount, tail->Elements + tail->Count);
+
+            tail->Count += copiedCount;
+            count += copiedCount;
+            i += copiedCount;
+        }
+    }
+
+    /// @brief Adds an element into the Unrolled Linked List at a specified index, (splitting its
+    /// block in halves if it's full).
+    /// @param element The value of the element that'll be copied into the Unrolled Linked List.
+    /// @param index The order in which the element will be inserted at.
+    void Insert(const T &element, const size_t &index) noexcept(false) { EmplaceAt(index, element); }
+
+    /// @brief Adds an element into the Unrolled Linked List at a specified index, (splitting its
+    /// block in halves if it's full).
+    /// @param element The value of the element that'll be moved into the Unrolled Linked List.
+    /// @param index The order in which the element will be inserted at.
+    void Insert(T &&element, const size_t &index) noexcept(false) { EmplaceAt(index, std::move(element)); }
+
+    /// @brief Constructs an element from a set of arguments, and adds it into the Unrolled Linked List
+    /// at a specified index, (splitting its block in halves if it's full).
+    /// @tparam ...TArguments The types of the arguments given to the element constructor.
+    /// @param index The order in which the element will be inserted at.
+    /// @param ...arguments The arguments that'll be forwarded to the element constructor.
+    /// @return The reference of the inserted element.
+    template<typename... TArguments>
+    T &EmplaceAt(const size_t &index, TArguments&&... arguments) noexcept(false)
+    {
+        if (index == count) { return Emplace(std::forward<TArguments>(arguments)...); }
+
+        ValidateBoundaries(index);
+
+        T element(std::forward<TArguments>(arguments)...);
+
+        size_t position;
+        Block* block = Locate(index, position);
+
+        if (block->Count == BLOCK_CAPACITY)
+        {
+            SplitBlock(block);
+            if (position > block->Count)
+            {
+                position -= block->Count;
+                block = block->Next;
+            }
+        }
+
+        std::move_backward(block->Elements + position, block->Elements + block->Count, block->Elements + block->Count + 1);
+        block->Count++;
+        count++;
+
+        return block->Elements[position] = std::move(element);
+    }
+
+    /// @brief Gets or Sets an element in the Unrolled Linked List, by skipping whole blocks until
+    /// the one holding it, (from whichever end is closer).
+    /// @param index The order of the desired element.
+    /// @return The reference of the element.
+    T &At(const size_t &index) const noexcept(false)
+    {
+        ValidateBoundaries(index);
+
+        size_t position;
+        Block* block = Locate(index, position);
+        return block->Elements[position];
+    }
+
+    /// @brief Searches for an element in the Unrolled Linked List, and returns its occuring index.
+    /// @param element The desired value of the element.
+    /// @return The occuring index of the element, or -1 if unfound.
+    long IndexOf(const T &element) const
+    {
+        size_t index = 0;
+        for (Block* block = head; block; index += block->Count, block = block->Next)
+        {
+            for (size_t i = 0; i < block->Count; i++)
+            { if (block->Elements[i] == element) { return (long)(index + i); } }
+        }
+
+        return -1;
+    }
+
+    /// @brief Checks for the existence of an element within the Unrolled Linked List.
+    /// @param element The desired value of the element.
+    /// @return A boolean representing whether or not the element exists within the Unrolled Linked List.
+    bool Contains(const T &element) const { return IndexOf(element) != -1; }
+
+    /// @brief Removes the first element that has a specified value from the Unrolled Linked List.
+    /// @param element The value of the element that'll be removed.
+    /// @return A boolean representing whether or not the element has been removed.
+    bool Remove(const T &element)
+    {
+        long index = IndexOf(element);
+        if (index == -1) { return false; }
+
+        RemoveAt(index);
+        return true;
+    }
+
+    /// @brief Removes an element at a specified index from the Unrolled Linked List, (merging its block
+    /// with the next one if both of them are no more than half full).
+    /// @param index The index of the element that'll be removed.
+    void RemoveAt(const size_t &index) noexcept(false)
+    {
+        ValidateBoundaries(index);
+
+        size_t position;
+        Block* block = Locate(index, position);
+
+        std::move(block->Elements + position + 1, block->Elements + block->Count, block->Elements + position);
+        block->Elements[--block->Count] = T();
+        count--;
+
+        if (!block->Count) { UnlinkBlock(block); return; }
+
+        Block* nextBlock = block->Next;
+        if (block->Count < BLOCK_CAPACITY / 2 && nextBlock && block->Count + nextBlock->Count <= BLOCK_CAPACITY)
+        {
+            std::move(nextBlock->Elements, nextBlock->Elements + nextBlock->Count, block->Elements + block->Count);
+            block->Count += nextBlock->Count;
+            UnlinkBlock(nextBlock);
+        }
+    }
+
+    /// @brief Clears every element from the Unrolled Linked List, and releases all of its blocks.
+    void Clear()
+    {
+        for (Block* block = head, *nextBlock; block; block = nextBlock)
+        {
+            nextBlock = block->Next;
+            delete block;
+        }
+
+        head = tail = nullptr;
+        count = blockCount = 0;
+    }
+
+    /// @brief Applies a callback Function for each element in the Unrolled Linked List.
+    /// @param callback The function that'll be applied to all elements, that takes the reference
+    /// of the current element.
+    void Foreach(std::function<void(T &element)> callback)
+    {
+        for (Block* block = head; block; block = block->Next)
+        { for (size_t i = 0; i < block->Count; i++) { callback(block->Elements[i]); } }
+    }
+
+    /// @brief Applies an indexed callback Function for each element in the Unrolled Linked List.
+    /// @param callback The function that'll be applied to all elements, that takes the reference
+    /// of the current element, and the index of it.
+    void Foreach(std::function<void(T &element, const size_t &index)> callback)
+    {
+        size_t index = 0;
+        for (Block* block = head; block; block = block->Next)
+        { for (size_t i = 0; i < block->Count; i++) { callback(block->Elements[i], index++); } }
+    }
+
+    /// @brief Converts the Unrolled Linked List into an Array, by copying it block by block.
+    /// @return An Array consisting of all of the Unrolled Linked List elements.
+    Array<T> ToArray() const
+    {
+        Array<T> array(count);
+
+        T* destination = array.begin();
+        for (Block* block = head; block; block = block->Next)
+        { destination = std::copy(block->Elements, block->Elements + block->Count, destination); }
+
+        return array;
+    }
+
+    /// @brief Copies an Unrolled Linked List into another.
+    /// @param reference The reference of the Unrolled Linked List that'll be copied.
+    /// @return The result of the copying.
+    UnrolledLinkedList<T, BLOCK_CAPACITY> &operator=(const UnrolledLinkedList<T, BLOCK_CAPACITY> &reference)
+    {
+        if (this == &reference) { return *this; }
+
+        Clear();
+        CopyBlocks(reference);
+        return *this;
+    }
+
+    /// @brief Moves an Unrolled Linked List into another, by taking over its blocks.
+    /// @param reference The reference of the Unrolled Linked List that'll be moved.
+    /// @return The result of the moving.
+    UnrolledLinkedList<T, BLOCK_CAPACITY> &operator=(UnrolledLinkedList<T, BLOCK_CAPACITY> &&reference) noexcept
+    {
+        if (this == &reference) { return *this; }
+
+        Clear();
+
+        count = reference.count;
+        blockCount = reference.blockCount;
+        head = reference.head;
+        tail = reference.tail;
+
+        reference.count = reference.blockCount = 0;
+        reference.head = reference.tail = nullptr;
+        return *this;
+    }
+
+    /// @brief Gets or Sets an element in the Unrolled Linked List.
+    /// @param index The order of the desired element.
+    /// @return The reference of the element.
+    T &operator[](const size_t &index) const noexcept(false) { return At(index); }
+
+    /// @brief Adds an element to the end of the Unrolled Linked List.
+    /// @param element The value of the element that'll be copied into the Unrolled Linked List.
+    /// @return The reference of the Unrolled Linked List after adding the element value to it.
+    UnrolledLinkedList<T, BLOCK_CAPACITY> &operator<<(const T &element) { Add(element); return *this; }
+
+    /// @brief Adds an element to the end of the Unrolled Linked List.
+    /// @param element The value of the element that'll be moved into the Unrolled Linked List.
+    /// @return The reference of the Unrolled Linked List after adding the element value to it.
+    UnrolledLinkedList<T, BLOCK_CAPACITY> &operator<<(T &&element) { Add(std::move(element)); return *this; }
+
+    /// @brief Adds an Array of elements to the end of the Unrolled Linked List.
+    /// @param array The Array that'll be added to the Unrolled Linked List.
+    /// @return The reference of the Unrolled Linked List after adding the Array of elements value to it.
+    UnrolledLinkedList<T, BLOCK_CAPACITY> &operator<<(const Array<T> &array) { AddRange(array); return *this; }
+
+private:
+    /// @brief Checks whether or not an index is within the boundaries of the Unrolled Linked List,
+    /// if not, it'll throw an "out of range" exception.
+    /// @param index The selected index that'll be checked.
+    void ValidateBoundaries(const size_t &index) const noexcept(false)
+    {
+        if (index < count) { return; }
+
+        throw std::out_of_range("The index [" + std::to_string(index) + "] is out of the range of the Unrolled Linked List.");
+    }
+
+    /// @brief Finds the block that holds an element, by skipping whole blocks from whichever end is closer.
+    /// @param index The order of the element, (it must be within the boundaries).
+    /// @param position The reference that'll be assigned the position of the element within its block.
+    /// @return A pointer to the block holding the element.
+    Block* Locate(const size_t &index, size_t &position) const
+    {
+        if (index < count / 2)
+        {
+            Block* block = head;
+            for (position = index; position >= block->Count; block = block->Next) { position -= block->Count; }
+            return block;
+        }
+
+        Block* block = tail;
+        size_t remainingCount = count - index;
+        for ( ; remainingCount > block->Count; block = block->Previous) { remainingCount -= block->Count; }
+
+        position = block->Count - remainingCount;
+        return block;
+    }
+
+    /// @brief Allocates a new empty block, and links it after a defined block.
+    /// @param previousBlock A pointer to the block that'll point to the new block, (or null pointer
+    /// to link it as the head).
+    /// @return A pointer to the new block.
+    Block* LinkBlock(Block* previousBlock)
+    {
+        Block* block = new Block();
+        block->Previous = previousBlock;
+        block->Next = previousBlock ? previousBlock->Next : head;
+
+        if (block->Next) { block->Next->Previous = block; }
+        else { tail = block; }
+
+        if (previousBlock) { previousBlock->Next = block; }
+        else { head = block; }
+
+        blockCount++;
+        return block;
+    }
+
+    /// @brief Unlinks a block from the Unrolled Linked List, and releases it from memory.
+    /// @param block A pointer to the block that'll be removed.
+    void UnlinkBlock(Block* block)
+    {
+        if (block->Previous) { block->Previous->Next = block->Next; }
+        else { head = block->Next; }
+
+        if (block->Next) { block->Next->Previous = block->Previous; }
+        else { tail = block->Previous; }
+
+        delete block;
+        blockCount--;
+    }
+
+    /// @brief Moves the upper half of a full block into a new block linked after it.
+    /// @param block A pointer to the block that'll be split.
+    void SplitBlock(Block* block)
+    {
+        Block* newBlock = LinkBlock(block);
+        size_t keptCount = BLOCK_CAPACITY / 2;
+
+        std::move(block->Elements + keptCount, block->Elements + block->Count, newBlock->Elements);
+        std::fill(block->Elements + keptCount, block->Elements + block->Count, T());
+
+        newBlock->Count = block->Count - keptCount;
+        block->Count = keptCount;
+    }
+
+    /// @brief Copies the blocks of another Unrolled Linked List, keeping the same layout.
+    /// @param reference The reference of the Unrolled Linked List that'll be copied.
+    void CopyBlocks(const UnrolledLinkedList<T, BLOCK_CAPACITY> &reference)
+    {
+        for (Block* block = reference.head; block; block = block->Next)
+        {
+            Block* copiedBlock = LinkBlock(tail);
+            std::copy(block->Elements, block->Elements + block->Count, copiedBlock->Elements);
+            copiedBlock->Count = block->Count;
+        }
+
+        count = reference.count;
+    }
+};
+
+#endif
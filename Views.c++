@@ -0,0 +1,378 @@
+#include<iostream>
+
+#ifndef VIEWS
+#define VIEWS
+
+#include<iterator>
+#include<stdexcept>
+#include<string>
+#include<type_traits>
+
+/// @brief Introduces the abstraction of the Array class to the Views.
+/// @tparam T The type of the data stored within the Array.
+template<typename T>
+class Array;
+
+/// @brief Introduces the abstraction of the Dynamic Array class to the Views.
+/// @tparam T The type of the data stored within the Dynamic Array.
+template<typename T>
+class DynamicArray;
+
+/// @brief Introduces the abstraction of the List class to the Views.
+/// @tparam T The type of the data stored within the List.
+template<typename T>
+class List;
+
+/// @brief Introduces the abstraction of the Reverse View class to the Lazy View class.
+template<typename TView>
+class ReverseView;
+
+/// @brief Introduces the abstraction of the Filter View class to the Lazy View class.
+template<typename TView, typename TPredicate>
+class FilterView;
+
+/// @brief Introduces the abstraction of the Map View class to the Lazy View class.
+template<typename TView, typename TMapper>
+class MapView;
+
+/// @brief Introduces the abstraction of the Take View class to the Lazy View class.
+template<typename TView>
+class TakeView;
+
+/// @brief Introduces the abstraction of the Skip View class to the Lazy View class.
+template<typename TView>
+class SkipView;
+
+/// @brief The operations shared by all of the lazy Views, that chain one View over another without copying
+/// any element, (the elements are only visited when the last View is iterated, or materialized).
+/// @tparam TView The type of the View that derives from the Lazy View.
+template<typename TView>
+class LazyView
+{
+public:
+    /// @brief Makes a View that walks through the elements backwards, (the iterators must be bidirectional).
+    /// @return A Reverse View of this View.
+    ReverseView<TView> Reverse() const { return ReverseView<TView>(Self()); }
+
+    /// @brief Makes a View of only the elements that match a set of conditions.
+    /// @tparam TPredicate The type of the function that validates the elements.
+    /// @param predicate A function that takes an element and validates it throughout a set of conditions,
+    /// (it's called each time an element is passed by, so it shouldn't have side effects).
+    /// @return A Filter View of this View.
+    template<typename TPredicate>
+    FilterView<TView, TPredicate> Filter(const TPredicate &predicate) const { return FilterView<TView, TPredicate>(Self(), predicate); }
+
+    /// @brief Makes a View of the results of a function applied to the elements.
+    /// @tparam TMapper The type of the function that maps the elements.
+    /// @param mapper A function that takes an element and returns the value it's mapped to, (it's called
+    /// each time an element is accessed).
+    /// @return A Map View of this View.
+    template<typename TMapper>
+    MapView<TView, TMapper> Map(const TMapper &mapper) const { return MapView<TView, TMapper>(Self(), mapper); }
+
+    /// @brief Makes a View of only the first elements.
+    /// @param count The amount of the first elements, (all of them if there're fewer).
+    /// @return A Take View of this View.
+    TakeView<TView> Take(const size_t &count) const { return TakeView<TView>(Self(), count); }
+
+    /// @brief Makes a View of all the elements except the first ones.
+    /// @param count The amount of the skipped elements, (all of them if there're fewer).
+    /// @return A Skip View of this View.
+    SkipView<TView> Skip(const size_t &count) const { return SkipView<TView>(Self(), count); }
+
+    /// @brief Makes a View of the elements within a range of indices, if the range is reversed, it'll throw
+    /// an "out of range" exception, (the indices beyond the last element are cut off).
+    /// @param begin The index of the first element within the range.
+    /// @param end The index past the last element within the range.
+    /// @return A Take View of a Skip View of this View.
+    TakeView<SkipView<TView>> Slice(const size_t &begin, const size_t &end) const noexcept(false)
+    {
+        if (begin > end)
+        { throw std::out_of_range("The slice [" + std::to_string(begin) + ", " + std::to_string(end) + ") has its beginning after its end."); }
+
+        return Skip(begin).Take(end - begin);
+    }
+
+    /// @brief Counts the elements by walking through the View, (without accessing them).
+    /// @return The amount of elements within the View.
+    size_t Count() const { return (size_t)std::distance(Self().begin(), Self().end()); }
+
+    /// @brief Indicates whether or not the View has no elements.
+    /// @return A boolean representing whether or not the View is empty.
+    bool IsEmpty() const { return Self().begin() == Self().end(); }
+
+    /// @brief Copies the elements into an Array, by walking through the View twice, (once to count them).
+    /// @return An Array consisting of all of the elements of the View.
+    auto ToArray() const
+    {
+        Array<std::decay_t<decltype(*Self().begin())>> array(Count());
+        auto destination = array.begin();
+        for (auto &&element : Self()) { *destination++ = element; }
+        return array;
+    }
+
+    /// @brief Copies the elements into a Dynamic Array, by walking through the View twice, (once to count them).
+    /// @return A Dynamic Array consisting of all of the elements of the View.
+    auto ToDynamicArray() const { return DynamicArray<std::decay_t<decltype(*Self().begin())>>(ToArray()); }
+
+    /// @brief Copies the elements into a List, by walking through the View twice, (once to count them).
+    /// @return A List consisting of all of the elements of the View.
+    auto ToList() const { return List<std::decay_t<decltype(*Self().begin())>>(ToArray()); }
+
+private:
+    /// @brief The View that derives from the Lazy View.
+    /// @return The reference of the derived View.
+    const TView &Self() const { return static_cast<const TView &>(*this); }
+};
+
+/// @brief A View of the elements of a container between two of its iterators, which is the beginning of
+/// every chain of Views, (the container must outlive the View, and not be changed in size meanwhile).
+/// @tparam TIterator The type of the iterators of the container.
+template<typename TIterator>
+class RangeView : public LazyView<RangeView<TIterator>>
+{
+public:
+    /// @brief Creates a new View of the elements between two iterators.
+    /// @param first The iterator at the first element.
+    /// @param last The iterator past the last element.
+    RangeView(const TIterator &first, const TIterator &last) : first(first), last(last) { }
+
+    /// @brief The beginning of the Range View.
+    /// @return The iterator at the first element.
+    TIterator begin() const { return first; }
+    /// @brief The end of the Range View.
+    /// @return The iterator past the last element.
+    TIterator end() const { return last; }
+
+private:
+    /// @brief The iterator at the first element.
+    TIterator first;
+    /// @brief The iterator past the last element.
+    TIterator last;
+};
+
+/// @brief A View that walks through the elements of another View backwards.
+/// @tparam TView The type of the reversed View.
+template<typename TView>
+class ReverseView : public LazyView<ReverseView<TView>>
+{
+public:
+    /// @brief Creates a new View of the elements of a View backwards.
+    /// @param view The View that'll be reversed.
+    explicit ReverseView(const TView &view) : view(view) { }
+
+    /// @brief The beginning of the Reverse View.
+    /// @return An iterator at the last element of the reversed View.
+    auto begin() const { return std::make_reverse_iterator(view.end()); }
+    /// @brief The end of the Reverse View.
+    /// @return An iterator before the first element of the reversed View.
+    auto end() const { return std::make_reverse_iterator(view.begin()); }
+
+private:
+    /// @brief The reversed View.
+    TView view;
+};
+
+/// @brief A View that skips the elements of another View that don't match a set of conditions.
+/// @tparam TView The type of the filtered View.
+/// @tparam TPredicate The type of the function that validates the elements.
+template<typename TView, typename TPredicate>
+class FilterView : public LazyView<FilterView<TView, TPredicate>>
+{
+    /// @brief The type of the iterators of the filtered View.
+    using TIterator = decltype(std::declval<const TView &>().begin());
+
+public:
+    /// @brief Walks through the elements of the filtered View, by skipping the unmatched ones at each step.
+    class Iterator
+    {
+    public:
+        using iterator_category = std::conditional_t<std::is_base_of_v<std::bidirectional_iterator_tag,
+            typename std::iterator_traits<TIterator>::iterator_category>, std::bidirectional_iterator_tag, std::forward_iterator_tag>;
+        using value_type = typename std::iterator_traits<TIterator>::value_type;
+        using difference_type = typename std::iterator_traits<TIterator>::difference_type;
+        using pointer = typename std::iterator_traits<TIterator>::pointer;
+        using reference = typename std::iterator_traits<TIterator>::reference;
+
+        /// @brief Creates a new Iterator at an element, and skips to the first matched one.
+        /// @param current The iterator at the current element of the filtered View.
+        /// @param first The iterator at the first element of the filtered View.
+        /// @param last The iterator past the last element of the filtered View.
+        /// @param predicate A pointer to the function that validates the elements.
+        Iterator(const TIterator &current, const TIterator &first, const TIterator &last, const TPredicate* predicate)
+            : current(current), first(first), last(last), predicate(predicate) { SkipUnmatched(); }
+
+        reference operator*() const { return *current; }
+        Iterator &operator++() { ++current; SkipUnmatched(); return *this; }
+        Iterator operator++(int) { Iterator iterator = *this; ++*this; return iterator; }
+        Iterator &operator--() { do { --current; } while (current != first && !(*predicate)(*current)); return *this; }
+        Iterator operator--(int) { Iterator iterator = *this; --*this; return iterator; }
+        bool operator==(const Iterator &iterator) const { return current == iterator.current; }
+        bool operator!=(const Iterator &iterator) const { return current != iterator.current; }
+
+    private:
+        /// @brief The iterator at the current element of the filtered View.
+        TIterator current;
+        /// @brief The iterator at the first element of the filtered View.
+        TIterator first;
+        /// @brief The iterator past the last element of the filtered View.
+        TIterator last;
+        /// @brief A pointer to the function that validates the elements.
+        const TPredicate* predicate;
+
+        /// @brief Moves forward until a matched element or the end is reached.
+        void SkipUnmatched() { while (current != last && !(*predicate)(*current)) { ++current; } }
+    };
+
+    /// @brief Creates a new View of the elements of a View that match a set of conditions.
+    /// @param view The View that'll be filtered.
+    /// @param predicate A function that takes an element and validates it throughout a set of conditions.
+    FilterView(const TView &view, const TPredicate &predicate) : view(view), predicate(predicate) { }
+
+    /// @brief The beginning of the Filter View.
+    /// @return An Iterator at the first matched element.
+    Iterator begin() const { return Iterator(view.begin(), view.begin(), view.end(), &predicate); }
+    /// @brief The end of the Filter View.
+    /// @return An Iterator past the last element.
+    Iterator end() const { return Iterator(view.end(), view.begin(), view.end(), &predicate); }
+
+private:
+    /// @brief The filtered View.
+    TView view;
+    /// @brief The function that validates the elements.
+    TPredicate predicate;
+};
+
+/// @brief A View of the results of a function applied to the elements of another View.
+/// @tparam TView The type of the mapped View.
+/// @tparam TMapper The type of the function that maps the elements.
+template<typename TView, typename TMapper>
+class MapView : public LazyView<MapView<TView, TMapper>>
+{
+    /// @brief The type of the iterators of the mapped View.
+    using TIterator = decltype(std::declval<const TView &>().begin());
+
+public:
+    /// @brief Walks through the elements of the mapped View, by mapping each one when it's accessed.
+    class Iterator
+    {
+    public:
+        using iterator_category = std::conditional_t<std::is_base_of_v<std::bidirectional_iterator_tag,
+            typename std::iterator_traits<TIterator>::iterator_category>, std::bidirectional_iterator_tag, std::forward_iterator_tag>;
+        using reference = decltype(std::declval<const TMapper &>()(*std::declval<TIterator>()));
+        using value_type = std::decay_t<reference>;
+        using difference_type = typename std::iterator_traits<TIterator>::difference_type;
+        using pointer = void;
+
+        /// @brief Creates a new Iterator at an element.
+        /// @param current The iterator at the current element of the mapped View.
+        /// @param mapper A pointer to the function that maps the elements.
+        Iterator(const TIterator &current, const TMapper* mapper) : current(current), mapper(mapper) { }
+
+        reference operator*() const { return (*mapper)(*current); }
+        Iterator &operator++() { ++current; return *this; }
+        Iterator operator++(int) { Iterator iterator = *this; ++current; return iterator; }
+        Iterator &operator--() { --current; return *this; }
+        Iterator operator--(int) { Iterator iterator = *this; --current; return iterator; }
+        bool operator==(const Iterator &iterator) const { return current == iterator.current; }
+        bool operator!=(const Iterator &iterator) const { return current != iterator.current; }
+
+    private:
+        /// @brief The iterator at the current element of the mapped View.
+        TIterator current;
+        /// @brief A pointer to the function that maps the elements.
+        const TMapper* mapper;
+    };
+
+    /// @brief Creates a new View of the results of a function applied to the elements of a View.
+    /// @param view The View that'll be mapped.
+    /// @param mapper A function that takes an element and returns the value it's mapped to.
+    MapView(const TView &view, const TMapper &mapper) : view(view), mapper(mapper) { }
+
+    /// @brief The beginning of the Map View.
+    /// @return An Iterator at the first element.
+    Iterator begin() const { return Iterator(view.begin(), &mapper); }
+    /// @brief The end of the Map View.
+    /// @return An Iterator past the last element.
+    Iterator end() const { return Iterator(view.end(), &mapper); }
+
+private:
+    /// @brief The mapped View.
+    TView view;
+    /// @brief The function that maps the elements.
+    TMapper mapper;
+};
+
+/// @brief A View of only the first elements of another View.
+/// @tparam TView The type of the taken View.
+template<typename TView>
+class TakeView : public LazyView<TakeView<TView>>
+{
+public:
+    /// @brief Creates a new View of the first elements of a View.
+    /// @param view The View whose elements will be taken.
+    /// @param count The amount of the first elements.
+    TakeView(const TView &view, const size_t &count) : view(view), count(count) { }
+
+    /// @brief The beginning of the Take View.
+    /// @return The iterator at the first element of the taken View.
+    auto begin() const { return view.begin(); }
+    /// @brief The end of the Take View, which is found by stepping over the taken elements, (at once if the
+    /// iterators are random access), so the Take View iterators are the ones of the taken View.
+    /// @return The iterator past the last taken element.
+    auto end() const { return Advance(view.begin(), view.end(), count); }
+
+private:
+    /// @brief The taken View.
+    TView view;
+    /// @brief The amount of the first elements.
+    size_t count;
+
+    template<typename TView_>
+    friend class SkipView;
+
+    /// @brief Moves an iterator forward by a few elements, without going past an end.
+    /// @tparam TIterator The type of the iterator.
+    /// @param current The iterator that'll be moved.
+    /// @param last The iterator past the last element.
+    /// @param count The amount of elements the iterator is moved by.
+    /// @return The moved iterator.
+    template<typename TIterator>
+    static TIterator Advance(TIterator current, const TIterator &last, const size_t &count)
+    {
+        if constexpr (std::is_base_of_v<std::random_access_iterator_tag, typename std::iterator_traits<TIterator>::iterator_category>)
+        { return current + (std::ptrdiff_t)std::min(count, (size_t)(last - current)); }
+        else
+        {
+            for (size_t i = 0; i < count && current != last; i++) { ++current; }
+            return current;
+        }
+    }
+};
+
+/// @brief A View of all the elements of another View except the first ones.
+/// @tparam TView The type of the skipped View.
+template<typename TView>
+class SkipView : public LazyView<SkipView<TView>>
+{
+public:
+    /// @brief Creates a new View of the elements of a View after the first ones.
+    /// @param view The View whose elements will be skipped.
+    /// @param count The amount of the skipped elements.
+    SkipView(const TView &view, const size_t &count) : view(view), count(count) { }
+
+    /// @brief The beginning of the Skip View, which is found by stepping over the skipped elements.
+    /// @return The iterator at the first element after the skipped ones.
+    auto begin() const { return TakeView<TView>::Advance(view.begin(), view.end(), count); }
+    /// @brief The end of the Skip View.
+    /// @return The iterator past the last element of the skipped View.
+    auto end() const { return view.end(); }
+
+private:
+    /// @brief The skipped View.
+    TView view;
+    /// @brief The amount of the skipped elements.
+    size_t count;
+};
+
+#endif
@@ -0,0 +1,234 @@
+#include<iostream>
+
+#ifndef WORK_STEALING_DEQUE
+#define WORK_STEALING_DEQUE
+
+#include<algorithm>
+#include<atomic>
+#include<cstdint>
+#include<stdexcept>
+#include<type_traits>
+
+#include "Array.c++"
+#include "CacheLine.c++"
+#include "GrowthPolicy.c++"
+
+/// @brief A Stack that's owned by one thread, which pushes and pops elements on its top without locks,
+/// while other threads can steal elements from its bottom at the same time, (the Chase-Lev deque),
+/// where the elements are stored within a circular buffer that grows as powers of two.
+/// @tparam T The type of the data stored within the Work Stealing Deque, (it must be trivially copyable,
+/// since a thief may read an element while the owner overwrites its slot, like pointers to tasks).
+template<typename T>
+class WorkStealingDeque
+{
+    static_assert(std::is_trivially_copyable_v<T>, "The data of a Work Stealing Deque must be trivially copyable.");
+
+private:
+    /// @brief A circular buffer of the elements, that points to the buffer it has replaced, (which can't
+    /// be released while thieves might still be reading it).
+    struct Buffer
+    {
+        /// @brief Creates a new circular buffer.
+        /// @param length The amount of slots within the buffer, (it must be a power of two).
+        /// @param previous The buffer that the new buffer replaces.
+        Buffer(const size_t &length, Buffer* previous) : Slots(length), Previous(previous) { }
+
+        /// @brief The slots of the buffer, (its length is always a power of two).
+        Array<std::atomic<T>> Slots;
+        /// @brief The buffer that this buffer has replaced.
+        Buffer* Previous;
+
+        /// @brief Reads the element at a position, wrapped around the buffer.
+        /// @param position The position of the element.
+        /// @return The value of the element.
+        T Get(const int64_t &position) const
+        { return Slots.begin()[position & (Slots.Length() - 1)].load(std::memory_order_relaxed); }
+
+        /// @brief Writes an element at a position, wrapped around the buffer.
+        /// @param position The position of the element.
+        /// @param element The value of the element.
+        void Put(const int64_t &position, const T &element)
+        { Slots.begin()[position & (Slots.Length() - 1)].store(element, std::memory_order_relaxed); }
+    };
+
+public:
+    /// @brief Creates a new empty Work Stealing Deque with a defined capacity.
+    /// @param capacity The amount of elements that can be stored before growing, (it's rounded up
+    /// to the closest power of two).
+    explicit WorkStealingDeque(const size_t &capacity = INITIAL_CAPACITY)
+        : buffer(new Buffer(GrowthPolicy::NextPowerOfTwo(std::max(capacity, (size_t)2)), nullptr)) { }
+
+    /// @brief Work Stealing Deques can't be copied, since other threads might be using them.
+    WorkStealingDeque(const WorkStealingDeque<T> &reference) = delete;
+
+    ~WorkStealingDeque()
+    {
+        for (Buffer* currentBuffer = buffer.load(std::memory_order_relaxed), *previousBuffer;
+            currentBuffer; currentBuffer = previousBuffer)
+        {
+            previousBuffer = currentBuffer->Previous;
+            delete currentBuffer;
+        }
+    }
+
+private:
+    /// @brief The position of the element at the bottom, that thieves steal from.
+    alignas(CACHE_LINE_SIZE) std::atomic<int64_t> top { 0 };
+    /// @brief The position past the element on the top, that the owner pushes to and pops from.
+    alignas(CACHE_LINE_SIZE) std::atomic<int64_t> bottom { 0 };
+    /// @brief The current circular buffer.
+    std::atomic<Buffer*> buffer;
+
+public:
+    /// @brief The initial value of the Work Stealing Deque capacity if unspecified by the consumer.
+    static constexpr size_t INITIAL_CAPACITY = 256;
+
+    /// @brief The amount of elements the Work Stealing Deque can hold before growing.
+    /// @return The capacity of the Work Stealing Deque.
+    size_t Capacity() const { return buffer.load(std::memory_order_acquire)->Slots.Length(); }
+    /// @brief The amount of elements currently stored within the Work Stealing Deque, (it may be
+    /// outdated as soon as it's returned if thieves are active).
+    /// @return The elements count of the Work Stealing Deque.
+    size_t Count() const
+    {
+        int64_t currentBottom = bottom.load(std::memory_order_acquire), currentTop = top.load(std::memory_order_acquire);
+        return currentBottom > currentTop ? (size_t)(currentBottom - currentTop) : 0;
+    }
+    /// @brief Indicates whether or not the Work Stealing Deque has currently no elements.
+    /// @return A boolean representing whether or not the Work Stealing Deque is empty.
+    bool IsEmpty() const { return !Count(); }
+
+    /// @brief Retrieves the element that is on the top of the Work Stealing Deque, without removing it,
+    /// (owner only, and it might get stolen right after if it's the last one).
+    /// @return The value of the element that is on the top of the Work Stealing Deque.
+    T Top() const noexcept(false)
+    {
+        int64_t currentBottom = bottom.load(std::memory_order_relaxed);
+        if (currentBottom <= top.load(std::memory_order_acquire))
+        { throw std::out_of_range("Attempting to access an element of an empty Work Stealing Deque."); }
+
+        return buffer.load(std::memory_order_relaxed)->Get(currentBottom - 1);
+    }
+
+    /// @brief Adds an element on the top of the Work Stealing Deque, (owner only).
+    /// @param element The value of the element that'll be added on the top of the Work Stealing Deque.
+    void Push(const T &element)
+    {
+        int64_t currentBottom = bottom.load(std::memory_order_relaxed),
+            currentTop = top.load(std::memory_order_acquire);
+        Buffer* currentBuffer = buffer.load(std::memory_order_relaxed);
+
+        if (currentBottom - currentTop >= (int64_t)currentBuffer->Slots.Length())
+        { currentBuffer = Grow(currentBuffer, currentTop, currentBottom); }
+
+        currentBuffer->Put(currentBottom, element);
+        std::atomic_thread_fence(std::memory_order_release);
+        bottom.store(currentBottom + 1, std::memory_order_relaxed);
+    }
+
+    /// @brief Adds an Array on the top of the Work Stealing Deque, (owner only).
+    /// @param array The Array that'll be added on the top of the Work Stealing Deque.
+    void PushRange(const Array<T> &array) { PushRange(array.Length(), array.begin()); }
+
+    /// @brief Adds a range of elements on the top of the Work Stealing Deque, publishing them all at once,
+    /// (owner only).
+    /// @param length The amount of elements that'll be added on the top of the Work Stealing Deque.
+    /// @param data A pointer to an array in memory, that has some values that'll be added on the top.
+    void PushRange(const size_t &length, const T* data)
+    {
+        int64_t currentBottom = bottom.load(std::memory_order_relaxed),
+            currentTop = top.load(std::memory_order_acquire);
+        Buffer* currentBuffer = buffer.load(std::memory_order_relaxed);
+
+        while (currentBottom - currentTop + (int64_t)length > (int64_t)currentBuffer->Slots.Length())
+        { currentBuffer = Grow(currentBuffer, currentTop, currentBottom); }
+
+        for (size_t i = 0; i < length; i++) { currentBuffer->Put(currentBottom + i, data[i]); }
+
+        std::atomic_thread_fence(std::memory_order_release);
+        bottom.store(currentBottom + length, std::memory_order_relaxed);
+    }
+
+    /// @brief Retrieves the element that is on the top of the Work Stealing Deque if there's any,
+    /// by removing it, (owner only).
+    /// @param element The reference that'll be assigned the value of the popped element.
+    /// @return A boolean representing whether or not an element has been popped, (it fails if
+    /// a thief has taken the last element first).
+    bool TryPop(T &element)
+    {
+        int64_t currentBottom = bottom.load(std::memory_order_relaxed) - 1;
+        Buffer* currentBuffer = buffer.load(std::memory_order_relaxed);
+
+        bottom.store(currentBottom, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        int64_t currentTop = top.load(std::memory_order_relaxed);
+
+        if (currentTop > currentBottom)
+        {
+            bottom.store(currentBottom + 1, std::memory_order_relaxed);
+            return false;
+        }
+
+        element = currentBuffer->Get(currentBottom);
+        if (currentTop < currentBottom) { return true; }
+
+        // It's the last element, so the owner races the thieves for it.
+        bool hasWon = top.compare_exchange_strong(currentTop, currentTop + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+        bottom.store(currentBottom + 1, std::memory_order_relaxed);
+        return hasWon;
+    }
+
+    /// @brief Retrieves the element that is on the top of the Work Stealing Deque, by removing it,
+    /// (owner only, and if it's empty, it'll throw an "out of range" exception).
+    /// @return The value of the element that was on the top of the Work Stealing Deque.
+    T Pop() noexcept(false)
+    {
+        T element;
+        if (TryPop(element)) { return element; }
+
+        throw std::out_of_range("Attempting to pop an element out of an empty Work Stealing Deque.");
+    }
+
+    /// @brief Retrieves the element that is at the bottom of the Work Stealing Deque if there's any,
+    /// by removing it, (any thread).
+    /// @param element The reference that'll be assigned the value of the stolen element.
+    /// @return A boolean representing whether or not an element has been stolen, (it fails if it's
+    /// empty, or if another thread has taken the element first).
+    bool Steal(T &element)
+    {
+        int64_t currentTop = top.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        int64_t currentBottom = bottom.load(std::memory_order_acquire);
+
+        if (currentTop >= currentBottom) { return false; }
+
+        element = buffer.load(std::memory_order_acquire)->Get(currentTop);
+        return top.compare_exchange_strong(currentTop, currentTop + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+    }
+
+    /// @brief Work Stealing Deques can't be copied, since other threads might be using them.
+    WorkStealingDeque<T> &operator=(const WorkStealingDeque<T> &reference) = delete;
+
+    /// @brief Adds an element on the top of the Work Stealing Deque, (owner only).
+    /// @param element The value of the element that'll be added on the top of the Work Stealing Deque.
+    /// @return The reference of the Work Stealing Deque after adding the element value to it.
+    WorkStealingDeque<T> &operator<<(const T &element) { Push(element); return *this; }
+
+private:
+    /// @brief Copies the elements into a new circular buffer twice as large, and publishes it, (the old
+    /// buffer is kept until the Work Stealing Deque is destroyed, since thieves might still read it).
+    /// @param currentBuffer The current circular buffer.
+    /// @param currentTop The position of the element at the bottom.
+    /// @param currentBottom The position past the element on the top.
+    /// @return A pointer to the new circular buffer.
+    Buffer* Grow(Buffer* currentBuffer, const int64_t &currentTop, const int64_t &currentBottom)
+    {
+        Buffer* newBuffer = new Buffer(currentBuffer->Slots.Length() * 2, currentBuffer);
+        for (int64_t i = currentTop; i < currentBottom; i++) { newBuffer->Put(i, currentBuffer->Get(i)); }
+
+        buffer.store(newBuffer, std::memory_order_release);
+        return newBuffer;
+    }
+};
+
+#endif